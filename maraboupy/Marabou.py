@@ -108,7 +108,8 @@ def createOptions(numWorkers=1, initialTimeout=5, initialSplits=0, onlineSplits=
                   preprocessorBoundTolerance=0.0000000001, dumpBounds=False,
                   tighteningStrategy="deeppoly", milpTightening="none", milpSolverTimeout=0,
                   numSimulations=10, numBlasThreads=1, performLpTighteningAfterSplit=False,
-                  lpSolver="", produceProofs=False):
+                  lpSolver="", produceProofs=False, workStealing=False, numDeepPolyThreads=1,
+                  numProofCheckingThreads=1):
     """Create an options object for how Marabou should solve the query
 
     Args:
@@ -135,6 +136,9 @@ def createOptions(numWorkers=1, initialTimeout=5, initialSplits=0, onlineSplits=
         numBlasThreads (int, optional): Number of threads to use when using OpenBLAS matrix multiplication (e.g., for DeepPoly analysis), defaults to 1
         performLpTighteningAfterSplit (bool, optional): Whether to perform a LP tightening after a case split, defaults to False
         lpSolver (string, optional): the engine for solving LP (native/gurobi).
+        workStealing (bool, optional): Whether to schedule sub-queries with work stealing in SnC mode, and split the search of busy workers on demand, defaults to False
+        numDeepPolyThreads (int, optional): Number of threads among which the back-substitution of each layer is divided in DeepPoly analysis, defaults to 1
+        numProofCheckingThreads (int, optional): Number of threads among which the subtrees of an UNSAT certificate are checked, defaults to 1
     Returns:
         :class:`~maraboupy.MarabouCore.Options`
     """
@@ -150,6 +154,7 @@ def createOptions(numWorkers=1, initialTimeout=5, initialSplits=0, onlineSplits=
     options._splittingStrategy = splittingStrategy
     options._sncSplittingStrategy = sncSplittingStrategy
     options._restoreTreeStates = restoreTreeStates
+    options._workStealing = workStealing
     options._splitThreshold = splitThreshold
     options._solveWithMILP = solveWithMILP
     options._preprocessorBoundTolerance = preprocessorBoundTolerance
@@ -159,6 +164,8 @@ def createOptions(numWorkers=1, initialTimeout=5, initialSplits=0, onlineSplits=
     options._milpSolverTimeout = milpSolverTimeout
     options._numSimulations = numSimulations
     options._numBlasThreads = numBlasThreads
+    options._numDeepPolyThreads = numDeepPolyThreads
+    options._numProofCheckingThreads = numProofCheckingThreads
     options._performLpTighteningAfterSplit = performLpTighteningAfterSplit
     options._lpSolver = lpSolver
     options._produceProofs = produceProofs
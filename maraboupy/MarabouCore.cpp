@@ -285,10 +285,13 @@ struct MarabouOptions
     MarabouOptions()
         : _snc( Options::get()->getBool( Options::DNC_MODE ) )
         , _restoreTreeStates( Options::get()->getBool( Options::RESTORE_TREE_STATES ) )
+        , _workStealing( Options::get()->getBool( Options::DNC_WORK_STEALING ) )
         , _solveWithMILP( Options::get()->getBool( Options::SOLVE_WITH_MILP ) )
         , _dumpBounds( Options::get()->getBool( Options::DUMP_BOUNDS ) )
         , _numWorkers( Options::get()->getInt( Options::NUM_WORKERS ) )
         , _numBlasThreads( Options::get()->getInt( Options::NUM_BLAS_THREADS ) )
+        , _numDeepPolyThreads( Options::get()->getInt( Options::NUM_DEEPPOLY_THREADS ) )
+        , _numProofCheckingThreads( Options::get()->getInt( Options::NUM_PROOF_CHECKING_THREADS ) )
         , _initialTimeout( Options::get()->getInt( Options::INITIAL_TIMEOUT ) )
         , _initialDivides( Options::get()->getInt( Options::NUM_INITIAL_DIVIDES ) )
         , _onlineDivides( Options::get()->getInt( Options::NUM_ONLINE_DIVIDES ) )
@@ -318,6 +321,7 @@ struct MarabouOptions
         // Bool options
         Options::get()->setBool( Options::DNC_MODE, _snc );
         Options::get()->setBool( Options::RESTORE_TREE_STATES, _restoreTreeStates );
+        Options::get()->setBool( Options::DNC_WORK_STEALING, _workStealing );
         Options::get()->setBool( Options::SOLVE_WITH_MILP, _solveWithMILP );
         Options::get()->setBool( Options::DUMP_BOUNDS, _dumpBounds );
         Options::get()->setBool( Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT,
@@ -327,6 +331,8 @@ struct MarabouOptions
         // int options
         Options::get()->setInt( Options::NUM_WORKERS, _numWorkers );
         Options::get()->setInt( Options::NUM_BLAS_THREADS, _numBlasThreads );
+        Options::get()->setInt( Options::NUM_DEEPPOLY_THREADS, _numDeepPolyThreads );
+        Options::get()->setInt( Options::NUM_PROOF_CHECKING_THREADS, _numProofCheckingThreads );
         Options::get()->setInt( Options::INITIAL_TIMEOUT, _initialTimeout );
         Options::get()->setInt( Options::NUM_INITIAL_DIVIDES, _initialDivides );
         Options::get()->setInt( Options::NUM_ONLINE_DIVIDES, _onlineDivides );
@@ -352,12 +358,15 @@ struct MarabouOptions
 
     bool _snc;
     bool _restoreTreeStates;
+    bool _workStealing;
     bool _solveWithMILP;
     bool _dumpBounds;
     bool _performLpTighteningAfterSplit;
     bool _produceProofs;
     unsigned _numWorkers;
     unsigned _numBlasThreads;
+    unsigned _numDeepPolyThreads;
+    unsigned _numProofCheckingThreads;
     unsigned _initialTimeout;
     unsigned _initialDivides;
     unsigned _onlineDivides;
@@ -530,6 +539,11 @@ void saveQueryAsSmtLib( InputQuery &query, std::string filename )
     query.saveQueryAsSmtLib( String( filename ) );
 }
 
+void saveQueryAsBinary( InputQuery &inputQuery, std::string filename )
+{
+    inputQuery.saveQueryAsBinary( String( filename ) );
+}
+
 void loadQuery( std::string filename, InputQuery &inputQuery )
 {
     return QueryLoader::loadQuery( String( filename ), inputQuery );
@@ -544,6 +558,8 @@ PYBIND11_MODULE( MarabouCore, m )
         .def( py::init() )
         .def_readwrite( "_numWorkers", &MarabouOptions::_numWorkers )
         .def_readwrite( "_numBlasThreads", &MarabouOptions::_numBlasThreads )
+        .def_readwrite( "_numDeepPolyThreads", &MarabouOptions::_numDeepPolyThreads )
+        .def_readwrite( "_numProofCheckingThreads", &MarabouOptions::_numProofCheckingThreads )
         .def_readwrite( "_initialTimeout", &MarabouOptions::_initialTimeout )
         .def_readwrite( "_initialDivides", &MarabouOptions::_initialDivides )
         .def_readwrite( "_onlineDivides", &MarabouOptions::_onlineDivides )
@@ -558,6 +574,7 @@ PYBIND11_MODULE( MarabouCore, m )
         .def_readwrite( "_solveWithMILP", &MarabouOptions::_solveWithMILP )
         .def_readwrite( "_dumpBounds", &MarabouOptions::_dumpBounds )
         .def_readwrite( "_restoreTreeStates", &MarabouOptions::_restoreTreeStates )
+        .def_readwrite( "_workStealing", &MarabouOptions::_workStealing )
         .def_readwrite( "_splittingStrategy", &MarabouOptions::_splittingStrategyString )
         .def_readwrite( "_sncSplittingStrategy", &MarabouOptions::_sncSplittingStrategyString )
         .def_readwrite( "_tighteningStrategy", &MarabouOptions::_tighteningStrategyString )
@@ -626,6 +643,17 @@ PYBIND11_MODULE( MarabouCore, m )
            R"pbdoc(
         Serializes the inputQuery in the given filename as an SMTLIB file
 
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be saved
+            filename (str): Name of file to save query
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "filename" ) );
+    m.def( "saveQueryAsBinary",
+           &saveQueryAsBinary,
+           R"pbdoc(
+        Serializes the inputQuery in the given filename in binary form, which loads faster
+
         Args:
             inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be saved
             filename (str): Name of file to save query
@@ -20,6 +20,9 @@
 #include "FloatUtils.h"
 #include "MString.h"
 #include "SparseUnsortedList.h"
+#include "Vector.h"
+
+#include <algorithm>
 
 CSRMatrix::CSRMatrix()
     : _m( 0 )
@@ -77,6 +80,64 @@ void CSRMatrix::initialize( const double *M, unsigned m, unsigned n )
     }
 }
 
+void CSRMatrix::initialize( const SparseUnsortedList **rows, unsigned m, unsigned n )
+{
+    _m = m;
+    _n = n;
+
+    freeMemoryIfNeeded();
+
+    // Allocate exactly as much memory as needed
+    unsigned nnz = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+        nnz += rows[i]->getNnz();
+    _estimatedNnz = std::max( 2U, nnz );
+
+    _A = new double[_estimatedNnz];
+    if ( !_A )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::A" );
+
+    _IA = new unsigned[_m + 1];
+    if ( !_IA )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "CSRMatrix::IA" );
+
+    _JA = new unsigned[_estimatedNnz];
+    if ( !_JA )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "CSRMatrix::JA" );
+
+    // The rows are unsorted, whereas JA needs to be sorted within each row
+    Vector<SparseUnsortedList::Entry> rowEntries;
+
+    _nnz = 0;
+    _IA[0] = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        rowEntries.clear();
+        for ( const auto &entry : *rows[i] )
+        {
+            // Ignore zero entries
+            if ( !FloatUtils::isZero( entry._value ) )
+                rowEntries.append( entry );
+        }
+
+        std::sort( rowEntries.begin(),
+                   rowEntries.end(),
+                   []( const SparseUnsortedList::Entry &a, const SparseUnsortedList::Entry &b ) {
+                       return a._index < b._index;
+                   } );
+
+        _IA[i + 1] = _IA[i] + rowEntries.size();
+        for ( const auto &entry : rowEntries )
+        {
+            _A[_nnz] = entry._value;
+            _JA[_nnz] = entry._index;
+            ++_nnz;
+        }
+    }
+}
+
 void CSRMatrix::initializeToEmpty( unsigned m, unsigned n )
 {
     _m = m;
@@ -107,8 +168,10 @@ void CSRMatrix::initializeToEmpty( unsigned m, unsigned n )
 
 void CSRMatrix::increaseCapacity()
 {
+    // Grow geometrically, so that the capacity stays proportional to the
+    // number of non-zero entries rather than to the matrix dimensions
     unsigned estimatedNumRowEntries = std::max( 2U, _n / ROW_DENSITY_ESTIMATE );
-    unsigned newEstimatedNnz = _estimatedNnz + ( estimatedNumRowEntries * _m );
+    unsigned newEstimatedNnz = _estimatedNnz + std::max( estimatedNumRowEntries, _estimatedNnz );
 
     double *newA = new double[newEstimatedNnz];
     if ( !newA )
@@ -54,6 +54,12 @@ public:
     void initialize( const double *M, unsigned m, unsigned n );
     void initializeToEmpty( unsigned m, unsigned n );
 
+    /*
+      Initialize the matrix from its m sparse rows, with exactly as
+      much storage as it has non-zero entries
+    */
+    void initialize( const SparseUnsortedList **rows, unsigned m, unsigned n );
+
     /*
       Obtain a single element/row/column of the matrix.
     */
@@ -16,6 +16,8 @@
 #ifndef __IBasisFactorization_h__
 #define __IBasisFactorization_h__
 
+#include "BasisFactorizationError.h"
+
 class SparseColumnsOfBasis;
 class SparseMatrix;
 class SparseUnsortedList;
@@ -78,6 +80,39 @@ public:
     */
     virtual void backwardTransformation( const double *y, double *x ) const = 0;
 
+    /*
+      Forward and backward transformations for right-hand sides with
+      few non-zero entries. The right-hand side y is sparse. x must be
+      all zeros on entry; on exit it contains the solution, and the
+      first xNnz entries of xNonZeros (of size m) list the indices of
+      all entries of x that may be non-zero.
+
+      These are only available if supportsSparseTransformations()
+      returns true.
+    */
+    virtual bool supportsSparseTransformations() const
+    {
+        return false;
+    }
+
+    virtual void sparseForwardTransformation( const SparseUnsortedList & /* y */,
+                                              double * /* x */,
+                                              unsigned * /* xNonZeros */,
+                                              unsigned & /* xNnz */ ) const
+    {
+        throw BasisFactorizationError( BasisFactorizationError::FEATURE_NOT_YET_SUPPORTED,
+                                       "sparseForwardTransformation" );
+    }
+
+    virtual void sparseBackwardTransformation( const SparseUnsortedList & /* y */,
+                                               double * /* x */,
+                                               unsigned * /* xNonZeros */,
+                                               unsigned & /* xNnz */ ) const
+    {
+        throw BasisFactorizationError( BasisFactorizationError::FEATURE_NOT_YET_SUPPORTED,
+                                       "sparseBackwardTransformation" );
+    }
+
     /*
       Store/restore the basis factorization.
     */
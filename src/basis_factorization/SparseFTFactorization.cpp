@@ -20,6 +20,9 @@
 #include "FloatUtils.h"
 #include "GlobalConfiguration.h"
 #include "MalformedBasisException.h"
+#include "SparseUnsortedList.h"
+
+#include <algorithm>
 
 SparseFTFactorization::SparseFTFactorization( unsigned m,
                                               const BasisColumnOracle &basisColumnOracle )
@@ -33,6 +36,9 @@ SparseFTFactorization::SparseFTFactorization( unsigned m,
     , _z2( NULL )
     , _z3( NULL )
     , _z4( NULL )
+    , _sparseWork( NULL )
+    , _sparseNonZeros( NULL )
+    , _inPattern( NULL )
 {
     _z1 = new double[m];
     if ( !_z1 )
@@ -53,6 +59,15 @@ SparseFTFactorization::SparseFTFactorization( unsigned m,
     if ( !_z4 )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
                                        "SparseFTFactorization::z4" );
+
+    _sparseWork = new double[m];
+    _sparseNonZeros = new unsigned[m];
+    _inPattern = new char[m];
+    if ( !_sparseWork || !_sparseNonZeros || !_inPattern )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseFTFactorization::sparseWork" );
+    std::fill_n( _sparseWork, m, 0 );
+    std::fill_n( _inPattern, m, 0 );
 }
 
 SparseFTFactorization::~SparseFTFactorization()
@@ -87,6 +102,24 @@ void SparseFTFactorization::freeIfNeeded()
         delete[] _z4;
         _z4 = NULL;
     }
+
+    if ( _sparseWork )
+    {
+        delete[] _sparseWork;
+        _sparseWork = NULL;
+    }
+
+    if ( _sparseNonZeros )
+    {
+        delete[] _sparseNonZeros;
+        _sparseNonZeros = NULL;
+    }
+
+    if ( _inPattern )
+    {
+        delete[] _inPattern;
+        _inPattern = NULL;
+    }
 }
 
 const double *SparseFTFactorization::getBasis() const
@@ -347,6 +380,49 @@ void SparseFTFactorization::backwardTransformation( const double *y, double *x )
     _sparseLUFactors.fBackwardTransformation( _z2, x );
 }
 
+bool SparseFTFactorization::supportsSparseTransformations() const
+{
+    return true;
+}
+
+void SparseFTFactorization::sparseForwardTransformation( const SparseUnsortedList &y,
+                                                         double *x,
+                                                         unsigned *xNonZeros,
+                                                         unsigned &xNnz ) const
+{
+    unsigned nnz = 0;
+    for ( const auto &entry : y )
+    {
+        _sparseWork[entry._index] = entry._value;
+        _sparseNonZeros[nnz++] = entry._index;
+    }
+
+    // Eliminate F, then H, and then V, as in the dense version
+    _sparseLUFactors.fForwardTransformation( _sparseWork, _sparseNonZeros, nnz );
+    hForwardTransformation( _sparseWork, _sparseNonZeros, nnz );
+    _sparseLUFactors.vForwardTransformation(
+        _sparseWork, _sparseNonZeros, nnz, x, xNonZeros, xNnz );
+}
+
+void SparseFTFactorization::sparseBackwardTransformation( const SparseUnsortedList &y,
+                                                          double *x,
+                                                          unsigned *xNonZeros,
+                                                          unsigned &xNnz ) const
+{
+    unsigned nnz = 0;
+    for ( const auto &entry : y )
+    {
+        _sparseWork[entry._index] = entry._value;
+        _sparseNonZeros[nnz++] = entry._index;
+    }
+
+    // Eliminate V, then H, and then F, as in the dense version
+    _sparseLUFactors.vBackwardTransformation(
+        _sparseWork, _sparseNonZeros, nnz, x, xNonZeros, xNnz );
+    hBackwardTransformation( x, xNonZeros, xNnz );
+    _sparseLUFactors.fBackwardTransformation( x, xNonZeros, xNnz );
+}
+
 void SparseFTFactorization::clearFactorization()
 {
     List<SparseEtaMatrix *>::iterator it;
@@ -483,6 +559,60 @@ void SparseFTFactorization::hBackwardTransformation( const double *y, double *x
     }
 }
 
+void SparseFTFactorization::hForwardTransformation( double *x,
+                                                    unsigned *nonZeros,
+                                                    unsigned &nnz ) const
+{
+    for ( unsigned i = 0; i < nnz; ++i )
+        _inPattern[nonZeros[i]] = 1;
+
+    for ( const auto &eta : _etas )
+    {
+        unsigned pivotIndex = eta->_columnIndex;
+
+        for ( const auto &entry : eta->_sparseColumn )
+            x[pivotIndex] -= entry._value * x[entry._index];
+
+        if ( !_inPattern[pivotIndex] && x[pivotIndex] != 0.0 )
+        {
+            _inPattern[pivotIndex] = 1;
+            nonZeros[nnz++] = pivotIndex;
+        }
+    }
+
+    for ( unsigned i = 0; i < nnz; ++i )
+        _inPattern[nonZeros[i]] = 0;
+}
+
+void SparseFTFactorization::hBackwardTransformation( double *x,
+                                                     unsigned *nonZeros,
+                                                     unsigned &nnz ) const
+{
+    for ( unsigned i = 0; i < nnz; ++i )
+        _inPattern[nonZeros[i]] = 1;
+
+    for ( auto eta = _etas.rbegin(); eta != _etas.rend(); ++eta )
+    {
+        unsigned pivotIndex = ( *eta )->_columnIndex;
+        double pivotValue = x[pivotIndex];
+        if ( pivotValue == 0.0 )
+            continue;
+
+        for ( const auto &entry : ( *eta )->_sparseColumn )
+        {
+            x[entry._index] -= entry._value * pivotValue;
+            if ( !_inPattern[entry._index] )
+            {
+                _inPattern[entry._index] = 1;
+                nonZeros[nnz++] = entry._index;
+            }
+        }
+    }
+
+    for ( unsigned i = 0; i < nnz; ++i )
+        _inPattern[nonZeros[i]] = 0;
+}
+
 void SparseFTFactorization::fixPForL()
 {
     if ( !_sparseLUFactors._usePForF )
@@ -72,6 +72,19 @@ public:
     */
     void backwardTransformation( const double *y, double *x ) const;
 
+    /*
+      Hypersparse forward and backward transformations
+    */
+    bool supportsSparseTransformations() const;
+    void sparseForwardTransformation( const SparseUnsortedList &y,
+                                      double *x,
+                                      unsigned *xNonZeros,
+                                      unsigned &xNnz ) const;
+    void sparseBackwardTransformation( const SparseUnsortedList &y,
+                                       double *x,
+                                       unsigned *xNonZeros,
+                                       unsigned &xNnz ) const;
+
     /*
       Store and restore the basis factorization.
     */
@@ -145,12 +158,28 @@ private:
     double *_z3;
     double *_z4;
 
+    /*
+      Work memory for the hypersparse transformations. The work vectors
+      are all zeros between transformations, and _inPattern marks the
+      entries listed in the current array of non-zeros.
+    */
+    mutable double *_sparseWork;
+    mutable unsigned *_sparseNonZeros;
+    mutable char *_inPattern;
+
     /*
       Transformations on the H matrix (the list of etas)
     */
     void hForwardTransformation( const double *y, double *x ) const;
     void hBackwardTransformation( const double *y, double *x ) const;
 
+    /*
+      Hypersparse transformations on the H matrix, in place. Entries
+      that become non-zero are added to nonZeros.
+    */
+    void hForwardTransformation( double *x, unsigned *nonZeros, unsigned &nnz ) const;
+    void hBackwardTransformation( double *x, unsigned *nonZeros, unsigned &nnz ) const;
+
     /*
       Free any allocated memory.
     */
@@ -20,6 +20,8 @@
 #include "FloatUtils.h"
 #include "MString.h"
 
+#include <algorithm>
+
 SparseLUFactors::SparseLUFactors( unsigned m )
     : _m( m )
     , _F( NULL )
@@ -34,6 +36,10 @@ SparseLUFactors::SparseLUFactors( unsigned m )
     , _z( NULL )
     , _workMatrix( NULL )
     , _workVector( NULL )
+    , _reachStack( NULL )
+    , _reachNextEdge( NULL )
+    , _reachVisited( NULL )
+    , _reachOrder( NULL )
 {
     _F = new SparseUnsortedArrays();
     if ( !_F )
@@ -74,6 +80,15 @@ SparseLUFactors::SparseLUFactors( unsigned m )
     if ( !_workVector )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
                                        "SparseLUFactors::workVector" );
+
+    _reachStack = new unsigned[m];
+    _reachNextEdge = new unsigned[m];
+    _reachVisited = new char[m];
+    _reachOrder = new unsigned[m];
+    if ( !_reachStack || !_reachNextEdge || !_reachVisited || !_reachOrder )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseLUFactors::reach" );
+    std::fill_n( _reachVisited, m, 0 );
 }
 
 SparseLUFactors::~SparseLUFactors()
@@ -125,6 +140,30 @@ SparseLUFactors::~SparseLUFactors()
         delete[] _workVector;
         _workVector = NULL;
     }
+
+    if ( _reachStack )
+    {
+        delete[] _reachStack;
+        _reachStack = NULL;
+    }
+
+    if ( _reachNextEdge )
+    {
+        delete[] _reachNextEdge;
+        _reachNextEdge = NULL;
+    }
+
+    if ( _reachVisited )
+    {
+        delete[] _reachVisited;
+        _reachVisited = NULL;
+    }
+
+    if ( _reachOrder )
+    {
+        delete[] _reachOrder;
+        _reachOrder = NULL;
+    }
 }
 
 void SparseLUFactors::dump() const
@@ -413,6 +452,196 @@ void SparseLUFactors::vBackwardTransformation( const double *y, double *x ) cons
     }
 }
 
+template <class SuccessorFunction>
+unsigned SparseLUFactors::reach( const unsigned *nodes,
+                                 unsigned count,
+                                 SuccessorFunction getSuccessors ) const
+{
+    /*
+      A depth-first search from every node. A node is added to the
+      order once all of its successors have been added, and the order
+      is filled from its end, so it ends up topologically sorted: every
+      node precedes its successors.
+    */
+    unsigned first = _m;
+
+    for ( unsigned i = 0; i < count; ++i )
+    {
+        if ( _reachVisited[nodes[i]] )
+            continue;
+
+        int top = 0;
+        _reachStack[0] = nodes[i];
+        _reachNextEdge[0] = 0;
+        _reachVisited[nodes[i]] = 1;
+
+        while ( top >= 0 )
+        {
+            unsigned node = _reachStack[top];
+            const SparseUnsortedArray *successors = getSuccessors( node );
+            const SparseUnsortedArray::Entry *entry = successors->getArray();
+            unsigned nnz = successors->getNnz();
+
+            // Descend into the next unvisited successor, if there is one
+            bool descended = false;
+            while ( _reachNextEdge[top] < nnz )
+            {
+                unsigned successor = entry[_reachNextEdge[top]++]._index;
+                if ( !_reachVisited[successor] )
+                {
+                    _reachVisited[successor] = 1;
+                    ++top;
+                    _reachStack[top] = successor;
+                    _reachNextEdge[top] = 0;
+                    descended = true;
+                    break;
+                }
+            }
+
+            if ( !descended )
+            {
+                _reachOrder[--first] = node;
+                --top;
+            }
+        }
+    }
+
+    for ( unsigned i = first; i < _m; ++i )
+        _reachVisited[_reachOrder[i]] = 0;
+
+    return first;
+}
+
+void SparseLUFactors::fForwardTransformation( double *x, unsigned *nonZeros, unsigned &nnz ) const
+{
+    // The same elimination as the dense version, but only over the
+    // columns of F that are reachable from the non-zero entries of x
+    unsigned first = reach( nonZeros, nnz, [this]( unsigned fColumn ) {
+        return (const SparseUnsortedArray *)_Ft->getRow( fColumn );
+    } );
+
+    nnz = 0;
+    for ( unsigned i = first; i < _m; ++i )
+    {
+        unsigned fColumn = _reachOrder[i];
+        nonZeros[nnz++] = fColumn;
+
+        double xElement = x[fColumn];
+        if ( xElement != 0.0 )
+        {
+            const SparseUnsortedArray *sparseColumn = _Ft->getRow( fColumn );
+            const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+            unsigned columnNnz = sparseColumn->getNnz();
+
+            for ( unsigned j = 0; j < columnNnz; ++j )
+                x[entry[j]._index] -= xElement * entry[j]._value;
+        }
+    }
+}
+
+void SparseLUFactors::fBackwardTransformation( double *x, unsigned *nonZeros, unsigned &nnz ) const
+{
+    unsigned first = reach( nonZeros, nnz, [this]( unsigned fRow ) {
+        return (const SparseUnsortedArray *)_F->getRow( fRow );
+    } );
+
+    nnz = 0;
+    for ( unsigned i = first; i < _m; ++i )
+    {
+        unsigned fRow = _reachOrder[i];
+        nonZeros[nnz++] = fRow;
+
+        double xElement = x[fRow];
+        if ( xElement != 0.0 )
+        {
+            const SparseUnsortedArray *sparseRow = _F->getRow( fRow );
+            const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+            unsigned rowNnz = sparseRow->getNnz();
+
+            for ( unsigned j = 0; j < rowNnz; ++j )
+                x[entry[j]._index] -= xElement * entry[j]._value;
+        }
+    }
+}
+
+void SparseLUFactors::vForwardTransformation( double *y,
+                                              const unsigned *yNonZeros,
+                                              unsigned yNnz,
+                                              double *x,
+                                              unsigned *xNonZeros,
+                                              unsigned &xNnz ) const
+{
+    /*
+      The entry of y in row vRow of V determines the entry of x that
+      corresponds to the column of V that holds the diagonal element of
+      that row, and is then eliminated from the other rows of that
+      column.
+    */
+    unsigned first = reach( yNonZeros, yNnz, [this]( unsigned vRow ) {
+        return (const SparseUnsortedArray *)_Vt->getRow(
+            _Q._rowOrdering[_P._rowOrdering[vRow]] );
+    } );
+
+    xNnz = 0;
+    for ( unsigned i = first; i < _m; ++i )
+    {
+        unsigned vRow = _reachOrder[i];
+        unsigned vColumn = _Q._rowOrdering[_P._rowOrdering[vRow]];
+
+        double xElement = x[vColumn] = y[vRow] / _vDiagonalElements[vRow];
+        xNonZeros[xNnz++] = vColumn;
+
+        if ( xElement != 0.0 )
+        {
+            const SparseUnsortedArray *sparseColumn = _Vt->getRow( vColumn );
+            const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+            unsigned columnNnz = sparseColumn->getNnz();
+
+            for ( unsigned j = 0; j < columnNnz; ++j )
+                y[entry[j]._index] -= xElement * entry[j]._value;
+        }
+
+        // This also discards the elimination of the diagonal element
+        y[vRow] = 0;
+    }
+}
+
+void SparseLUFactors::vBackwardTransformation( double *y,
+                                               const unsigned *yNonZeros,
+                                               unsigned yNnz,
+                                               double *x,
+                                               unsigned *xNonZeros,
+                                               unsigned &xNnz ) const
+{
+    // As in the dense version, xV = y is solved as V'x' = y'
+    unsigned first = reach( yNonZeros, yNnz, [this]( unsigned vColumn ) {
+        return (const SparseUnsortedArray *)_V->getRow(
+            _P._columnOrdering[_Q._columnOrdering[vColumn]] );
+    } );
+
+    xNnz = 0;
+    for ( unsigned i = first; i < _m; ++i )
+    {
+        unsigned vColumn = _reachOrder[i];
+        unsigned vRow = _P._columnOrdering[_Q._columnOrdering[vColumn]];
+
+        double xElement = x[vRow] = y[vColumn] / _vDiagonalElements[vRow];
+        xNonZeros[xNnz++] = vRow;
+
+        if ( xElement != 0.0 )
+        {
+            const SparseUnsortedArray *sparseRow = _V->getRow( vRow );
+            const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+            unsigned rowNnz = sparseRow->getNnz();
+
+            for ( unsigned j = 0; j < rowNnz; ++j )
+                y[entry[j]._index] -= xElement * entry[j]._value;
+        }
+
+        y[vColumn] = 0;
+    }
+}
+
 void SparseLUFactors::forwardTransformation( const double *y, double *x ) const
 {
     /*
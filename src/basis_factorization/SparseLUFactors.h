@@ -110,6 +110,36 @@ public:
     void vForwardTransformation( const double *y, double *x ) const;
     void vBackwardTransformation( const double *y, double *x ) const;
 
+    /*
+      Hypersparse versions of the F and V transformations, for
+      right-hand sides with few non-zero entries. A sparse vector is
+      given by a dense array that is zero everywhere except at the
+      entries listed in its array of non-zeros.
+
+      The F transformations work in place. The V transformations read
+      the right-hand side y, which is all zeros on exit, and write the
+      solution into x, which must be all zeros on entry.
+
+      Only the entries of the solution that are reachable from the
+      non-zero entries of y in the graph of the factor are computed
+      (Gilbert and Peierls), so the work is proportional to the number
+      of arithmetic operations rather than to m.
+    */
+    void fForwardTransformation( double *x, unsigned *nonZeros, unsigned &nnz ) const;
+    void fBackwardTransformation( double *x, unsigned *nonZeros, unsigned &nnz ) const;
+    void vForwardTransformation( double *y,
+                                 const unsigned *yNonZeros,
+                                 unsigned yNnz,
+                                 double *x,
+                                 unsigned *xNonZeros,
+                                 unsigned &xNnz ) const;
+    void vBackwardTransformation( double *y,
+                                  const unsigned *yNonZeros,
+                                  unsigned yNnz,
+                                  double *x,
+                                  unsigned *xNonZeros,
+                                  unsigned &xNnz ) const;
+
     /*
       Compute the inverse of the factorized basis
     */
@@ -122,6 +152,26 @@ public:
     double *_workMatrix;
     double *_workVector;
 
+    /*
+      Work memory for the hypersparse transformations: the stack of the
+      depth-first search, the next edge to explore for each node on
+      the stack, the nodes already visited, and the reachable nodes in
+      topological order, which fill _reachOrder from its end.
+    */
+    unsigned *_reachStack;
+    unsigned *_reachNextEdge;
+    char *_reachVisited;
+    unsigned *_reachOrder;
+
+    /*
+      Find all nodes that are reachable from the given nodes, where the
+      successors of a node are the indices of the entries of the
+      sparse array returned by getSuccessors. Return the position in
+      _reachOrder of the first reachable node.
+    */
+    template <class SuccessorFunction>
+    unsigned reach( const unsigned *nodes, unsigned count, SuccessorFunction getSuccessors ) const;
+
     /*
       Clone this SparseLUFactors object into another object
     */
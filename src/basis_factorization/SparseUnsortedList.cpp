@@ -46,7 +46,7 @@ SparseUnsortedList::~SparseUnsortedList()
 void SparseUnsortedList::initialize( const double *V, unsigned size )
 {
     _size = size;
-    _list.clear();
+    _entries.clear();
 
     for ( unsigned i = 0; i < _size; ++i )
     {
@@ -54,34 +54,34 @@ void SparseUnsortedList::initialize( const double *V, unsigned size )
         if ( FloatUtils::isZero( V[i] ) )
             continue;
 
-        _list.append( Entry( i, V[i] ) );
+        _entries.append( Entry( i, V[i] ) );
     }
 }
 
 void SparseUnsortedList::initializeToEmpty()
 {
     _size = 0;
-    _list.clear();
+    _entries.clear();
 }
 
 void SparseUnsortedList::clear()
 {
-    _list.clear();
+    _entries.clear();
 }
 
 unsigned SparseUnsortedList::getNnz() const
 {
-    return _list.size();
+    return _entries.size();
 }
 
 bool SparseUnsortedList::empty() const
 {
-    return _list.empty();
+    return _entries.empty();
 }
 
 double SparseUnsortedList::get( unsigned entry ) const
 {
-    for ( const auto &listEntry : _list )
+    for ( const auto &listEntry : _entries )
     {
         if ( listEntry._index == entry )
             return listEntry._value;
@@ -92,8 +92,8 @@ double SparseUnsortedList::get( unsigned entry ) const
 
 void SparseUnsortedList::dump() const
 {
-    printf( "\nDumping sparse unsortedList: (nnz = %u)\n", _list.size() );
-    for ( const auto &entry : _list )
+    printf( "\nDumping sparse unsortedList: (nnz = %u)\n", _entries.size() );
+    for ( const auto &entry : _entries )
         printf( "\tEntry %u: %6.2lf\n", entry._index, entry._value );
     printf( "\n" );
 }
@@ -113,14 +113,14 @@ void SparseUnsortedList::toDense( double *result ) const
 {
     std::fill_n( result, _size, 0 );
 
-    for ( const auto &entry : _list )
+    for ( const auto &entry : _entries )
         result[entry._index] = entry._value;
 }
 
 SparseUnsortedList &SparseUnsortedList::operator=( const SparseUnsortedList &other )
 {
     _size = other._size;
-    _list = other._list;
+    _entries = other._entries;
 
     return *this;
 }
@@ -128,59 +128,59 @@ SparseUnsortedList &SparseUnsortedList::operator=( const SparseUnsortedList &oth
 void SparseUnsortedList::storeIntoOther( SparseUnsortedList *other ) const
 {
     other->_size = _size;
-    other->_list = _list;
+    other->_entries = _entries;
 }
 
-List<SparseUnsortedList::Entry>::const_iterator SparseUnsortedList::begin() const
+SparseUnsortedList::const_iterator SparseUnsortedList::begin() const
 {
-    return _list.begin();
+    return _entries.begin();
 }
 
-List<SparseUnsortedList::Entry>::const_iterator SparseUnsortedList::end() const
+SparseUnsortedList::const_iterator SparseUnsortedList::end() const
 {
-    return _list.end();
+    return _entries.end();
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::begin()
+SparseUnsortedList::iterator SparseUnsortedList::begin()
 {
-    return _list.begin();
+    return _entries.begin();
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::end()
+SparseUnsortedList::iterator SparseUnsortedList::end()
 {
-    return _list.end();
+    return _entries.end();
 }
 
 void SparseUnsortedList::set( unsigned index, double value )
 {
     bool isZero = FloatUtils::isZero( value );
 
-    for ( auto it = begin(); it != end(); ++it )
+    for ( unsigned i = 0; i < _entries.size(); ++i )
     {
-        if ( it->_index == index )
+        if ( _entries[i]._index == index )
         {
             if ( isZero )
-                _list.erase( it );
+                eraseAt( i );
             else
-                it->_value = value;
+                _entries[i]._value = value;
 
             return;
         }
     }
 
     if ( !isZero )
-        _list.append( Entry( index, value ) );
+        _entries.append( Entry( index, value ) );
 }
 
 void SparseUnsortedList::append( unsigned index, double value )
 {
-    _list.append( Entry( index, value ) );
+    _entries.append( Entry( index, value ) );
 }
 
 void SparseUnsortedList::addLastEntry( double entry )
 {
     if ( !FloatUtils::isZero( entry ) )
-        _list.append( Entry( _size, entry ) );
+        _entries.append( Entry( _size, entry ) );
 
     ++_size;
 }
@@ -192,50 +192,68 @@ void SparseUnsortedList::incrementSize()
 
 void SparseUnsortedList::mergeEntries( unsigned source, unsigned target )
 {
-    List<Entry>::iterator sourceIt = _list.end();
-    List<Entry>::iterator targetIt = _list.end();
-    List<Entry>::iterator it;
+    unsigned nnz = _entries.size();
+    unsigned sourcePosition = nnz;
+    unsigned targetPosition = nnz;
 
-    for ( it = _list.begin(); it != _list.end(); ++it )
+    for ( unsigned i = 0; i < nnz; ++i )
     {
-        if ( it->_index == source )
+        if ( _entries[i]._index == source )
         {
-            sourceIt = it;
-            if ( targetIt != _list.end() )
+            sourcePosition = i;
+            if ( targetPosition != nnz )
                 break;
         }
-
-        if ( it->_index == target )
+        else if ( _entries[i]._index == target )
         {
-            targetIt = it;
-            if ( sourceIt != _list.end() )
+            targetPosition = i;
+            if ( sourcePosition != nnz )
                 break;
         }
     }
 
     // If no source entry exists, we are done
-    if ( sourceIt == _list.end() )
+    if ( sourcePosition == nnz )
         return;
 
     // If no target entry, simply change index on source entry
-    if ( targetIt == _list.end() )
+    if ( targetPosition == nnz )
     {
-        sourceIt->_index = target;
+        _entries[sourcePosition]._index = target;
         return;
     }
 
-    // Both source and target entries
-    targetIt->_value += sourceIt->_value;
+    // Both source and target entries exist. Erase the one at the
+    // larger position first, so that the other one does not move.
+    _entries[targetPosition]._value += _entries[sourcePosition]._value;
+    bool eraseTarget = FloatUtils::isZero( _entries[targetPosition]._value );
 
-    _list.erase( sourceIt );
-    if ( FloatUtils::isZero( targetIt->_value ) )
-        _list.erase( targetIt );
+    if ( eraseTarget && targetPosition > sourcePosition )
+    {
+        eraseAt( targetPosition );
+        eraseAt( sourcePosition );
+    }
+    else
+    {
+        eraseAt( sourcePosition );
+        if ( eraseTarget )
+            eraseAt( targetPosition );
+    }
 }
 
-List<SparseUnsortedList::Entry>::iterator
-SparseUnsortedList::erase( List<SparseUnsortedList::Entry>::iterator it )
+SparseUnsortedList::iterator SparseUnsortedList::erase( iterator it )
 {
-    return _list.erase( it );
+    unsigned position = it - _entries.begin();
+    eraseAt( position );
+    return _entries.begin() + position;
+}
+
+void SparseUnsortedList::eraseAt( unsigned position )
+{
+    ASSERT( position < _entries.size() );
+
+    _entries[position] = _entries.last();
+    _entries.pop();
 }
 
 unsigned SparseUnsortedList::getSize() const
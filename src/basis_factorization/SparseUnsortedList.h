@@ -18,7 +18,13 @@
 
 #include "HashMap.h"
 #include "SparseMatrix.h"
+#include "Vector.h"
 
+/*
+  A sparse vector whose entries are kept, in no particular order, in
+  one contiguous array. Clearing the vector keeps the array, so that
+  a vector that is refilled repeatedly does not allocate memory again.
+*/
 class SparseUnsortedList
 {
 public:
@@ -94,15 +100,19 @@ public:
     /*
       Retrieve entries
     */
-    List<Entry>::const_iterator begin() const;
-    List<Entry>::const_iterator end() const;
-    List<Entry>::iterator begin();
-    List<Entry>::iterator end();
+    typedef Vector<Entry>::iterator iterator;
+    typedef Vector<Entry>::const_iterator const_iterator;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    iterator begin();
+    iterator end();
 
     /*
-      Erasing an element by iterator
+      Erasing an element by iterator. The last entry is moved into its
+      place, and the returned iterator points to it.
     */
-    List<Entry>::iterator erase( List<Entry>::iterator it );
+    iterator erase( iterator it );
 
     /*
       Addes the coefficient for entry 'source' to entry 'target'
@@ -123,7 +133,12 @@ public:
 
 private:
     unsigned _size;
-    List<Entry> _list;
+    Vector<Entry> _entries;
+
+    /*
+      Erase the entry at the given position in _entries
+    */
+    void eraseAt( unsigned position );
 };
 
 #endif // __SparseUnsortedList_h__
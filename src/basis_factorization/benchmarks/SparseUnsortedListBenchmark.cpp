@@ -0,0 +1,246 @@
+/*********************                                                        */
+/*! \file SparseUnsortedListBenchmark.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A microbenchmark of SparseUnsortedList, which stores its entries
+ ** contiguously, against a linked list of the same entries. The loops
+ ** are those that the tableau, the row bound tightener and the bound
+ ** explainer run over the rows and columns of the constraint matrix.
+ ** Build it with
+ **
+ **    make SparseUnsortedListBenchmark
+ **
+ ** and run it with an optional number of repetitions per loop.
+
+**/
+
+#include "BenchmarkUtils.h"
+#include "List.h"
+#include "SparseUnsortedList.h"
+#include "Vector.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+  The previous representation of SparseUnsortedList
+*/
+class LinkedSparseList
+{
+public:
+    typedef SparseUnsortedList::Entry Entry;
+
+    explicit LinkedSparseList( unsigned size )
+        : _size( size )
+    {
+    }
+
+    void append( unsigned index, double value )
+    {
+        _list.append( Entry( index, value ) );
+    }
+
+    void toDense( double *result ) const
+    {
+        std::fill_n( result, _size, 0 );
+        for ( const auto &entry : _list )
+            result[entry._index] = entry._value;
+    }
+
+    List<Entry>::const_iterator begin() const
+    {
+        return _list.begin();
+    }
+
+    List<Entry>::const_iterator end() const
+    {
+        return _list.end();
+    }
+
+private:
+    unsigned _size;
+    List<Entry> _list;
+};
+
+/*
+  A constraint matrix with m rows and n columns, about nnzPerRow
+  non-zero entries in each row, and an identity block for the slack
+  variables. The columns are filled row by row, as in
+  Tableau::setConstraintMatrix(), so the entries of a column are
+  added in between those of all other columns.
+*/
+template <class SparseList>
+static void buildMatrix( unsigned m,
+                         unsigned n,
+                         unsigned nnzPerRow,
+                         Vector<SparseList *> &rows,
+                         Vector<SparseList *> &columns )
+{
+    for ( unsigned i = 0; i < m; ++i )
+        rows.append( new SparseList( n ) );
+    for ( unsigned j = 0; j < n; ++j )
+        columns.append( new SparseList( m ) );
+
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        Vector<unsigned> indices;
+        for ( unsigned k = 0; k < nnzPerRow; ++k )
+        {
+            unsigned j = rand() % ( n - m );
+            if ( !indices.exists( j ) )
+                indices.append( j );
+        }
+        indices.append( n - m + i );
+
+        for ( unsigned j : indices )
+        {
+            double value = (double)rand() / RAND_MAX * 2 - 1;
+            rows[i]->append( j, value );
+            columns[j]->append( i, value );
+        }
+    }
+}
+
+template <class SparseList> static void freeMatrix( Vector<SparseList *> &lists )
+{
+    for ( auto &list : lists )
+        delete list;
+    lists.clear();
+}
+
+struct Timings
+{
+    double _construction;
+    double _ftran;
+    double _rowTightening;
+    double _explanation;
+    double _checksum;
+};
+
+template <class SparseList>
+static Timings run( unsigned repetitions, unsigned m, unsigned n, unsigned nnzPerRow )
+{
+    Timings timings;
+    Vector<SparseList *> rows;
+    Vector<SparseList *> columns;
+
+    srand( 1 );
+    timings._construction = BenchmarkUtils::millisecondsPerRun(
+        1, [&]() { buildMatrix( m, n, nnzPerRow, rows, columns ); } );
+
+    Vector<double> dense( std::max( m, n ), 0 );
+    Vector<double> invB( m * 4, 0 );
+    for ( unsigned i = 0; i < invB.size(); ++i )
+        invB[i] = (double)rand() / RAND_MAX;
+    double checksum = 0;
+
+    // Tableau::computeBasicAssignment(): the right-hand side of FTRAN
+    // is a linear combination of the columns of A
+    timings._ftran = BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+        std::fill_n( dense.data(), m, 0 );
+        for ( unsigned j = 0; j < n - m; ++j )
+        {
+            double value = (double)( j % 7 ) - 3;
+            for ( const auto &entry : *columns[j] )
+                dense[entry._index] -= entry._value * value;
+        }
+        checksum += dense[0];
+    } );
+
+    // RowBoundTightener::examineInvertedBasisMatrix(): the dot products
+    // of rows of inv(B) with the columns of A
+    timings._rowTightening = BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            const double *invBRow = invB.data() + i * m;
+            for ( unsigned j = 0; j < n; ++j )
+            {
+                double coefficient = 0;
+                for ( const auto &entry : *columns[j] )
+                    coefficient -= invBRow[entry._index] * entry._value;
+                checksum += coefficient;
+            }
+        }
+    } );
+
+    // BoundExplainer::addSparseRowCoefficients(): add multiples of the
+    // rows of A to an explanation
+    timings._explanation = BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+        std::fill_n( dense.data(), m, 0 );
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            double ci = rows[i]->begin()->_value;
+            for ( const auto &entry : *rows[i] )
+                if ( entry._index >= n - m )
+                    dense[entry._index - n + m] += entry._value / ci;
+        }
+        checksum += dense[0];
+    } );
+
+    timings._checksum = checksum;
+
+    freeMatrix( rows );
+    freeMatrix( columns );
+    return timings;
+}
+
+int main( int argc, char **argv )
+{
+    unsigned repetitions = argc > 1 ? atoi( argv[1] ) : 20;
+
+    // Constraint matrices of the shapes that ReLU networks produce:
+    // m equations over n variables, of which m are slack variables
+    unsigned shapes[][3] = { { 1000, 3000, 20 }, { 10000, 30000, 50 }, { 50000, 150000, 100 } };
+
+    printf( "%-24s %-12s %12s %12s %12s %12s\n",
+            "m x n, nnz per row",
+            "storage",
+            "build (ms)",
+            "ftran (ms)",
+            "rows (ms)",
+            "explain (ms)" );
+
+    for ( const auto &shape : shapes )
+    {
+        Timings linked = run<LinkedSparseList>( repetitions, shape[0], shape[1], shape[2] );
+        Timings contiguous = run<SparseUnsortedList>( repetitions, shape[0], shape[1], shape[2] );
+
+        // The loops must have computed the same values
+        if ( linked._checksum != contiguous._checksum )
+        {
+            printf( "Checksum mismatch: %lf != %lf\n", linked._checksum, contiguous._checksum );
+            return 1;
+        }
+
+        char description[64];
+        snprintf( description, 64, "%u x %u, %u", shape[0], shape[1], shape[2] );
+
+        for ( unsigned i = 0; i < 2; ++i )
+        {
+            const Timings &timings = i == 0 ? linked : contiguous;
+            printf( "%-24s %-12s %12.2f %12.2f %12.2f %12.2f\n",
+                    i == 0 ? description : "",
+                    i == 0 ? "linked" : "contiguous",
+                    timings._construction,
+                    timings._ftran,
+                    timings._rowTightening,
+                    timings._explanation );
+        }
+    }
+
+    return 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
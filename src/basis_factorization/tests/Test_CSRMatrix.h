@@ -78,6 +78,54 @@ public:
                 TS_ASSERT_EQUALS( M2[i * 4 + j], csr2.get( i, j ) );
     }
 
+    void test_initialize_from_sparse_rows()
+    {
+        double M1[] = {
+            0, 0, 0, 0, //
+            5, 8, 0, 0, //
+            0, 0, 3, 0, //
+            0, 6, 0, 2, //
+        };
+
+        SparseUnsortedList row0( 4 );
+        SparseUnsortedList row1( 4 );
+        SparseUnsortedList row2( 4 );
+        SparseUnsortedList row3( 4 );
+
+        // Entries need not be sorted, and zeros are dropped
+        row1.append( 1, 8 );
+        row1.append( 0, 5 );
+        row2.append( 2, 3 );
+        row2.append( 3, 0 );
+        row3.append( 3, 2 );
+        row3.append( 1, 6 );
+
+        const SparseUnsortedList *rows[] = { &row0, &row1, &row2, &row3 };
+
+        CSRMatrix csr1;
+        TS_ASSERT_THROWS_NOTHING( csr1.initialize( rows, 4, 4 ) );
+        TS_ASSERT_EQUALS( csr1.getNnz(), 5U );
+
+        double dense[16];
+        TS_ASSERT_THROWS_NOTHING( csr1.toDense( dense ) );
+        TS_ASSERT_SAME_DATA( M1, dense, sizeof( M1 ) );
+
+        // The matrix can still grow beyond its initial capacity
+        double newRow[] = { 1, 2, 3, 4, 5 };
+        TS_ASSERT_THROWS_NOTHING( csr1.addEmptyColumn() );
+        TS_ASSERT_THROWS_NOTHING( csr1.addLastRow( newRow ) );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            for ( unsigned j = 0; j < 4; ++j )
+                TS_ASSERT_EQUALS( csr1.get( i, j ), M1[i * 4 + j] );
+            TS_ASSERT_EQUALS( csr1.get( i, 4 ), 0.0 );
+        }
+
+        for ( unsigned j = 0; j < 5; ++j )
+            TS_ASSERT_EQUALS( csr1.get( 4, j ), newRow[j] );
+    }
+
     void test_store_restore()
     {
         double M1[] = {
@@ -21,6 +21,8 @@
 #include "MockColumnOracle.h"
 #include "MockErrno.h"
 #include "SparseFTFactorization.h"
+#include "SparseUnsortedList.h"
+#include "Vector.h"
 
 #include <cxxtest/TestSuite.h>
 
@@ -375,6 +377,108 @@ public:
         TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( a3, d3 ) );
         TS_ASSERT( memcmp( d3other, d3, sizeof( double ) * 3 ) );
     }
+
+    void checkSparseTransformations( SparseFTFactorization &basis, unsigned m )
+    {
+        /*
+          Solve for every unit vector, and for a vector with two
+          non-zero entries, and compare with the dense transformations
+        */
+        for ( unsigned i = 0; i <= m; ++i )
+        {
+            double *y = new double[m];
+            std::fill_n( y, m, 0 );
+            if ( i < m )
+                y[i] = 1;
+            else
+            {
+                y[0] = 2;
+                y[m - 1] = -3;
+            }
+
+            SparseUnsortedList sparseY( y, m );
+            double *expected = new double[m];
+            double *x = new double[m];
+            unsigned *nonZeros = new unsigned[m];
+            unsigned nnz = 0;
+
+            for ( bool forward : { true, false } )
+            {
+                if ( forward )
+                    basis.forwardTransformation( y, expected );
+                else
+                    basis.backwardTransformation( y, expected );
+
+                std::fill_n( x, m, 0 );
+                if ( forward )
+                {
+                    TS_ASSERT_THROWS_NOTHING(
+                        basis.sparseForwardTransformation( sparseY, x, nonZeros, nnz ) );
+                }
+                else
+                {
+                    TS_ASSERT_THROWS_NOTHING(
+                        basis.sparseBackwardTransformation( sparseY, x, nonZeros, nnz ) );
+                }
+
+                for ( unsigned j = 0; j < m; ++j )
+                    TS_ASSERT( FloatUtils::areEqual( x[j], expected[j] ) );
+
+                // Every non-zero entry is listed exactly once
+                TS_ASSERT( nnz <= m );
+                Vector<unsigned> listed( m, 0 );
+                for ( unsigned j = 0; j < nnz; ++j )
+                    ++listed[nonZeros[j]];
+                for ( unsigned j = 0; j < m; ++j )
+                {
+                    TS_ASSERT( listed[j] <= 1 );
+                    if ( x[j] != 0 )
+                        TS_ASSERT_EQUALS( listed[j], 1U );
+                }
+            }
+
+            delete[] nonZeros;
+            delete[] x;
+            delete[] expected;
+            delete[] y;
+        }
+    }
+
+    void test_sparse_transformations()
+    {
+        SparseFTFactorization basis( 6, *oracle );
+        TS_ASSERT( basis.supportsSparseTransformations() );
+
+        // Two independent blocks, so that most solutions are sparse
+        double B[] = {
+            2, 0, 0, 1, 0, 0, //
+            0, 1, 0, 0, 0, 0, //
+            1, 0, 3, 0, 0, 0, //
+            0, 0, 0, 1, 0, 0, //
+            0, 0, 0, 0, 4, 1, //
+            0, 0, 0, 0, 2, 1, //
+        };
+        oracle->storeBasis( 6, B );
+        basis.obtainFreshBasis();
+        checkSparseTransformations( basis, 6 );
+
+        // Replace columns, which adds etas to the factorization
+        double a1[] = { 0, 1, 0, 0, 0, 1 };
+        TS_ASSERT_THROWS_NOTHING( basis.updateToAdjacentBasis( 1, NULL, a1 ) );
+        checkSparseTransformations( basis, 6 );
+
+        double a2[] = { 1, 0, 0, 5, 0, 0 };
+        TS_ASSERT_THROWS_NOTHING( basis.updateToAdjacentBasis( 3, NULL, a2 ) );
+        checkSparseTransformations( basis, 6 );
+
+        // The sparse transformations agree with the dense ones after a
+        // refactorization, as well
+        B[5 * 6 + 1] = 1;
+        B[3 * 6 + 3] = 5;
+        oracle->storeBasis( 6, B );
+        basis.obtainFreshBasis();
+        checkSparseTransformations( basis, 6 );
+    }
 };
 
 //
@@ -174,6 +174,56 @@ public:
 
         TS_ASSERT_EQUALS( v1.getNnz(), 0U );
     }
+
+    void test_merge_entries_that_cancel_out()
+    {
+        SparseUnsortedList v1( 5 );
+
+        // The target entry precedes the source entry
+        v1.set( 4, -7 );
+        v1.set( 2, 3 );
+        v1.set( 0, 7 );
+
+        TS_ASSERT_THROWS_NOTHING( v1.mergeEntries( 0, 4 ) );
+
+        TS_ASSERT_EQUALS( v1.getNnz(), 1U );
+        TS_ASSERT_EQUALS( v1.get( 2 ), 3 );
+        TS_ASSERT_EQUALS( v1.get( 4 ), 0 );
+    }
+
+    void test_erase_while_iterating()
+    {
+        double dense[8] = {
+            1, 2, 3, 0, 0, 4, 5, 6 //
+        };
+
+        SparseUnsortedList v1( dense, 8 );
+
+        // Erase the entries with odd indices
+        for ( auto it = v1.begin(); it != v1.end(); )
+        {
+            if ( it->_index % 2 )
+                it = v1.erase( it );
+            else
+                ++it;
+        }
+
+        TS_ASSERT_EQUALS( v1.getNnz(), 3U );
+
+        double expected[8] = {
+            1, 0, 3, 0, 0, 0, 5, 0 //
+        };
+
+        for ( unsigned i = 0; i < 8; ++i )
+            TS_ASSERT( FloatUtils::areEqual( expected[i], v1.get( i ) ) );
+
+        // The cleared list can be refilled
+        v1.clear();
+        TS_ASSERT( v1.empty() );
+        v1.append( 3, 2 );
+        TS_ASSERT_EQUALS( v1.getNnz(), 1U );
+        TS_ASSERT_EQUALS( v1.get( 3 ), 2 );
+    }
 };
 
 //
@@ -0,0 +1,58 @@
+/*********************                                                        */
+/*! \file BenchmarkUtils.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Shared helpers of the microbenchmarks in the benchmarks directories,
+ ** which are added by marabou_add_benchmark() in src/CMakeLists.txt.
+
+ **/
+
+#ifndef __BenchmarkUtils_h__
+#define __BenchmarkUtils_h__
+
+#include "TimeUtils.h"
+
+class BenchmarkUtils
+{
+public:
+    /*
+      The average time, in milliseconds, of one call to loop(), over
+      the given number of calls
+    */
+    template <class Loop> static double millisecondsPerRun( unsigned repetitions, const Loop &loop )
+    {
+        struct timespec start = TimeUtils::sampleMicro();
+        for ( unsigned i = 0; i < repetitions; ++i )
+            loop();
+        unsigned long long micro = TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+
+        // Avoid dividing by zero in the rates computed from the result
+        if ( micro == 0 )
+            micro = 1;
+        return (double)micro / repetitions / 1000;
+    }
+
+    /*
+      The throughput, in GFLOP/s, of a kernel that performs the given
+      number of multiply-adds per call and takes the given time per call
+    */
+    static double gflops( unsigned long long multiplyAdds, double milliseconds )
+    {
+        return 2.0 * multiplyAdds / milliseconds / 1000000;
+    }
+};
+
+#endif // __BenchmarkUtils_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
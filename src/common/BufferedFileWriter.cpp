@@ -0,0 +1,67 @@
+/*********************                                                        */
+/*! \file BufferedFileWriter.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "BufferedFileWriter.h"
+
+#include <cstring>
+
+BufferedFileWriter::BufferedFileWriter( IFile &file )
+    : _file( file )
+    , _buffer( new char[BUFFER_SIZE] )
+    , _used( 0 )
+{
+}
+
+BufferedFileWriter::~BufferedFileWriter()
+{
+    delete[] _buffer;
+    _buffer = NULL;
+}
+
+void BufferedFileWriter::write( const String &data )
+{
+    write( data.ascii(), data.length() );
+}
+
+void BufferedFileWriter::write( const char *data, unsigned size )
+{
+    if ( _used + size > BUFFER_SIZE )
+        flush();
+
+    // Chunks that do not fit in the buffer are passed on as they are
+    if ( size >= BUFFER_SIZE )
+    {
+        _file.write( String( data, size ) );
+        return;
+    }
+
+    memcpy( _buffer + _used, data, size );
+    _used += size;
+}
+
+void BufferedFileWriter::flush()
+{
+    if ( _used == 0 )
+        return;
+
+    _file.write( String( _buffer, _used ) );
+    _used = 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
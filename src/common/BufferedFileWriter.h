@@ -0,0 +1,64 @@
+/*********************                                                        */
+/*! \file BufferedFileWriter.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __BufferedFileWriter_h__
+#define __BufferedFileWriter_h__
+
+#include "IFile.h"
+#include "MString.h"
+
+/*
+  Collects small writes into a fixed-size buffer and passes them on to
+  an open file in large chunks, so that large outputs can be produced
+  incrementally without holding them in memory, and without a system
+  call per write. The file is not opened or closed by the writer;
+  flush() has to be called before the file is closed.
+*/
+class BufferedFileWriter
+{
+public:
+    enum {
+        BUFFER_SIZE = 65536,
+    };
+
+    BufferedFileWriter( IFile &file );
+    ~BufferedFileWriter();
+
+    void write( const String &data );
+    void write( const char *data, unsigned size );
+
+    /*
+      Write the in-memory representation of a fixed-width value
+    */
+    template <typename T> void writeValue( const T &value )
+    {
+        write( (const char *)&value, sizeof( T ) );
+    }
+
+    void flush();
+
+private:
+    IFile &_file;
+    char *_buffer;
+    unsigned _used;
+};
+
+#endif // __BufferedFileWriter_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,160 @@
+/*********************                                                        */
+/*! \file ILPSolver.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __ILPSolver_h__
+#define __ILPSolver_h__
+
+#include "List.h"
+#include "MString.h"
+#include "Map.h"
+
+class ILPSolver
+{
+    /*
+      This is the interface class for an (MI)LP solver, used by the
+      network level reasoner to encode and optimize relaxations of the
+      network, and by the MILPEncoder to encode queries. Variables are
+      identified by their names.
+    */
+public:
+    enum VariableType {
+        CONTINUOUS = 0,
+        BINARY = 1,
+        INTEGER = 2,
+    };
+
+    /*
+      A term has the form: coefficient * variable
+    */
+    struct Term
+    {
+        Term( double coefficient, String variable )
+            : _coefficient( coefficient )
+            , _variable( variable )
+        {
+        }
+
+        Term()
+            : _coefficient( 0 )
+            , _variable( "" )
+        {
+        }
+
+        double _coefficient;
+        String _variable;
+    };
+
+    virtual ~ILPSolver()
+    {
+    }
+
+    // Add a new variable to the model
+    virtual void
+    addVariable( String name, double lb, double ub, VariableType type = CONTINUOUS ) = 0;
+
+    // Set or get the lower or upper bound for an existing variable
+    virtual void setLowerBound( String name, double lb ) = 0;
+    virtual void setUpperBound( String name, double ub ) = 0;
+    virtual double getLowerBound( const String &name ) = 0;
+    virtual double getUpperBound( const String &name ) = 0;
+
+    // Add a new LEQ, GEQ or EQ constraint, e.g. 3x + 4y <= -5
+    virtual void addLeqConstraint( const List<Term> &terms, double scalar ) = 0;
+    virtual void addGeqConstraint( const List<Term> &terms, double scalar ) = 0;
+    virtual void addEqConstraint( const List<Term> &terms, double scalar ) = 0;
+
+    // Add a piecewise-linear constraint, target = f( source ), where f
+    // interpolates the given points linearly
+    virtual void addPiecewiseLinearConstraint( String sourceVariable,
+                                               String targetVariable,
+                                               unsigned numPoints,
+                                               const double *xPoints,
+                                               const double *yPoints ) = 0;
+
+    // Add a new LEQ, GEQ or EQ indicator constraint, which only needs
+    // to hold when the binary variable binVarName equals binVal
+    virtual void addLeqIndicatorConstraint( const String binVarName,
+                                            const int binVal,
+                                            const List<Term> &terms,
+                                            double scalar ) = 0;
+    virtual void addGeqIndicatorConstraint( const String binVarName,
+                                            const int binVal,
+                                            const List<Term> &terms,
+                                            double scalar ) = 0;
+    virtual void addEqIndicatorConstraint( const String binVarName,
+                                           const int binVal,
+                                           const List<Term> &terms,
+                                           double scalar ) = 0;
+
+    // Add a bilinear constraint, output = input1 * input2. Solvers that
+    // support it may require a call to nonConvex() first
+    virtual void
+    addBilinearConstraint( const String input1, const String input2, const String output ) = 0;
+    virtual void nonConvex() = 0;
+
+    // A cost function to minimize, or an objective function to maximize
+    virtual void setCost( const List<Term> &terms, double constant = 0 ) = 0;
+    virtual void setObjective( const List<Term> &terms, double constant = 0 ) = 0;
+    virtual double getOptimalCostOrObjective() = 0;
+
+    // Set a cutoff value for the objective function: if the optimal
+    // value is worse than the cutoff, the solver reports a cutoff
+    virtual void setCutoff( double cutoff ) = 0;
+
+    // The status of the last call to solve()
+    virtual bool optimal() = 0;
+    virtual bool cutoffOccurred() = 0;
+    virtual bool infeasible() = 0;
+    virtual bool timeout() = 0;
+    virtual bool haveFeasibleSolution() = 0;
+
+    // Specify a time limit, in seconds
+    virtual void setTimeLimit( double seconds ) = 0;
+
+    virtual void setVerbosity( unsigned verbosity ) = 0;
+    virtual bool containsVariable( String name ) const = 0;
+    virtual void setNumberOfThreads( unsigned threads ) = 0;
+
+    // Solve and extract the solution, or the best known bound on the
+    // objective function
+    virtual void solve() = 0;
+    virtual void extractSolution( Map<String, double> &values, double &costOrObjective ) = 0;
+    virtual double getObjectiveBound() = 0;
+    virtual double getAssignment( const String &variable ) = 0;
+    virtual bool existsAssignment( const String &variable ) = 0;
+    virtual unsigned getNumberOfSimplexIterations() = 0;
+    virtual unsigned getNumberOfNodes() = 0;
+
+    // A solver-specific status code of the last call to solve(), for
+    // diagnostics
+    virtual unsigned getStatusCode() = 0;
+
+    // Apply pending modifications to the model
+    virtual void updateModel() = 0;
+
+    // Discard the result of the last solve, keeping the model
+    virtual void reset() = 0;
+
+    // Clear the underlying model and create a fresh model
+    virtual void resetModel() = 0;
+};
+
+#endif // __ILPSolver_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
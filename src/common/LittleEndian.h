@@ -0,0 +1,82 @@
+/*********************                                                        */
+/*! \file LittleEndian.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __LittleEndian_h__
+#define __LittleEndian_h__
+
+#include <cstdint>
+#include <cstring>
+
+/*
+  Convert fixed-width values to and from their little-endian
+  representation. Binary files are stored in this byte order, so that
+  they can be read on any machine, whatever the byte order of the
+  machine that wrote them. The bytes need not be aligned.
+*/
+class LittleEndian
+{
+public:
+    static void storeUint32( uint32_t value, char *bytes )
+    {
+        for ( unsigned i = 0; i < sizeof( uint32_t ); ++i )
+            bytes[i] = (char)( ( value >> ( 8 * i ) ) & 0xFF );
+    }
+
+    static uint32_t loadUint32( const char *bytes )
+    {
+        uint32_t value = 0;
+        for ( unsigned i = 0; i < sizeof( uint32_t ); ++i )
+            value |= (uint32_t)(unsigned char)bytes[i] << ( 8 * i );
+        return value;
+    }
+
+    static void storeUint64( uint64_t value, char *bytes )
+    {
+        for ( unsigned i = 0; i < sizeof( uint64_t ); ++i )
+            bytes[i] = (char)( ( value >> ( 8 * i ) ) & 0xFF );
+    }
+
+    static uint64_t loadUint64( const char *bytes )
+    {
+        uint64_t value = 0;
+        for ( unsigned i = 0; i < sizeof( uint64_t ); ++i )
+            value |= (uint64_t)(unsigned char)bytes[i] << ( 8 * i );
+        return value;
+    }
+
+    static void storeDouble( double value, char *bytes )
+    {
+        uint64_t bits;
+        memcpy( &bits, &value, sizeof( double ) );
+        storeUint64( bits, bytes );
+    }
+
+    static double loadDouble( const char *bytes )
+    {
+        uint64_t bits = loadUint64( bytes );
+
+        double value;
+        memcpy( &value, &bits, sizeof( double ) );
+        return value;
+    }
+};
+
+#endif // __LittleEndian_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
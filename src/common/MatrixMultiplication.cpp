@@ -15,6 +15,16 @@
 
 #include "MatrixMultiplication.h"
 
+#include "GlobalConfiguration.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #ifdef ENABLE_OPENBLAS
 #include "cblas.h"
 void matrixMultiplication( const double *matA,
@@ -45,6 +55,32 @@ void matrixMultiplication( const double *matA,
                  matC,
                  columnsB );
 }
+
+void transposedMatrixMultiplication( const double *matA,
+                                     const double *matB,
+                                     double *matC,
+                                     unsigned rowsA,
+                                     unsigned columnsA,
+                                     unsigned columnsB )
+{
+    double alpha = 1;
+    double beta = 1;
+    // cblas_dgemm is executing: C <- alpha * A^T B + beta * C
+    cblas_dgemm( CblasRowMajor,
+                 CblasTrans,
+                 CblasNoTrans,
+                 columnsA,
+                 columnsB,
+                 rowsA,
+                 alpha,
+                 matA,
+                 columnsA,
+                 matB,
+                 columnsB,
+                 beta,
+                 matC,
+                 columnsB );
+}
 #else
 void matrixMultiplication( const double *matA,
                            const double *matB,
@@ -53,15 +89,420 @@ void matrixMultiplication( const double *matA,
                            unsigned columnsA,
                            unsigned columnsB )
 {
-    for ( unsigned i = 0; i < rowsA; ++i )
+    blockedMatrixMultiplication( matA, matB, matC, rowsA, columnsA, columnsB );
+}
+
+void transposedMatrixMultiplication( const double *matA,
+                                     const double *matB,
+                                     double *matC,
+                                     unsigned rowsA,
+                                     unsigned columnsA,
+                                     unsigned columnsB )
+{
+    // Traverse the rows of matA and matB, so that the inner loop runs
+    // over contiguous memory of both matB and matC
+    for ( unsigned k = 0; k < rowsA; ++k )
+    {
+        for ( unsigned i = 0; i < columnsA; ++i )
+        {
+            double entry = matA[k * columnsA + i];
+            if ( entry == 0 )
+                continue;
+
+            for ( unsigned j = 0; j < columnsB; ++j )
+                matC[i * columnsB + j] += entry * matB[k * columnsB + j];
+        }
+    }
+}
+#endif
+
+/*
+  The blocked kernel follows the usual GotoBLAS scheme. matB is packed
+  into panels of BLOCK_K x BLOCK_N entries, and matA into blocks of
+  BLOCK_M x BLOCK_K entries, so that both are read contiguously and
+  stay in cache. The micro-kernel then computes a TILE_M x TILE_N tile
+  of matC in registers; its inner loops have a fixed length, so the
+  compiler vectorizes them.
+*/
+static const unsigned TILE_M = 4;
+static const unsigned TILE_N = 8;
+static const unsigned BLOCK_M = 64;
+static const unsigned BLOCK_K = 256;
+static const unsigned BLOCK_N = 1024;
+
+/*
+  Products that are this small are not worth packing
+*/
+static const unsigned long long SMALL_PRODUCT = 4096;
+
+static void packPanelOfB( const double *matB,
+                          unsigned columnsB,
+                          unsigned firstRow,
+                          unsigned rows,
+                          unsigned firstColumn,
+                          unsigned columns,
+                          double *packed )
+{
+    // Slivers of TILE_N columns, padded with zeros
+    for ( unsigned j = 0; j < columns; j += TILE_N )
     {
-        for ( unsigned j = 0; j < columnsB; ++j )
+        unsigned width = std::min( TILE_N, columns - j );
+        for ( unsigned k = 0; k < rows; ++k )
         {
-            for ( unsigned k = 0; k < columnsA; ++k )
+            const double *row = matB + ( firstRow + k ) * columnsB + firstColumn + j;
+            unsigned c = 0;
+            for ( ; c < width; ++c )
+                packed[c] = row[c];
+            for ( ; c < TILE_N; ++c )
+                packed[c] = 0;
+            packed += TILE_N;
+        }
+    }
+}
+
+static void packBlockOfA( const double *matA,
+                          unsigned columnsA,
+                          unsigned firstRow,
+                          unsigned rows,
+                          unsigned firstColumn,
+                          unsigned columns,
+                          double *packed )
+{
+    // Slivers of TILE_M rows, padded with zeros
+    for ( unsigned i = 0; i < rows; i += TILE_M )
+    {
+        unsigned height = std::min( TILE_M, rows - i );
+        for ( unsigned k = 0; k < columns; ++k )
+        {
+            unsigned r = 0;
+            for ( ; r < height; ++r )
+                packed[r] = matA[( firstRow + i + r ) * columnsA + firstColumn + k];
+            for ( ; r < TILE_M; ++r )
+                packed[r] = 0;
+            packed += TILE_M;
+        }
+    }
+}
+
+static void microKernel( unsigned depth,
+                         const double *packedA,
+                         const double *packedB,
+                         double *matC,
+                         unsigned columnsC,
+                         unsigned height,
+                         unsigned width )
+{
+    double tile[TILE_M][TILE_N] = {};
+
+    for ( unsigned k = 0; k < depth; ++k )
+    {
+        for ( unsigned r = 0; r < TILE_M; ++r )
+        {
+            double a = packedA[k * TILE_M + r];
+            for ( unsigned c = 0; c < TILE_N; ++c )
+                tile[r][c] += a * packedB[k * TILE_N + c];
+        }
+    }
+
+    for ( unsigned r = 0; r < height; ++r )
+        for ( unsigned c = 0; c < width; ++c )
+            matC[r * columnsC + c] += tile[r][c];
+}
+
+static void smallMatrixMultiplication( const double *matA,
+                                       const double *matB,
+                                       double *matC,
+                                       unsigned firstRow,
+                                       unsigned lastRow,
+                                       unsigned columnsA,
+                                       unsigned columnsB )
+{
+    // The i-k-j order runs over contiguous rows of matB and matC
+    for ( unsigned i = firstRow; i < lastRow; ++i )
+    {
+        for ( unsigned k = 0; k < columnsA; ++k )
+        {
+            double entry = matA[i * columnsA + k];
+            if ( entry == 0 )
+                continue;
+
+            for ( unsigned j = 0; j < columnsB; ++j )
+                matC[i * columnsB + j] += entry * matB[k * columnsB + j];
+        }
+    }
+}
+
+static void blockedMatrixMultiplicationOfRows( const double *matA,
+                                               const double *matB,
+                                               double *matC,
+                                               unsigned firstRow,
+                                               unsigned lastRow,
+                                               unsigned columnsA,
+                                               unsigned columnsB )
+{
+    std::vector<double> packedA( BLOCK_M * BLOCK_K );
+    std::vector<double> packedB( BLOCK_K * ( ( std::min( BLOCK_N, columnsB ) + TILE_N - 1 ) /
+                                             TILE_N * TILE_N ) );
+
+    for ( unsigned jc = 0; jc < columnsB; jc += BLOCK_N )
+    {
+        unsigned columns = std::min( BLOCK_N, columnsB - jc );
+
+        for ( unsigned pc = 0; pc < columnsA; pc += BLOCK_K )
+        {
+            unsigned depth = std::min( BLOCK_K, columnsA - pc );
+            packPanelOfB( matB, columnsB, pc, depth, jc, columns, packedB.data() );
+
+            for ( unsigned ic = firstRow; ic < lastRow; ic += BLOCK_M )
             {
-                matC[i * columnsB + j] += matA[i * columnsA + k] * matB[k * columnsB + j];
+                unsigned rows = std::min( BLOCK_M, lastRow - ic );
+                packBlockOfA( matA, columnsA, ic, rows, pc, depth, packedA.data() );
+
+                for ( unsigned jr = 0; jr < columns; jr += TILE_N )
+                {
+                    for ( unsigned ir = 0; ir < rows; ir += TILE_M )
+                    {
+                        microKernel( depth,
+                                     packedA.data() + ir * depth,
+                                     packedB.data() + jr * depth,
+                                     matC + ( ic + ir ) * columnsB + jc + jr,
+                                     columnsB,
+                                     std::min( TILE_M, rows - ir ),
+                                     std::min( TILE_N, columns - jr ) );
+                    }
+                }
             }
         }
     }
 }
-#endif
+
+static std::atomic<unsigned> matrixMultiplicationThreads( 1 );
+
+void setMatrixMultiplicationThreads( unsigned threads )
+{
+    matrixMultiplicationThreads = std::max( 1u, threads );
+}
+
+unsigned getMatrixMultiplicationThreads()
+{
+    return matrixMultiplicationThreads;
+}
+
+/*
+  The threads among which large products are divided. The calling
+  thread takes part in every run, so a run on n threads uses n - 1
+  threads of the pool. A product that finds the pool in use, e.g., by
+  another solver thread, is computed on its calling thread alone.
+*/
+class MatrixMultiplicationThreadPool
+{
+public:
+    MatrixMultiplicationThreadPool()
+        : _task( NULL )
+        , _numberOfTasks( 0 )
+        , _nextTask( 0 )
+        , _activeWorkers( 0 )
+        , _runningWorkers( 0 )
+        , _generation( 0 )
+        , _stop( false )
+    {
+    }
+
+    ~MatrixMultiplicationThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            _stop = true;
+        }
+        _taskAvailable.notify_all();
+
+        for ( auto &worker : _workers )
+            worker.join();
+    }
+
+    /*
+      Call task( t ) for every 0 <= t < tasks, on up to threads
+      threads. Returns false, without calling the task, if the pool is
+      in use.
+    */
+    bool run( unsigned tasks, unsigned threads, const std::function<void( unsigned )> &task )
+    {
+        std::unique_lock<std::mutex> inUse( _inUse, std::try_to_lock );
+        if ( !inUse.owns_lock() )
+            return false;
+
+        while ( _workers.size() + 1 < threads )
+        {
+            unsigned index = _workers.size();
+            _workers.emplace_back( [this, index]() { workerLoop( index ); } );
+        }
+
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            _task = &task;
+            _numberOfTasks = tasks;
+            _nextTask = 0;
+            _activeWorkers = threads - 1;
+            _runningWorkers = threads - 1;
+            ++_generation;
+        }
+        _taskAvailable.notify_all();
+
+        runTasks();
+
+        std::unique_lock<std::mutex> lock( _mutex );
+        _workersDone.wait( lock, [this]() { return _runningWorkers == 0; } );
+        _task = NULL;
+        return true;
+    }
+
+private:
+    // Held by the thread that runs the pool
+    std::mutex _inUse;
+
+    // Guards the state of the current run
+    std::mutex _mutex;
+    std::condition_variable _taskAvailable;
+    std::condition_variable _workersDone;
+
+    std::vector<std::thread> _workers;
+    const std::function<void( unsigned )> *_task;
+    unsigned _numberOfTasks;
+    std::atomic<unsigned> _nextTask;
+    unsigned _activeWorkers;
+    unsigned _runningWorkers;
+    unsigned long long _generation;
+    bool _stop;
+
+    void runTasks()
+    {
+        unsigned t;
+        while ( ( t = _nextTask++ ) < _numberOfTasks )
+            ( *_task )( t );
+    }
+
+    void workerLoop( unsigned index )
+    {
+        unsigned long long lastGeneration = 0;
+        while ( true )
+        {
+            {
+                std::unique_lock<std::mutex> lock( _mutex );
+                _taskAvailable.wait(
+                    lock, [&]() { return _stop || _generation != lastGeneration; } );
+                if ( _stop )
+                    return;
+
+                lastGeneration = _generation;
+                if ( index >= _activeWorkers )
+                    continue;
+            }
+
+            runTasks();
+
+            {
+                std::lock_guard<std::mutex> lock( _mutex );
+                --_runningWorkers;
+            }
+            _workersDone.notify_one();
+        }
+    }
+};
+
+static MatrixMultiplicationThreadPool &threadPool()
+{
+    static MatrixMultiplicationThreadPool pool;
+    return pool;
+}
+
+/*
+  The number of threads to use for a product with the given number of
+  multiply-adds, whose rows can be divided into the given number of
+  independent chunks
+*/
+static unsigned numberOfThreads( unsigned long long multiplyAdds, unsigned chunks )
+{
+    if ( multiplyAdds < GlobalConfiguration::MATRIX_MULTIPLICATION_PARALLEL_THRESHOLD )
+        return 1;
+
+    return std::max( 1u, std::min( getMatrixMultiplicationThreads(), chunks ) );
+}
+
+/*
+  Divide the rows [0, rows) into ranges whose boundaries are multiples
+  of granularity, and call work( firstRow, lastRow ) on each range, on
+  the threads of the pool
+*/
+template <class Work>
+static void divideRows( unsigned rows, unsigned granularity, unsigned threads, const Work &work )
+{
+    if ( threads <= 1 )
+    {
+        work( 0, rows );
+        return;
+    }
+
+    unsigned chunks = ( rows + granularity - 1 ) / granularity;
+    std::function<void( unsigned )> range = [&]( unsigned t ) {
+        unsigned firstRow = std::min( rows, chunks * t / threads * granularity );
+        unsigned lastRow = std::min( rows, chunks * ( t + 1 ) / threads * granularity );
+        if ( firstRow < lastRow )
+            work( firstRow, lastRow );
+    };
+
+    if ( !threadPool().run( threads, threads, range ) )
+        work( 0, rows );
+}
+
+void blockedMatrixMultiplication( const double *matA,
+                                  const double *matB,
+                                  double *matC,
+                                  unsigned rowsA,
+                                  unsigned columnsA,
+                                  unsigned columnsB )
+{
+    if ( rowsA == 0 || columnsA == 0 || columnsB == 0 )
+        return;
+
+    unsigned long long multiplyAdds = (unsigned long long)rowsA * columnsA * columnsB;
+    if ( multiplyAdds <= SMALL_PRODUCT || rowsA < TILE_M || columnsB < TILE_N )
+    {
+        smallMatrixMultiplication( matA, matB, matC, 0, rowsA, columnsA, columnsB );
+        return;
+    }
+
+    unsigned threads = numberOfThreads( multiplyAdds, ( rowsA + BLOCK_M - 1 ) / BLOCK_M );
+    divideRows( rowsA, BLOCK_M, threads, [&]( unsigned firstRow, unsigned lastRow ) {
+        blockedMatrixMultiplicationOfRows(
+            matA, matB, matC, firstRow, lastRow, columnsA, columnsB );
+    } );
+}
+
+void sparseMatrixMultiplication( const unsigned *rowStart,
+                                 const unsigned *columns,
+                                 const double *values,
+                                 const double *matB,
+                                 double *matC,
+                                 unsigned rowsA,
+                                 unsigned columnsB )
+{
+    if ( rowsA == 0 || columnsB == 0 )
+        return;
+
+    unsigned long long multiplyAdds = (unsigned long long)rowStart[rowsA] * columnsB;
+    unsigned threads = numberOfThreads( multiplyAdds, rowsA );
+
+    divideRows( rowsA, 1, threads, [&]( unsigned firstRow, unsigned lastRow ) {
+        for ( unsigned i = firstRow; i < lastRow; ++i )
+        {
+            double *rowOfC = matC + i * columnsB;
+            for ( unsigned k = rowStart[i]; k < rowStart[i + 1]; ++k )
+            {
+                double entry = values[k];
+                const double *rowOfB = matB + columns[k] * columnsB;
+                for ( unsigned j = 0; j < columnsB; ++j )
+                    rowOfC[j] += entry * rowOfB[j];
+            }
+        }
+    } );
+}
@@ -14,4 +14,55 @@ void matrixMultiplication( const double *matA,
                            unsigned columnsA,
                            unsigned columnsB );
 
+/*
+  The size of matA is rowsA x columnsA,
+  and the size of matB is rowsA x columnsB.
+  Compute matA^T * matB + matC and store the result in matC, which is of
+  size columnsA x columnsB
+*/
+void transposedMatrixMultiplication( const double *matA,
+                                     const double *matB,
+                                     double *matC,
+                                     unsigned rowsA,
+                                     unsigned columnsA,
+                                     unsigned columnsB );
+
+/*
+  The same as matrixMultiplication, but always computed by Marabou's
+  own cache-blocked and register-tiled kernel, rather than by OpenBLAS.
+  Large products are divided among the threads set by
+  setMatrixMultiplicationThreads(). This is the implementation of
+  matrixMultiplication when OpenBLAS is not available.
+*/
+void blockedMatrixMultiplication( const double *matA,
+                                  const double *matB,
+                                  double *matC,
+                                  unsigned rowsA,
+                                  unsigned columnsA,
+                                  unsigned columnsB );
+
+/*
+  matA is a sparse matrix of size rowsA x columnsA, in Compressed
+  Sparse Row format: the non-zero entries of row i are values[k], in
+  column columns[k], for rowStart[i] <= k < rowStart[i + 1]. The size
+  of matB is columnsA x columnsB.
+  Compute matA * matB + matC and store the result in matC
+*/
+void sparseMatrixMultiplication( const unsigned *rowStart,
+                                 const unsigned *columns,
+                                 const double *values,
+                                 const double *matB,
+                                 double *matC,
+                                 unsigned rowsA,
+                                 unsigned columnsB );
+
+/*
+  The number of threads among which Marabou's own kernels divide large
+  products, the counterpart of openblas_set_num_threads(). The default
+  is a single thread. The threads are created on first use and reused
+  by later products.
+*/
+void setMatrixMultiplicationThreads( unsigned threads );
+unsigned getMatrixMultiplicationThreads();
+
 #endif // __MatrixMultiplication_h__
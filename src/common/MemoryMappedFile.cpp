@@ -0,0 +1,125 @@
+/*********************                                                        */
+/*! \file MemoryMappedFile.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "MemoryMappedFile.h"
+
+#include "CommonError.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+MemoryMappedFile::MemoryMappedFile( const String &path )
+    : _path( path )
+    , _data( NULL )
+    , _size( 0 )
+{
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    closeIfNeeded();
+}
+
+void MemoryMappedFile::open()
+{
+    closeIfNeeded();
+
+#ifndef _WIN32
+    int descriptor = ::open( _path.ascii(), O_RDONLY );
+    if ( descriptor == -1 )
+        throw CommonError( CommonError::OPEN_FAILED, _path.ascii() );
+
+    struct stat fileData;
+    if ( fstat( descriptor, &fileData ) != 0 )
+    {
+        ::close( descriptor );
+        throw CommonError( CommonError::STAT_FAILED, _path.ascii() );
+    }
+
+    _size = fileData.st_size;
+    if ( _size > 0 )
+    {
+        void *data = mmap( NULL, _size, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+        if ( data == MAP_FAILED )
+        {
+            ::close( descriptor );
+            throw CommonError( CommonError::READ_FAILED, _path.ascii() );
+        }
+
+        _data = (char *)data;
+    }
+
+    // The mapping remains valid after the descriptor is closed
+    ::close( descriptor );
+#else
+    std::ifstream input( _path.ascii(), std::ios::binary | std::ios::ate );
+    if ( !input )
+        throw CommonError( CommonError::OPEN_FAILED, _path.ascii() );
+
+    _size = input.tellg();
+    if ( _size > 0 )
+    {
+        _data = new char[_size];
+        input.seekg( 0 );
+        if ( !input.read( _data, _size ) )
+        {
+            closeIfNeeded();
+            throw CommonError( CommonError::READ_FAILED, _path.ascii() );
+        }
+    }
+#endif
+}
+
+void MemoryMappedFile::close()
+{
+    closeIfNeeded();
+}
+
+const char *MemoryMappedFile::data() const
+{
+    return _data;
+}
+
+unsigned long long MemoryMappedFile::size() const
+{
+    return _size;
+}
+
+void MemoryMappedFile::closeIfNeeded()
+{
+    if ( _data )
+    {
+#ifndef _WIN32
+        munmap( _data, _size );
+#else
+        delete[] _data;
+#endif
+        _data = NULL;
+    }
+
+    _size = 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
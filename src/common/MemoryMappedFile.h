@@ -0,0 +1,52 @@
+/*********************                                                        */
+/*! \file MemoryMappedFile.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __MemoryMappedFile_h__
+#define __MemoryMappedFile_h__
+
+#include "MString.h"
+
+/*
+  A read-only view of the contents of a file. Where available, the file
+  is mapped into memory, so that its pages are only read once they are
+  accessed; otherwise, it is read into a buffer in full.
+*/
+class MemoryMappedFile
+{
+public:
+    MemoryMappedFile( const String &path );
+    ~MemoryMappedFile();
+
+    void open();
+    void close();
+
+    const char *data() const;
+    unsigned long long size() const;
+
+private:
+    String _path;
+    char *_data;
+    unsigned long long _size;
+
+    void closeIfNeeded();
+};
+
+#endif // __MemoryMappedFile_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -289,7 +289,7 @@ public:
             throw CommonError( CommonError::POPPING_FROM_EMPTY_VECTOR );
 
         T value = last();
-        eraseAt( size() - 1 );
+        _container.pop_back();
         return value;
     }
 
@@ -0,0 +1,172 @@
+/*********************                                                        */
+/*! \file MatrixMultiplicationBenchmark.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A microbenchmark of the matrix multiplication kernels: the naive
+ ** triple loop, Marabou's blocked kernel, its sparse variant and, if
+ ** Marabou was built with it, OpenBLAS. Build it with
+ **
+ **    make MatrixMultiplicationBenchmark
+ **
+ ** and run it with an optional number of repetitions per product, and an
+ ** optional number of threads for the blocked and sparse kernels.
+
+**/
+
+#include "BenchmarkUtils.h"
+#include "MatrixMultiplication.h"
+#include "Vector.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+static void naiveMatrixMultiplication( const double *matA,
+                                       const double *matB,
+                                       double *matC,
+                                       unsigned rowsA,
+                                       unsigned columnsA,
+                                       unsigned columnsB )
+{
+    for ( unsigned i = 0; i < rowsA; ++i )
+        for ( unsigned j = 0; j < columnsB; ++j )
+            for ( unsigned k = 0; k < columnsA; ++k )
+                matC[i * columnsB + j] += matA[i * columnsA + k] * matB[k * columnsB + j];
+}
+
+static Vector<double> randomMatrix( unsigned size, double density )
+{
+    Vector<double> matrix( size, 0 );
+    for ( unsigned i = 0; i < size; ++i )
+    {
+        if ( (double)rand() / RAND_MAX < density )
+            matrix[i] = (double)rand() / RAND_MAX * 2 - 1;
+    }
+    return matrix;
+}
+
+int main( int argc, char **argv )
+{
+    unsigned repetitions = argc > 1 ? atoi( argv[1] ) : 5;
+    setMatrixMultiplicationThreads( argc > 2 ? atoi( argv[2] ) : 1 );
+    srand( 1 );
+
+    // Square products, and the shapes of symbolic bound propagation:
+    // (input size) x (source layer) x (target layer)
+    unsigned shapes[][3] = { { 64, 64, 64 },
+                             { 256, 256, 256 },
+                             { 512, 512, 512 },
+                             { 1024, 1024, 1024 },
+                             { 5, 300, 300 },
+                             { 784, 100, 100 },
+                             { 784, 1024, 1024 } };
+
+    printf( "Dense products (GFLOP/s)\n" );
+    printf( "%-20s %10s %10s %10s\n", "rows x inner x cols", "naive", "blocked", "openblas" );
+
+    for ( const auto &shape : shapes )
+    {
+        unsigned rowsA = shape[0];
+        unsigned columnsA = shape[1];
+        unsigned columnsB = shape[2];
+        unsigned long long multiplyAdds = (unsigned long long)rowsA * columnsA * columnsB;
+
+        Vector<double> matA = randomMatrix( rowsA * columnsA, 1 );
+        Vector<double> matB = randomMatrix( columnsA * columnsB, 1 );
+        Vector<double> matC( rowsA * columnsB, 0 );
+
+        // The naive loop is too slow to be worth waiting for on the
+        // largest products
+        double naive = 0;
+        if ( multiplyAdds <= 512ULL * 512 * 512 )
+            naive = BenchmarkUtils::gflops(
+                multiplyAdds, BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+                    naiveMatrixMultiplication(
+                        matA.data(), matB.data(), matC.data(), rowsA, columnsA, columnsB );
+                } ) );
+
+        double blocked = BenchmarkUtils::gflops(
+            multiplyAdds, BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+                blockedMatrixMultiplication(
+                    matA.data(), matB.data(), matC.data(), rowsA, columnsA, columnsB );
+            } ) );
+
+        printf( "%5u x %5u x %5u  ", rowsA, columnsA, columnsB );
+        if ( naive > 0 )
+            printf( "%10.2f ", naive );
+        else
+            printf( "%10s ", "-" );
+        printf( "%10.2f ", blocked );
+
+#ifdef ENABLE_OPENBLAS
+        double openBlas = BenchmarkUtils::gflops(
+            multiplyAdds, BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+                matrixMultiplication(
+                    matA.data(), matB.data(), matC.data(), rowsA, columnsA, columnsB );
+            } ) );
+        printf( "%10.2f\n", openBlas );
+#else
+        printf( "%10s\n", "n/a" );
+#endif
+    }
+
+    // Sparse weights times a dense matrix, as in DeepPoly back-substitution
+    // through convolutional layers
+    printf( "\nSparse (CSR) x dense, 1024 x 1024 x 1024 (ms per product)\n" );
+    printf( "%-20s %10s %10s\n", "density", "sparse", "blocked" );
+
+    double densities[] = { 0.01, 0.05, 0.2 };
+    unsigned size = 1024;
+    for ( double density : densities )
+    {
+        Vector<double> matA = randomMatrix( size * size, density );
+        Vector<double> matB = randomMatrix( size * size, 1 );
+
+        Vector<unsigned> rowStart;
+        Vector<unsigned> columns;
+        Vector<double> values;
+        rowStart.append( 0 );
+        for ( unsigned i = 0; i < size; ++i )
+        {
+            for ( unsigned j = 0; j < size; ++j )
+            {
+                if ( matA[i * size + j] != 0 )
+                {
+                    columns.append( j );
+                    values.append( matA[i * size + j] );
+                }
+            }
+            rowStart.append( columns.size() );
+        }
+
+        Vector<double> matC( size * size, 0 );
+        double sparse = BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+            sparseMatrixMultiplication( rowStart.data(),
+                                        columns.data(),
+                                        values.data(),
+                                        matB.data(),
+                                        matC.data(),
+                                        size,
+                                        size );
+        } );
+        double blocked = BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+            blockedMatrixMultiplication( matA.data(), matB.data(), matC.data(), size, size, size );
+        } );
+
+        printf( "%-20.2f %10.2f %10.2f\n", density, sparse, blocked );
+    }
+
+    return 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,116 @@
+/*********************                                                        */
+/*! \file Test_BufferedFileWriter.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "BufferedFileWriter.h"
+#include "MockFile.h"
+
+#include <cxxtest/TestSuite.h>
+
+class CountingFile : public MockFile
+{
+public:
+    CountingFile()
+        : numberOfWrites( 0 )
+    {
+    }
+
+    unsigned numberOfWrites;
+
+    void write( const String &line )
+    {
+        ++numberOfWrites;
+        MockFile::write( line );
+    }
+};
+
+class BufferedFileWriterTestSuite : public CxxTest::TestSuite
+{
+public:
+    void test_small_writes_are_buffered()
+    {
+        CountingFile file;
+        BufferedFileWriter writer( file );
+
+        writer.write( String( "abc" ) );
+        writer.write( String( "def\n" ) );
+        writer.writeValue<char>( 'g' );
+
+        TS_ASSERT_EQUALS( file.numberOfWrites, 0U );
+
+        writer.flush();
+        TS_ASSERT_EQUALS( file.numberOfWrites, 1U );
+        TS_ASSERT_EQUALS( file.writtenLines, String( "abcdef\ng" ) );
+
+        // Nothing left to flush
+        writer.flush();
+        TS_ASSERT_EQUALS( file.numberOfWrites, 1U );
+    }
+
+    void test_binary_values()
+    {
+        CountingFile file;
+        BufferedFileWriter writer( file );
+
+        writer.writeValue<unsigned>( 0 );
+        writer.writeValue<double>( 1.5 );
+        writer.flush();
+
+        String written = file.writtenLines;
+        TS_ASSERT_EQUALS( written.length(), sizeof( unsigned ) + sizeof( double ) );
+
+        unsigned zero = 1;
+        double value = 0;
+        memcpy( &zero, written.ascii(), sizeof( unsigned ) );
+        memcpy( &value, written.ascii() + sizeof( unsigned ), sizeof( double ) );
+        TS_ASSERT_EQUALS( zero, 0U );
+        TS_ASSERT_EQUALS( value, 1.5 );
+    }
+
+    void test_large_writes()
+    {
+        CountingFile file;
+        BufferedFileWriter writer( file );
+
+        String chunk( std::string( BufferedFileWriter::BUFFER_SIZE, 'a' ) );
+
+        // Filling the buffer exactly does not write anything yet
+        writer.write( String( "x" ) );
+        writer.write( chunk.ascii(), chunk.length() - 1 );
+        TS_ASSERT_EQUALS( file.numberOfWrites, 0U );
+
+        // The next write flushes the full buffer first
+        writer.write( String( "y" ) );
+        TS_ASSERT_EQUALS( file.numberOfWrites, 1U );
+
+        // A chunk larger than the buffer is written directly, after the
+        // pending data
+        String large = chunk + chunk;
+        writer.write( large );
+        TS_ASSERT_EQUALS( file.numberOfWrites, 3U );
+
+        writer.flush();
+        TS_ASSERT_EQUALS( file.numberOfWrites, 3U );
+
+        String expected =
+            String( "x" ) + chunk.substring( 0, chunk.length() - 1 ) + String( "y" ) + large;
+        TS_ASSERT_EQUALS( file.writtenLines, expected );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
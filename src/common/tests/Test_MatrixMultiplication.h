@@ -15,7 +15,9 @@
  **/
 
 #include "MatrixMultiplication.h"
+#include "Vector.h"
 
+#include <cstdlib>
 #include <cxxtest/TestSuite.h>
 
 class MatrixMultiplicationTestSuite : public CxxTest::TestSuite
@@ -54,6 +56,100 @@ public:
         TS_ASSERT( matC[4] == 23 );
         TS_ASSERT( matC[5] == 34 );
     }
+
+    void test_transposed_matrix_matrix()
+    {
+        double matA[] = { 1, 2, 3, 4, 5, 6 }; // [1,2], [3,4], [5,6]
+        double matB[] = { 1, 0, 2, 1, 0, 3 }; // [1,0], [2,1], [0,3]
+        double matC[4] = { 1, 1, 1, 1 };
+        unsigned rowsA = 3;
+        unsigned columnsA = 2;
+        unsigned columnsB = 2;
+        transposedMatrixMultiplication( matA, matB, matC, rowsA, columnsA, columnsB );
+
+        // A^T = [1,3,5], [2,4,6]
+        TS_ASSERT( matC[0] == 8 );
+        TS_ASSERT( matC[1] == 19 );
+        TS_ASSERT( matC[2] == 11 );
+        TS_ASSERT( matC[3] == 23 );
+    }
+
+    bool checkBlockedMatrixMultiplication( unsigned rowsA, unsigned columnsA, unsigned columnsB )
+    {
+        // Small integers, so that the order of summation does not
+        // matter
+        Vector<double> matA( rowsA * columnsA );
+        Vector<double> matB( columnsA * columnsB );
+        Vector<double> matC( rowsA * columnsB );
+        for ( auto &entry : matA )
+            entry = (int)( rand() % 7 ) - 3;
+        for ( auto &entry : matB )
+            entry = (int)( rand() % 7 ) - 3;
+        for ( auto &entry : matC )
+            entry = (int)( rand() % 7 ) - 3;
+
+        Vector<double> expected = matC;
+        for ( unsigned i = 0; i < rowsA; ++i )
+            for ( unsigned j = 0; j < columnsB; ++j )
+                for ( unsigned k = 0; k < columnsA; ++k )
+                    expected[i * columnsB + j] += matA[i * columnsA + k] * matB[k * columnsB + j];
+
+        blockedMatrixMultiplication(
+            matA.data(), matB.data(), matC.data(), rowsA, columnsA, columnsB );
+
+        bool equal = true;
+        for ( unsigned i = 0; i < rowsA * columnsB; ++i )
+            equal = equal && ( matC[i] == expected[i] );
+        return equal;
+    }
+
+    void test_blocked_matrix_multiplication()
+    {
+        srand( 1 );
+
+        // Small products, products that are not multiples of the tile
+        // and block sizes, and a product large enough to be divided
+        // among threads
+        unsigned sizes[][3] = { { 1, 2, 2 }, { 3, 5, 7 }, { 13, 9, 17 }, { 67, 300, 1030 } };
+
+        for ( const auto &size : sizes )
+            TS_ASSERT( checkBlockedMatrixMultiplication( size[0], size[1], size[2] ) );
+    }
+
+    void test_blocked_matrix_multiplication_on_several_threads()
+    {
+        srand( 1 );
+        TS_ASSERT_EQUALS( getMatrixMultiplicationThreads(), 1U );
+
+        // The threads of the first product are reused by the next ones,
+        // including one that uses fewer of them
+        setMatrixMultiplicationThreads( 3 );
+        TS_ASSERT( checkBlockedMatrixMultiplication( 67, 300, 1030 ) );
+        TS_ASSERT( checkBlockedMatrixMultiplication( 200, 300, 300 ) );
+        setMatrixMultiplicationThreads( 2 );
+        TS_ASSERT( checkBlockedMatrixMultiplication( 67, 300, 1030 ) );
+
+        setMatrixMultiplicationThreads( 0 );
+        TS_ASSERT_EQUALS( getMatrixMultiplicationThreads(), 1U );
+    }
+
+    void test_sparse_matrix_multiplication()
+    {
+        // matA = [1,0,2], [0,0,0], [0,-1,0]
+        unsigned rowStart[] = { 0, 2, 2, 3 };
+        unsigned columns[] = { 0, 2, 1 };
+        double values[] = { 1, 2, -1 };
+        double matB[] = { 1, 2, 3, 4, 5, 6 }; // [1,2], [3,4], [5,6]
+        double matC[6] = { 1, 1, 1, 1, 1, 1 };
+        sparseMatrixMultiplication( rowStart, columns, values, matB, matC, 3, 2 );
+
+        TS_ASSERT( matC[0] == 12 );
+        TS_ASSERT( matC[1] == 15 );
+        TS_ASSERT( matC[2] == 1 );
+        TS_ASSERT( matC[3] == 1 );
+        TS_ASSERT( matC[4] == -2 );
+        TS_ASSERT( matC[5] == -3 );
+    }
 };
 
 //
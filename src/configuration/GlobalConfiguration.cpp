@@ -35,6 +35,8 @@ const double GlobalConfiguration::SCORE_BUMP_FOR_PL_CONSTRAINTS_NOT_IN_SOI = 5;
 // and how to repair a ReLU constraint.
 const bool GlobalConfiguration::USE_POLARITY_BASED_DIRECTION_HEURISTICS = true;
 
+const bool GlobalConfiguration::USE_CONTEXT_DEPENDENT_CONSTRAINT_STATES = true;
+
 const double GlobalConfiguration::DEFAULT_EPSILON_FOR_COMPARISONS = 0.0000000001;
 const unsigned GlobalConfiguration::DEFAULT_DOUBLE_TO_STRING_PRECISION = 10;
 const unsigned GlobalConfiguration::STATISTICS_PRINTING_FREQUENCY = 10000;
@@ -72,8 +74,15 @@ const bool GlobalConfiguration::USE_HARRIS_RATIO_TEST = true;
 
 const double GlobalConfiguration::SYMBOLIC_TIGHTENING_ROUNDING_CONSTANT = 0.00000000001;
 const double GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT = 0.00000001;
+const unsigned GlobalConfiguration::LP_TIGHTENING_BATCH_SIZE = 4;
+const double GlobalConfiguration::LP_TIGHTENING_TIME_BUDGET_IN_SECONDS = 0;
 
 const double GlobalConfiguration::SIGMOID_CUTOFF_CONSTANT = 20;
+const unsigned GlobalConfiguration::DEEPPOLY_MIN_NEURONS_PER_THREAD = 16;
+const double GlobalConfiguration::NLR_SPARSE_WEIGHTS_DENSITY_THRESHOLD = 0.1;
+const unsigned GlobalConfiguration::MATRIX_MULTIPLICATION_PARALLEL_THRESHOLD = 16777216;
+const unsigned long long GlobalConfiguration::NLR_FUSED_SYMBOLIC_BOUNDS_MAX_MULTIPLY_ADDS =
+    134217728;
 
 const bool GlobalConfiguration::PREPROCESS_INPUT_QUERY = true;
 const bool GlobalConfiguration::PREPROCESSOR_ELIMINATE_VARIABLES = true;
@@ -106,19 +115,31 @@ const double GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONST
 const unsigned GlobalConfiguration::REFACTORIZATION_THRESHOLD = 100;
 const GlobalConfiguration::BasisFactorizationType GlobalConfiguration::BASIS_FACTORIZATION_TYPE =
     GlobalConfiguration::SPARSE_FORREST_TOMLIN_FACTORIZATION;
+const double GlobalConfiguration::HYPERSPARSE_SOLVE_DENSITY_THRESHOLD = 0.1;
 
 const unsigned GlobalConfiguration::BABSR_CANDIDATES_THRESHOLD = 5;
 const unsigned GlobalConfiguration::POLARITY_CANDIDATES_THRESHOLD = 5;
 
 const unsigned GlobalConfiguration::DNC_DEPTH_THRESHOLD = 5;
+const unsigned GlobalConfiguration::DNC_MIN_SEARCH_TIME_BEFORE_SPLIT_IN_MILLISECONDS = 500;
+const unsigned GlobalConfiguration::DNC_SPLIT_REQUEST_INITIAL_BACKOFF_IN_MILLISECONDS = 50;
+const unsigned GlobalConfiguration::DNC_SPLIT_REQUEST_MAX_BACKOFF_IN_MILLISECONDS = 2000;
 
 const double GlobalConfiguration::MINIMAL_COEFFICIENT_FOR_TIGHTENING = 0.01;
 const double GlobalConfiguration::LEMMA_CERTIFICATION_TOLERANCE = 0.000001;
+const unsigned GlobalConfiguration::PROOF_CHECKING_SUBTREES_PER_THREAD = 4;
 const bool GlobalConfiguration::WRITE_JSON_PROOF = false;
+const bool GlobalConfiguration::WRITE_BINARY_PROOF = false;
 
 const unsigned GlobalConfiguration::BACKWARD_BOUND_PROPAGATION_DEPTH = 3;
 const unsigned GlobalConfiguration::MAX_ROUNDS_OF_BACKWARD_ANALYSIS = 10;
 
+const unsigned GlobalConfiguration::NATIVE_LP_SOLVER_MAX_ITERATIONS = 100000;
+const unsigned GlobalConfiguration::NATIVE_LP_SOLVER_ASSIGNMENT_RECOMPUTATION_FREQUENCY = 100;
+const unsigned GlobalConfiguration::NATIVE_LP_SOLVER_DEGENERATE_STEPS_BEFORE_BLAND = 50;
+const double GlobalConfiguration::NATIVE_MILP_SOLVER_INTEGRALITY_TOLERANCE = 0.000001;
+const unsigned GlobalConfiguration::NATIVE_MILP_SOLVER_MAX_NODES = 1000000;
+
 #ifdef ENABLE_GUROBI
 const unsigned GlobalConfiguration::GUROBI_NUMBER_OF_THREADS = 1;
 const bool GlobalConfiguration::GUROBI_LOGGING = false;
@@ -178,6 +199,8 @@ void GlobalConfiguration::print()
             BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY );
     printf( "  COST_FUNCTION_ERROR_THRESHOLD: %.15lf\n", COST_FUNCTION_ERROR_THRESHOLD );
     printf( "  USE_HARRIS_RATIO_TEST: %s\n", USE_HARRIS_RATIO_TEST ? "Yes" : "No" );
+    printf( "  USE_CONTEXT_DEPENDENT_CONSTRAINT_STATES: %s\n",
+            USE_CONTEXT_DEPENDENT_CONSTRAINT_STATES ? "Yes" : "No" );
 
     printf( "  PREPROCESS_INPUT_QUERY: %s\n", PREPROCESS_INPUT_QUERY ? "Yes" : "No" );
     printf( "  PREPROCESSOR_ELIMINATE_VARIABLES: %s\n",
@@ -221,6 +244,7 @@ void GlobalConfiguration::print()
         basisFactorizationType = "Unknown";
 
     printf( "  BASIS_FACTORIZATION_TYPE: %s\n", basisFactorizationType.ascii() );
+    printf( "  HYPERSPARSE_SOLVE_DENSITY_THRESHOLD: %.2lf\n", HYPERSPARSE_SOLVE_DENSITY_THRESHOLD );
     printf( "****************************\n" );
 }
 
@@ -40,6 +40,10 @@ public:
     // and how to repair a ReLU constraint.
     static const bool USE_POLARITY_BASED_DIRECTION_HEURISTICS;
 
+    // Backtrack the piecewise-linear constraints that support it by popping the context,
+    // instead of storing a copy of every constraint before each case split.
+    static const bool USE_CONTEXT_DEPENDENT_CONSTRAINT_STATES;
+
     // The default epsilon used for comparing doubles
     static const double DEFAULT_EPSILON_FOR_COMPARISONS;
 
@@ -199,8 +203,36 @@ public:
     static const double SYMBOLIC_TIGHTENING_ROUNDING_CONSTANT;
     static const double LP_TIGHTENING_ROUNDING_CONSTANT;
 
+    /*
+      The number of neurons that a worker of an LP/MILP bound tightening
+      pass takes at a time, and the time budget of such a pass. Once the
+      budget is spent, the remaining neurons are not tightened. A budget
+      of 0 means no budget.
+    */
+    static const unsigned LP_TIGHTENING_BATCH_SIZE;
+    static const double LP_TIGHTENING_TIME_BUDGET_IN_SECONDS;
+
     static const double SIGMOID_CUTOFF_CONSTANT;
 
+    // When DeepPoly analysis runs on several threads, the back-substitution of a layer is
+    // only divided among the threads if each of them gets at least this many neurons.
+    static const unsigned DEEPPOLY_MIN_NEURONS_PER_THREAD;
+
+    // Weighted-sum layers in which at most this fraction of the weights are non-zero store
+    // their weights in sparse (CSR) format, rather than as a dense matrix.
+    static const double NLR_SPARSE_WEIGHTS_DENSITY_THRESHOLD;
+
+    // Matrix products that are not delegated to OpenBLAS are divided among the threads set by
+    // setMatrixMultiplicationThreads(), if they take at least this many multiply-adds.
+    static const unsigned MATRIX_MULTIPLICATION_PARALLEL_THRESHOLD;
+
+    // Dense weighted-sum layers propagate symbolic bounds with the single-threaded, fused
+    // BoundKernels pass, unless the propagation takes at least this many multiply-adds, or at
+    // least MATRIX_MULTIPLICATION_PARALLEL_THRESHOLD of them and several threads are allowed for
+    // matrix multiplication. Larger propagations are done with four (cache-blocked, possibly
+    // multi-threaded) matrix products instead.
+    static const unsigned long long NLR_FUSED_SYMBOLIC_BOUNDS_MAX_MULTIPLY_ADDS;
+
     /*
       Constraint fixing heuristics
     */
@@ -229,6 +261,11 @@ public:
     };
     static const BasisFactorizationType BASIS_FACTORIZATION_TYPE;
 
+    // The tableau solves with the basis factorization using hypersparse forward and backward
+    // transformations, if the factorization supports them, as long as the average fraction of
+    // non-zero entries in their results stays below this threshold
+    static const double HYPERSPARSE_SOLVE_DENSITY_THRESHOLD;
+
     /* In the BaBSR-based branching heuristics, only this many earliest nodes are considered to
        branch on.
     */
@@ -243,6 +280,17 @@ public:
      */
     static const unsigned DNC_DEPTH_THRESHOLD;
 
+    /* With work stealing, a busy worker is only asked to split its search after it has
+       searched for at least this long
+     */
+    static const unsigned DNC_MIN_SEARCH_TIME_BEFORE_SPLIT_IN_MILLISECONDS;
+
+    /* With work stealing, an idle worker waits this long before asking for another split,
+       doubling the wait after every request up to the maximum
+     */
+    static const unsigned DNC_SPLIT_REQUEST_INITIAL_BACKOFF_IN_MILLISECONDS;
+    static const unsigned DNC_SPLIT_REQUEST_MAX_BACKOFF_IN_MILLISECONDS;
+
     /* Minimal coefficient of a variable in a Tableau row, that is used for bound tightening
      */
     static const double MINIMAL_COEFFICIENT_FOR_TIGHTENING;
@@ -251,10 +299,20 @@ public:
      */
     static const double LEMMA_CERTIFICATION_TOLERANCE;
 
+    /* When an UNSAT certificate is checked on several threads, the number of subtrees into
+       which the certificate is divided, per thread
+     */
+    static const unsigned PROOF_CHECKING_SUBTREES_PER_THREAD;
+
     /* Denote whether proofs should be written as a JSON file
      */
     static const bool WRITE_JSON_PROOF;
 
+    /* Denote whether proofs should be written in the compact binary certificate format. If so,
+       the proof is checked as it is read back from that file
+     */
+    static const bool WRITE_BINARY_PROOF;
+
     /* How many layers after the current layer do we encode in backward analysis.
      */
     static const unsigned BACKWARD_BOUND_PROPAGATION_DEPTH;
@@ -263,6 +321,31 @@ public:
      */
     static const unsigned MAX_ROUNDS_OF_BACKWARD_ANALYSIS;
 
+    /* The maximal number of simplex iterations of the native LP solver, after which it gives up
+       (reported as an iteration limit, not as a timeout)
+     */
+    static const unsigned NATIVE_LP_SOLVER_MAX_ITERATIONS;
+
+    /* The native LP solver updates the basic variables incrementally after every pivot, and
+       recomputes them from scratch every this many pivots
+     */
+    static const unsigned NATIVE_LP_SOLVER_ASSIGNMENT_RECOMPUTATION_FREQUENCY;
+
+    /* After this many consecutive degenerate pivots, the native LP solver switches to Bland's
+       rule to avoid cycling
+     */
+    static const unsigned NATIVE_LP_SOLVER_DEGENERATE_STEPS_BEFORE_BLAND;
+
+    /* The distance from an integer within which the native MILP solver considers the value of an
+       integer variable to be integral
+     */
+    static const double NATIVE_MILP_SOLVER_INTEGRALITY_TOLERANCE;
+
+    /* The maximal number of branch-and-bound nodes of the native MILP solver, after which it gives
+       up (reported as a timeout)
+     */
+    static const unsigned NATIVE_MILP_SOLVER_MAX_NODES;
+
 #ifdef ENABLE_GUROBI
     /*
       The number of threads Gurobi spawns
@@ -67,6 +67,12 @@ void OptionParser::initialize()
             ->default_value( ( *_stringOptions )[Options::INPUT_QUERY_FILE_PATH] ),
         "Input Query file. When specified, Marabou will solve this instead of the network and "
         "property pair." )(
+        "network-cache-dir",
+        boost::program_options::value<std::string>(
+            &( ( *_stringOptions )[Options::NETWORK_CACHE_DIRECTORY] ) )
+            ->default_value( ( *_stringOptions )[Options::NETWORK_CACHE_DIRECTORY] ),
+        "Directory for caching parsed networks. Verifying more properties of the same network "
+        "then skips parsing it again." )(
         "num-workers",
         boost::program_options::value<int>( &( *_intOptions )[Options::NUM_WORKERS] )
             ->default_value( ( *_intOptions )[Options::NUM_WORKERS] ),
@@ -74,14 +80,12 @@ void OptionParser::initialize()
         "timeout",
         boost::program_options::value<int>( &( *_intOptions )[Options::TIMEOUT] )
             ->default_value( ( *_intOptions )[Options::TIMEOUT] ),
-        "Global timeout in seconds. 0 means no timeout." )
-#ifdef ENABLE_GUROBI
-        ( "milp",
-          boost::program_options::bool_switch( &( *_boolOptions )[Options::SOLVE_WITH_MILP] )
-              ->default_value( ( *_boolOptions )[Options::SOLVE_WITH_MILP] ),
-          "Solve the input query with a MILP encoding in Gruobi." )
-#endif
-        ;
+        "Global timeout in seconds. 0 means no timeout." )(
+        "milp",
+        boost::program_options::bool_switch( &( *_boolOptions )[Options::SOLVE_WITH_MILP] )
+            ->default_value( ( *_boolOptions )[Options::SOLVE_WITH_MILP] ),
+        "Solve the input query with a MILP encoding, in Gurobi if it is available and with the "
+        "native MILP solver otherwise." );
 
     // Less common options
     _other.add_options()(
@@ -110,6 +114,11 @@ void OptionParser::initialize()
         boost::program_options::value<std::string>( &( *_stringOptions )[Options::QUERY_DUMP_FILE] )
             ->default_value( ( *_stringOptions )[Options::QUERY_DUMP_FILE] ),
         "Dump the verification query in Marabou's input query format." )(
+        "binary-query-dump",
+        boost::program_options::bool_switch( &( ( *_boolOptions )[Options::BINARY_QUERY_DUMP] ) )
+            ->default_value( ( *_boolOptions )[Options::BINARY_QUERY_DUMP] ),
+        "Dump the verification query in binary form, which loads faster. Combined with "
+        "--input-query, converts a query from the text format." )(
         "summary-file",
         boost::program_options::value<std::string>(
             &( ( *_stringOptions )[Options::SUMMARY_FILE] ) )
@@ -201,10 +210,32 @@ void OptionParser::initialize()
         boost::program_options::bool_switch( &( ( *_boolOptions )[Options::RESTORE_TREE_STATES] ) )
             ->default_value( ( *_boolOptions )[Options::RESTORE_TREE_STATES] ),
         "(SnC) Restore tree states in SnC mode.\n" )(
+        "work-stealing",
+        boost::program_options::bool_switch( &( ( *_boolOptions )[Options::DNC_WORK_STEALING] ) )
+            ->default_value( ( *_boolOptions )[Options::DNC_WORK_STEALING] ),
+        "(SnC) Schedule subqueries with per-worker work stealing, and split the search of busy "
+        "workers on demand when others are idle.\n" )(
+        "split-disjuncts",
+        boost::program_options::bool_switch(
+            &( ( *_boolOptions )[Options::SPLIT_TOP_LEVEL_DISJUNCTS] ) )
+            ->default_value( ( *_boolOptions )[Options::SPLIT_TOP_LEVEL_DISJUNCTS] ),
+        "(SnC) Solve the disjuncts of a top-level disjunction in a VNN-LIB property as separate "
+        "subqueries on the worker threads, sharing one preprocessed network.\n" )(
         "blas-threads",
         boost::program_options::value<int>( &( ( *_intOptions )[Options::NUM_BLAS_THREADS] ) )
             ->default_value( ( *_intOptions )[Options::NUM_BLAS_THREADS] ),
-        "Number of threads to use for matrix multiplication with OpenBLAS." )(
+        "Number of threads to use for matrix multiplication, with OpenBLAS or with Marabou's own "
+        "kernels." )(
+        "deeppoly-threads",
+        boost::program_options::value<int>( &( ( *_intOptions )[Options::NUM_DEEPPOLY_THREADS] ) )
+            ->default_value( ( *_intOptions )[Options::NUM_DEEPPOLY_THREADS] ),
+        "Number of threads among which the back-substitution of each layer is divided in "
+        "DeepPoly analysis." )(
+        "proof-checking-threads",
+        boost::program_options::value<int>(
+            &( ( *_intOptions )[Options::NUM_PROOF_CHECKING_THREADS] ) )
+            ->default_value( ( *_intOptions )[Options::NUM_PROOF_CHECKING_THREADS] ),
+        "Number of threads among which the subtrees of an UNSAT certificate are checked." )(
         "reluplex-split-threshold",
         boost::program_options::value<int>(
             &( ( *_intOptions )[Options::CONSTRAINT_VIOLATION_THRESHOLD] ) )
@@ -241,33 +272,35 @@ void OptionParser::initialize()
             &( *_boolOptions )[Options::DO_NOT_MERGE_CONSECUTIVE_WEIGHTED_SUM_LAYERS] )
             ->default_value(
                 ( *_boolOptions )[Options::DO_NOT_MERGE_CONSECUTIVE_WEIGHTED_SUM_LAYERS] ),
-        "Do no merge consecutive weighted-sum layers." )
+        "Do no merge consecutive weighted-sum layers." )(
+        "lp-tightening-after-split",
+        boost::program_options::bool_switch(
+            &( ( *_boolOptions )[Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT] ) )
+            ->default_value( ( *_boolOptions )[Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT] ),
+        "Whether to skip a LP tightening after a case split." )(
+        "milp-timeout",
+        boost::program_options::value<float>(
+            &( ( *_floatOptions )[Options::MILP_SOLVER_TIMEOUT] ) )
+            ->default_value( ( *_floatOptions )[Options::MILP_SOLVER_TIMEOUT] ),
+        "Per-ReLU timeout for iterative propagation." )(
+        "milp-tightening",
+        boost::program_options::value<std::string>(
+            &( ( *_stringOptions )[Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE] ) )
+            ->default_value( ( *_stringOptions )[Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE] ),
+        "The MILP solver bound tightening type: "
+        "lp/backward-once/backward-converge/lp-inc/milp/milp-inc/iter-prop/none. "
+        "Without Gurobi, the native LP and MILP solvers are used." )(
+        "lp-solver",
+        boost::program_options::value<std::string>( &( ( *_stringOptions )[Options::LP_SOLVER] ) )
+            ->default_value( ( *_stringOptions )[Options::LP_SOLVER] ),
+        "Solver for the LPs during the complete analysis: native/gurobi. Without Gurobi, "
+        "'gurobi' uses the native MILP solver instead." )
 #ifdef ENABLE_GUROBI
-        ( "lp-solver",
-          boost::program_options::value<std::string>( &( ( *_stringOptions )[Options::LP_SOLVER] ) )
-              ->default_value( ( *_stringOptions )[Options::LP_SOLVER] ),
-          "Solver for the LPs during the complete analysis: native/gurobi." )(
-            "num-simulations",
-            boost::program_options::value<int>(
-                &( ( *_intOptions )[Options::NUMBER_OF_SIMULATIONS] ) )
-                ->default_value( ( *_intOptions )[Options::NUMBER_OF_SIMULATIONS] ),
-            "Number of simulations generated per neuron." )(
-            "lp-tightening-after-split",
-            boost::program_options::bool_switch(
-                &( ( *_boolOptions )[Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT] ) )
-                ->default_value( ( *_boolOptions )[Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT] ),
-            "Whether to skip a LP tightening after a case split." )(
-            "milp-timeout",
-            boost::program_options::value<float>(
-                &( ( *_floatOptions )[Options::MILP_SOLVER_TIMEOUT] ) )
-                ->default_value( ( *_floatOptions )[Options::MILP_SOLVER_TIMEOUT] ),
-            "Per-ReLU timeout for iterative propagation." )(
-            "milp-tightening",
-            boost::program_options::value<std::string>(
-                &( ( *_stringOptions )[Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE] ) )
-                ->default_value( ( *_stringOptions )[Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE] ),
-            "The MILP solver bound tightening type: "
-            "lp/backward-once/backward-converge/lp-inc/milp/milp-inc/iter-prop/none." )
+        ( "num-simulations",
+          boost::program_options::value<int>(
+              &( ( *_intOptions )[Options::NUMBER_OF_SIMULATIONS] ) )
+              ->default_value( ( *_intOptions )[Options::NUMBER_OF_SIMULATIONS] ),
+          "Number of simulations generated per neuron." )
 #endif
         ;
 
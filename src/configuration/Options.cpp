@@ -46,8 +46,11 @@ void Options::initializeDefaultValues()
     _boolOptions[DNC_MODE] = false;
     _boolOptions[PREPROCESSOR_PL_CONSTRAINTS_ADD_AUX_EQUATIONS] = false;
     _boolOptions[RESTORE_TREE_STATES] = false;
+    _boolOptions[DNC_WORK_STEALING] = false;
+    _boolOptions[SPLIT_TOP_LEVEL_DISJUNCTS] = false;
     _boolOptions[DUMP_BOUNDS] = false;
     _boolOptions[DUMP_TOPOLOGY] = false;
+    _boolOptions[BINARY_QUERY_DUMP] = false;
     _boolOptions[SOLVE_WITH_MILP] = false;
     _boolOptions[PERFORM_LP_TIGHTENING_AFTER_SPLIT] = false;
     _boolOptions[PARALLEL_DEEPSOI] = false;
@@ -70,6 +73,8 @@ void Options::initializeDefaultValues()
     _intOptions[NUMBER_OF_SIMULATIONS] = 100;
     _intOptions[SEED] = 1;
     _intOptions[NUM_BLAS_THREADS] = 1;
+    _intOptions[NUM_DEEPPOLY_THREADS] = 1;
+    _intOptions[NUM_PROOF_CHECKING_THREADS] = 1;
     _intOptions[NUM_CONSTRAINTS_TO_REFINE_INC_LIN] = 30;
 
     /*
@@ -94,6 +99,7 @@ void Options::initializeDefaultValues()
     _stringOptions[SYMBOLIC_BOUND_TIGHTENING_TYPE] = "deeppoly";
     _stringOptions[MILP_SOLVER_BOUND_TIGHTENING_TYPE] = "none";
     _stringOptions[QUERY_DUMP_FILE] = "";
+    _stringOptions[NETWORK_CACHE_DIRECTORY] = "";
     _stringOptions[IMPORT_ASSIGNMENT_FILE_PATH] = "assignment.txt";
     _stringOptions[EXPORT_ASSIGNMENT_FILE_PATH] = "assignment.txt";
     _stringOptions[SOI_SEARCH_STRATEGY] = "mcmc";
@@ -197,33 +203,29 @@ SymbolicBoundTighteningType Options::getSymbolicBoundTighteningType() const
 
 MILPSolverBoundTighteningType Options::getMILPSolverBoundTighteningType() const
 {
-    if ( gurobiEnabled() )
-    {
-        String strategyString =
-            String( _stringOptions.get( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE ) );
-        if ( strategyString == "lp" )
-            return MILPSolverBoundTighteningType::LP_RELAXATION;
-        else if ( strategyString == "lp-inc" )
-            return MILPSolverBoundTighteningType::LP_RELAXATION_INCREMENTAL;
-        if ( strategyString == "backward-once" )
-            return MILPSolverBoundTighteningType::BACKWARD_ANALYSIS_ONCE;
-        if ( strategyString == "backward-converge" )
-            return MILPSolverBoundTighteningType::BACKWARD_ANALYSIS_CONVERGE;
-        else if ( strategyString == "milp" )
-            return MILPSolverBoundTighteningType::MILP_ENCODING;
-        else if ( strategyString == "milp-inc" )
-            return MILPSolverBoundTighteningType::MILP_ENCODING_INCREMENTAL;
-        else if ( strategyString == "iter-prop" )
-            return MILPSolverBoundTighteningType::ITERATIVE_PROPAGATION;
-        else if ( strategyString == "none" )
-            return MILPSolverBoundTighteningType::NONE;
-        else
-            return MILPSolverBoundTighteningType::LP_RELAXATION;
-    }
-    else
-    {
+    String strategyString =
+        String( _stringOptions.get( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE ) );
+
+    // MILP encodings are solved by Gurobi if it is available, and by the
+    // native MILP solver otherwise
+    if ( strategyString == "lp" )
+        return MILPSolverBoundTighteningType::LP_RELAXATION;
+    else if ( strategyString == "lp-inc" )
+        return MILPSolverBoundTighteningType::LP_RELAXATION_INCREMENTAL;
+    else if ( strategyString == "backward-once" )
+        return MILPSolverBoundTighteningType::BACKWARD_ANALYSIS_ONCE;
+    else if ( strategyString == "backward-converge" )
+        return MILPSolverBoundTighteningType::BACKWARD_ANALYSIS_CONVERGE;
+    else if ( strategyString == "none" )
         return MILPSolverBoundTighteningType::NONE;
-    }
+    else if ( strategyString == "milp" )
+        return MILPSolverBoundTighteningType::MILP_ENCODING;
+    else if ( strategyString == "milp-inc" )
+        return MILPSolverBoundTighteningType::MILP_ENCODING_INCREMENTAL;
+    else if ( strategyString == "iter-prop" )
+        return MILPSolverBoundTighteningType::ITERATIVE_PROPAGATION;
+    else
+        return MILPSolverBoundTighteningType::LP_RELAXATION;
 }
 
 SoISearchStrategy Options::getSoISearchStrategy() const
@@ -45,12 +45,23 @@ public:
         // Restore tree states of the parent when handling children in DnC.
         RESTORE_TREE_STATES,
 
+        // Schedule the DnC subqueries on per-worker deques with work stealing,
+        // and let idle workers ask busy workers to split their search
+        DNC_WORK_STEALING,
+
+        // Solve each disjunct of the first top-level disjunction of a VNN-LIB
+        // property as a separate DnC subquery
+        SPLIT_TOP_LEVEL_DISJUNCTS,
+
         // Dump the bounds of each variable after preprocessing
         DUMP_BOUNDS,
 
         // Dump the topology of the network
         DUMP_TOPOLOGY,
 
+        // Dump the query to QUERY_DUMP_FILE in binary form, rather than as text
+        BINARY_QUERY_DUMP,
+
         // Help flag
         HELP,
 
@@ -113,6 +124,14 @@ public:
         // The number of threads to use for OpenBLAS matrix multiplication.
         NUM_BLAS_THREADS,
 
+        // The number of threads among which the back-substitution of a
+        // layer is divided in DeepPoly analysis.
+        NUM_DEEPPOLY_THREADS,
+
+        // The number of threads among which the subtrees of an UNSAT
+        // certificate are checked.
+        NUM_PROOF_CHECKING_THREADS,
+
         // Maximal number of constraints to refine in incremental linearization
         NUM_CONSTRAINTS_TO_REFINE_INC_LIN,
     };
@@ -145,6 +164,10 @@ public:
         SYMBOLIC_BOUND_TIGHTENING_TYPE,
         MILP_SOLVER_BOUND_TIGHTENING_TYPE,
         QUERY_DUMP_FILE,
+
+        // Directory in which parsed networks are cached across runs
+        NETWORK_CACHE_DIRECTORY,
+
         EXPORT_ASSIGNMENT_FILE_PATH,
         IMPORT_ASSIGNMENT_FILE_PATH,
         SOFTMAX_BOUND_TYPE,
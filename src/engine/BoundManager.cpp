@@ -268,20 +268,25 @@ void BoundManager::clearTightenings()
 
 void BoundManager::propagateTightenings()
 {
+    // Collect the round's tightenings first, so that every watcher is
+    // notified once, with all the changes that concern it
+    _roundTightenings.clear();
     for ( unsigned i = 0; i < _size; ++i )
     {
         if ( *_tightenedLower[i] )
         {
-            _tableau->notifyLowerBound( i, getLowerBound( i ) );
+            _roundTightenings.append( Tightening( i, getLowerBound( i ), Tightening::LB ) );
             *_tightenedLower[i] = false;
         }
 
         if ( *_tightenedUpper[i] )
         {
-            _tableau->notifyUpperBound( i, getUpperBound( i ) );
+            _roundTightenings.append( Tightening( i, getUpperBound( i ), Tightening::UB ) );
             *_tightenedUpper[i] = false;
         }
     }
+
+    _tableau->notifyBounds( _roundTightenings );
 }
 
 bool BoundManager::consistentBounds() const
@@ -307,7 +312,7 @@ void BoundManager::registerRowBoundTightener( IRowBoundTightener *ptrRowBoundTig
     _rowBoundTightener = ptrRowBoundTightener;
 }
 
-const SparseUnsortedList &BoundManager::getExplanation( unsigned variable, bool isUpper ) const
+SparseUnsortedList BoundManager::getExplanation( unsigned variable, bool isUpper ) const
 {
     ASSERT( _engine->shouldProduceProofs() && variable < _size );
     return _boundExplainer->getExplanation( variable, isUpper );
@@ -119,7 +119,7 @@ public:
     void clearTightenings();
 
     /*
-       Inform variable watchers of new tightenings.
+       Inform variable watchers of new tightenings, in a single batch.
      */
     void propagateTightenings();
 
@@ -179,7 +179,7 @@ public:
     /*
       Return the bounds explanation of a variable in the tableau to the argument vector
     */
-    const SparseUnsortedList &getExplanation( unsigned variable, bool isUpper ) const;
+    SparseUnsortedList getExplanation( unsigned variable, bool isUpper ) const;
 
     /*
       Artificially update an explanation, without using the recursive rule
@@ -236,6 +236,12 @@ private:
     Vector<CVC4::context::CDO<bool> *> _tightenedLower;
     Vector<CVC4::context::CDO<bool> *> _tightenedUpper;
 
+    /*
+      The tightenings of the current propagation round, kept across
+      rounds to avoid reallocating them
+    */
+    Vector<Tightening> _roundTightenings;
+
     /*
        Record first tightening that violates bounds
      */
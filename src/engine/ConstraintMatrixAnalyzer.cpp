@@ -24,6 +24,8 @@ ConstraintMatrixAnalyzer::ConstraintMatrixAnalyzer()
     , _numColumnElements( NULL )
     , _workRow( NULL )
     , _workRow2( NULL )
+    , _pivotRowIndices( NULL )
+    , _eliminatedRowIndices( NULL )
     , _rowHeaders( NULL )
     , _columnHeaders( NULL )
     , _rowHeadersInverse( NULL )
@@ -74,6 +76,18 @@ void ConstraintMatrixAnalyzer::freeMemoryIfNeeded()
         _workRow2 = NULL;
     }
 
+    if ( _pivotRowIndices )
+    {
+        delete[] _pivotRowIndices;
+        _pivotRowIndices = NULL;
+    }
+
+    if ( _eliminatedRowIndices )
+    {
+        delete[] _eliminatedRowIndices;
+        _eliminatedRowIndices = NULL;
+    }
+
     if ( _numRowElements )
     {
         delete[] _numRowElements;
@@ -153,6 +167,11 @@ void ConstraintMatrixAnalyzer::allocateMemory()
     // Work memory
     _workRow = new double[_n];
     _workRow2 = new double[_n];
+    std::fill_n( _workRow, _n, 0 );
+    std::fill_n( _workRow2, _n, 0 );
+
+    _pivotRowIndices = new unsigned[_n];
+    _eliminatedRowIndices = new unsigned[_n];
 }
 
 void ConstraintMatrixAnalyzer::gaussianElimination()
@@ -365,21 +384,35 @@ void ConstraintMatrixAnalyzer::permute()
 void ConstraintMatrixAnalyzer::eliminate()
 {
     /*
-      Eliminate all entries below the pivot element A[k,k]
+      Eliminate all entries below the pivot element A[k,k]. The rows
+      involved are scattered into dense work rows for quick access, but
+      only their non-zero entries are visited.
     */
-
-    // Get the pivot row in dense format, due to repeated access
-    _A.getRowDense( _rowHeaders[_eliminationStep], _workRow );
+    const SparseUnsortedArray *pivotRow = _A.getRow( _rowHeaders[_eliminationStep] );
+    const SparseUnsortedArray::Entry *pivotEntry = pivotRow->getArray();
+    unsigned pivotRowNnz = 0;
 
     /*
       The pivot row is not eliminated per se, but it is excluded
       from the active submatrix, so we adjust the element counters
     */
     _numRowElements[_eliminationStep] = 0;
-    for ( unsigned column = _eliminationStep; column < _n; ++column )
+    for ( unsigned i = 0; i < pivotRow->getNnz(); ++i )
     {
-        if ( !FloatUtils::isZero( _workRow[_columnHeaders[column]] ) )
-            --_numColumnElements[column];
+        unsigned columnLocation = pivotEntry[i]._index;
+        unsigned column = _columnHeadersInverse[columnLocation];
+        if ( column < _eliminationStep || FloatUtils::isZero( pivotEntry[i]._value ) )
+            continue;
+
+        --_numColumnElements[column];
+
+        // The pivot column itself is handled separately
+        if ( column > _eliminationStep )
+        {
+            _workRow[columnLocation] = pivotEntry[i]._value;
+            _pivotRowIndices[pivotRowNnz] = columnLocation;
+            ++pivotRowNnz;
+        }
     }
 
     // Process all rows below the pivot row
@@ -403,8 +436,15 @@ void ConstraintMatrixAnalyzer::eliminate()
         */
         double rowMultiplier = -entry[index]._value / _pivotElement;
 
-        // Get the row being eliminated in dense format
-        _A.getRowDense( _rowHeaders[row], _workRow2 );
+        // Scatter the row being eliminated
+        SparseUnsortedArray *eliminatedRow = _A.getRow( _rowHeaders[row] );
+        const SparseUnsortedArray::Entry *rowEntry = eliminatedRow->getArray();
+        unsigned eliminatedRowNnz = eliminatedRow->getNnz();
+        for ( unsigned i = 0; i < eliminatedRowNnz; ++i )
+        {
+            _workRow2[rowEntry[i]._index] = rowEntry[i]._value;
+            _eliminatedRowIndices[i] = rowEntry[i]._index;
+        }
 
         // Eliminate the sub-diagonal entry
         --_numColumnElements[_eliminationStep];
@@ -412,21 +452,25 @@ void ConstraintMatrixAnalyzer::eliminate()
         sparseColumn->erase( index );
         _workRow2[_columnHeaders[_eliminationStep]] = 0;
 
-        // Handle the rest of the row
-        for ( unsigned column = _eliminationStep + 1; column < _n; ++column )
+        // Handle the rest of the row: only the columns where the pivot
+        // row is non-zero change
+        for ( unsigned i = 0; i < pivotRowNnz; ++i )
         {
-            unsigned columnLocation = _columnHeaders[column];
-
-            // If the value does not change, skip
-            if ( FloatUtils::isZero( _workRow[columnLocation] ) )
-                continue;
+            unsigned columnLocation = _pivotRowIndices[i];
+            unsigned column = _columnHeadersInverse[columnLocation];
 
-            // Value will change
             double oldValue = _workRow2[columnLocation];
             bool wasZero = FloatUtils::isZero( oldValue );
             double newValue = oldValue + ( rowMultiplier * _workRow[columnLocation] );
             bool isZero = FloatUtils::isZero( newValue );
 
+            // A new entry in the row
+            if ( oldValue == 0 )
+            {
+                _eliminatedRowIndices[eliminatedRowNnz] = columnLocation;
+                ++eliminatedRowNnz;
+            }
+
             if ( !wasZero && isZero )
             {
                 newValue = 0;
@@ -447,8 +491,19 @@ void ConstraintMatrixAnalyzer::eliminate()
                 _At.set( columnLocation, _rowHeaders[row], newValue );
         }
 
-        _A.updateSingleRow( _rowHeaders[row], _workRow2 );
+        // Gather the row back, and reset the work row
+        eliminatedRow->clear();
+        for ( unsigned i = 0; i < eliminatedRowNnz; ++i )
+        {
+            unsigned columnLocation = _eliminatedRowIndices[i];
+            if ( !FloatUtils::isZero( _workRow2[columnLocation] ) )
+                eliminatedRow->append( columnLocation, _workRow2[columnLocation] );
+            _workRow2[columnLocation] = 0;
+        }
     }
+
+    for ( unsigned i = 0; i < pivotRowNnz; ++i )
+        _workRow[_pivotRowIndices[i]] = 0;
 }
 
 List<unsigned> ConstraintMatrixAnalyzer::getIndependentColumns() const
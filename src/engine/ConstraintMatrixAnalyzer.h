@@ -54,8 +54,15 @@ private:
     unsigned _pivotColumn;
     double _pivotElement;
 
+    /*
+      Dense work rows, kept all-zero between uses, and the locations of
+      the non-zero entries of the pivot row and of the row being
+      eliminated
+    */
     double *_workRow;
     double *_workRow2;
+    unsigned *_pivotRowIndices;
+    unsigned *_eliminatedRowIndices;
 
     /*
       The i'th (permuted) row of the matrix is stored in memory
@@ -177,6 +177,24 @@ void DisjunctionConstraint::notifyUpperBound( unsigned variable, double bound )
         updateFeasibleDisjuncts();
 }
 
+void DisjunctionConstraint::notifyBounds( const Tightening *tightenings, unsigned count )
+{
+    if ( _boundManager == nullptr )
+    {
+        PiecewiseLinearConstraint::notifyBounds( tightenings, count );
+        return;
+    }
+
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS,
+                                       count );
+
+    // The bounds are already stored in the bound manager. Proofs
+    // currently don't support case elimination
+    if ( !_boundManager->shouldProduceProofs() )
+        updateFeasibleDisjuncts();
+}
+
 bool DisjunctionConstraint::participatingVariable( unsigned variable ) const
 {
     return _participatingVariables.exists( variable );
@@ -338,7 +356,7 @@ void DisjunctionConstraint::dump( String &output ) const
         output += Stringf( "\t%s\n", disjunctOutput.ascii() );
     }
 
-    output += Stringf( "Active? %s.", _constraintActive ? "Yes" : "No" );
+    output += Stringf( "Active? %s.", isActive() ? "Yes" : "No" );
 }
 
 void DisjunctionConstraint::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
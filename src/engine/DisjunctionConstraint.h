@@ -67,6 +67,12 @@ public:
     void notifyLowerBound( unsigned variable, double bound ) override;
     void notifyUpperBound( unsigned variable, double bound ) override;
 
+    /*
+      Handle a batch of bound changes, updating the feasible disjuncts
+      once for all of them.
+    */
+    void notifyBounds( const Tightening *tightenings, unsigned count ) override;
+
     /*
       Returns true iff the variable participates in this piecewise
       linear constraint
@@ -17,14 +17,18 @@
 
 #include "Debug.h"
 #include "DnCWorker.h"
+#include "Equation.h"
+#include "FloatUtils.h"
 #include "GetCPUData.h"
 #include "GlobalConfiguration.h"
 #include "LargestIntervalDivider.h"
 #include "MStringf.h"
 #include "MarabouError.h"
+#include "MatrixMultiplication.h"
 #include "Options.h"
 #include "PiecewiseLinearCaseSplit.h"
 #include "PolarityBasedDivider.h"
+#include "Preprocessor.h"
 #include "Query.h"
 #include "QueryDivider.h"
 #include "SnCDivideStrategy.h"
@@ -52,7 +56,8 @@ void DnCManager::dncSolve( WorkerQueue *workload,
                            bool restoreTreeStates,
                            unsigned verbosity,
                            unsigned seed,
-                           bool parallelDeepSoI )
+                           bool parallelDeepSoI,
+                           WorkStealingScheduler *scheduler )
 {
     unsigned cpuId = 0;
     (void)threadId;
@@ -74,7 +79,8 @@ void DnCManager::dncSolve( WorkerQueue *workload,
                       timeoutFactor,
                       divideStrategy,
                       verbosity,
-                      parallelDeepSoI );
+                      parallelDeepSoI,
+                      scheduler );
     while ( !shouldQuitSolving.load() )
     {
         worker.popOneSubQueryAndSolve( restoreTreeStates );
@@ -90,6 +96,8 @@ DnCManager::DnCManager( IQuery *inputQuery )
     , _verbosity( Options::get()->getInt( Options::VERBOSITY ) )
     , _runParallelDeepSoI( Options::get()->getBool( Options::PARALLEL_DEEPSOI ) )
     , _sncSplittingStrategy( Options::get()->getSnCDivideStrategy() )
+    , _workStealing( Options::get()->getBool( Options::DNC_WORK_STEALING ) &&
+                     !_runParallelDeepSoI )
 {
 }
 
@@ -114,6 +122,11 @@ void DnCManager::freeMemoryIfNeeded()
     }
 }
 
+void DnCManager::setTopLevelDisjuncts( const List<PiecewiseLinearCaseSplit> &disjuncts )
+{
+    _topLevelDisjuncts = disjuncts;
+}
+
 void DnCManager::solve()
 {
     enum {
@@ -133,6 +146,7 @@ void DnCManager::solve()
     // When preprocess the input query with SBT, we leverage multi-threading.
     openblas_set_num_threads( numWorkers );
 #endif
+    setMatrixMultiplicationThreads( numWorkers );
 
     // Preprocess the input query and create an engine for each of the threads
     if ( !createEngines( numWorkers ) )
@@ -146,6 +160,7 @@ void DnCManager::solve()
     // will be single-threaded.
     openblas_set_num_threads( 1 );
 #endif
+    setMatrixMultiplicationThreads( 1 );
 
     // Prepare the mechanism through which we can ask the engines to quit
     List<std::atomic_bool *> quitThreads;
@@ -159,7 +174,17 @@ void DnCManager::solve()
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "DnCManager::workload" );
 
     SubQueries subQueries;
-    if ( !_runParallelDeepSoI )
+    if ( !_runParallelDeepSoI && !_topLevelDisjuncts.empty() )
+    {
+        divideOnDisjuncts( subQueries );
+        if ( subQueries.empty() )
+        {
+            // Every disjunct was refuted by preprocessing
+            _exitCode = DnCManager::UNSAT;
+            return;
+        }
+    }
+    else if ( !_runParallelDeepSoI )
         initialDivide( subQueries );
     else
     {
@@ -180,12 +205,25 @@ void DnCManager::solve()
     _numUnsolvedSubQueries = _runParallelDeepSoI ? 1 : subQueries.size();
     std::atomic_bool shouldQuitSolving( false );
     WorkerQueue *workload = new WorkerQueue( 0 );
-    for ( auto &subQuery : subQueries )
+    std::unique_ptr<WorkStealingScheduler> scheduler = nullptr;
+    if ( _workStealing )
     {
-        if ( !workload->push( subQuery ) )
+        scheduler = std::unique_ptr<WorkStealingScheduler>( new WorkStealingScheduler( numWorkers ) );
+        for ( unsigned i = 0; i < numWorkers; ++i )
+            scheduler->registerSplitRequestFlag( i, _engines[i]->getSplitRequested() );
+
+        // The subqueries are owned by the scheduler from now on
+        scheduler->distribute( subQueries );
+    }
+    else
+    {
+        for ( auto &subQuery : subQueries )
         {
-            // This should never happen
-            ASSERT( false );
+            if ( !workload->push( subQuery ) )
+            {
+                // This should never happen
+                ASSERT( false );
+            }
         }
     }
 
@@ -194,6 +232,11 @@ void DnCManager::solve()
     bool restoreTreeStates = Options::get()->getBool( Options::RESTORE_TREE_STATES );
     unsigned seed = Options::get()->getInt( Options::SEED );
 
+    // Splits requested by idle workers interrupt a search midway, so the
+    // state of the search tree is passed on to the new subqueries
+    if ( _workStealing )
+        restoreTreeStates = true;
+
     auto baseQuery = std::unique_ptr<Query>( new Query( *( _baseEngine->getQuery() ) ) );
 
     // Spawn threads and start solving
@@ -218,7 +261,8 @@ void DnCManager::solve()
                                         restoreTreeStates,
                                         _verbosity,
                                         _runParallelDeepSoI ? seed + threadId : seed,
-                                        _runParallelDeepSoI ) );
+                                        _runParallelDeepSoI,
+                                        scheduler.get() ) );
     }
 
     // Wait until either all subQueries are solved or a satisfying assignment is
@@ -240,6 +284,12 @@ void DnCManager::solve()
     for ( auto &thread : threads )
         thread.join();
 
+    if ( scheduler )
+        DNC_MANAGER_LOG( Stringf( "Number of steals: %u, number of split requests: %u",
+                                  scheduler->getNumberOfSteals(),
+                                  scheduler->getNumberOfSplitRequests() )
+                             .ascii() );
+
     updateDnCExitCode();
     return;
 }
@@ -396,23 +446,7 @@ bool DnCManager::createEngines( unsigned numberOfEngines )
 
 void DnCManager::initialDivide( SubQueries &subQueries )
 {
-    if ( _sncSplittingStrategy == SnCDivideStrategy::Auto )
-    {
-        DNC_MANAGER_LOG( Stringf( "Deciding splitting strategy automatically...\n" ).ascii() );
-        Query *processedQuery = _baseEngine->getQuery();
-        if ( processedQuery->getNumInputVariables() <
-                 GlobalConfiguration::INTERVAL_SPLITTING_THRESHOLD ||
-             processedQuery->getPiecewiseLinearConstraints().empty() )
-        {
-            DNC_MANAGER_LOG( Stringf( "\tUsing Largest Interval Heuristics\n" ).ascii() );
-            _sncSplittingStrategy = SnCDivideStrategy::LargestInterval;
-        }
-        else
-        {
-            DNC_MANAGER_LOG( Stringf( "\tUsing Polarity-based Heuristics\n" ).ascii() );
-            _sncSplittingStrategy = SnCDivideStrategy::Polarity;
-        }
-    }
+    chooseDivideStrategy();
 
     auto split = std::unique_ptr<PiecewiseLinearCaseSplit>( new PiecewiseLinearCaseSplit() );
     std::unique_ptr<QueryDivider> queryDivider = nullptr;
@@ -446,6 +480,152 @@ void DnCManager::initialDivide( SubQueries &subQueries )
         pow( 2, initialDivides ), queryId, 0, *split, initialTimeout, subQueries );
 }
 
+void DnCManager::chooseDivideStrategy()
+{
+    if ( _sncSplittingStrategy == SnCDivideStrategy::Auto )
+    {
+        DNC_MANAGER_LOG( Stringf( "Deciding splitting strategy automatically...\n" ).ascii() );
+        Query *processedQuery = _baseEngine->getQuery();
+        if ( processedQuery->getNumInputVariables() <
+                 GlobalConfiguration::INTERVAL_SPLITTING_THRESHOLD ||
+             processedQuery->getPiecewiseLinearConstraints().empty() )
+        {
+            DNC_MANAGER_LOG( Stringf( "\tUsing Largest Interval Heuristics\n" ).ascii() );
+            _sncSplittingStrategy = SnCDivideStrategy::LargestInterval;
+        }
+        else
+        {
+            DNC_MANAGER_LOG( Stringf( "\tUsing Polarity-based Heuristics\n" ).ascii() );
+            _sncSplittingStrategy = SnCDivideStrategy::Polarity;
+        }
+    }
+}
+
+void DnCManager::divideOnDisjuncts( SubQueries &subQueries )
+{
+    chooseDivideStrategy();
+
+    // Disjuncts that time out are divided further, like any other subquery
+    unsigned initialTimeout = Options::get()->getInt( Options::INITIAL_TIMEOUT );
+
+    unsigned disjunctIndex = 0;
+    for ( const auto &disjunct : _topLevelDisjuncts )
+    {
+        ++disjunctIndex;
+        auto split = std::unique_ptr<PiecewiseLinearCaseSplit>( new PiecewiseLinearCaseSplit() );
+        if ( !translateDisjunct( disjunct, *split ) )
+        {
+            DNC_MANAGER_LOG( Stringf( "Disjunct %u is infeasible", disjunctIndex ).ascii() );
+            continue;
+        }
+
+        SubQuery *subQuery = new SubQuery;
+        subQuery->_queryId = Stringf( "%u", disjunctIndex );
+        subQuery->_split = std::move( split );
+        subQuery->_timeoutInSeconds = initialTimeout;
+        subQuery->_depth = 0;
+        subQueries.append( subQuery );
+    }
+
+    DNC_MANAGER_LOG( Stringf( "Created %u subqueries from %u disjuncts",
+                              subQueries.size(),
+                              _topLevelDisjuncts.size() )
+                         .ascii() );
+}
+
+bool DnCManager::translateDisjunct( const PiecewiseLinearCaseSplit &disjunct,
+                                    PiecewiseLinearCaseSplit &split )
+{
+    Query *processedQuery = _baseEngine->getQuery();
+    const List<unsigned> inputVariables( processedQuery->getInputVariables() );
+
+    Map<unsigned, double> lowerBounds;
+    Map<unsigned, double> upperBounds;
+    for ( const auto &variable : inputVariables )
+    {
+        lowerBounds[variable] = processedQuery->getLowerBound( variable );
+        upperBounds[variable] = processedQuery->getUpperBound( variable );
+    }
+
+    List<Tightening> otherBounds;
+    for ( const auto &bound : disjunct.getBoundTightenings() )
+    {
+        unsigned variable = bound._variable;
+        double fixedValue;
+        if ( !getPreprocessedIndex( variable, fixedValue ) )
+        {
+            if ( ( bound._type == Tightening::LB && FloatUtils::lt( fixedValue, bound._value ) ) ||
+                 ( bound._type == Tightening::UB && FloatUtils::gt( fixedValue, bound._value ) ) )
+                return false;
+        }
+        else if ( !lowerBounds.exists( variable ) )
+            otherBounds.append( Tightening( variable, bound._value, bound._type ) );
+        else if ( bound._type == Tightening::LB )
+            lowerBounds[variable] = FloatUtils::max( lowerBounds[variable], bound._value );
+        else
+            upperBounds[variable] = FloatUtils::min( upperBounds[variable], bound._value );
+    }
+
+    for ( const auto &variable : inputVariables )
+    {
+        if ( FloatUtils::gt( lowerBounds[variable], upperBounds[variable] ) )
+            return false;
+        split.storeBoundTightening( Tightening( variable, lowerBounds[variable], Tightening::LB ) );
+        split.storeBoundTightening( Tightening( variable, upperBounds[variable], Tightening::UB ) );
+    }
+
+    for ( const auto &bound : otherBounds )
+        split.storeBoundTightening( bound );
+
+    for ( const auto &equation : disjunct.getEquations() )
+    {
+        Equation newEquation( equation._type );
+        double scalar = equation._scalar;
+        for ( const auto &addend : equation._addends )
+        {
+            unsigned variable = addend._variable;
+            double fixedValue;
+            if ( getPreprocessedIndex( variable, fixedValue ) )
+                newEquation.addAddend( addend._coefficient, variable );
+            else
+                scalar -= addend._coefficient * fixedValue;
+        }
+        newEquation.setScalar( scalar );
+
+        if ( !newEquation._addends.empty() )
+            split.addEquation( newEquation );
+        else if ( ( equation._type == Equation::EQ && !FloatUtils::isZero( scalar ) ) ||
+                  ( equation._type == Equation::LE && FloatUtils::isNegative( scalar ) ) ||
+                  ( equation._type == Equation::GE && FloatUtils::isPositive( scalar ) ) )
+            return false;
+    }
+
+    return true;
+}
+
+bool DnCManager::getPreprocessedIndex( unsigned &variable, double &fixedValue )
+{
+    Preprocessor *preprocessor = _baseEngine->getPreprocessor();
+
+    // Property variables are input and output variables, which the
+    // preprocessor never eliminates symbolically
+    if ( preprocessor->variableIsUnusedAndSymbolicallyFixed( variable ) )
+        throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                            Stringf( "Disjunct over eliminated variable %u", variable ).ascii() );
+
+    while ( preprocessor->variableIsMerged( variable ) )
+        variable = preprocessor->getMergedIndex( variable );
+
+    if ( preprocessor->variableIsFixed( variable ) )
+    {
+        fixedValue = preprocessor->getFixedValue( variable );
+        return false;
+    }
+
+    variable = preprocessor->getNewIndex( variable );
+    return true;
+}
+
 void DnCManager::updateTimeoutReached( timespec startTime,
                                        unsigned long long timeoutInMicroSeconds )
 {
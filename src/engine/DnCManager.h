@@ -18,9 +18,12 @@
 
 #include "Engine.h"
 #include "IQuery.h"
+#include "List.h"
+#include "PiecewiseLinearCaseSplit.h"
 #include "SnCDivideStrategy.h"
 #include "SubQuery.h"
 #include "Vector.h"
+#include "WorkStealingScheduler.h"
 
 #include <atomic>
 
@@ -48,6 +51,14 @@ public:
 
     void freeMemoryIfNeeded();
 
+    /*
+      Solve each of the given disjuncts (over the variables of the input
+      query) as a separate subquery, instead of dividing the input region.
+      The input query is then satisfiable iff it is satisfiable together
+      with one of the disjuncts.
+    */
+    void setTopLevelDisjuncts( const List<PiecewiseLinearCaseSplit> &disjuncts );
+
     /*
       Perform the Divide-and-conquer solving
     */
@@ -96,7 +107,8 @@ private:
                           bool restoreTreeStates,
                           unsigned verbosity,
                           unsigned seed,
-                          bool parallelDeepSoI );
+                          bool parallelDeepSoI,
+                          WorkStealingScheduler *scheduler );
 
     /*
       Create the base engine from the network and property files,
@@ -110,6 +122,32 @@ private:
     */
     void initialDivide( SubQueries &subQueries );
 
+    /*
+      Resolve the Auto divide strategy based on the preprocessed query
+    */
+    void chooseDivideStrategy();
+
+    /*
+      Create one subquery for each of the top-level disjuncts. Disjuncts
+      that are infeasible after preprocessing are dropped.
+    */
+    void divideOnDisjuncts( SubQueries &subQueries );
+
+    /*
+      Express a disjunct over the variables of the preprocessed query. The
+      split also bounds every input variable, as the query dividers expect.
+      Returns false if the disjunct is infeasible.
+    */
+    bool translateDisjunct( const PiecewiseLinearCaseSplit &disjunct,
+                            PiecewiseLinearCaseSplit &split );
+
+    /*
+      Map a variable of the input query to the preprocessed query. Returns
+      false if the preprocessor has fixed the variable, in which case its
+      value is stored in fixedValue.
+    */
+    bool getPreprocessedIndex( unsigned &variable, double &fixedValue );
+
     /*
       Read the exitCode of the engine of each thread, and update the manager's
       exitCode.
@@ -176,6 +214,17 @@ private:
       The strategy for dividing a query
     */
     SnCDivideStrategy _sncSplittingStrategy;
+
+    /*
+      True if the subqueries are scheduled on per-worker deques with
+      work stealing, instead of on a single shared queue
+    */
+    bool _workStealing;
+
+    /*
+      The disjuncts to solve as separate subqueries, if any
+    */
+    List<PiecewiseLinearCaseSplit> _topLevelDisjuncts;
 };
 
 #endif // __DnCManager_h__
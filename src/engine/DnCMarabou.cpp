@@ -17,10 +17,12 @@
 #include "DnCMarabou.h"
 
 #include "AcasParser.h"
+#include "DisjunctionConstraint.h"
 #include "DnCManager.h"
 #include "File.h"
 #include "MStringf.h"
 #include "MarabouError.h"
+#include "NetworkCache.h"
 #include "OnnxParser.h"
 #include "Options.h"
 #include "PropertyParser.h"
@@ -65,16 +67,27 @@ void DnCMarabou::run()
         }
         printf( "Network: %s\n", networkFilePath.ascii() );
 
-        if ( ( (String)networkFilePath ).endsWith( ".onnx" ) )
+        NetworkCache networkCache( Options::get()->getString( Options::NETWORK_CACHE_DIRECTORY ),
+                                   networkFilePath );
+        if ( networkCache.lookup( _inputQuery ) )
         {
-            InputQueryBuilder queryBuilder;
-            OnnxParser::parse( queryBuilder, networkFilePath, {}, {} );
-            queryBuilder.generateQuery( _inputQuery );
+            printf( "Network loaded from cache: %s\n", networkCache.getEntryPath().ascii() );
         }
         else
         {
-            AcasParser *_acasParser = new AcasParser( networkFilePath );
-            _acasParser->generateQuery( _inputQuery );
+            if ( ( (String)networkFilePath ).endsWith( ".onnx" ) )
+            {
+                InputQueryBuilder queryBuilder;
+                OnnxParser::parse( queryBuilder, networkFilePath, {}, {} );
+                queryBuilder.generateQuery( _inputQuery );
+            }
+            else
+            {
+                AcasParser *_acasParser = new AcasParser( networkFilePath );
+                _acasParser->generateQuery( _inputQuery );
+            }
+
+            networkCache.store( _inputQuery );
         }
 
         /*
@@ -86,7 +99,10 @@ void DnCMarabou::run()
             printf( "Property: %s\n", propertyFilePath.ascii() );
             if ( propertyFilePath.endsWith( ".vnnlib" ) )
             {
-                VnnLibParser().parse( propertyFilePath, _inputQuery );
+                if ( Options::get()->getBool( Options::SPLIT_TOP_LEVEL_DISJUNCTS ) )
+                    VnnLibParser().parse( propertyFilePath, _inputQuery, _topLevelDisjuncts );
+                else
+                    VnnLibParser().parse( propertyFilePath, _inputQuery );
             }
             else
             {
@@ -101,7 +117,15 @@ void DnCMarabou::run()
     String queryDumpFilePath = Options::get()->getString( Options::QUERY_DUMP_FILE );
     if ( queryDumpFilePath.length() > 0 )
     {
-        _inputQuery.saveQuery( queryDumpFilePath );
+        // The dumped query should still contain the whole property
+        if ( !_topLevelDisjuncts.empty() )
+            _inputQuery.addPiecewiseLinearConstraint(
+                new DisjunctionConstraint( _topLevelDisjuncts ) );
+
+        if ( Options::get()->getBool( Options::BINARY_QUERY_DUMP ) )
+            _inputQuery.saveQueryAsBinary( queryDumpFilePath );
+        else
+            _inputQuery.saveQuery( queryDumpFilePath );
         printf( "\nInput query successfully dumped to file\n" );
         exit( 0 );
     }
@@ -110,6 +134,12 @@ void DnCMarabou::run()
       Step 3: initialize the DNC core
     */
     _dncManager = std::unique_ptr<DnCManager>( new DnCManager( &_inputQuery ) );
+    if ( !_topLevelDisjuncts.empty() )
+    {
+        printf( "Solving the %u disjuncts of the property as separate subqueries\n\n",
+                _topLevelDisjuncts.size() );
+        _dncManager->setTopLevelDisjuncts( _topLevelDisjuncts );
+    }
 
     struct timespec start = TimeUtils::sampleMicro();
 
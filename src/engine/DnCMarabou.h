@@ -33,6 +33,13 @@ public:
 private:
     std::unique_ptr<DnCManager> _dncManager;
     InputQuery _inputQuery;
+
+    /*
+      The disjuncts of the top-level disjunction of the property, if it
+      is to be solved one disjunct per subquery
+    */
+    List<PiecewiseLinearCaseSplit> _topLevelDisjuncts;
+
     /*
       Display the results
     */
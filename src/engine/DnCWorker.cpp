@@ -41,9 +41,11 @@ DnCWorker::DnCWorker( WorkerQueue *workload,
                       float timeoutFactor,
                       SnCDivideStrategy divideStrategy,
                       unsigned verbosity,
-                      bool parallelDeepSoI )
+                      bool parallelDeepSoI,
+                      WorkStealingScheduler *scheduler )
     : _workload( workload )
     , _engine( engine )
+    , _scheduler( scheduler )
     , _numUnsolvedSubQueries( &numUnsolvedSubQueries )
     , _shouldQuitSolving( &shouldQuitSolving )
     , _threadId( threadId )
@@ -77,10 +79,7 @@ void DnCWorker::setQueryDivider( SnCDivideStrategy divideStrategy )
 void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
 {
     SubQuery *subQuery = NULL;
-    // Boost queue stores the next element into the passed-in pointer
-    // and returns true if the pop is successful (aka, the queue is not empty
-    // in most cases)
-    if ( _workload->pop( subQuery ) )
+    if ( popSubQuery( subQuery ) )
     {
         String queryId = subQuery->_queryId;
         unsigned depth = subQuery->_depth;
@@ -107,7 +106,13 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
         IEngine::ExitCode result = IEngine::NOT_DONE;
         if ( fullSolveNeeded )
         {
+            // While busy, idle workers may ask the engine to interrupt
+            // the search, which is then split below
+            if ( _scheduler )
+                _scheduler->setBusy( _threadId, true );
             _engine->solve( timeoutInSeconds );
+            if ( _scheduler )
+                _scheduler->setBusy( _threadId, false );
             result = _engine->getExitCode();
         }
         else
@@ -131,42 +136,18 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
         {
             // If TIMEOUT, split the current input region and add the
             // new subQueries to the current queue
-            SubQueries subQueries;
             unsigned newTimeout = ( depth >= GlobalConfiguration::DNC_DEPTH_THRESHOLD - 1
                                         ? 0
                                         : (unsigned)timeoutInSeconds * _timeoutFactor );
-            unsigned numNewSubQueries = pow( 2, _onlineDivides );
-            std::vector<std::unique_ptr<SmtState>> newSmtStates;
-            if ( restoreTreeStates )
-            {
-                // create |numNewSubQueries| copies of the current SmtState
-                for ( unsigned i = 0; i < numNewSubQueries; ++i )
-                {
-                    newSmtStates.push_back( std::unique_ptr<SmtState>( new SmtState() ) );
-                    _engine->storeSmtState( *( newSmtStates[i] ) );
-                }
-            }
-
-            _queryDivider->createSubQueries(
-                numNewSubQueries, queryId, depth, *split, newTimeout, subQueries );
-
-            unsigned i = 0;
-            for ( auto &newSubQuery : subQueries )
-            {
-                // Store the SmtCore state
-                if ( restoreTreeStates )
-                {
-                    newSubQuery->_smtState = std::move( newSmtStates[i++] );
-                }
-
-                if ( !_workload->push( std::move( newSubQuery ) ) )
-                {
-                    throw MarabouError( MarabouError::UNSUCCESSFUL_QUEUE_PUSH );
-                }
-
-                *_numUnsolvedSubQueries += 1;
-            }
-            *_numUnsolvedSubQueries -= 1;
+            divideSubQuery( queryId, *split, newTimeout, depth + 1, restoreTreeStates );
+            delete subQuery;
+        }
+        else if ( result == IEngine::SPLIT_REQUESTED )
+        {
+            // The search was interrupted for idle workers rather than
+            // timed out, so the new subQueries keep the time budget
+            // and the depth of the current one
+            divideSubQuery( queryId, *split, timeoutInSeconds, depth, restoreTreeStates );
             delete subQuery;
         }
         else if ( result == IEngine::QUIT_REQUESTED )
@@ -210,6 +191,75 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
     }
 }
 
+void DnCWorker::divideSubQuery( const String &queryId,
+                                const PiecewiseLinearCaseSplit &split,
+                                unsigned timeoutInSeconds,
+                                unsigned depth,
+                                bool restoreTreeStates )
+{
+    SubQueries subQueries;
+    unsigned numNewSubQueries = pow( 2, _onlineDivides );
+    std::vector<std::unique_ptr<SmtState>> newSmtStates;
+    if ( restoreTreeStates )
+    {
+        // create |numNewSubQueries| copies of the current SmtState
+        for ( unsigned i = 0; i < numNewSubQueries; ++i )
+        {
+            newSmtStates.push_back( std::unique_ptr<SmtState>( new SmtState() ) );
+            _engine->storeSmtState( *( newSmtStates[i] ) );
+        }
+    }
+
+    _queryDivider->createSubQueries(
+        numNewSubQueries, queryId, depth, split, timeoutInSeconds, subQueries );
+
+    unsigned i = 0;
+    for ( auto &newSubQuery : subQueries )
+    {
+        // The dividers place the new subQueries one level below the given
+        // depth, which is overridden here
+        newSubQuery->_depth = depth;
+
+        // Store the SmtCore state
+        if ( restoreTreeStates )
+        {
+            newSubQuery->_smtState = std::move( newSmtStates[i++] );
+        }
+
+        *_numUnsolvedSubQueries += 1;
+        pushSubQuery( std::move( newSubQuery ) );
+    }
+    *_numUnsolvedSubQueries -= 1;
+}
+
+bool DnCWorker::popSubQuery( SubQuery *&subQuery )
+{
+    if ( _scheduler )
+    {
+        subQuery = _scheduler->pop( _threadId );
+        return subQuery != NULL;
+    }
+
+    // Boost queue stores the next element into the passed-in pointer
+    // and returns true if the pop is successful (aka, the queue is not empty
+    // in most cases)
+    return _workload->pop( subQuery );
+}
+
+void DnCWorker::pushSubQuery( SubQuery *subQuery )
+{
+    if ( _scheduler )
+    {
+        _scheduler->push( _threadId, subQuery );
+        return;
+    }
+
+    if ( !_workload->push( subQuery ) )
+    {
+        throw MarabouError( MarabouError::UNSUCCESSFUL_QUEUE_PUSH );
+    }
+}
+
 void DnCWorker::printProgress( String queryId, IEngine::ExitCode result ) const
 {
     printf( "Worker %d: Query %s %s, %d tasks remaining\n",
@@ -233,6 +283,8 @@ String DnCWorker::exitCodeToString( IEngine::ExitCode result )
         return "TIMEOUT";
     case IEngine::QUIT_REQUESTED:
         return "QUIT_REQUESTED";
+    case IEngine::SPLIT_REQUESTED:
+        return "SPLIT_REQUESTED";
     default:
         ASSERT( false );
         return "UNKNOWN (this should never happen)";
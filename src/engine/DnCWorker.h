@@ -20,6 +20,7 @@
 #include "PiecewiseLinearCaseSplit.h"
 #include "QueryDivider.h"
 #include "SnCDivideStrategy.h"
+#include "WorkStealingScheduler.h"
 
 #include <atomic>
 
@@ -35,7 +36,8 @@ public:
                float timeoutFactor,
                SnCDivideStrategy divideStrategy,
                unsigned verbosity,
-               bool parallelDeepSoI );
+               bool parallelDeepSoI,
+               WorkStealingScheduler *scheduler = NULL );
 
     /*
       Pop one subQuery, solve it and handle the result
@@ -59,12 +61,35 @@ private:
     */
     void printProgress( String queryId, IEngine::ExitCode result ) const;
 
+    /*
+      Divide the subQuery with the given id and split, and push the new
+      subQueries, which get the given timeout and depth
+    */
+    void divideSubQuery( const String &queryId,
+                         const PiecewiseLinearCaseSplit &split,
+                         unsigned timeoutInSeconds,
+                         unsigned depth,
+                         bool restoreTreeStates );
+
+    /*
+      Pop a subQuery from, or push a subQuery into, the shared queue or
+      the work-stealing scheduler, whichever is in use
+    */
+    bool popSubQuery( SubQuery *&subQuery );
+    void pushSubQuery( SubQuery *subQuery );
+
     /*
       The queue of subqueries (shared across threads)
     */
     WorkerQueue *_workload;
     std::shared_ptr<IEngine> _engine;
 
+    /*
+      If not NULL, subqueries are obtained from per-worker deques
+      instead of from the shared queue
+    */
+    WorkStealingScheduler *_scheduler;
+
     /*
       The number of unsolved subqueries
     */
@@ -17,6 +17,8 @@
 #include "Engine.h"
 
 #include "AutoConstraintMatrixAnalyzer.h"
+#include "BinaryCertificateReader.h"
+#include "BinaryCertificateWriter.h"
 #include "Debug.h"
 #include "DisjunctionConstraint.h"
 #include "EngineState.h"
@@ -50,6 +52,7 @@ Engine::Engine()
     , _basisRestorationPerformed( Engine::NO_RESTORATION_PERFORMED )
     , _costFunctionManager( _tableau )
     , _quitRequested( false )
+    , _splitRequested( false )
     , _exitCode( Engine::NOT_DONE )
     , _numVisitedStatesAtPreviousRestoration( 0 )
     , _networkLevelReasoner( NULL )
@@ -59,11 +62,10 @@ Engine::Engine()
     , _symbolicBoundTighteningType( Options::get()->getSymbolicBoundTighteningType() )
     , _solveWithMILP( Options::get()->getBool( Options::SOLVE_WITH_MILP ) )
     , _lpSolverType( Options::get()->getLPSolverType() )
-    , _gurobi( nullptr )
+    , _solver( nullptr )
     , _milpEncoder( nullptr )
     , _soiManager( nullptr )
     , _simulationSize( Options::get()->getInt( Options::NUMBER_OF_SIMULATIONS ) )
-    , _isGurobyEnabled( Options::get()->gurobiEnabled() )
     , _performLpTighteningAfterSplit(
           Options::get()->getBool( Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT ) )
     , _milpSolverBoundTighteningType( Options::get()->getMILPSolverBoundTighteningType() )
@@ -210,11 +212,11 @@ bool Engine::solve( double timeoutInSeconds )
     else if ( _lpSolverType == LPSolverType::GUROBI )
     {
         ENGINE_LOG( "Encoding convex relaxation into Gurobi..." );
-        _gurobi = std::unique_ptr<GurobiWrapper>( new GurobiWrapper() );
-        _tableau->setGurobi( &( *_gurobi ) );
+        _solver = std::unique_ptr<ILPSolver>( MILPEncoder::createMILPSolver() );
+        _tableau->setILPSolver( &( *_solver ) );
         _milpEncoder = std::unique_ptr<MILPEncoder>( new MILPEncoder( *_tableau ) );
         _milpEncoder->setStatistics( &_statistics );
-        _milpEncoder->encodeQuery( *_gurobi, *_preprocessedQuery, true );
+        _milpEncoder->encodeQuery( *_solver, *_preprocessedQuery, true );
         ENGINE_LOG( "Encoding convex relaxation into Gurobi - done" );
     }
 
@@ -262,6 +264,17 @@ bool Engine::solve( double timeoutInSeconds )
             return false;
         }
 
+        if ( _splitRequested.exchange( false ) )
+        {
+            if ( _verbosity > 0 )
+                printf( "\n\nEngine: interrupting the search so that it can be split...\n\n" );
+
+            // The search is cut short before its time runs out, so that
+            // the sub-query can be divided among the idle workers
+            _exitCode = Engine::SPLIT_REQUESTED;
+            return false;
+        }
+
         try
         {
             DEBUG( _tableau->verifyInvariants() );
@@ -1053,29 +1066,49 @@ void Engine::storeEquationsInDegradationChecker()
     _degradationChecker.storeEquations( *_preprocessedQuery );
 }
 
-double *Engine::createConstraintMatrix()
+SparseUnsortedList **Engine::createConstraintMatrix()
 {
     const List<Equation> &equations( _preprocessedQuery->getEquations() );
     unsigned m = equations.size();
     unsigned n = _preprocessedQuery->getNumberOfVariables();
 
-    // Step 1: create a constraint matrix from the equations
-    double *constraintMatrix = new double[n * m];
+    // Step 1: create a sparse constraint matrix from the equations, row by row.
+    // Repeated addends of the same variable are accumulated.
+    SparseUnsortedList **constraintMatrix = new SparseUnsortedList *[m];
     if ( !constraintMatrix )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "Engine::constraintMatrix" );
-    std::fill_n( constraintMatrix, n * m, 0.0 );
+
+    Vector<double> row( n, 0 );
+    List<unsigned> rowVariables;
 
     unsigned equationIndex = 0;
     for ( const auto &equation : equations )
     {
         if ( equation._type != Equation::EQ )
         {
+            freeConstraintMatrix( constraintMatrix, equationIndex );
             _exitCode = Engine::ERROR;
             throw MarabouError( MarabouError::NON_EQUALITY_INPUT_EQUATION_DISCOVERED );
         }
 
+        rowVariables.clear();
         for ( const auto &addend : equation._addends )
-            constraintMatrix[equationIndex * n + addend._variable] = addend._coefficient;
+        {
+            if ( row[addend._variable] == 0 )
+                rowVariables.append( addend._variable );
+            row[addend._variable] += addend._coefficient;
+        }
+
+        constraintMatrix[equationIndex] = new SparseUnsortedList( n );
+        if ( !constraintMatrix[equationIndex] )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Engine::constraintMatrix[i]" );
+
+        for ( const auto &variable : rowVariables )
+        {
+            if ( !FloatUtils::isZero( row[variable] ) )
+                constraintMatrix[equationIndex]->append( variable, row[variable] );
+            row[variable] = 0;
+        }
 
         ++equationIndex;
     }
@@ -1083,7 +1116,15 @@ double *Engine::createConstraintMatrix()
     return constraintMatrix;
 }
 
-void Engine::removeRedundantEquations( const double *constraintMatrix )
+void Engine::freeConstraintMatrix( SparseUnsortedList **constraintMatrix, unsigned m )
+{
+    for ( unsigned i = 0; i < m; ++i )
+        delete constraintMatrix[i];
+
+    delete[] constraintMatrix;
+}
+
+void Engine::removeRedundantEquations( const SparseUnsortedList **constraintMatrix )
 {
     const List<Equation> &equations( _preprocessedQuery->getEquations() );
     unsigned m = equations.size();
@@ -1107,7 +1148,7 @@ void Engine::removeRedundantEquations( const double *constraintMatrix )
     }
 }
 
-void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
+void Engine::selectInitialVariablesForBasis( const SparseUnsortedList **constraintMatrix,
                                              List<unsigned> &initialBasis,
                                              List<unsigned> &basicRows )
 {
@@ -1141,24 +1182,36 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
     std::fill_n( nnzInRow, m, 0 );
     std::fill_n( nnzInColumn, n, 0 );
 
+    // The orderings map positions to rows and columns, and the inverse
+    // orderings map rows and columns back to their positions
     unsigned *columnOrdering = new unsigned[n];
     unsigned *rowOrdering = new unsigned[m];
+    unsigned *columnPosition = new unsigned[n];
+    unsigned *rowPosition = new unsigned[m];
 
     for ( unsigned i = 0; i < m; ++i )
+    {
         rowOrdering[i] = i;
+        rowPosition[i] = i;
+    }
 
     for ( unsigned i = 0; i < n; ++i )
+    {
         columnOrdering[i] = i;
+        columnPosition[i] = i;
+    }
 
-    // Initialize the counters
+    // Initialize the counters, and the rows in which each column has entries
+    Vector<List<unsigned>> rowsOfColumn( n );
     for ( unsigned i = 0; i < m; ++i )
     {
-        for ( unsigned j = 0; j < n; ++j )
+        for ( const auto &entry : *constraintMatrix[i] )
         {
-            if ( !FloatUtils::isZero( constraintMatrix[i * n + j] ) )
+            if ( !FloatUtils::isZero( entry._value ) )
             {
                 ++nnzInRow[i];
-                ++nnzInColumn[j];
+                ++nnzInColumn[entry._index];
+                rowsOfColumn[entry._index].append( i );
             }
         }
     }
@@ -1194,38 +1247,44 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
             rowOrdering[singletonRow] = rowOrdering[numTriangularRows];
             rowOrdering[numTriangularRows] = temp;
 
+            rowPosition[rowOrdering[singletonRow]] = singletonRow;
+            rowPosition[rowOrdering[numTriangularRows]] = numTriangularRows;
+
             temp = nnzInRow[numTriangularRows];
             nnzInRow[numTriangularRows] = nnzInRow[singletonRow];
             nnzInRow[singletonRow] = temp;
 
             // Find the non-zero entry in the row and swap it to the diagonal
             DEBUG( bool foundNonZero = false );
-            for ( unsigned i = numTriangularRows; i < n - numExcluded; ++i )
+            for ( const auto &entry : *constraintMatrix[rowOrdering[numTriangularRows]] )
             {
-                if ( !FloatUtils::isZero( constraintMatrix[rowOrdering[numTriangularRows] * n +
-                                                           columnOrdering[i]] ) )
-                {
-                    temp = columnOrdering[i];
-                    columnOrdering[i] = columnOrdering[numTriangularRows];
-                    columnOrdering[numTriangularRows] = temp;
+                unsigned i = columnPosition[entry._index];
+                if ( i < numTriangularRows || i >= n - numExcluded ||
+                     FloatUtils::isZero( entry._value ) )
+                    continue;
 
-                    temp = nnzInColumn[numTriangularRows];
-                    nnzInColumn[numTriangularRows] = nnzInColumn[i];
-                    nnzInColumn[i] = temp;
+                temp = columnOrdering[i];
+                columnOrdering[i] = columnOrdering[numTriangularRows];
+                columnOrdering[numTriangularRows] = temp;
 
-                    DEBUG( foundNonZero = true );
-                    break;
-                }
+                columnPosition[columnOrdering[i]] = i;
+                columnPosition[columnOrdering[numTriangularRows]] = numTriangularRows;
+
+                temp = nnzInColumn[numTriangularRows];
+                nnzInColumn[numTriangularRows] = nnzInColumn[i];
+                nnzInColumn[i] = temp;
+
+                DEBUG( foundNonZero = true );
+                break;
             }
 
             ASSERT( foundNonZero );
 
             // Remove all entries under the diagonal entry from the row counters
-            for ( unsigned i = numTriangularRows + 1; i < m; ++i )
+            for ( const auto &row : rowsOfColumn[columnOrdering[numTriangularRows]] )
             {
-                if ( !FloatUtils::isZero( constraintMatrix[rowOrdering[i] * n +
-                                                           columnOrdering[numTriangularRows]] ) )
-                    --nnzInRow[i];
+                if ( rowPosition[row] > numTriangularRows )
+                    --nnzInRow[rowPosition[row]];
             }
 
             ++numTriangularRows;
@@ -1246,18 +1305,22 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
             }
 
             // Update the row counters to account for the excluded column
-            for ( unsigned i = numTriangularRows; i < m; ++i )
+            for ( const auto &row : rowsOfColumn[columnOrdering[column]] )
             {
-                double element = constraintMatrix[rowOrdering[i] * n + columnOrdering[column]];
-                if ( !FloatUtils::isZero( element ) )
+                if ( rowPosition[row] >= numTriangularRows )
                 {
-                    ASSERT( nnzInRow[i] > 1 );
-                    --nnzInRow[i];
+                    ASSERT( nnzInRow[rowPosition[row]] > 1 );
+                    --nnzInRow[rowPosition[row]];
                 }
             }
 
-            columnOrdering[column] = columnOrdering[n - 1 - numExcluded];
-            nnzInColumn[column] = nnzInColumn[n - 1 - numExcluded];
+            unsigned last = n - 1 - numExcluded;
+            temp = columnOrdering[column];
+            columnOrdering[column] = columnOrdering[last];
+            columnOrdering[last] = temp;
+            columnPosition[columnOrdering[column]] = column;
+            columnPosition[columnOrdering[last]] = last;
+            nnzInColumn[column] = nnzInColumn[last];
             ++numExcluded;
         }
     }
@@ -1280,6 +1343,8 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
     delete[] nnzInColumn;
     delete[] columnOrdering;
     delete[] rowOrdering;
+    delete[] columnPosition;
+    delete[] rowPosition;
 }
 
 void Engine::addAuxiliaryVariables()
@@ -1322,7 +1387,8 @@ void Engine::augmentInitialBasisIfNeeded( List<unsigned> &initialBasis,
     }
 }
 
-void Engine::initializeTableau( const double *constraintMatrix, const List<unsigned> &initialBasis )
+void Engine::initializeTableau( const SparseUnsortedList **constraintMatrix,
+                                const List<unsigned> &initialBasis )
 {
     const List<Equation> &equations( _preprocessedQuery->getEquations() );
     unsigned m = equations.size();
@@ -1364,6 +1430,15 @@ void Engine::initializeBoundsAndConstraintWatchersInTableau( unsigned numberOfVa
         constraint->registerAsWatcher( _tableau );
         constraint->setStatistics( &_statistics );
 
+        // Constraints whose entire search state is context-dependent are
+        // backtracked together with the bounds, when the context is popped
+        if ( GlobalConfiguration::USE_CONTEXT_DEPENDENT_CONSTRAINT_STATES &&
+             constraint->searchStateIsContextDependent() && constraint->getContext() == nullptr )
+        {
+            ASSERT( _context.getLevel() == 0 );
+            constraint->initializeCDOs( &_context );
+        }
+
         // Assuming aux var is use, add the constraint's auxiliary variable assigned to it in the
         // tableau, to the constraint
         if ( _produceUNSATProofs )
@@ -1373,6 +1448,9 @@ void Engine::initializeBoundsAndConstraintWatchersInTableau( unsigned numberOfVa
                                                   var );
     }
 
+    _plConstraintChangeTracker.initialize( _plConstraints );
+    _tableau->registerToWatchAllVariables( &_plConstraintChangeTracker );
+
     _nlConstraints = _preprocessedQuery->getNonlinearConstraints();
     for ( const auto &constraint : _nlConstraints )
     {
@@ -1454,31 +1532,39 @@ bool Engine::processInputQuery( const IQuery &inputQuery, bool preprocess )
 
         if ( _lpSolverType == LPSolverType::NATIVE )
         {
-            double *constraintMatrix = createConstraintMatrix();
-            removeRedundantEquations( constraintMatrix );
+            unsigned m = _preprocessedQuery->getEquations().size();
+            SparseUnsortedList **constraintMatrix = createConstraintMatrix();
+            removeRedundantEquations(
+                const_cast<const SparseUnsortedList **>( constraintMatrix ) );
 
             // The equations have changed, recreate the constraint matrix
-            delete[] constraintMatrix;
+            freeConstraintMatrix( constraintMatrix, m );
+            m = _preprocessedQuery->getEquations().size();
             constraintMatrix = createConstraintMatrix();
 
             List<unsigned> initialBasis;
             List<unsigned> basicRows;
-            selectInitialVariablesForBasis( constraintMatrix, initialBasis, basicRows );
+            selectInitialVariablesForBasis(
+                const_cast<const SparseUnsortedList **>( constraintMatrix ),
+                initialBasis,
+                basicRows );
             addAuxiliaryVariables();
             augmentInitialBasisIfNeeded( initialBasis, basicRows );
 
             storeEquationsInDegradationChecker();
 
             // The equations have changed, recreate the constraint matrix
-            delete[] constraintMatrix;
+            freeConstraintMatrix( constraintMatrix, m );
+            m = _preprocessedQuery->getEquations().size();
             constraintMatrix = createConstraintMatrix();
 
             unsigned n = _preprocessedQuery->getNumberOfVariables();
             _boundManager.initialize( n );
 
-            initializeTableau( constraintMatrix, initialBasis );
+            initializeTableau( const_cast<const SparseUnsortedList **>( constraintMatrix ),
+                               initialBasis );
             _boundManager.initializeBoundExplainer( n, _tableau->getM() );
-            delete[] constraintMatrix;
+            freeConstraintMatrix( constraintMatrix, m );
 
             if ( _produceUNSATProofs )
             {
@@ -1569,7 +1655,8 @@ bool Engine::processInputQuery( const IQuery &inputQuery, bool preprocess )
 
 void Engine::performMILPSolverBoundedTightening( Query *inputQuery )
 {
-    if ( _networkLevelReasoner && Options::get()->gurobiEnabled() )
+    if ( _networkLevelReasoner &&
+         _milpSolverBoundTighteningType != MILPSolverBoundTighteningType::NONE )
     {
         // Obtain from and store bounds into inputquery if it is not null.
         if ( inputQuery )
@@ -1665,7 +1752,7 @@ void Engine::performMILPSolverBoundedTighteningForSingleLayer( unsigned targetIn
     if ( _produceUNSATProofs )
         return;
 
-    if ( _networkLevelReasoner && _isGurobyEnabled && _performLpTighteningAfterSplit &&
+    if ( _networkLevelReasoner && _performLpTighteningAfterSplit &&
          _milpSolverBoundTighteningType != MILPSolverBoundTighteningType::NONE )
     {
         _networkLevelReasoner->obtainCurrentBounds();
@@ -1757,8 +1844,8 @@ bool Engine::allVarsWithinBounds() const
 {
     if ( _lpSolverType == LPSolverType::GUROBI )
     {
-        ASSERT( _gurobi );
-        return _gurobi->haveFeasibleSolution();
+        ASSERT( _solver );
+        return _solver->haveFeasibleSolution();
     }
     else
         return !_tableau->existsBasicOutOfBounds();
@@ -1819,7 +1906,8 @@ void Engine::storeState( EngineState &state, TableauStateStorageLevel level ) co
     state._tableauStateStorageLevel = level;
 
     for ( const auto &constraint : _plConstraints )
-        state._plConstraintToState[constraint] = constraint->duplicateConstraint();
+        if ( !isBacktrackedByContext( constraint ) )
+            state._plConstraintToState[constraint] = constraint->duplicateConstraint();
 
     state._numPlConstraintsDisabledByValidSplits = _numPlConstraintsDisabledByValidSplits;
 }
@@ -1837,6 +1925,10 @@ void Engine::restoreState( const EngineState &state )
     ENGINE_LOG( "\tRestoring constraint states" );
     for ( auto &constraint : _plConstraints )
     {
+        // These constraints are restored when the context is popped
+        if ( isBacktrackedByContext( constraint ) )
+            continue;
+
         if ( !state._plConstraintToState.exists( constraint ) )
             throw MarabouError( MarabouError::MISSING_PL_CONSTRAINT_STATE );
 
@@ -1845,6 +1937,9 @@ void Engine::restoreState( const EngineState &state )
 
     _numPlConstraintsDisabledByValidSplits = state._numPlConstraintsDisabledByValidSplits;
 
+    // Constraints may have been re-activated
+    _plConstraintChangeTracker.markAllChanged();
+
     if ( _lpSolverType == LPSolverType::NATIVE )
     {
         // Make sure the data structures are initialized to the correct size
@@ -1858,6 +1953,11 @@ void Engine::restoreState( const EngineState &state )
     _smtCore.resetSplitConditions();
 }
 
+bool Engine::isBacktrackedByContext( const PiecewiseLinearConstraint *constraint ) const
+{
+    return constraint->getContext() == &_context && constraint->searchStateIsContextDependent();
+}
+
 void Engine::setNumPlConstraintsDisabledByValidSplits( unsigned numConstraints )
 {
     _numPlConstraintsDisabledByValidSplits = numConstraints;
@@ -2148,10 +2248,22 @@ bool Engine::applyAllValidConstraintCaseSplits()
 {
     struct timespec start = TimeUtils::sampleMicro();
 
+    // Bound changes are only reported through the tableau when it is
+    // used as the LP solver
+    if ( _lpSolverType != LPSolverType::NATIVE )
+        _plConstraintChangeTracker.markAllChanged();
+
+    // A constraint's phase can only become fixed once its bounds
+    // change, so only these constraints are checked. Applying a split
+    // may tighten bounds, and so more constraints may need checking.
     bool appliedSplit = false;
-    for ( auto &constraint : _plConstraints )
-        if ( applyValidConstraintCaseSplit( constraint ) )
-            appliedSplit = true;
+    while ( _plConstraintChangeTracker.hasChanges() )
+    {
+        _plConstraintChangeTracker.extractChangedConstraints( _plConstraintsToCheckForValidSplits );
+        for ( auto &constraint : _plConstraintsToCheckForValidSplits )
+            if ( applyValidConstraintCaseSplit( constraint ) )
+                appliedSplit = true;
+    }
 
     struct timespec end = TimeUtils::sampleMicro();
     _statistics.incLongAttribute( Statistics::TOTAL_TIME_PERFORMING_VALID_CASE_SPLITS_MICRO,
@@ -2382,6 +2494,11 @@ std::atomic_bool *Engine::getQuitRequested()
     return &_quitRequested;
 }
 
+std::atomic_bool *Engine::getSplitRequested()
+{
+    return &_splitRequested;
+}
+
 List<unsigned> Engine::getInputVariables() const
 {
     return _preprocessedQuery->getInputVariables();
@@ -2397,24 +2514,23 @@ void Engine::performSimulation()
         return;
     }
 
-    // outer vector is for neuron
-    // inner vector is for simulation value
-    Vector<Vector<double>> simulations;
+    // The simulations are stored row by row: the simulated values of
+    // each input neuron are consecutive
+    const NLR::Layer *inputLayer = _networkLevelReasoner->getLayer( 0 );
+    unsigned inputSize = inputLayer->getSize();
+    Vector<double> simulations( inputSize * _simulationSize );
 
     std::mt19937 mt( GlobalConfiguration::SIMULATION_RANDOM_SEED );
 
-    for ( unsigned i = 0; i < _networkLevelReasoner->getLayer( 0 )->getSize(); ++i )
+    for ( unsigned i = 0; i < inputSize; ++i )
     {
-        std::uniform_real_distribution<double> distribution(
-            _networkLevelReasoner->getLayer( 0 )->getLb( i ),
-            _networkLevelReasoner->getLayer( 0 )->getUb( i ) );
-        Vector<double> simulationInput( _simulationSize );
+        std::uniform_real_distribution<double> distribution( inputLayer->getLb( i ),
+                                                             inputLayer->getUb( i ) );
 
         for ( unsigned j = 0; j < _simulationSize; ++j )
-            simulationInput[j] = distribution( mt );
-        simulations.append( simulationInput );
+            simulations[i * _simulationSize + j] = distribution( mt );
     }
-    _networkLevelReasoner->simulate( &simulations );
+    _networkLevelReasoner->simulate( simulations.data(), _simulationSize );
 }
 
 unsigned Engine::performSymbolicBoundTightening( Query *inputQuery )
@@ -2530,6 +2646,7 @@ void Engine::postContextPopHook()
     if ( _produceUNSATProofs )
         _groundBoundManager.restoreLocalBounds();
     _tableau->postContextPopHook();
+    _plConstraintChangeTracker.markAllChanged();
 
     struct timespec end = TimeUtils::sampleMicro();
     _statistics.incLongAttribute( Statistics::TIME_CONTEXT_POP_HOOK,
@@ -2541,6 +2658,7 @@ void Engine::reset()
     resetStatistics();
     _sncMode = false;
     clearViolatedPLConstraints();
+    _plConstraintChangeTracker.markAllChanged();
     resetSmtCore();
     resetBoundTighteners();
     resetExitCode();
@@ -2981,6 +3099,7 @@ bool Engine::restoreSmtState( SmtState &smtState )
             _exitCode = Engine::UNSAT;
             for ( PiecewiseLinearConstraint *p : _plConstraints )
                 p->setActiveConstraint( true );
+            _plConstraintChangeTracker.markAllChanged();
             return false;
         }
     }
@@ -3015,21 +3134,21 @@ bool Engine::solveWithMILPEncoding( double timeoutInSeconds )
     }
 
     ENGINE_LOG( "Encoding the input query with Gurobi...\n" );
-    _gurobi = std::unique_ptr<GurobiWrapper>( new GurobiWrapper() );
-    _tableau->setGurobi( &( *_gurobi ) );
+    _solver = std::unique_ptr<ILPSolver>( MILPEncoder::createMILPSolver() );
+    _tableau->setILPSolver( &( *_solver ) );
     _milpEncoder = std::unique_ptr<MILPEncoder>( new MILPEncoder( *_tableau ) );
-    _milpEncoder->encodeQuery( *_gurobi, *_preprocessedQuery );
+    _milpEncoder->encodeQuery( *_solver, *_preprocessedQuery );
     ENGINE_LOG( "Query encoded in Gurobi...\n" );
 
     double timeoutForGurobi = ( timeoutInSeconds == 0 ? FloatUtils::infinity() : timeoutInSeconds );
     ENGINE_LOG( Stringf( "Gurobi timeout set to %f\n", timeoutForGurobi ).ascii() )
-    _gurobi->setTimeLimit( timeoutForGurobi );
+    _solver->setTimeLimit( timeoutForGurobi );
     if ( !_sncMode )
-        _gurobi->setNumberOfThreads( Options::get()->getInt( Options::NUM_WORKERS ) );
-    _gurobi->setVerbosity( _verbosity > 0 );
-    _gurobi->solve();
+        _solver->setNumberOfThreads( Options::get()->getInt( Options::NUM_WORKERS ) );
+    _solver->setVerbosity( _verbosity > 0 );
+    _solver->solve();
 
-    if ( _gurobi->haveFeasibleSolution() )
+    if ( _solver->haveFeasibleSolution() )
     {
         if ( allNonlinearConstraintsHold() )
         {
@@ -3042,9 +3161,9 @@ bool Engine::solveWithMILPEncoding( double timeoutInSeconds )
             return false;
         }
     }
-    else if ( _gurobi->infeasible() )
+    else if ( _solver->infeasible() )
         _exitCode = IEngine::UNSAT;
-    else if ( _gurobi->timeout() )
+    else if ( _solver->timeout() )
         _exitCode = IEngine::TIMEOUT;
     else
         throw NLRError( NLRError::UNEXPECTED_RETURN_STATUS_FROM_GUROBI );
@@ -3188,7 +3307,7 @@ void Engine::minimizeHeuristicCost( const LinearExpression &heuristicCost )
         minimizeCostWithGurobi( heuristicCost );
 
         ENGINE_LOG(
-            Stringf( "Current heuristic cost: %f", _gurobi->getOptimalCostOrObjective() ).ascii() );
+            Stringf( "Current heuristic cost: %f", _solver->getOptimalCostOrObjective() ).ascii() );
     }
     else
     {
@@ -3272,10 +3391,10 @@ void Engine::informLPSolverOfBounds()
         for ( unsigned i = 0; i < _preprocessedQuery->getNumberOfVariables(); ++i )
         {
             String variableName = _milpEncoder->getVariableNameFromVariable( i );
-            _gurobi->setLowerBound( variableName, _tableau->getLowerBound( i ) );
-            _gurobi->setUpperBound( variableName, _tableau->getUpperBound( i ) );
+            _solver->setLowerBound( variableName, _tableau->getLowerBound( i ) );
+            _solver->setUpperBound( variableName, _tableau->getUpperBound( i ) );
         }
-        _gurobi->updateModel();
+        _solver->updateModel();
         struct timespec end = TimeUtils::sampleMicro();
         _statistics.incLongAttribute( Statistics::TIME_ADDING_CONSTRAINTS_TO_MILP_SOLVER_MICRO,
                                       TimeUtils::timePassed( start, end ) );
@@ -3289,40 +3408,40 @@ void Engine::informLPSolverOfBounds()
 
 bool Engine::minimizeCostWithGurobi( const LinearExpression &costFunction )
 {
-    ASSERT( _gurobi && _milpEncoder );
+    ASSERT( _solver && _milpEncoder );
 
     struct timespec simplexStart = TimeUtils::sampleMicro();
 
-    _milpEncoder->encodeCostFunction( *_gurobi, costFunction );
-    _gurobi->setTimeLimit( FloatUtils::infinity() );
-    _gurobi->solve();
+    _milpEncoder->encodeCostFunction( *_solver, costFunction );
+    _solver->setTimeLimit( FloatUtils::infinity() );
+    _solver->solve();
 
     struct timespec simplexEnd = TimeUtils::sampleMicro();
 
     _statistics.incLongAttribute( Statistics::TIME_SIMPLEX_STEPS_MICRO,
                                   TimeUtils::timePassed( simplexStart, simplexEnd ) );
     _statistics.incLongAttribute( Statistics::NUM_SIMPLEX_STEPS,
-                                  _gurobi->getNumberOfSimplexIterations() );
+                                  _solver->getNumberOfSimplexIterations() );
 
-    if ( _gurobi->infeasible() )
+    if ( _solver->infeasible() )
         throw InfeasibleQueryException();
-    else if ( _gurobi->optimal() )
+    else if ( _solver->optimal() )
         return true;
     else
         throw CommonError( CommonError::UNEXPECTED_GUROBI_STATUS,
-                           Stringf( "Current status: %u", _gurobi->getStatusCode() ).ascii() );
+                           Stringf( "Current status: %u", _solver->getStatusCode() ).ascii() );
 
     return false;
 }
 
 void Engine::checkGurobiBoundConsistency() const
 {
-    if ( _gurobi && _milpEncoder )
+    if ( _solver && _milpEncoder )
     {
         for ( unsigned i = 0; i < _preprocessedQuery->getNumberOfVariables(); ++i )
         {
             String iName = _milpEncoder->getVariableNameFromVariable( i );
-            double gurobiLowerBound = _gurobi->getLowerBound( iName );
+            double gurobiLowerBound = _solver->getLowerBound( iName );
             double lowerBound = _tableau->getLowerBound( i );
             if ( !FloatUtils::areEqual( gurobiLowerBound, lowerBound ) )
             {
@@ -3334,7 +3453,7 @@ void Engine::checkGurobiBoundConsistency() const
                                              lowerBound )
                                         .ascii() );
             }
-            double gurobiUpperBound = _gurobi->getUpperBound( iName );
+            double gurobiUpperBound = _solver->getUpperBound( iName );
             double upperBound = _tableau->getUpperBound( i );
 
             if ( !FloatUtils::areEqual( gurobiUpperBound, upperBound ) )
@@ -3717,13 +3836,45 @@ bool Engine::certifyUNSATCertificate()
                                       file );
     }
 
-    Checker unsatCertificateChecker( _UNSATCertificate,
-                                     _tableau->getM(),
-                                     _tableau->getSparseA(),
-                                     groundUpperBounds,
-                                     groundLowerBounds,
-                                     _plConstraints );
-    bool certificationSucceeded = unsatCertificateChecker.check();
+    if ( GlobalConfiguration::WRITE_BINARY_PROOF )
+    {
+        File file( BinaryCertificateWriter::PROOF_FILENAME );
+        BinaryCertificateWriter::writeProof( _UNSATCertificate,
+                                             _tableau->getM(),
+                                             _tableau->getSparseA(),
+                                             groundUpperBounds,
+                                             groundLowerBounds,
+                                             _plConstraints,
+                                             file );
+    }
+
+    bool certificationSucceeded;
+    if ( GlobalConfiguration::WRITE_BINARY_PROOF )
+    {
+        // Check the certificate as it was written to the file, rather than
+        // the one in memory, so that the file is known to be a valid proof
+        BinaryCertificateReader reader( BinaryCertificateWriter::PROOF_FILENAME );
+        reader.read();
+
+        Checker unsatCertificateChecker( reader.getRoot(),
+                                         reader.getExplanationSize(),
+                                         reader.getInitialTableau(),
+                                         reader.getUpperBounds(),
+                                         reader.getLowerBounds(),
+                                         _plConstraints );
+        certificationSucceeded =
+            reader.matchesConstraints( _plConstraints ) && unsatCertificateChecker.check();
+    }
+    else
+    {
+        Checker unsatCertificateChecker( _UNSATCertificate,
+                                         _tableau->getM(),
+                                         _tableau->getSparseA(),
+                                         groundUpperBounds,
+                                         groundLowerBounds,
+                                         _plConstraints );
+        certificationSucceeded = unsatCertificateChecker.check();
+    }
 
     _statistics.setLongAttribute(
         Statistics::TOTAL_CERTIFICATION_TIME,
@@ -27,8 +27,8 @@
 #include "DegradationChecker.h"
 #include "DivideStrategy.h"
 #include "GlobalConfiguration.h"
-#include "GurobiWrapper.h"
 #include "IEngine.h"
+#include "ILPSolver.h"
 #include "IQuery.h"
 #include "JsonWriter.h"
 #include "LPSolverType.h"
@@ -36,6 +36,7 @@
 #include "MILPEncoder.h"
 #include "Map.h"
 #include "Options.h"
+#include "PLConstraintChangeTracker.h"
 #include "PrecisionRestorer.h"
 #include "Preprocessor.h"
 #include "Query.h"
@@ -156,6 +157,12 @@ public:
     */
     std::atomic_bool *getQuitRequested();
 
+    /*
+      Get the splitRequested flag. Raising it interrupts the current
+      search, which then terminates with a SPLIT_REQUESTED exit code.
+    */
+    std::atomic_bool *getSplitRequested();
+
     /*
       Get the list of input variables
     */
@@ -363,6 +370,13 @@ private:
     */
     List<PiecewiseLinearConstraint *> _violatedPlConstraints;
 
+    /*
+      Tracks the piecewise linear constraints whose variables' bounds
+      changed, and which may therefore have become valid case splits.
+    */
+    PLConstraintChangeTracker _plConstraintChangeTracker;
+    Vector<PiecewiseLinearConstraint *> _plConstraintsToCheckForValidSplits;
+
     /*
       A single, violated PL constraint, selected for fixing.
     */
@@ -442,6 +456,12 @@ private:
     */
     std::atomic_bool _quitRequested;
 
+    /*
+      Indicates a DnCManager request to interrupt the search, so that
+      the current sub-query can be split
+    */
+    std::atomic_bool _splitRequested;
+
     /*
       A code indicating how the run terminated.
     */
@@ -500,9 +520,10 @@ private:
     LPSolverType _lpSolverType;
 
     /*
-      GurobiWrapper object
+      The MILP solver: a GurobiWrapper if Gurobi is available, and a
+      NativeMILPSolver otherwise
     */
-    std::unique_ptr<GurobiWrapper> _gurobi;
+    std::unique_ptr<ILPSolver> _solver;
 
     /*
       MILPEncoder
@@ -520,7 +541,6 @@ private:
       there is a chance that multiple Engine object be accessing the Options object.
     */
     unsigned _simulationSize;
-    bool _isGurobyEnabled;
     bool _performLpTighteningAfterSplit;
     MILPSolverBoundTighteningType _milpSolverBoundTighteningType;
 
@@ -608,6 +628,12 @@ private:
 
     bool applyValidConstraintCaseSplit( PiecewiseLinearConstraint *constraint );
 
+    /*
+      Return true if the state of the constraint is restored by popping
+      the context, so that storeState() does not need to copy it.
+    */
+    bool isBacktrackedByContext( const PiecewiseLinearConstraint *constraint ) const;
+
     /*
       Update statitstics, print them if needed.
     */
@@ -720,14 +746,22 @@ private:
     void invokePreprocessor( const IQuery &inputQuery, bool preprocess );
     void printInputBounds( const IQuery &inputQuery ) const;
     void storeEquationsInDegradationChecker();
-    void removeRedundantEquations( const double *constraintMatrix );
-    void selectInitialVariablesForBasis( const double *constraintMatrix,
+    void removeRedundantEquations( const SparseUnsortedList **constraintMatrix );
+    void selectInitialVariablesForBasis( const SparseUnsortedList **constraintMatrix,
                                          List<unsigned> &initialBasis,
                                          List<unsigned> &basicRows );
-    void initializeTableau( const double *constraintMatrix, const List<unsigned> &initialBasis );
+    void initializeTableau( const SparseUnsortedList **constraintMatrix,
+                            const List<unsigned> &initialBasis );
     void initializeBoundsAndConstraintWatchersInTableau( unsigned numberOfVariables );
     void initializeNetworkLevelReasoning();
-    double *createConstraintMatrix();
+
+    /*
+      The constraint matrix is created row by row from the equations, and
+      is stored sparsely, so that its size is proportional to the number
+      of non-zero coefficients
+    */
+    SparseUnsortedList **createConstraintMatrix();
+    static void freeConstraintMatrix( SparseUnsortedList **constraintMatrix, unsigned m );
     void addAuxiliaryVariables();
     void augmentInitialBasisIfNeeded( List<unsigned> &initialBasis,
                                       const List<unsigned> &basicRows );
@@ -810,7 +844,7 @@ private:
     /*
       Minimize the given cost function with Gurobi. Return true if
       the cost function is minimized. Throw InfeasibleQueryException if
-      the constraints in _gurobi are infeasible. Throw an error otherwise.
+      the constraints in _solver are infeasible. Throw an error otherwise.
     */
     bool minimizeCostWithGurobi( const LinearExpression &costFunction );
 
@@ -50,6 +50,7 @@ public:
         UNKNOWN = 3,
         TIMEOUT = 4,
         QUIT_REQUESTED = 5,
+        SPLIT_REQUESTED = 6,
 
         NOT_DONE = 999,
     };
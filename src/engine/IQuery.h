@@ -75,6 +75,12 @@ public:
     */
     virtual void saveQuery( const String &fileName ) = 0;
 
+    /*
+      Serializes the query to a file in binary form, which QueryLoader
+      can load without parsing.
+    */
+    virtual void saveQueryAsBinary( const String &fileName ) const = 0;
+
     /*
       Generate a non-context-dependent version of the Query
     */
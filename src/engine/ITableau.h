@@ -24,9 +24,9 @@
 
 class EntrySelectionStrategy;
 class Equation;
-class GurobiWrapper;
 class IBoundManager;
 class ICostFunctionManager;
+class ILPSolver;
 class PiecewiseLinearCaseSplit;
 class SparseMatrix;
 class SparseUnsortedList;
@@ -74,6 +74,23 @@ public:
         virtual void notifyUpperBound( unsigned /* variable */, double /* bound */ )
         {
         }
+
+        /*
+          The batched form of the callbacks above: invoked once per
+          propagation round, with all of that round's bound changes to
+          the variables being watched. By default, the changes are
+          forwarded one at a time.
+        */
+        virtual void notifyBounds( const Tightening *tightenings, unsigned count )
+        {
+            for ( unsigned i = 0; i < count; ++i )
+            {
+                if ( tightenings[i]._type == Tightening::LB )
+                    notifyLowerBound( tightenings[i]._variable, tightenings[i]._value );
+                else
+                    notifyUpperBound( tightenings[i]._variable, tightenings[i]._value );
+            }
+        }
     };
 
     class ResizeWatcher
@@ -100,6 +117,7 @@ public:
 
     virtual void setDimensions( unsigned m, unsigned n ) = 0;
     virtual void setConstraintMatrix( const double *A ) = 0;
+    virtual void setConstraintMatrix( const SparseUnsortedList **A ) = 0;
     virtual void setRightHandSide( const double *b ) = 0;
     virtual void setRightHandSide( unsigned index, double value ) = 0;
     virtual void markAsBasic( unsigned variable ) = 0;
@@ -116,6 +134,7 @@ public:
     virtual void tightenUpperBound( unsigned variable, double value ) = 0;
     virtual void notifyLowerBound( unsigned variable, double bound ) = 0;
     virtual void notifyUpperBound( unsigned variable, double bound ) = 0;
+    virtual void notifyBounds( const Vector<Tightening> &tightenings ) = 0;
     virtual void updateVariablesToComplyWithBounds() = 0;
     virtual void updateVariableToComplyWithLowerBoundUpdate( unsigned variable, double value ) = 0;
     virtual void updateVariableToComplyWithUpperBoundUpdate( unsigned variable, double value ) = 0;
@@ -163,7 +182,7 @@ public:
     virtual unsigned getM() const = 0;
     virtual unsigned getN() const = 0;
     virtual void getTableauRow( unsigned index, TableauRow *row ) = 0;
-    virtual const double *getAColumn( unsigned variable ) const = 0;
+    virtual void getAColumn( unsigned variable, double *result ) const = 0;
     virtual void getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const = 0;
     virtual void getSparseARow( unsigned row, SparseUnsortedList *result ) const = 0;
     virtual const SparseUnsortedList *getSparseAColumn( unsigned variable ) const = 0;
@@ -172,7 +191,7 @@ public:
     virtual void performDegeneratePivot() = 0;
     virtual void storeState( TableauState &state, TableauStateStorageLevel level ) const = 0;
     virtual void restoreState( const TableauState &state, TableauStateStorageLevel level ) = 0;
-    virtual void setGurobi( GurobiWrapper *gurobi ) = 0;
+    virtual void setILPSolver( ILPSolver *solver ) = 0;
     virtual void setStatistics( Statistics *statistics ) = 0;
     virtual const double *getRightHandSide() const = 0;
     virtual void forwardTransformation( const double *y, double *x ) const = 0;
@@ -339,6 +339,13 @@ void InputQuery::saveQuery( const String &fileName )
     delete query;
 }
 
+void InputQuery::saveQueryAsBinary( const String &fileName ) const
+{
+    Query *query = generateQuery();
+    query->saveQueryAsBinary( fileName );
+    delete query;
+}
+
 void InputQuery::saveQueryAsSmtLib( const String &fileName ) const
 {
     Query *query = generateQuery();
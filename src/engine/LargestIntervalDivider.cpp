@@ -36,12 +36,18 @@ void LargestIntervalDivider::createSubQueries( unsigned numNewSubqueries,
 
     List<InputRegion> inputRegions;
 
-    // Create the first input region from the previous case split
+    // Create the first input region from the previous case split. Bounds on
+    // other variables (e.g., from a property disjunct) are passed on as-is.
     InputRegion region;
+    List<Tightening> otherBounds;
     List<Tightening> bounds = previousSplit.getBoundTightenings();
     for ( const auto &bound : bounds )
     {
-        if ( bound._type == Tightening::LB )
+        if ( !_inputVariables.exists( bound._variable ) )
+        {
+            otherBounds.append( bound );
+        }
+        else if ( bound._type == Tightening::LB )
         {
             region._lowerBounds[bound._variable] = bound._value;
         }
@@ -87,6 +93,11 @@ void LargestIntervalDivider::createSubQueries( unsigned numNewSubqueries,
             split->storeBoundTightening( Tightening( variable, ub, Tightening::UB ) );
         }
 
+        for ( const auto &bound : otherBounds )
+            split->storeBoundTightening( bound );
+        for ( const auto &equation : previousSplit.getEquations() )
+            split->addEquation( equation );
+
         // Construct the new subquery and add it to subqueries
         SubQuery *subQuery = new SubQuery;
         subQuery->_queryId = queryId;
@@ -177,126 +177,168 @@ void LeakyReluConstraint::notifyLowerBound( unsigned variable, double bound )
     setLowerBound( variable, bound );
 
     if ( isActive() && _boundManager && !phaseFixed() )
+        propagateLowerBound( variable, bound );
+
+    checkIfLowerBoundUpdateFixesPhase( variable, bound );
+}
+
+void LeakyReluConstraint::notifyUpperBound( unsigned variable, double bound )
+{
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS );
+
+    if ( _boundManager == nullptr && existsUpperBound( variable ) &&
+         !FloatUtils::lt( bound, getUpperBound( variable ) ) )
+        return;
+
+    setUpperBound( variable, bound );
+
+    if ( isActive() && _boundManager && !phaseFixed() )
+        propagateUpperBound( variable, bound );
+
+    checkIfUpperBoundUpdateFixesPhase( variable, bound );
+}
+
+void LeakyReluConstraint::notifyBounds( const Tightening *tightenings, unsigned count )
+{
+    // Proof explanations depend on the phase at the time each bound is
+    // learned, so with proofs the changes are handled one at a time
+    if ( _boundManager == nullptr || _boundManager->shouldProduceProofs() )
     {
-        bool proofs = _boundManager->shouldProduceProofs();
+        PiecewiseLinearConstraint::notifyBounds( tightenings, count );
+        return;
+    }
 
-        if ( proofs )
-        {
-            createActiveTighteningRow();
-            createInactiveTighteningRow();
-        }
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS,
+                                       count );
 
-        // A positive lower bound is always propagated between f and b
-        if ( variable == _f || variable == _b )
+    if ( isActive() && !phaseFixed() )
+    {
+        for ( unsigned i = 0; i < count; ++i )
         {
-            if ( FloatUtils::gte( bound, 0 ) )
-            {
-                // If we're in the active phase, activeAux should be 0
-                if ( proofs )
-                    _boundManager->addLemmaExplanationAndTightenBound(
-                        _activeAux, 0, Tightening::UB, { variable }, Tightening::LB, getType() );
-                else if ( !proofs && _auxVarsInUse )
-                    _boundManager->tightenUpperBound( _activeAux, 0 );
-
-                // After updating to active phase
-                unsigned partner = ( variable == _f ) ? _b : _f;
-                _boundManager->tightenLowerBound( partner, bound, *_activeTighteningRow );
-            }
-            else if ( variable == _b && FloatUtils::isNegative( bound ) )
-            {
-                _boundManager->tightenLowerBound( _f, _slope * bound, *_inactiveTighteningRow );
-            }
-            else if ( variable == _f && FloatUtils::isNegative( bound ) )
-            {
-                if ( proofs )
-                    _boundManager->addLemmaExplanationAndTightenBound(
-                        _b, bound / _slope, Tightening::LB, { _f }, Tightening::LB, getType() );
-                else
-                    _boundManager->tightenLowerBound( _b, bound / _slope, *_inactiveTighteningRow );
-            }
+            unsigned variable = tightenings[i]._variable;
+            if ( tightenings[i]._type == Tightening::LB )
+                propagateLowerBound( variable, getLowerBound( variable ) );
+            else
+                propagateUpperBound( variable, getUpperBound( variable ) );
         }
+    }
+
+    for ( unsigned i = 0; i < count; ++i )
+    {
+        unsigned variable = tightenings[i]._variable;
+        if ( tightenings[i]._type == Tightening::LB )
+            checkIfLowerBoundUpdateFixesPhase( variable, getLowerBound( variable ) );
+        else
+            checkIfUpperBoundUpdateFixesPhase( variable, getUpperBound( variable ) );
+    }
+}
 
-        // A positive lower bound for activeAux means we're inactive: _inactiveAux <= 0
-        else if ( _auxVarsInUse && variable == _activeAux && bound > 0 )
+void LeakyReluConstraint::propagateLowerBound( unsigned variable, double bound )
+{
+    bool proofs = _boundManager->shouldProduceProofs();
+
+    if ( proofs )
+    {
+        createActiveTighteningRow();
+        createInactiveTighteningRow();
+    }
+
+    // A positive lower bound is always propagated between f and b
+    if ( variable == _f || variable == _b )
+    {
+        if ( FloatUtils::gte( bound, 0 ) )
         {
-            // Inactive phase
+            // If we're in the active phase, activeAux should be 0
             if ( proofs )
                 _boundManager->addLemmaExplanationAndTightenBound(
-                    _inactiveAux, 0, Tightening::UB, { _activeAux }, Tightening::LB, getType() );
-            else
-                _boundManager->tightenUpperBound( _inactiveAux, 0 );
-        }
+                    _activeAux, 0, Tightening::UB, { variable }, Tightening::LB, getType() );
+            else if ( !proofs && _auxVarsInUse )
+                _boundManager->tightenUpperBound( _activeAux, 0 );
 
-        // A positive lower bound for inactiveAux means we're active: _activeAux <= 0
-        else if ( _auxVarsInUse && variable == _inactiveAux && bound > 0 )
+            // After updating to active phase
+            unsigned partner = ( variable == _f ) ? _b : _f;
+            _boundManager->tightenLowerBound( partner, bound, *_activeTighteningRow );
+        }
+        else if ( variable == _b && FloatUtils::isNegative( bound ) )
+        {
+            _boundManager->tightenLowerBound( _f, _slope * bound, *_inactiveTighteningRow );
+        }
+        else if ( variable == _f && FloatUtils::isNegative( bound ) )
         {
-            // Active phase
             if ( proofs )
                 _boundManager->addLemmaExplanationAndTightenBound(
-                    _activeAux, 0, Tightening::UB, { _inactiveAux }, Tightening::LB, getType() );
+                    _b, bound / _slope, Tightening::LB, { _f }, Tightening::LB, getType() );
             else
-                _boundManager->tightenUpperBound( _activeAux, 0 );
+                _boundManager->tightenLowerBound( _b, bound / _slope, *_inactiveTighteningRow );
         }
     }
 
-    checkIfLowerBoundUpdateFixesPhase( variable, bound );
+    // A positive lower bound for activeAux means we're inactive: _inactiveAux <= 0
+    else if ( _auxVarsInUse && variable == _activeAux && bound > 0 )
+    {
+        // Inactive phase
+        if ( proofs )
+            _boundManager->addLemmaExplanationAndTightenBound(
+                _inactiveAux, 0, Tightening::UB, { _activeAux }, Tightening::LB, getType() );
+        else
+            _boundManager->tightenUpperBound( _inactiveAux, 0 );
+    }
+
+    // A positive lower bound for inactiveAux means we're active: _activeAux <= 0
+    else if ( _auxVarsInUse && variable == _inactiveAux && bound > 0 )
+    {
+        // Active phase
+        if ( proofs )
+            _boundManager->addLemmaExplanationAndTightenBound(
+                _activeAux, 0, Tightening::UB, { _inactiveAux }, Tightening::LB, getType() );
+        else
+            _boundManager->tightenUpperBound( _activeAux, 0 );
+    }
 }
 
-void LeakyReluConstraint::notifyUpperBound( unsigned variable, double bound )
+void LeakyReluConstraint::propagateUpperBound( unsigned variable, double bound )
 {
-    if ( _statistics )
-        _statistics->incLongAttribute( Statistics::NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS );
-
-    if ( _boundManager == nullptr && existsUpperBound( variable ) &&
-         !FloatUtils::lt( bound, getUpperBound( variable ) ) )
-        return;
+    bool proofs = _boundManager->shouldProduceProofs();
 
-    setUpperBound( variable, bound );
-
-    if ( isActive() && _boundManager && !phaseFixed() )
+    if ( proofs )
     {
-        bool proofs = _boundManager->shouldProduceProofs();
+        createActiveTighteningRow();
+        createInactiveTighteningRow();
+    }
 
-        if ( proofs )
+    // A positive upper bound is always propagated between f and b
+    if ( variable == _f || variable == _b )
+    {
+        if ( !FloatUtils::isNegative( bound ) )
         {
-            createActiveTighteningRow();
-            createInactiveTighteningRow();
+            unsigned partner = ( variable == _f ) ? _b : _f;
+            if ( proofs )
+                _boundManager->addLemmaExplanationAndTightenBound(
+                    partner, bound, Tightening::UB, { variable }, Tightening::UB, getType() );
+            else
+                _boundManager->tightenUpperBound( partner, bound );
         }
-
-        // A positive upper bound is always propagated between f and b
-        if ( variable == _f || variable == _b )
+        else if ( variable == _b )
         {
-            if ( !FloatUtils::isNegative( bound ) )
-            {
-                unsigned partner = ( variable == _f ) ? _b : _f;
-                if ( proofs )
-                    _boundManager->addLemmaExplanationAndTightenBound(
-                        partner, bound, Tightening::UB, { variable }, Tightening::UB, getType() );
-                else
-                    _boundManager->tightenUpperBound( partner, bound );
-            }
-            else if ( variable == _b )
-            {
-                // A negative upper bound of b implies inactive phase
-                if ( proofs && _auxVarsInUse )
-                    _boundManager->addLemmaExplanationAndTightenBound(
-                        _inactiveAux, 0, Tightening::UB, { _b }, Tightening::UB, getType() );
+            // A negative upper bound of b implies inactive phase
+            if ( proofs && _auxVarsInUse )
+                _boundManager->addLemmaExplanationAndTightenBound(
+                    _inactiveAux, 0, Tightening::UB, { _b }, Tightening::UB, getType() );
 
-                _boundManager->tightenUpperBound( _f, _slope * bound, *_inactiveTighteningRow );
-            }
-            else if ( variable == _f )
-            {
-                // A negative upper bound of f implies inactive phase as well
-                if ( proofs && _auxVarsInUse )
-                    _boundManager->addLemmaExplanationAndTightenBound(
-                        _inactiveAux, 0, Tightening::UB, { _f }, Tightening::UB, getType() );
+            _boundManager->tightenUpperBound( _f, _slope * bound, *_inactiveTighteningRow );
+        }
+        else if ( variable == _f )
+        {
+            // A negative upper bound of f implies inactive phase as well
+            if ( proofs && _auxVarsInUse )
+                _boundManager->addLemmaExplanationAndTightenBound(
+                    _inactiveAux, 0, Tightening::UB, { _f }, Tightening::UB, getType() );
 
-                _boundManager->tightenUpperBound( _b, bound / _slope, *_inactiveTighteningRow );
-            }
+            _boundManager->tightenUpperBound( _b, bound / _slope, *_inactiveTighteningRow );
         }
     }
-
-    checkIfUpperBoundUpdateFixesPhase( variable, bound );
 }
 
 bool LeakyReluConstraint::participatingVariable( unsigned variable ) const
@@ -403,7 +445,7 @@ List<PiecewiseLinearConstraint::Fix> LeakyReluConstraint::getSmartFixes( ITablea
 
 List<PiecewiseLinearCaseSplit> LeakyReluConstraint::getCaseSplits() const
 {
-    if ( _phaseStatus != PHASE_NOT_FIXED )
+    if ( getPhaseStatus() != PHASE_NOT_FIXED )
         throw MarabouError( MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
 
     List<PiecewiseLinearCaseSplit> splits;
@@ -525,14 +567,14 @@ PiecewiseLinearCaseSplit LeakyReluConstraint::getActiveSplit() const
 
 bool LeakyReluConstraint::phaseFixed() const
 {
-    return _phaseStatus != PHASE_NOT_FIXED;
+    return getPhaseStatus() != PHASE_NOT_FIXED;
 }
 
 PiecewiseLinearCaseSplit LeakyReluConstraint::getImpliedCaseSplit() const
 {
-    ASSERT( _phaseStatus != PHASE_NOT_FIXED );
+    ASSERT( getPhaseStatus() != PHASE_NOT_FIXED );
 
-    if ( _phaseStatus == RELU_PHASE_ACTIVE )
+    if ( getPhaseStatus() == RELU_PHASE_ACTIVE )
         return getActiveSplit();
 
     return getInactiveSplit();
@@ -550,9 +592,9 @@ void LeakyReluConstraint::dump( String &output ) const
                       _f,
                       _b,
                       _slope,
-                      _constraintActive ? "Yes" : "No",
-                      _phaseStatus,
-                      phaseToString( _phaseStatus ).ascii() );
+                      isActive() ? "Yes" : "No",
+                      getPhaseStatus(),
+                      phaseToString( getPhaseStatus() ).ascii() );
 
     output +=
         Stringf( "b in [%s, %s], ",
@@ -625,18 +667,18 @@ void LeakyReluConstraint::eliminateVariable( __attribute__( ( unused ) ) unsigne
         {
             if ( FloatUtils::gt( fixedValue, 0 ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_INACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_INACTIVE );
             }
             else if ( FloatUtils::lt( fixedValue, 0 ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_ACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_ACTIVE );
             }
         }
         else if ( variable == _activeAux )
         {
             if ( FloatUtils::isPositive( fixedValue ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_ACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_ACTIVE );
             }
         }
         else
@@ -644,7 +686,7 @@ void LeakyReluConstraint::eliminateVariable( __attribute__( ( unused ) ) unsigne
             // This is the inactive aux variable
             if ( FloatUtils::isPositive( fixedValue ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_INACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_INACTIVE );
             }
         }
     } );
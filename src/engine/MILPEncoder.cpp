@@ -19,6 +19,8 @@
 #include "DeepPolySoftmaxElement.h"
 #include "FloatUtils.h"
 #include "GurobiWrapper.h"
+#include "NativeMILPSolver.h"
+#include "Options.h"
 #include "TimeUtils.h"
 
 MILPEncoder::MILPEncoder( const ITableau &tableau )
@@ -27,25 +29,32 @@ MILPEncoder::MILPEncoder( const ITableau &tableau )
 {
 }
 
-void MILPEncoder::encodeQuery( GurobiWrapper &gurobi, const Query &inputQuery, bool relax )
+ILPSolver *MILPEncoder::createMILPSolver()
+{
+    if ( Options::get()->gurobiEnabled() )
+        return new GurobiWrapper();
+    return new NativeMILPSolver();
+}
+
+void MILPEncoder::encodeQuery( ILPSolver &solver, const Query &inputQuery, bool relax )
 {
     struct timespec start = TimeUtils::sampleMicro();
 
-    gurobi.reset();
+    solver.reset();
     // Add variables
     for ( unsigned var = 0; var < inputQuery.getNumberOfVariables(); var++ )
     {
         double lb = _tableau.getLowerBound( var );
         double ub = _tableau.getUpperBound( var );
         String varName = Stringf( "x%u", var );
-        gurobi.addVariable( varName, lb, ub );
+        solver.addVariable( varName, lb, ub );
         _variableToVariableName[var] = varName;
     }
 
     // Add equations
     for ( const auto &equation : inputQuery.getEquations() )
     {
-        encodeEquation( gurobi, equation );
+        encodeEquation( solver, equation );
     }
 
     // Add Piecewise-linear Constraints
@@ -58,26 +67,26 @@ void MILPEncoder::encodeQuery( GurobiWrapper &gurobi, const Query &inputQuery, b
         switch ( plConstraint->getType() )
         {
         case PiecewiseLinearFunctionType::RELU:
-            encodeReLUConstraint( gurobi, (ReluConstraint *)plConstraint, relax );
+            encodeReLUConstraint( solver, (ReluConstraint *)plConstraint, relax );
             break;
         case PiecewiseLinearFunctionType::LEAKY_RELU:
-            encodeLeakyReLUConstraint( gurobi, (LeakyReluConstraint *)plConstraint, relax );
+            encodeLeakyReLUConstraint( solver, (LeakyReluConstraint *)plConstraint, relax );
             break;
         case PiecewiseLinearFunctionType::MAX:
-            encodeMaxConstraint( gurobi, (MaxConstraint *)plConstraint, relax );
+            encodeMaxConstraint( solver, (MaxConstraint *)plConstraint, relax );
             break;
         case PiecewiseLinearFunctionType::SIGN:
-            encodeSignConstraint( gurobi, (SignConstraint *)plConstraint, relax );
+            encodeSignConstraint( solver, (SignConstraint *)plConstraint, relax );
             break;
         case PiecewiseLinearFunctionType::ABSOLUTE_VALUE:
-            encodeAbsoluteValueConstraint( gurobi, (AbsoluteValueConstraint *)plConstraint, relax );
+            encodeAbsoluteValueConstraint( solver, (AbsoluteValueConstraint *)plConstraint, relax );
             break;
         case PiecewiseLinearFunctionType::DISJUNCTION:
-            encodeDisjunctionConstraint( gurobi, (DisjunctionConstraint *)plConstraint, relax );
+            encodeDisjunctionConstraint( solver, (DisjunctionConstraint *)plConstraint, relax );
             break;
         default:
             throw MarabouError( MarabouError::UNSUPPORTED_PIECEWISE_LINEAR_CONSTRAINT,
-                                "GurobiWrapper::encodeQuery: "
+                                "MILPEncoder::encodeQuery: "
                                 "Unsupported piecewise-linear constraints\n" );
         }
     }
@@ -88,25 +97,25 @@ void MILPEncoder::encodeQuery( GurobiWrapper &gurobi, const Query &inputQuery, b
         switch ( nlConstraint->getType() )
         {
         case NonlinearFunctionType::SIGMOID:
-            encodeSigmoidConstraint( gurobi, (SigmoidConstraint *)nlConstraint );
+            encodeSigmoidConstraint( solver, (SigmoidConstraint *)nlConstraint );
             break;
         case NonlinearFunctionType::SOFTMAX:
-            encodeSoftmaxConstraint( gurobi, (SoftmaxConstraint *)nlConstraint );
+            encodeSoftmaxConstraint( solver, (SoftmaxConstraint *)nlConstraint );
             break;
         case NonlinearFunctionType::BILINEAR:
-            encodeBilinearConstraint( gurobi, (BilinearConstraint *)nlConstraint, relax );
+            encodeBilinearConstraint( solver, (BilinearConstraint *)nlConstraint, relax );
             break;
         case NonlinearFunctionType::ROUND:
-            encodeRoundConstraint( gurobi, (RoundConstraint *)nlConstraint, relax );
+            encodeRoundConstraint( solver, (RoundConstraint *)nlConstraint, relax );
             break;
         default:
             throw MarabouError( MarabouError::UNSUPPORTED_TRANSCENDENTAL_CONSTRAINT,
-                                "GurobiWrapper::encodeQuery: "
+                                "MILPEncoder::encodeQuery: "
                                 "Unsupported non-linear constraints\n" );
         }
     }
 
-    gurobi.updateModel();
+    solver.updateModel();
 
     if ( _statistics )
     {
@@ -123,29 +132,29 @@ String MILPEncoder::getVariableNameFromVariable( unsigned variable )
     return _variableToVariableName[variable];
 }
 
-void MILPEncoder::encodeEquation( GurobiWrapper &gurobi, const Equation &equation )
+void MILPEncoder::encodeEquation( ILPSolver &solver, const Equation &equation )
 {
-    List<GurobiWrapper::Term> terms;
+    List<ILPSolver::Term> terms;
     double scalar = equation._scalar;
     for ( const auto &term : equation._addends )
-        terms.append( GurobiWrapper::Term( term._coefficient, Stringf( "x%u", term._variable ) ) );
+        terms.append( ILPSolver::Term( term._coefficient, Stringf( "x%u", term._variable ) ) );
     switch ( equation._type )
     {
     case Equation::EQ:
-        gurobi.addEqConstraint( terms, scalar );
+        solver.addEqConstraint( terms, scalar );
         break;
     case Equation::LE:
-        gurobi.addLeqConstraint( terms, scalar );
+        solver.addLeqConstraint( terms, scalar );
         break;
     case Equation::GE:
-        gurobi.addGeqConstraint( terms, scalar );
+        solver.addGeqConstraint( terms, scalar );
         break;
     default:
         break;
     }
 }
 
-void MILPEncoder::encodeReLUConstraint( GurobiWrapper &gurobi, ReluConstraint *relu, bool relax )
+void MILPEncoder::encodeReLUConstraint( ILPSolver &solver, ReluConstraint *relu, bool relax )
 {
     if ( !relu->isActive() || relu->phaseFixed() )
     {
@@ -166,29 +175,29 @@ void MILPEncoder::encodeReLUConstraint( GurobiWrapper &gurobi, ReluConstraint *r
       When a = 0, the constriants become:
           f - b <= - lb_b, f <= 0
     */
-    gurobi.addVariable( Stringf( "a%u", _binVarIndex ),
+    solver.addVariable( Stringf( "a%u", _binVarIndex ),
                         0,
                         1,
-                        relax ? GurobiWrapper::CONTINUOUS : GurobiWrapper::BINARY );
+                        relax ? ILPSolver::CONTINUOUS : ILPSolver::BINARY );
 
     unsigned sourceVariable = relu->getB();
     unsigned targetVariable = relu->getF();
     double sourceLb = _tableau.getLowerBound( sourceVariable );
     double targetUb = _tableau.getUpperBound( targetVariable );
 
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-    terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-    terms.append( GurobiWrapper::Term( -sourceLb, Stringf( "a%u", _binVarIndex ) ) );
-    gurobi.addLeqConstraint( terms, -sourceLb );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+    terms.append( ILPSolver::Term( -sourceLb, Stringf( "a%u", _binVarIndex ) ) );
+    solver.addLeqConstraint( terms, -sourceLb );
 
     terms.clear();
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-    terms.append( GurobiWrapper::Term( -targetUb, Stringf( "a%u", _binVarIndex++ ) ) );
-    gurobi.addLeqConstraint( terms, 0 );
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( -targetUb, Stringf( "a%u", _binVarIndex++ ) ) );
+    solver.addLeqConstraint( terms, 0 );
 }
 
-void MILPEncoder::encodeLeakyReLUConstraint( GurobiWrapper &gurobi,
+void MILPEncoder::encodeLeakyReLUConstraint( ILPSolver &solver,
                                              LeakyReluConstraint *lRelu,
                                              bool relax )
 {
@@ -204,17 +213,17 @@ void MILPEncoder::encodeLeakyReLUConstraint( GurobiWrapper &gurobi,
 
     if ( sourceLb >= 0 )
     {
-        List<GurobiWrapper::Term> terms;
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-        gurobi.addEqConstraint( terms, 0 );
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+        solver.addEqConstraint( terms, 0 );
     }
     else if ( sourceUb <= 0 )
     {
-        List<GurobiWrapper::Term> terms;
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
-        gurobi.addEqConstraint( terms, 0 );
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
+        solver.addEqConstraint( terms, 0 );
     }
     else
     {
@@ -227,10 +236,10 @@ void MILPEncoder::encodeLeakyReLUConstraint( GurobiWrapper &gurobi,
             */
 
             double lambda = ( sourceUb - slope * sourceLb ) / ( sourceUb - sourceLb );
-            List<GurobiWrapper::Term> terms;
-            terms.append( GurobiWrapper::Term( lambda, Stringf( "x%u", sourceVariable ) ) );
-            terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", targetVariable ) ) );
-            gurobi.addGeqConstraint( terms, ( lambda - 1 ) * sourceUb );
+            List<ILPSolver::Term> terms;
+            terms.append( ILPSolver::Term( lambda, Stringf( "x%u", sourceVariable ) ) );
+            terms.append( ILPSolver::Term( -1, Stringf( "x%u", targetVariable ) ) );
+            solver.addGeqConstraint( terms, ( lambda - 1 ) * sourceUb );
         }
         else
         {
@@ -242,7 +251,7 @@ void MILPEncoder::encodeLeakyReLUConstraint( GurobiWrapper &gurobi,
             yPoints[1] = 0;
             xPoints[2] = sourceUb;
             yPoints[2] = sourceUb;
-            gurobi.addPiecewiseLinearConstraint( Stringf( "x%u", sourceVariable ),
+            solver.addPiecewiseLinearConstraint( Stringf( "x%u", sourceVariable ),
                                                  Stringf( "x%u", targetVariable ),
                                                  3,
                                                  xPoints,
@@ -251,26 +260,26 @@ void MILPEncoder::encodeLeakyReLUConstraint( GurobiWrapper &gurobi,
     }
 }
 
-void MILPEncoder::encodeMaxConstraint( GurobiWrapper &gurobi, MaxConstraint *max, bool relax )
+void MILPEncoder::encodeMaxConstraint( ILPSolver &solver, MaxConstraint *max, bool relax )
 {
     if ( !max->isActive() )
         return;
 
-    List<GurobiWrapper::Term> terms;
+    List<ILPSolver::Term> terms;
     List<PhaseStatus> phases = max->getAllCases();
     for ( unsigned i = 0; i < phases.size(); ++i )
     {
         // add a binary variable for each disjunct
-        gurobi.addVariable( Stringf( "a%u_%u", _binVarIndex, i ),
+        solver.addVariable( Stringf( "a%u_%u", _binVarIndex, i ),
                             0,
                             1,
-                            relax ? GurobiWrapper::CONTINUOUS : GurobiWrapper::BINARY );
+                            relax ? ILPSolver::CONTINUOUS : ILPSolver::BINARY );
 
-        terms.append( GurobiWrapper::Term( 1, Stringf( "a%u_%u", _binVarIndex, i ) ) );
+        terms.append( ILPSolver::Term( 1, Stringf( "a%u_%u", _binVarIndex, i ) ) );
     }
 
     // add constraint: a_1 + a_2 + ... + = 1
-    gurobi.addEqConstraint( terms, 1 );
+    solver.addEqConstraint( terms, 1 );
 
     terms.clear();
     unsigned index = 0;
@@ -289,9 +298,9 @@ void MILPEncoder::encodeMaxConstraint( GurobiWrapper &gurobi, MaxConstraint *max
             double yUb = _tableau.getUpperBound( y );
             double eliminatedValue = split.getBoundTightenings().begin()->_value;
 
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", y ) ) );
-            terms.append( GurobiWrapper::Term( yUb - eliminatedValue, binVarName ) );
-            gurobi.addLeqConstraint( terms, yUb );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", y ) ) );
+            terms.append( ILPSolver::Term( yUb - eliminatedValue, binVarName ) );
+            solver.addLeqConstraint( terms, yUb );
         }
         else
         {
@@ -305,9 +314,9 @@ void MILPEncoder::encodeMaxConstraint( GurobiWrapper &gurobi, MaxConstraint *max
             } );
             unsigned aux = split.getBoundTightenings().begin()->_variable;
             double auxUb = _tableau.getUpperBound( aux );
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", aux ) ) );
-            terms.append( GurobiWrapper::Term( auxUb, binVarName ) );
-            gurobi.addLeqConstraint( terms, auxUb );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", aux ) ) );
+            terms.append( ILPSolver::Term( auxUb, binVarName ) );
+            solver.addLeqConstraint( terms, auxUb );
         }
         terms.clear();
         ++index;
@@ -316,7 +325,7 @@ void MILPEncoder::encodeMaxConstraint( GurobiWrapper &gurobi, MaxConstraint *max
     _binVarIndex++;
 }
 
-void MILPEncoder::encodeAbsoluteValueConstraint( GurobiWrapper &gurobi,
+void MILPEncoder::encodeAbsoluteValueConstraint( ILPSolver &solver,
                                                  AbsoluteValueConstraint *abs,
                                                  bool relax )
 {
@@ -348,26 +357,26 @@ void MILPEncoder::encodeAbsoluteValueConstraint( GurobiWrapper &gurobi,
       When a = 0, the constriants become:
       f - b <= ub_f - lb_b, f + b <= 0
     */
-    gurobi.addVariable( Stringf( "a%u", _binVarIndex ),
+    solver.addVariable( Stringf( "a%u", _binVarIndex ),
                         0,
                         1,
-                        relax ? GurobiWrapper::CONTINUOUS : GurobiWrapper::BINARY );
+                        relax ? ILPSolver::CONTINUOUS : ILPSolver::BINARY );
 
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-    terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-    terms.append( GurobiWrapper::Term( targetUb - sourceLb, Stringf( "a%u", _binVarIndex ) ) );
-    gurobi.addLeqConstraint( terms, targetUb - sourceLb );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+    terms.append( ILPSolver::Term( targetUb - sourceLb, Stringf( "a%u", _binVarIndex ) ) );
+    solver.addLeqConstraint( terms, targetUb - sourceLb );
 
     terms.clear();
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", sourceVariable ) ) );
-    terms.append( GurobiWrapper::Term( -( targetUb + sourceUb ), Stringf( "a%u", _binVarIndex ) ) );
-    gurobi.addLeqConstraint( terms, 0 );
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", sourceVariable ) ) );
+    terms.append( ILPSolver::Term( -( targetUb + sourceUb ), Stringf( "a%u", _binVarIndex ) ) );
+    solver.addLeqConstraint( terms, 0 );
     ++_binVarIndex;
 }
 
-void MILPEncoder::encodeDisjunctionConstraint( GurobiWrapper &gurobi,
+void MILPEncoder::encodeDisjunctionConstraint( ILPSolver &solver,
                                                DisjunctionConstraint *disj,
                                                bool relax )
 {
@@ -375,21 +384,21 @@ void MILPEncoder::encodeDisjunctionConstraint( GurobiWrapper &gurobi,
         return;
 
     // terms for Gurobi
-    List<GurobiWrapper::Term> terms;
+    List<ILPSolver::Term> terms;
     List<PiecewiseLinearCaseSplit> disjuncts = disj->getCaseSplits();
     for ( unsigned i = 0; i < disjuncts.size(); ++i )
     {
         // add a binary variable for each disjunct
-        gurobi.addVariable( Stringf( "a%u_%u", _binVarIndex, i ),
+        solver.addVariable( Stringf( "a%u_%u", _binVarIndex, i ),
                             0,
                             1,
-                            relax ? GurobiWrapper::CONTINUOUS : GurobiWrapper::BINARY );
+                            relax ? ILPSolver::CONTINUOUS : ILPSolver::BINARY );
 
-        terms.append( GurobiWrapper::Term( 1, Stringf( "a%u_%u", _binVarIndex, i ) ) );
+        terms.append( ILPSolver::Term( 1, Stringf( "a%u_%u", _binVarIndex, i ) ) );
     }
 
     // add constraint: a_1 + a_2 + ... + >= 1
-    gurobi.addGeqConstraint( terms, 1 );
+    solver.addGeqConstraint( terms, 1 );
 
     // Add each disjunct as indicator constraints
     terms.clear();
@@ -401,11 +410,11 @@ void MILPEncoder::encodeDisjunctionConstraint( GurobiWrapper &gurobi,
         {
             // add indicator constraint: a_1 => disjunct1, etc.
             terms.append(
-                GurobiWrapper::Term( 1, getVariableNameFromVariable( tightening._variable ) ) );
+                ILPSolver::Term( 1, getVariableNameFromVariable( tightening._variable ) ) );
             if ( tightening._type == Tightening::UB )
-                gurobi.addLeqIndicatorConstraint( binVarName, 1, terms, tightening._value );
+                solver.addLeqIndicatorConstraint( binVarName, 1, terms, tightening._value );
             else
-                gurobi.addGeqIndicatorConstraint( binVarName, 1, terms, tightening._value );
+                solver.addGeqIndicatorConstraint( binVarName, 1, terms, tightening._value );
             terms.clear();
         }
         ++index;
@@ -414,7 +423,7 @@ void MILPEncoder::encodeDisjunctionConstraint( GurobiWrapper &gurobi,
     _binVarIndex++;
 }
 
-void MILPEncoder::encodeSignConstraint( GurobiWrapper &gurobi, SignConstraint *sign, bool relax )
+void MILPEncoder::encodeSignConstraint( ILPSolver &solver, SignConstraint *sign, bool relax )
 {
     ASSERT( GlobalConfiguration::PL_CONSTRAINTS_ADD_AUX_EQUATIONS_AFTER_PREPROCESSING );
 
@@ -444,20 +453,20 @@ void MILPEncoder::encodeSignConstraint( GurobiWrapper &gurobi, SignConstraint *s
       Moreover, when f is 1, 1 <= -2 / lb_b * b + 1, thus, b >= 0.
       When f is -1, -1 >= 2/ub_b * b - 1, thus, b <= 0.
     */
-    gurobi.addVariable( Stringf( "a%u", _binVarIndex ),
+    solver.addVariable( Stringf( "a%u", _binVarIndex ),
                         0,
                         1,
-                        relax ? GurobiWrapper::CONTINUOUS : GurobiWrapper::BINARY );
+                        relax ? ILPSolver::CONTINUOUS : ILPSolver::BINARY );
 
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-    terms.append( GurobiWrapper::Term( -2, Stringf( "a%u", _binVarIndex ) ) );
-    gurobi.addEqConstraint( terms, -1 );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( -2, Stringf( "a%u", _binVarIndex ) ) );
+    solver.addEqConstraint( terms, -1 );
 
     ++_binVarIndex;
 }
 
-void MILPEncoder::encodeSigmoidConstraint( GurobiWrapper &gurobi, SigmoidConstraint *sigmoid )
+void MILPEncoder::encodeSigmoidConstraint( ILPSolver &solver, SigmoidConstraint *sigmoid )
 {
     unsigned sourceVariable = sigmoid->getB(); // x_b
     unsigned targetVariable = sigmoid->getF(); // x_f
@@ -470,10 +479,10 @@ void MILPEncoder::encodeSigmoidConstraint( GurobiWrapper &gurobi, SigmoidConstra
     }
     else if ( FloatUtils::lt( sourceLb, 0 ) && FloatUtils::gt( sourceUb, 0 ) )
     {
-        List<GurobiWrapper::Term> terms;
+        List<ILPSolver::Term> terms;
         String binVarName = Stringf( "a%u", _binVarIndex ); // a = 1 -> the case where x_b >= 0,
                                                             // otherwise where x_b <= 0
-        gurobi.addVariable( binVarName, 0, 1, GurobiWrapper::BINARY );
+        solver.addVariable( binVarName, 0, 1, ILPSolver::BINARY );
 
         // Constraint where x_b >= 0
         // Upper line is tangent and lower line is secant for an overapproximation with a
@@ -485,9 +494,9 @@ void MILPEncoder::encodeSigmoidConstraint( GurobiWrapper &gurobi, SigmoidConstra
         double tangentPoint = sourceUb / 2;
         double yAtTangentPoint = sigmoid->sigmoid( tangentPoint );
         double tangentSlope = sigmoid->sigmoidDerivative( tangentPoint );
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -tangentSlope, Stringf( "x%u", sourceVariable ) ) );
-        gurobi.addLeqIndicatorConstraint(
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -tangentSlope, Stringf( "x%u", sourceVariable ) ) );
+        solver.addLeqIndicatorConstraint(
             binVarName, binVal, terms, -tangentSlope * tangentPoint + yAtTangentPoint );
         terms.clear();
 
@@ -495,19 +504,19 @@ void MILPEncoder::encodeSigmoidConstraint( GurobiWrapper &gurobi, SigmoidConstra
         double y_l = sigmoid->sigmoid( 0 );
         double y_u = sigmoid->sigmoid( sourceUb );
         double secantSlope = ( y_u - y_l ) / sourceUb;
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -secantSlope, Stringf( "x%u", sourceVariable ) ) );
-        gurobi.addGeqIndicatorConstraint( binVarName, binVal, terms, y_l );
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -secantSlope, Stringf( "x%u", sourceVariable ) ) );
+        solver.addGeqIndicatorConstraint( binVarName, binVal, terms, y_l );
         terms.clear();
 
         // lower bound of x_b
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", sourceVariable ) ) );
-        gurobi.addGeqIndicatorConstraint( binVarName, binVal, terms, 0 );
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", sourceVariable ) ) );
+        solver.addGeqIndicatorConstraint( binVarName, binVal, terms, 0 );
         terms.clear();
 
         // lower bound of x_f
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        gurobi.addGeqIndicatorConstraint( binVarName, binVal, terms, y_l );
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        solver.addGeqIndicatorConstraint( binVarName, binVal, terms, y_l );
         terms.clear();
 
         // Constraints where x_b <= 0
@@ -520,9 +529,9 @@ void MILPEncoder::encodeSigmoidConstraint( GurobiWrapper &gurobi, SigmoidConstra
         tangentPoint = sourceLb / 2;
         yAtTangentPoint = sigmoid->sigmoid( tangentPoint );
         tangentSlope = sigmoid->sigmoidDerivative( tangentPoint );
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -tangentSlope, Stringf( "x%u", sourceVariable ) ) );
-        gurobi.addGeqIndicatorConstraint(
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -tangentSlope, Stringf( "x%u", sourceVariable ) ) );
+        solver.addGeqIndicatorConstraint(
             binVarName, binVal, terms, -tangentSlope * tangentPoint + yAtTangentPoint );
         terms.clear();
 
@@ -530,20 +539,20 @@ void MILPEncoder::encodeSigmoidConstraint( GurobiWrapper &gurobi, SigmoidConstra
         y_u = y_l;
         y_l = sigmoid->sigmoid( sourceLb );
         secantSlope = ( y_u - y_l ) / ( 0 - sourceLb );
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -secantSlope, Stringf( "x%u", sourceVariable ) ) );
-        gurobi.addLeqIndicatorConstraint(
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -secantSlope, Stringf( "x%u", sourceVariable ) ) );
+        solver.addLeqIndicatorConstraint(
             binVarName, binVal, terms, -secantSlope * sourceLb + y_l );
         terms.clear();
 
         // upper bound of x_b
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", sourceVariable ) ) );
-        gurobi.addLeqIndicatorConstraint( binVarName, binVal, terms, 0 );
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", sourceVariable ) ) );
+        solver.addLeqIndicatorConstraint( binVarName, binVal, terms, 0 );
         terms.clear();
 
         // upper bound of x_f
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        gurobi.addLeqIndicatorConstraint( binVarName, binVal, terms, y_u );
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        solver.addLeqIndicatorConstraint( binVarName, binVal, terms, y_u );
         terms.clear();
 
         _binVarIndex++;
@@ -555,17 +564,17 @@ void MILPEncoder::encodeSigmoidConstraint( GurobiWrapper &gurobi, SigmoidConstra
         double yAtTangentPoint = sigmoid->sigmoid( tangentPoint );
         double tangentSlope = sigmoid->sigmoidDerivative( tangentPoint );
 
-        List<GurobiWrapper::Term> terms;
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -tangentSlope, Stringf( "x%u", sourceVariable ) ) );
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -tangentSlope, Stringf( "x%u", sourceVariable ) ) );
 
         if ( FloatUtils::gte( sourceLb, 0 ) )
         {
-            gurobi.addLeqConstraint( terms, -tangentSlope * tangentPoint + yAtTangentPoint );
+            solver.addLeqConstraint( terms, -tangentSlope * tangentPoint + yAtTangentPoint );
         }
         else
         {
-            gurobi.addGeqConstraint( terms, -tangentSlope * tangentPoint + yAtTangentPoint );
+            solver.addGeqConstraint( terms, -tangentSlope * tangentPoint + yAtTangentPoint );
         }
         terms.clear();
 
@@ -573,22 +582,22 @@ void MILPEncoder::encodeSigmoidConstraint( GurobiWrapper &gurobi, SigmoidConstra
         double y_u = sigmoid->sigmoid( sourceUb );
 
         double secantSlope = ( y_u - y_l ) / ( sourceUb - sourceLb );
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -secantSlope, Stringf( "x%u", sourceVariable ) ) );
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -secantSlope, Stringf( "x%u", sourceVariable ) ) );
 
         if ( FloatUtils::gte( sourceLb, 0 ) )
         {
-            gurobi.addGeqConstraint( terms, -secantSlope * sourceLb + y_l );
+            solver.addGeqConstraint( terms, -secantSlope * sourceLb + y_l );
         }
         else
         {
-            gurobi.addLeqConstraint( terms, -secantSlope * sourceLb + y_l );
+            solver.addLeqConstraint( terms, -secantSlope * sourceLb + y_l );
         }
         terms.clear();
     }
 }
 
-void MILPEncoder::encodeSoftmaxConstraint( GurobiWrapper &gurobi, SoftmaxConstraint *softmax )
+void MILPEncoder::encodeSoftmaxConstraint( ILPSolver &solver, SoftmaxConstraint *softmax )
 {
     Vector<double> sourceLbs;
     Vector<double> sourceUbs;
@@ -618,8 +627,8 @@ void MILPEncoder::encodeSoftmaxConstraint( GurobiWrapper &gurobi, SoftmaxConstra
         {
             // lower-bound
             bool wellFormed = true;
-            List<GurobiWrapper::Term> terms;
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariables[i] ) ) );
+            List<ILPSolver::Term> terms;
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariables[i] ) ) );
             double symbolicLowerBias;
             bool useLSE2 = false;
             for ( const auto &lb : targetLbs )
@@ -640,7 +649,7 @@ void MILPEncoder::encodeSoftmaxConstraint( GurobiWrapper &gurobi, SoftmaxConstra
                     if ( !FloatUtils::wellFormed( dldj ) )
                         wellFormed = false;
                     terms.append(
-                        GurobiWrapper::Term( -dldj, Stringf( "x%u", sourceVariables[j] ) ) );
+                        ILPSolver::Term( -dldj, Stringf( "x%u", sourceVariables[j] ) ) );
                     symbolicLowerBias -= dldj * sourceMids[j];
                 }
             }
@@ -657,12 +666,12 @@ void MILPEncoder::encodeSoftmaxConstraint( GurobiWrapper &gurobi, SoftmaxConstra
                     if ( !FloatUtils::wellFormed( dldj ) )
                         wellFormed = false;
                     terms.append(
-                        GurobiWrapper::Term( -dldj, Stringf( "x%u", sourceVariables[j] ) ) );
+                        ILPSolver::Term( -dldj, Stringf( "x%u", sourceVariables[j] ) ) );
                     symbolicLowerBias -= dldj * sourceMids[j];
                 }
             }
             if ( wellFormed )
-                gurobi.addGeqConstraint( terms, symbolicLowerBias );
+                solver.addGeqConstraint( terms, symbolicLowerBias );
 
             // Upper-bound
             wellFormed = true;
@@ -671,23 +680,23 @@ void MILPEncoder::encodeSoftmaxConstraint( GurobiWrapper &gurobi, SoftmaxConstra
             if ( !FloatUtils::wellFormed( symbolicUpperBias ) )
                 wellFormed = false;
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariables[i] ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariables[i] ) ) );
             for ( unsigned j = 0; j < size; ++j )
             {
                 double dudj = NLR::DeepPolySoftmaxElement::dLSEUpperbound(
                     sourceMids, targetLbs, targetUbs, i, j );
                 if ( !FloatUtils::wellFormed( dudj ) )
                     wellFormed = false;
-                terms.append( GurobiWrapper::Term( -dudj, Stringf( "x%u", sourceVariables[j] ) ) );
+                terms.append( ILPSolver::Term( -dudj, Stringf( "x%u", sourceVariables[j] ) ) );
                 symbolicUpperBias -= dudj * sourceMids[j];
             }
             if ( wellFormed )
-                gurobi.addLeqConstraint( terms, symbolicUpperBias );
+                solver.addLeqConstraint( terms, symbolicUpperBias );
         }
     }
 }
 
-void MILPEncoder::encodeBilinearConstraint( GurobiWrapper &gurobi,
+void MILPEncoder::encodeBilinearConstraint( ILPSolver &solver,
                                             BilinearConstraint *bilinear,
                                             bool relax )
 {
@@ -702,31 +711,31 @@ void MILPEncoder::encodeBilinearConstraint( GurobiWrapper &gurobi,
         double sourceLb2 = _tableau.getLowerBound( sourceVariable2 );
         double sourceUb2 = _tableau.getUpperBound( sourceVariable2 );
 
-        List<GurobiWrapper::Term> terms;
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -sourceLb2, Stringf( "x%u", sourceVariable1 ) ) );
-        terms.append( GurobiWrapper::Term( -sourceLb1, Stringf( "x%u", sourceVariable2 ) ) );
-        gurobi.addGeqConstraint( terms, -sourceLb1 * sourceLb2 );
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -sourceLb2, Stringf( "x%u", sourceVariable1 ) ) );
+        terms.append( ILPSolver::Term( -sourceLb1, Stringf( "x%u", sourceVariable2 ) ) );
+        solver.addGeqConstraint( terms, -sourceLb1 * sourceLb2 );
 
         terms.clear();
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -sourceUb2, Stringf( "x%u", sourceVariable1 ) ) );
-        terms.append( GurobiWrapper::Term( -sourceLb1, Stringf( "x%u", sourceVariable2 ) ) );
-        gurobi.addLeqConstraint( terms, -sourceLb1 * sourceUb2 );
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -sourceUb2, Stringf( "x%u", sourceVariable1 ) ) );
+        terms.append( ILPSolver::Term( -sourceLb1, Stringf( "x%u", sourceVariable2 ) ) );
+        solver.addLeqConstraint( terms, -sourceLb1 * sourceUb2 );
     }
     else
     {
-        gurobi.nonConvex();
+        solver.nonConvex();
         auto bs = bilinear->getBs();
         ASSERT( bs.size() == 2 );
         auto f = bilinear->getF();
-        gurobi.addBilinearConstraint(
+        solver.addBilinearConstraint(
             Stringf( "x%u", bs[0] ), Stringf( "x%u", bs[1] ), Stringf( "x%u", f ) );
         return;
     }
 }
 
-void MILPEncoder::encodeRoundConstraint( GurobiWrapper &gurobi, RoundConstraint *round, bool relax )
+void MILPEncoder::encodeRoundConstraint( ILPSolver &solver, RoundConstraint *round, bool relax )
 {
     /*
       We have already introduced during preprocessing
@@ -741,24 +750,24 @@ void MILPEncoder::encodeRoundConstraint( GurobiWrapper &gurobi, RoundConstraint
     {
         unsigned targetVariable = round->getF();
         String varName = Stringf( "i%u", _intVarIndex );
-        gurobi.addVariable( varName,
+        solver.addVariable( varName,
                             _tableau.getLowerBound( targetVariable ),
                             _tableau.getUpperBound( targetVariable ),
-                            GurobiWrapper::INTEGER );
-        List<GurobiWrapper::Term> terms;
-        terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-        terms.append( GurobiWrapper::Term( -1, Stringf( "i%u", _intVarIndex ) ) );
-        gurobi.addEqConstraint( terms, 0 );
+                            ILPSolver::INTEGER );
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+        terms.append( ILPSolver::Term( -1, Stringf( "i%u", _intVarIndex ) ) );
+        solver.addEqConstraint( terms, 0 );
         ++_intVarIndex;
     }
 }
 
-void MILPEncoder::encodeCostFunction( GurobiWrapper &gurobi, const LinearExpression &cost )
+void MILPEncoder::encodeCostFunction( ILPSolver &solver, const LinearExpression &cost )
 {
-    List<GurobiWrapper::Term> terms;
+    List<ILPSolver::Term> terms;
     for ( const auto &pair : cost._addends )
     {
-        terms.append( GurobiWrapper::Term( pair.second, Stringf( "x%u", pair.first ) ) );
+        terms.append( ILPSolver::Term( pair.second, Stringf( "x%u", pair.first ) ) );
     }
-    gurobi.setCost( terms, cost._constant );
+    solver.setCost( terms, cost._constant );
 }
@@ -18,7 +18,7 @@
 
 #include "BilinearConstraint.h"
 #include "DisjunctionConstraint.h"
-#include "GurobiWrapper.h"
+#include "ILPSolver.h"
 #include "ITableau.h"
 #include "LeakyReluConstraint.h"
 #include "LinearExpression.h"
@@ -35,10 +35,16 @@ public:
     MILPEncoder( const ITableau &tableau );
 
     /*
-      Encode the input query as a Gurobi query, variables and inequalities
+      Create a MILP solver for the encoding: Gurobi if it is available,
+      and the native branch and bound solver otherwise
+    */
+    static ILPSolver *createMILPSolver();
+
+    /*
+      Encode the input query as a MILP query, variables and inequalities
       are from inputQuery, and latest variable bounds are from tableau
     */
-    void encodeQuery( GurobiWrapper &gurobi, const Query &inputQuery, bool relax = false );
+    void encodeQuery( ILPSolver &solver, const Query &inputQuery, bool relax = false );
 
     /*
       get variable name from a variable in the encoded inputquery
@@ -51,9 +57,9 @@ public:
     }
 
     /*
-      Encode the cost function into Gurobi
+      Encode the cost function into the MILP solver
     */
-    void encodeCostFunction( GurobiWrapper &gurobi, const LinearExpression &cost );
+    void encodeCostFunction( ILPSolver &solver, const LinearExpression &cost );
 
 private:
     /*
@@ -67,7 +73,7 @@ private:
     Statistics *_statistics;
 
     /*
-      Map the variable to the string encoded in Gurobi
+      Map the variable to the string encoded in the MILP solver
     */
     Map<unsigned, String> _variableToVariableName;
 
@@ -84,7 +90,7 @@ private:
     /*
       Encode an (in)equality into Gurobi.
     */
-    void encodeEquation( GurobiWrapper &gurobi, const Equation &Equation );
+    void encodeEquation( ILPSolver &solver, const Equation &Equation );
 
     /*
       Encode a ReLU constraint f = ReLU(b) into Gurobi using the same encoding in
@@ -99,12 +105,12 @@ private:
       The other two constraints f >= b and f >= 0 are encoded already when
       preprocessing
     */
-    void encodeReLUConstraint( GurobiWrapper &gurobi, ReluConstraint *relu, bool relax );
+    void encodeReLUConstraint( ILPSolver &solver, ReluConstraint *relu, bool relax );
 
     /*
       Encode a LeakyReLU constraint f = LeakyReLU(b) into Gurobi as a Piecewise Linear Constraint
     */
-    void encodeLeakyReLUConstraint( GurobiWrapper &gurobi, LeakyReluConstraint *lRelu, bool relax );
+    void encodeLeakyReLUConstraint( ILPSolver &solver, LeakyReluConstraint *lRelu, bool relax );
 
     /*
       Encode a MAX constraint y = max(x_1, x_2, ... ,x_m) into Gurobi using the same encoding in
@@ -116,46 +122,46 @@ private:
       a_1 + a_2 + ... + a_m = 1
       a_i \in {0, 1} (i = 1 ~ m)
     */
-    void encodeMaxConstraint( GurobiWrapper &gurobi, MaxConstraint *max, bool relax );
+    void encodeMaxConstraint( ILPSolver &solver, MaxConstraint *max, bool relax );
 
     /*
       Encode an abs constraint f = Abs(b) into Gurobi
     */
-    void encodeAbsoluteValueConstraint( GurobiWrapper &gurobi,
+    void encodeAbsoluteValueConstraint( ILPSolver &solver,
                                         AbsoluteValueConstraint *abs,
                                         bool relax );
 
     /*
       Encode a sign constraint f = Sign(b) into Gurobi
     */
-    void encodeSignConstraint( GurobiWrapper &gurobi, SignConstraint *sign, bool relax );
+    void encodeSignConstraint( ILPSolver &solver, SignConstraint *sign, bool relax );
 
     /*
       Encode a disjunction constraint into Gurobi
     */
     void
-    encodeDisjunctionConstraint( GurobiWrapper &gurobi, DisjunctionConstraint *disj, bool relax );
+    encodeDisjunctionConstraint( ILPSolver &solver, DisjunctionConstraint *disj, bool relax );
 
     /*
       Encode a Sigmoid constraint
     */
-    void encodeSigmoidConstraint( GurobiWrapper &gurobi, SigmoidConstraint *sigmoid );
+    void encodeSigmoidConstraint( ILPSolver &solver, SigmoidConstraint *sigmoid );
 
     /*
       Encode a Softmax constraint
     */
-    void encodeSoftmaxConstraint( GurobiWrapper &gurobi, SoftmaxConstraint *softmax );
+    void encodeSoftmaxConstraint( ILPSolver &solver, SoftmaxConstraint *softmax );
 
     /*
       Encode a Bilinear constraint
     */
     void
-    encodeBilinearConstraint( GurobiWrapper &gurobi, BilinearConstraint *bilinear, bool relax );
+    encodeBilinearConstraint( ILPSolver &solver, BilinearConstraint *bilinear, bool relax );
 
     /*
       Encode a Round constraint
     */
-    void encodeRoundConstraint( GurobiWrapper &gurobi, RoundConstraint *round, bool relax );
+    void encodeRoundConstraint( ILPSolver &solver, RoundConstraint *round, bool relax );
 };
 
 #endif // __MILPEncoder_h__
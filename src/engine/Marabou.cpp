@@ -22,6 +22,7 @@
 #include "GlobalConfiguration.h"
 #include "MStringf.h"
 #include "MarabouError.h"
+#include "NetworkCache.h"
 #include "OnnxParser.h"
 #include "Options.h"
 #include "PropertyParser.h"
@@ -110,16 +111,27 @@ void Marabou::prepareQuery()
         }
         printf( "Network: %s\n", networkFilePath.ascii() );
 
-        if ( ( (String)networkFilePath ).endsWith( ".onnx" ) )
+        NetworkCache networkCache( Options::get()->getString( Options::NETWORK_CACHE_DIRECTORY ),
+                                   networkFilePath );
+        if ( networkCache.lookup( _inputQuery ) )
         {
-            InputQueryBuilder queryBuilder;
-            OnnxParser::parse( queryBuilder, networkFilePath, {}, {} );
-            queryBuilder.generateQuery( _inputQuery );
+            printf( "Network loaded from cache: %s\n", networkCache.getEntryPath().ascii() );
         }
         else
         {
-            _acasParser = new AcasParser( networkFilePath );
-            _acasParser->generateQuery( _inputQuery );
+            if ( ( (String)networkFilePath ).endsWith( ".onnx" ) )
+            {
+                InputQueryBuilder queryBuilder;
+                OnnxParser::parse( queryBuilder, networkFilePath, {}, {} );
+                queryBuilder.generateQuery( _inputQuery );
+            }
+            else
+            {
+                _acasParser = new AcasParser( networkFilePath );
+                _acasParser->generateQuery( _inputQuery );
+            }
+
+            networkCache.store( _inputQuery );
         }
 
         /*
@@ -150,7 +162,10 @@ void Marabou::prepareQuery()
     String queryDumpFilePath = Options::get()->getString( Options::QUERY_DUMP_FILE );
     if ( queryDumpFilePath.length() > 0 )
     {
-        _inputQuery.saveQuery( queryDumpFilePath );
+        if ( Options::get()->getBool( Options::BINARY_QUERY_DUMP ) )
+            _inputQuery.saveQueryAsBinary( queryDumpFilePath );
+        else
+            _inputQuery.saveQuery( queryDumpFilePath );
         printf( "\nInput query successfully dumped to file\n" );
         exit( 0 );
     }
@@ -55,6 +55,7 @@ public:
         UNABLE_TO_RECONSTRUCT_SOLUTION_FOR_ELIMINATED_NEURONS = 30,
 
         INPUT_QUERY_VARIABLE_BOUND_ALREADY_SET = 31,
+        INVALID_BINARY_CERTIFICATE_FILE = 32,
 
         // Error codes for Query Loader
         FILE_DOES_NOT_EXIST = 100,
@@ -63,6 +64,7 @@ public:
         UNSUPPORTED_TRANSCENDENTAL_CONSTRAINT = 103,
         UNSUPPORTED_NON_LINEAR_CONSTRAINT = 104,
         ONNX_PARSER_ERROR = 105,
+        INVALID_BINARY_QUERY_FILE = 106,
 
         FEATURE_NOT_YET_SUPPORTED = 900,
 
@@ -18,6 +18,7 @@
 #include "Error.h"
 #include "LPSolverType.h"
 #include "Marabou.h"
+#include "MatrixMultiplication.h"
 #include "Options.h"
 
 #ifdef ENABLE_OPENBLAS
@@ -92,6 +93,14 @@ int marabouMain( int argc, char **argv )
             printf( "Proof production is not yet supported with snc mode, turning --snc off.\n" );
         }
 
+        if ( options->getBool( Options::PRODUCE_PROOFS ) &&
+             ( options->getBool( Options::SPLIT_TOP_LEVEL_DISJUNCTS ) ) )
+        {
+            options->setBool( Options::SPLIT_TOP_LEVEL_DISJUNCTS, false );
+            printf( "Proof production is not yet supported with snc mode, turning "
+                    "--split-disjuncts off.\n" );
+        }
+
         if ( options->getBool( Options::PRODUCE_PROOFS ) &&
              ( options->getBool( Options::SOLVE_WITH_MILP ) ) )
         {
@@ -115,6 +124,13 @@ int marabouMain( int argc, char **argv )
                                       "Cannot set both --snc and --poi to true..." );
         }
 
+        if ( options->getBool( Options::SPLIT_TOP_LEVEL_DISJUNCTS ) &&
+             options->getBool( Options::PARALLEL_DEEPSOI ) )
+        {
+            throw ConfigurationError( ConfigurationError::INCOMPTATIBLE_OPTIONS,
+                                      "Cannot set both --split-disjuncts and --poi to true..." );
+        }
+
         if ( options->getBool( Options::PARALLEL_DEEPSOI ) &&
              ( options->getBool( Options::SOLVE_WITH_MILP ) ) )
         {
@@ -123,6 +139,7 @@ int marabouMain( int argc, char **argv )
         }
 
         if ( options->getBool( Options::DNC_MODE ) ||
+             options->getBool( Options::SPLIT_TOP_LEVEL_DISJUNCTS ) ||
              ( options->getBool( Options::PARALLEL_DEEPSOI ) &&
                options->getInt( Options::NUM_WORKERS ) > 1 ) )
             DnCMarabou().run();
@@ -131,6 +148,7 @@ int marabouMain( int argc, char **argv )
 #ifdef ENABLE_OPENBLAS
             openblas_set_num_threads( options->getInt( Options::NUM_BLAS_THREADS ) );
 #endif
+            setMatrixMultiplicationThreads( options->getInt( Options::NUM_BLAS_THREADS ) );
             Marabou().run();
         }
     }
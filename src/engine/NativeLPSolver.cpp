@@ -0,0 +1,930 @@
+/*********************                                                        */
+/*! \file NativeLPSolver.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "NativeLPSolver.h"
+
+#include "BasisFactorizationFactory.h"
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+#include "MalformedBasisException.h"
+#include "MarabouError.h"
+#include "Options.h"
+#include "SparseColumnsOfBasis.h"
+#include "TimeUtils.h"
+
+NativeLPSolver::NativeLPSolver()
+    : _costConstant( 0 )
+    , _maximize( false )
+    , _cutoffInUse( false )
+    , _cutoff( 0 )
+    , _timeoutInSeconds( Options::get()->getFloat( Options::MILP_SOLVER_TIMEOUT ) )
+    , _status( NOT_SOLVED )
+    , _optimalValue( 0 )
+    , _numberOfIterations( 0 )
+    , _n( 0 )
+    , _m( 0 )
+    , _basisFactorization( NULL )
+    , _basisFactorizationSize( 0 )
+    , _warmStartN( 0 )
+    , _warmStartM( 0 )
+{
+}
+
+NativeLPSolver::~NativeLPSolver()
+{
+    freeSimplexIfNeeded();
+
+    if ( _basisFactorization )
+    {
+        delete _basisFactorization;
+        _basisFactorization = NULL;
+    }
+}
+
+void NativeLPSolver::freeSimplexIfNeeded()
+{
+    for ( auto &column : _columns )
+    {
+        if ( column )
+        {
+            delete column;
+            column = NULL;
+        }
+    }
+
+    _columns.clear();
+}
+
+void NativeLPSolver::resetModel()
+{
+    _nameToVariable.clear();
+    _variableNames.clear();
+    _lowerBounds.clear();
+    _upperBounds.clear();
+    _constraints.clear();
+    _cost.clear();
+    _costConstant = 0;
+    _maximize = false;
+    _cutoffInUse = false;
+    _cutoff = 0;
+    _status = NOT_SOLVED;
+    _numberOfIterations = 0;
+}
+
+void NativeLPSolver::reset()
+{
+    _status = NOT_SOLVED;
+}
+
+void NativeLPSolver::addVariable( String name, double lb, double ub, VariableType type )
+{
+    if ( type != CONTINUOUS )
+        throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                            "NativeLPSolver only supports continuous variables" );
+
+    ASSERT( !_nameToVariable.exists( name ) );
+
+    _nameToVariable[name] = _variableNames.size();
+    _variableNames.append( name );
+    _lowerBounds.append( lb );
+    _upperBounds.append( ub );
+}
+
+void NativeLPSolver::setLowerBound( String name, double lb )
+{
+    _lowerBounds[_nameToVariable[name]] = lb;
+}
+
+void NativeLPSolver::setUpperBound( String name, double ub )
+{
+    _upperBounds[_nameToVariable[name]] = ub;
+}
+
+double NativeLPSolver::getLowerBound( const String &name )
+{
+    return _lowerBounds[_nameToVariable[name]];
+}
+
+double NativeLPSolver::getUpperBound( const String &name )
+{
+    return _upperBounds[_nameToVariable[name]];
+}
+
+void NativeLPSolver::addLeqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( toIndexedTerms( terms ), FloatUtils::negativeInfinity(), scalar );
+}
+
+void NativeLPSolver::addGeqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( toIndexedTerms( terms ), scalar, FloatUtils::infinity() );
+}
+
+void NativeLPSolver::addEqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( toIndexedTerms( terms ), scalar, scalar );
+}
+
+void NativeLPSolver::addConstraint( const List<IndexedTerm> &terms, double lb, double ub )
+{
+    Constraint constraint;
+    constraint._terms = terms;
+    constraint._lb = lb;
+    constraint._ub = ub;
+    _constraints.append( constraint );
+}
+
+void NativeLPSolver::setConstraint( unsigned constraint,
+                                    const List<IndexedTerm> &terms,
+                                    double lb,
+                                    double ub )
+{
+    ASSERT( constraint < _constraints.size() );
+
+    _constraints[constraint]._terms = terms;
+    _constraints[constraint]._lb = lb;
+    _constraints[constraint]._ub = ub;
+}
+
+void NativeLPSolver::setVariableBounds( unsigned variable, double lb, double ub )
+{
+    ASSERT( variable < _variableNames.size() );
+
+    _lowerBounds[variable] = lb;
+    _upperBounds[variable] = ub;
+}
+
+double NativeLPSolver::getValue( unsigned variable ) const
+{
+    ASSERT( variable < _n );
+    return _assignment[variable];
+}
+
+List<NativeLPSolver::IndexedTerm> NativeLPSolver::toIndexedTerms( const List<Term> &terms )
+{
+    List<IndexedTerm> indexedTerms;
+    for ( const auto &term : terms )
+        indexedTerms.append( IndexedTerm( term._coefficient, _nameToVariable[term._variable] ) );
+    return indexedTerms;
+}
+
+void NativeLPSolver::addPiecewiseLinearConstraint( String /* sourceVariable */,
+                                                   String /* targetVariable */,
+                                                   unsigned /* numPoints */,
+                                                   const double * /* xPoints */,
+                                                   const double * /* yPoints */ )
+{
+    throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                        "NativeLPSolver does not support piecewise-linear constraints" );
+}
+
+void NativeLPSolver::addLeqIndicatorConstraint( const String /* binVarName */,
+                                                const int /* binVal */,
+                                                const List<Term> & /* terms */,
+                                                double /* scalar */ )
+{
+    throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                        "NativeLPSolver does not support indicator constraints" );
+}
+
+void NativeLPSolver::addGeqIndicatorConstraint( const String /* binVarName */,
+                                                const int /* binVal */,
+                                                const List<Term> & /* terms */,
+                                                double /* scalar */ )
+{
+    throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                        "NativeLPSolver does not support indicator constraints" );
+}
+
+void NativeLPSolver::addEqIndicatorConstraint( const String /* binVarName */,
+                                               const int /* binVal */,
+                                               const List<Term> & /* terms */,
+                                               double /* scalar */ )
+{
+    throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                        "NativeLPSolver does not support indicator constraints" );
+}
+
+void NativeLPSolver::addBilinearConstraint( const String /* input1 */,
+                                            const String /* input2 */,
+                                            const String /* output */ )
+{
+    throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                        "NativeLPSolver does not support bilinear constraints" );
+}
+
+void NativeLPSolver::nonConvex()
+{
+}
+
+void NativeLPSolver::setCost( const List<Term> &terms, double constant )
+{
+    setObjectiveFunction( terms, constant, false );
+}
+
+void NativeLPSolver::setObjective( const List<Term> &terms, double constant )
+{
+    setObjectiveFunction( terms, constant, true );
+}
+
+void NativeLPSolver::setObjectiveFunction( const List<Term> &terms, double constant, bool maximize )
+{
+    _cost.clear();
+    for ( const auto &term : terms )
+    {
+        unsigned variable = _nameToVariable[term._variable];
+        if ( !_cost.exists( variable ) )
+            _cost[variable] = 0;
+        _cost[variable] += term._coefficient;
+    }
+
+    _costConstant = constant;
+    _maximize = maximize;
+}
+
+double NativeLPSolver::getOptimalCostOrObjective()
+{
+    return _optimalValue;
+}
+
+void NativeLPSolver::setCutoff( double cutoff )
+{
+    _cutoffInUse = true;
+    _cutoff = cutoff;
+}
+
+bool NativeLPSolver::optimal()
+{
+    return _status == OPTIMAL;
+}
+
+bool NativeLPSolver::cutoffOccurred()
+{
+    return _status == CUTOFF;
+}
+
+bool NativeLPSolver::infeasible()
+{
+    return _status == INFEASIBLE;
+}
+
+bool NativeLPSolver::timeout()
+{
+    return _status == TIME_LIMIT;
+}
+
+bool NativeLPSolver::failed() const
+{
+    return _status == ITERATION_LIMIT || _status == NUMERICAL_FAILURE;
+}
+
+bool NativeLPSolver::haveFeasibleSolution()
+{
+    return _status == OPTIMAL || _status == CUTOFF;
+}
+
+void NativeLPSolver::setTimeLimit( double seconds )
+{
+    _timeoutInSeconds = seconds;
+}
+
+void NativeLPSolver::setVerbosity( unsigned /* verbosity */ )
+{
+}
+
+bool NativeLPSolver::containsVariable( String name ) const
+{
+    return _nameToVariable.exists( name );
+}
+
+void NativeLPSolver::setNumberOfThreads( unsigned /* threads */ )
+{
+}
+
+void NativeLPSolver::extractSolution( Map<String, double> &values, double &costOrObjective )
+{
+    values.clear();
+
+    for ( unsigned i = 0; i < _n; ++i )
+        values[_variableNames[i]] = _assignment[i];
+
+    costOrObjective = _optimalValue;
+}
+
+double NativeLPSolver::getObjectiveBound()
+{
+    if ( haveFeasibleSolution() )
+        return _optimalValue;
+
+    // No bound is known: return the trivial one
+    return _maximize ? FloatUtils::infinity() : FloatUtils::negativeInfinity();
+}
+
+double NativeLPSolver::getAssignment( const String &variable )
+{
+    if ( !existsAssignment( variable ) )
+        throw MarabouError( MarabouError::VARIABLE_DOESNT_EXIST_IN_SOLUTION,
+                            Stringf( "Variable %s does not exist in the solution",
+                                     variable.ascii() )
+                                .ascii() );
+
+    return _assignment[_nameToVariable[variable]];
+}
+
+bool NativeLPSolver::existsAssignment( const String &variable )
+{
+    return haveFeasibleSolution() && _nameToVariable.exists( variable ) &&
+           _nameToVariable[variable] < _n;
+}
+
+unsigned NativeLPSolver::getNumberOfSimplexIterations()
+{
+    return _numberOfIterations;
+}
+
+unsigned NativeLPSolver::getNumberOfNodes()
+{
+    return 0;
+}
+
+unsigned NativeLPSolver::getStatusCode()
+{
+    return _status;
+}
+
+void NativeLPSolver::updateModel()
+{
+}
+
+void NativeLPSolver::getColumnOfBasis( unsigned column, double *result ) const
+{
+    ASSERT( column < _m );
+    _columns[_basicIndexToVariable[column]]->toDense( result );
+}
+
+void NativeLPSolver::getColumnOfBasis( unsigned column, SparseUnsortedList *result ) const
+{
+    ASSERT( column < _m );
+    _columns[_basicIndexToVariable[column]]->storeIntoOther( result );
+}
+
+void NativeLPSolver::getSparseBasis( SparseColumnsOfBasis &basis ) const
+{
+    for ( unsigned i = 0; i < _m; ++i )
+        basis._columns[i] = _columns[_basicIndexToVariable[i]];
+}
+
+void NativeLPSolver::solve()
+{
+    _numberOfIterations = 0;
+    initializeSimplex();
+
+    bool warmStart = canWarmStart();
+    try
+    {
+        initializeBasis( warmStart );
+        _status = runSimplex();
+    }
+    catch ( const MalformedBasisException & )
+    {
+        if ( !warmStart )
+        {
+            _status = NUMERICAL_FAILURE;
+            return;
+        }
+
+        // The warm start basis did not fit this model, start over
+        try
+        {
+            initializeBasis( false );
+            _status = runSimplex();
+        }
+        catch ( const MalformedBasisException & )
+        {
+            _status = NUMERICAL_FAILURE;
+            return;
+        }
+    }
+
+    if ( _status == TIME_LIMIT || failed() )
+        return;
+
+    storeWarmStartBasis();
+
+    if ( _status == OPTIMAL )
+    {
+        _optimalValue = computeObjectiveValue();
+        if ( _cutoffInUse && ( _maximize ? FloatUtils::lt( _optimalValue, _cutoff )
+                                         : FloatUtils::gt( _optimalValue, _cutoff ) ) )
+            _status = CUTOFF;
+    }
+}
+
+void NativeLPSolver::initializeSimplex()
+{
+    freeSimplexIfNeeded();
+
+    _n = _variableNames.size();
+    _m = _constraints.size();
+    unsigned total = _n + _m;
+
+    _columns.assign( total, NULL );
+    for ( unsigned i = 0; i < total; ++i )
+        _columns[i] = new SparseUnsortedList( _m );
+
+    // Structural variables: the columns of A. Entries of repeated
+    // variables within a constraint are accumulated.
+    Vector<double> row( _n, 0 );
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        List<unsigned> participating;
+        for ( const auto &term : _constraints[i]._terms )
+        {
+            unsigned variable = term._variable;
+            if ( row[variable] == 0 )
+                participating.append( variable );
+            row[variable] += term._coefficient;
+        }
+
+        for ( unsigned variable : participating )
+        {
+            if ( !FloatUtils::isZero( row[variable] ) )
+                _columns[variable]->append( i, row[variable] );
+            row[variable] = 0;
+        }
+
+        // Auxiliary variable
+        _columns[_n + i]->append( i, -1 );
+    }
+
+    _lb.assign( total, 0 );
+    _ub.assign( total, 0 );
+    for ( unsigned i = 0; i < _n; ++i )
+    {
+        _lb[i] = _lowerBounds[i];
+        _ub[i] = _upperBounds[i];
+    }
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        _lb[_n + i] = _constraints[i]._lb;
+        _ub[_n + i] = _constraints[i]._ub;
+    }
+
+    // The cost function is always minimized
+    _costs.assign( total, 0 );
+    for ( const auto &entry : _cost )
+        _costs[entry.first] = _maximize ? -entry.second : entry.second;
+
+    _assignment.assign( total, 0 );
+    _basicIndexToVariable.assign( _m, 0 );
+    _variableToBasicIndex.assign( total, -1 );
+
+    _basicCosts.assign( _m, 0 );
+    _multipliers.assign( _m, 0 );
+    _changeColumn.assign( _m, 0 );
+    _work.assign( _m, 0 );
+
+    if ( _basisFactorizationSize != _m )
+    {
+        if ( _basisFactorization )
+        {
+            delete _basisFactorization;
+            _basisFactorization = NULL;
+        }
+
+        if ( _m > 0 )
+            _basisFactorization = BasisFactorizationFactory::createBasisFactorization( _m, *this );
+        _basisFactorizationSize = _m;
+    }
+}
+
+bool NativeLPSolver::canWarmStart() const
+{
+    return ( _warmStartM > 0 || _warmStartN > 0 ) && _warmStartN <= _n && _warmStartM <= _m;
+}
+
+void NativeLPSolver::initializeBasis( bool warmStart )
+{
+    unsigned total = _n + _m;
+    for ( unsigned i = 0; i < total; ++i )
+        _variableToBasicIndex[i] = -1;
+
+    if ( warmStart )
+    {
+        // Old auxiliary variables are shifted by the number of new
+        // structural variables, and new constraints are initially
+        // represented by their auxiliary variables. Any basis of the
+        // old constraints thus extends to a basis of the new ones.
+        for ( unsigned i = 0; i < _warmStartM; ++i )
+        {
+            unsigned variable = _warmStartBasis[i];
+            if ( variable >= _warmStartN )
+                variable += _n - _warmStartN;
+            _basicIndexToVariable[i] = variable;
+        }
+        for ( unsigned i = _warmStartM; i < _m; ++i )
+            _basicIndexToVariable[i] = _n + i;
+    }
+    else
+    {
+        for ( unsigned i = 0; i < _m; ++i )
+            _basicIndexToVariable[i] = _n + i;
+    }
+
+    for ( unsigned i = 0; i < _m; ++i )
+        _variableToBasicIndex[_basicIndexToVariable[i]] = i;
+
+    // Place the non-basic variables at one of their bounds
+    for ( unsigned i = 0; i < total; ++i )
+    {
+        if ( isBasic( i ) )
+            continue;
+
+        unsigned oldIndex = i;
+        if ( i >= _n )
+            oldIndex = i - ( _n - _warmStartN );
+
+        bool atUpperBound = warmStart && ( i < _warmStartN || i >= _n ) &&
+                            _warmStartAtUpperBound.exists( oldIndex );
+
+        if ( atUpperBound && FloatUtils::isFinite( _ub[i] ) )
+            _assignment[i] = _ub[i];
+        else if ( FloatUtils::isFinite( _lb[i] ) )
+            _assignment[i] = _lb[i];
+        else if ( FloatUtils::isFinite( _ub[i] ) )
+            _assignment[i] = _ub[i];
+        else
+            _assignment[i] = 0;
+    }
+
+    if ( _m > 0 )
+        _basisFactorization->obtainFreshBasis();
+}
+
+bool NativeLPSolver::isBasic( unsigned variable ) const
+{
+    return _variableToBasicIndex[variable] >= 0;
+}
+
+void NativeLPSolver::computeBasicAssignment()
+{
+    if ( _m == 0 )
+        return;
+
+    // B * x_B = - N * x_N
+    for ( unsigned i = 0; i < _m; ++i )
+        _work[i] = 0;
+
+    for ( unsigned i = 0; i < _n + _m; ++i )
+    {
+        if ( isBasic( i ) || _assignment[i] == 0 )
+            continue;
+
+        for ( const auto &entry : *_columns[i] )
+            _work[entry._index] -= entry._value * _assignment[i];
+    }
+
+    _basisFactorization->forwardTransformation( _work.data(), _changeColumn.data() );
+
+    for ( unsigned i = 0; i < _m; ++i )
+        _assignment[_basicIndexToVariable[i]] = _changeColumn[i];
+}
+
+bool NativeLPSolver::computeBasicCosts()
+{
+    bool phaseOne = false;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        unsigned variable = _basicIndexToVariable[i];
+        double value = _assignment[variable];
+
+        if ( FloatUtils::lt( value,
+                             _lb[variable],
+                             GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE ) )
+        {
+            _basicCosts[i] = -1;
+            phaseOne = true;
+        }
+        else if ( FloatUtils::gt( value,
+                                  _ub[variable],
+                                  GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE ) )
+        {
+            _basicCosts[i] = 1;
+            phaseOne = true;
+        }
+        else
+            _basicCosts[i] = 0;
+    }
+
+    if ( !phaseOne )
+    {
+        for ( unsigned i = 0; i < _m; ++i )
+            _basicCosts[i] = _costs[_basicIndexToVariable[i]];
+    }
+
+    return phaseOne;
+}
+
+double NativeLPSolver::getReducedCost( unsigned variable, bool phaseOne ) const
+{
+    double reducedCost = phaseOne ? 0 : _costs[variable];
+    for ( const auto &entry : *_columns[variable] )
+        reducedCost -= _multipliers[entry._index] * entry._value;
+
+    return reducedCost;
+}
+
+bool NativeLPSolver::pickEnteringVariable( bool phaseOne,
+                                           bool useBlandsRule,
+                                           unsigned &entering,
+                                           int &direction )
+{
+    double bestScore = 0;
+    bool found = false;
+
+    for ( unsigned i = 0; i < _n + _m; ++i )
+    {
+        if ( isBasic( i ) || _lb[i] == _ub[i] )
+            continue;
+
+        double reducedCost = getReducedCost( i, phaseOne );
+        int candidateDirection = 0;
+
+        // A negative reduced cost means the cost decreases as the
+        // variable increases, and vice versa
+        if ( reducedCost < -GlobalConfiguration::ENTRY_ELIGIBILITY_TOLERANCE &&
+             FloatUtils::lt( _assignment[i], _ub[i] ) )
+            candidateDirection = 1;
+        else if ( reducedCost > GlobalConfiguration::ENTRY_ELIGIBILITY_TOLERANCE &&
+                  FloatUtils::gt( _assignment[i], _lb[i] ) )
+            candidateDirection = -1;
+
+        if ( candidateDirection == 0 )
+            continue;
+
+        if ( useBlandsRule )
+        {
+            entering = i;
+            direction = candidateDirection;
+            return true;
+        }
+
+        if ( FloatUtils::abs( reducedCost ) > bestScore )
+        {
+            bestScore = FloatUtils::abs( reducedCost );
+            entering = i;
+            direction = candidateDirection;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+NativeLPSolver::Status NativeLPSolver::runSimplex()
+{
+    struct timespec start = TimeUtils::sampleMicro();
+    unsigned long long timeoutInMicroSeconds =
+        FloatUtils::isFinite( _timeoutInSeconds )
+            ? (unsigned long long)( _timeoutInSeconds * 1000000 )
+            : 0;
+
+    unsigned degenerateSteps = 0;
+    unsigned stepsSinceRecomputation = 0;
+    bool freshBasis = true;
+
+    computeBasicAssignment();
+
+    while ( true )
+    {
+        if ( _numberOfIterations >= GlobalConfiguration::NATIVE_LP_SOLVER_MAX_ITERATIONS )
+            return ITERATION_LIMIT;
+
+        if ( timeoutInMicroSeconds > 0 &&
+             TimeUtils::timePassed( start, TimeUtils::sampleMicro() ) > timeoutInMicroSeconds )
+            return TIME_LIMIT;
+
+        bool phaseOne = computeBasicCosts();
+        if ( _m > 0 )
+            _basisFactorization->backwardTransformation( _basicCosts.data(),
+                                                         _multipliers.data() );
+
+        unsigned entering = 0;
+        int direction = 0;
+        bool useBlandsRule =
+            degenerateSteps > GlobalConfiguration::NATIVE_LP_SOLVER_DEGENERATE_STEPS_BEFORE_BLAND;
+        if ( !pickEnteringVariable( phaseOne, useBlandsRule, entering, direction ) )
+        {
+            // Before concluding, make sure this is not an artifact of
+            // accumulated numerical errors
+            if ( !freshBasis && _m > 0 )
+            {
+                _basisFactorization->obtainFreshBasis();
+                computeBasicAssignment();
+                stepsSinceRecomputation = 0;
+                freshBasis = true;
+                continue;
+            }
+
+            return phaseOne ? INFEASIBLE : OPTIMAL;
+        }
+
+        ++_numberOfIterations;
+
+        // The change column: when the entering variable changes by
+        // delta, the basic variables change by -delta * B^-1 * a_q
+        for ( unsigned i = 0; i < _m; ++i )
+            _work[i] = 0;
+        _columns[entering]->toDense( _work.data() );
+        if ( _m > 0 )
+            _basisFactorization->forwardTransformation( _work.data(), _changeColumn.data() );
+
+        // The ratio test. The entering variable may also hit its own
+        // opposite bound, in which case there is no pivot.
+        double maxStep = FloatUtils::infinity();
+        if ( FloatUtils::isFinite( _lb[entering] ) && FloatUtils::isFinite( _ub[entering] ) )
+            maxStep = _ub[entering] - _lb[entering];
+
+        int leavingIndex = -1;
+        double leavingValue = 0;
+        double leavingRate = 0;
+        for ( unsigned i = 0; i < _m; ++i )
+        {
+            if ( FloatUtils::isZero( _changeColumn[i],
+                                     GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE ) )
+                continue;
+
+            unsigned variable = _basicIndexToVariable[i];
+            double value = _assignment[variable];
+            double rate = -_changeColumn[i] * direction;
+            double bound;
+
+            if ( rate > 0 )
+            {
+                // Variables below their lower bound stop once they
+                // become feasible
+                if ( phaseOne &&
+                     FloatUtils::lt( value,
+                                     _lb[variable],
+                                     GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE ) )
+                    bound = _lb[variable];
+                else if ( FloatUtils::isFinite( _ub[variable] ) &&
+                          !FloatUtils::gt(
+                              value,
+                              _ub[variable],
+                              GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE ) )
+                    bound = _ub[variable];
+                else
+                    continue;
+            }
+            else
+            {
+                if ( phaseOne &&
+                     FloatUtils::gt( value,
+                                     _ub[variable],
+                                     GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE ) )
+                    bound = _ub[variable];
+                else if ( FloatUtils::isFinite( _lb[variable] ) &&
+                          !FloatUtils::lt(
+                              value,
+                              _lb[variable],
+                              GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE ) )
+                    bound = _lb[variable];
+                else
+                    continue;
+            }
+
+            double step = ( bound - value ) / rate;
+            if ( step < 0 )
+                step = 0;
+
+            // Among (almost) equal steps, prefer larger pivot elements
+            // and then smaller variable indices. Under Bland's rule,
+            // only the index counts, so that cycling is avoided.
+            bool better = false;
+            if ( FloatUtils::lt( step, maxStep ) )
+                better = true;
+            else if ( leavingIndex >= 0 && FloatUtils::areEqual( step, maxStep ) )
+            {
+                bool smallerIndex = variable < _basicIndexToVariable[leavingIndex];
+                if ( useBlandsRule )
+                    better = smallerIndex;
+                else if ( FloatUtils::areEqual( FloatUtils::abs( rate ),
+                                                FloatUtils::abs( leavingRate ) ) )
+                    better = smallerIndex;
+                else
+                    better = FloatUtils::abs( rate ) > FloatUtils::abs( leavingRate );
+            }
+
+            if ( better )
+            {
+                maxStep = step;
+                leavingIndex = i;
+                leavingValue = bound;
+                leavingRate = rate;
+            }
+        }
+
+        if ( !FloatUtils::isFinite( maxStep ) )
+        {
+            // The phase one cost is bounded from below, so an unbounded
+            // ray there is a numerical artifact
+            return phaseOne ? NUMERICAL_FAILURE : UNBOUNDED;
+        }
+
+        if ( FloatUtils::isZero( maxStep ) )
+            ++degenerateSteps;
+        else
+            degenerateSteps = 0;
+
+        freshBasis = false;
+        if ( leavingIndex < 0 )
+        {
+            // Bound flip
+            updateAssignment( entering, direction, maxStep );
+            _assignment[entering] = ( direction > 0 ) ? _ub[entering] : _lb[entering];
+        }
+        else
+        {
+            unsigned leaving = _basicIndexToVariable[leavingIndex];
+            updateAssignment( entering, direction, maxStep );
+            _assignment[leaving] = leavingValue;
+
+            _basicIndexToVariable[leavingIndex] = entering;
+            _variableToBasicIndex[entering] = leavingIndex;
+            _variableToBasicIndex[leaving] = -1;
+
+            // _work still holds the dense entering column
+            _basisFactorization->updateToAdjacentBasis( leavingIndex,
+                                                        _changeColumn.data(),
+                                                        _work.data() );
+        }
+
+        // The incremental updates accumulate numerical errors, so the
+        // basic variables are periodically recomputed from scratch
+        if ( ++stepsSinceRecomputation >=
+             GlobalConfiguration::NATIVE_LP_SOLVER_ASSIGNMENT_RECOMPUTATION_FREQUENCY )
+        {
+            computeBasicAssignment();
+            stepsSinceRecomputation = 0;
+        }
+    }
+}
+
+void NativeLPSolver::updateAssignment( unsigned entering, int direction, double step )
+{
+    // The basic variables change by -delta * B^-1 * a_q, with the
+    // change column B^-1 * a_q already in _changeColumn
+    double delta = direction * step;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( _changeColumn[i] != 0 )
+            _assignment[_basicIndexToVariable[i]] -= _changeColumn[i] * delta;
+    }
+
+    _assignment[entering] += delta;
+}
+
+void NativeLPSolver::storeWarmStartBasis()
+{
+    _warmStartN = _n;
+    _warmStartM = _m;
+    _warmStartBasis = _basicIndexToVariable;
+
+    _warmStartAtUpperBound.clear();
+    for ( unsigned i = 0; i < _n + _m; ++i )
+    {
+        if ( !isBasic( i ) && FloatUtils::isFinite( _ub[i] ) && _lb[i] != _ub[i] &&
+             _assignment[i] == _ub[i] )
+            _warmStartAtUpperBound.insert( i );
+    }
+}
+
+double NativeLPSolver::computeObjectiveValue() const
+{
+    double value = _costConstant;
+    for ( const auto &entry : _cost )
+        value += entry.second * _assignment[entry.first];
+
+    return value;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,291 @@
+/*********************                                                        */
+/*! \file NativeLPSolver.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __NativeLPSolver_h__
+#define __NativeLPSolver_h__
+
+#include "IBasisFactorization.h"
+#include "ILPSolver.h"
+#include "Set.h"
+#include "SparseUnsortedList.h"
+#include "Vector.h"
+
+/*
+  An LP solver that does not depend on an external library. The model
+  is kept in the form
+
+    A x - s = 0,    l <= ( x, s ) <= u
+
+  with one auxiliary variable s per constraint, whose bounds encode the
+  sense and scalar of the constraint. The model is solved with a
+  bounded-variable, revised primal simplex: phase one minimizes the sum
+  of infeasibilities of the basic variables, and phase two minimizes
+  the actual cost. The basis is maintained by the same basis
+  factorizations that are used by the Tableau.
+
+  The final basis of every solve is kept, also across calls to
+  resetModel(). If the next model has at least as many variables and
+  constraints (e.g., when optimizing the bounds of successive neurons
+  over the same LP relaxation, or when the model is extended
+  incrementally), the simplex is warm-started from that basis.
+
+  Only continuous variables and linear constraints are supported; see
+  NativeMILPSolver for integer variables and indicator constraints.
+*/
+class NativeLPSolver
+    : public ILPSolver
+    , public IBasisFactorization::BasisColumnOracle
+{
+public:
+    NativeLPSolver();
+    ~NativeLPSolver();
+
+    void addVariable( String name, double lb, double ub, VariableType type = CONTINUOUS ) override;
+
+    void setLowerBound( String name, double lb ) override;
+    void setUpperBound( String name, double ub ) override;
+    double getLowerBound( const String &name ) override;
+    double getUpperBound( const String &name ) override;
+
+    void addLeqConstraint( const List<Term> &terms, double scalar ) override;
+    void addGeqConstraint( const List<Term> &terms, double scalar ) override;
+    void addEqConstraint( const List<Term> &terms, double scalar ) override;
+
+    void addPiecewiseLinearConstraint( String sourceVariable,
+                                       String targetVariable,
+                                       unsigned numPoints,
+                                       const double *xPoints,
+                                       const double *yPoints ) override;
+    void addLeqIndicatorConstraint( const String binVarName,
+                                    const int binVal,
+                                    const List<Term> &terms,
+                                    double scalar ) override;
+    void addGeqIndicatorConstraint( const String binVarName,
+                                    const int binVal,
+                                    const List<Term> &terms,
+                                    double scalar ) override;
+    void addEqIndicatorConstraint( const String binVarName,
+                                   const int binVal,
+                                   const List<Term> &terms,
+                                   double scalar ) override;
+    void
+    addBilinearConstraint( const String input1, const String input2, const String output ) override;
+    void nonConvex() override;
+
+    void setCost( const List<Term> &terms, double constant = 0 ) override;
+    void setObjective( const List<Term> &terms, double constant = 0 ) override;
+    double getOptimalCostOrObjective() override;
+
+    void setCutoff( double cutoff ) override;
+
+    bool optimal() override;
+    bool cutoffOccurred() override;
+    bool infeasible() override;
+    bool timeout() override;
+    bool haveFeasibleSolution() override;
+
+    void setTimeLimit( double seconds ) override;
+
+    void setVerbosity( unsigned verbosity ) override;
+    bool containsVariable( String name ) const override;
+    void setNumberOfThreads( unsigned threads ) override;
+
+    void solve() override;
+    void extractSolution( Map<String, double> &values, double &costOrObjective ) override;
+    double getObjectiveBound() override;
+    double getAssignment( const String &variable ) override;
+    bool existsAssignment( const String &variable ) override;
+    unsigned getNumberOfSimplexIterations() override;
+    unsigned getNumberOfNodes() override;
+    unsigned getStatusCode() override;
+    void updateModel() override;
+
+    void reset() override;
+    void resetModel() override;
+
+    /*
+      Returns true iff the last solve gave up before reaching a
+      conclusion for a reason other than the time limit: the iteration
+      limit, or a numerical failure
+    */
+    bool failed() const;
+
+    /*
+      A term whose variable is given by its index, i.e., by the order
+      in which the variables were added
+    */
+    struct IndexedTerm
+    {
+        IndexedTerm( double coefficient, unsigned variable )
+            : _coefficient( coefficient )
+            , _variable( variable )
+        {
+        }
+
+        double _coefficient;
+        unsigned _variable;
+    };
+
+    /*
+      Access the model by variable and constraint indices instead of
+      by variable names. This is how NativeMILPSolver solves the LP
+      relaxations of its nodes, which share the same variables and
+      constraints and differ only in bounds and coefficients.
+    */
+    void addConstraint( const List<IndexedTerm> &terms, double lb, double ub );
+    void setConstraint( unsigned constraint, const List<IndexedTerm> &terms, double lb, double ub );
+    void setVariableBounds( unsigned variable, double lb, double ub );
+    double getValue( unsigned variable ) const;
+
+    /*
+      BasisColumnOracle methods, used by the basis factorization
+    */
+    void getColumnOfBasis( unsigned column, double *result ) const override;
+    void getColumnOfBasis( unsigned column, SparseUnsortedList *result ) const override;
+    void getSparseBasis( SparseColumnsOfBasis &basis ) const override;
+
+private:
+    enum Status {
+        NOT_SOLVED = 0,
+        OPTIMAL = 1,
+        INFEASIBLE = 2,
+        UNBOUNDED = 3,
+        CUTOFF = 4,
+        TIME_LIMIT = 5,
+        ITERATION_LIMIT = 6,
+        NUMERICAL_FAILURE = 7,
+    };
+
+    struct Constraint
+    {
+        List<IndexedTerm> _terms;
+        double _lb;
+        double _ub;
+    };
+
+    /*
+      The model
+    */
+    Map<String, unsigned> _nameToVariable;
+    Vector<String> _variableNames;
+    Vector<double> _lowerBounds;
+    Vector<double> _upperBounds;
+    Vector<Constraint> _constraints;
+    Map<unsigned, double> _cost;
+    double _costConstant;
+    bool _maximize;
+    bool _cutoffInUse;
+    double _cutoff;
+    double _timeoutInSeconds;
+
+    /*
+      The result of the last solve
+    */
+    Status _status;
+    double _optimalValue;
+    unsigned _numberOfIterations;
+
+    /*
+      The simplex state. There are _n structural and _m auxiliary
+      variables; the auxiliary variable of constraint i is _n + i.
+      _columns holds the columns of [ A | -I ], and _lb and _ub hold
+      the bounds of all _n + _m variables.
+    */
+    unsigned _n;
+    unsigned _m;
+    Vector<SparseUnsortedList *> _columns;
+    Vector<double> _lb;
+    Vector<double> _ub;
+    Vector<double> _costs;
+    Vector<double> _assignment;
+    Vector<unsigned> _basicIndexToVariable;
+    Vector<int> _variableToBasicIndex;
+    IBasisFactorization *_basisFactorization;
+    unsigned _basisFactorizationSize;
+
+    /*
+      The final basis of the previous solve, used for warm starts
+    */
+    unsigned _warmStartN;
+    unsigned _warmStartM;
+    Vector<unsigned> _warmStartBasis;
+    Set<unsigned> _warmStartAtUpperBound;
+
+    /*
+      Work memory
+    */
+    Vector<double> _basicCosts;
+    Vector<double> _multipliers;
+    Vector<double> _changeColumn;
+    Vector<double> _work;
+
+    List<IndexedTerm> toIndexedTerms( const List<Term> &terms );
+    void setObjectiveFunction( const List<Term> &terms, double constant, bool maximize );
+
+    /*
+      Build the simplex state from the model, starting from the warm
+      start basis if it fits the model, or from the all-auxiliary
+      basis otherwise
+    */
+    void initializeSimplex();
+    void initializeBasis( bool warmStart );
+    void freeSimplexIfNeeded();
+    bool canWarmStart() const;
+
+    /*
+      Recompute the values of the basic variables from the values of
+      the non-basic ones
+    */
+    void computeBasicAssignment();
+
+    /*
+      The main simplex loop. Returns the status reached.
+    */
+    Status runSimplex();
+
+    /*
+      Compute the costs of the basic variables. If some basic variable
+      is out of bounds, these are the phase one costs and the method
+      returns true; otherwise, these are the actual costs.
+    */
+    bool computeBasicCosts();
+
+    /*
+      Pick the entering variable and the direction in which it should
+      change, given the current simplex multipliers. Returns false if
+      no non-basic variable is eligible.
+    */
+    bool
+    pickEnteringVariable( bool phaseOne, bool useBlandsRule, unsigned &entering, int &direction );
+
+    /*
+      Move the entering variable by the given step in its direction,
+      and update the basic variables along the change column
+    */
+    void updateAssignment( unsigned entering, int direction, double step );
+
+    double getReducedCost( unsigned variable, bool phaseOne ) const;
+    bool isBasic( unsigned variable ) const;
+    void storeWarmStartBasis();
+    double computeObjectiveValue() const;
+};
+
+#endif // __NativeLPSolver_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,754 @@
+/*********************                                                        */
+/*! \file NativeMILPSolver.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "NativeMILPSolver.h"
+
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "Options.h"
+#include "TimeUtils.h"
+
+#include <cmath>
+
+NativeMILPSolver::NativeMILPSolver()
+    : _objectiveConstant( 0 )
+    , _maximize( false )
+    , _cutoffInUse( false )
+    , _cutoff( 0 )
+    , _timeoutInSeconds( Options::get()->getFloat( Options::MILP_SOLVER_TIMEOUT ) )
+    , _numberOfPiecewiseLinearConstraints( 0 )
+    , _status( NOT_SOLVED )
+    , _haveIncumbent( false )
+    , _incumbentValue( 0 )
+    , _objectiveBound( 0 )
+    , _numberOfIterations( 0 )
+    , _numberOfNodes( 0 )
+{
+}
+
+NativeMILPSolver::~NativeMILPSolver()
+{
+}
+
+void NativeMILPSolver::resetModel()
+{
+    _nameToVariable.clear();
+    _variableNames.clear();
+    _lowerBounds.clear();
+    _upperBounds.clear();
+    _variableTypes.clear();
+    _internalVariables.clear();
+    _constraints.clear();
+    _indicatorConstraints.clear();
+    _objectiveTerms.clear();
+    _objectiveConstant = 0;
+    _maximize = false;
+    _cutoffInUse = false;
+    _cutoff = 0;
+    _numberOfPiecewiseLinearConstraints = 0;
+    reset();
+}
+
+void NativeMILPSolver::reset()
+{
+    _status = NOT_SOLVED;
+    _haveIncumbent = false;
+    _incumbent.clear();
+    _numberOfIterations = 0;
+    _numberOfNodes = 0;
+}
+
+void NativeMILPSolver::addVariable( String name, double lb, double ub, VariableType type )
+{
+    ASSERT( !_nameToVariable.exists( name ) );
+
+    if ( type == BINARY )
+    {
+        lb = FloatUtils::max( lb, 0 );
+        ub = FloatUtils::min( ub, 1 );
+    }
+
+    _nameToVariable[name] = _variableNames.size();
+    _variableNames.append( name );
+    _lowerBounds.append( lb );
+    _upperBounds.append( ub );
+    _variableTypes.append( type );
+}
+
+void NativeMILPSolver::setLowerBound( String name, double lb )
+{
+    _lowerBounds[_nameToVariable[name]] = lb;
+}
+
+void NativeMILPSolver::setUpperBound( String name, double ub )
+{
+    _upperBounds[_nameToVariable[name]] = ub;
+}
+
+double NativeMILPSolver::getLowerBound( const String &name )
+{
+    return _lowerBounds[_nameToVariable[name]];
+}
+
+double NativeMILPSolver::getUpperBound( const String &name )
+{
+    return _upperBounds[_nameToVariable[name]];
+}
+
+void NativeMILPSolver::addLeqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( terms, FloatUtils::negativeInfinity(), scalar );
+}
+
+void NativeMILPSolver::addGeqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( terms, scalar, FloatUtils::infinity() );
+}
+
+void NativeMILPSolver::addEqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( terms, scalar, scalar );
+}
+
+void NativeMILPSolver::addConstraint( const List<Term> &terms, double lb, double ub )
+{
+    Constraint constraint;
+    constraint._terms = toIndexedTerms( terms );
+    constraint._lb = lb;
+    constraint._ub = ub;
+    _constraints.append( constraint );
+}
+
+void NativeMILPSolver::addPiecewiseLinearConstraint( String sourceVariable,
+                                                     String targetVariable,
+                                                     unsigned numPoints,
+                                                     const double *xPoints,
+                                                     const double *yPoints )
+{
+    ASSERT( numPoints > 0 );
+
+    if ( numPoints == 1 )
+    {
+        addEqConstraint( { Term( 1, targetVariable ) }, yPoints[0] );
+        return;
+    }
+
+    // One binary variable per segment of non-zero width, exactly one of
+    // which is set
+    unsigned id = _numberOfPiecewiseLinearConstraints++;
+    List<Term> selection;
+    for ( unsigned i = 0; i + 1 < numPoints; ++i )
+    {
+        double width = xPoints[i + 1] - xPoints[i];
+        if ( FloatUtils::isZero( width ) )
+            continue;
+
+        String binVarName = Stringf( "__pwl%u_%u", id, i );
+        addVariable( binVarName, 0, 1, BINARY );
+        _internalVariables.insert( _nameToVariable[binVarName] );
+        selection.append( Term( 1, binVarName ) );
+
+        // Within the segment: y - slope * x = intercept
+        double slope = ( yPoints[i + 1] - yPoints[i] ) / width;
+        double intercept = yPoints[i] - slope * xPoints[i];
+        addEqIndicatorConstraint( binVarName,
+                                  1,
+                                  { Term( 1, targetVariable ), Term( -slope, sourceVariable ) },
+                                  intercept );
+
+        // The first and last segments extend to infinity
+        if ( i > 0 )
+            addGeqIndicatorConstraint(
+                binVarName, 1, { Term( 1, sourceVariable ) }, xPoints[i] );
+        if ( i + 2 < numPoints )
+            addLeqIndicatorConstraint(
+                binVarName, 1, { Term( 1, sourceVariable ) }, xPoints[i + 1] );
+    }
+
+    if ( selection.empty() )
+        throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                            "NativeMILPSolver does not support vertical piecewise-linear "
+                            "constraints" );
+
+    addEqConstraint( selection, 1 );
+}
+
+void NativeMILPSolver::addLeqIndicatorConstraint( const String binVarName,
+                                                  const int binVal,
+                                                  const List<Term> &terms,
+                                                  double scalar )
+{
+    addIndicatorConstraint( binVarName, binVal, terms, FloatUtils::negativeInfinity(), scalar );
+}
+
+void NativeMILPSolver::addGeqIndicatorConstraint( const String binVarName,
+                                                  const int binVal,
+                                                  const List<Term> &terms,
+                                                  double scalar )
+{
+    addIndicatorConstraint( binVarName, binVal, terms, scalar, FloatUtils::infinity() );
+}
+
+void NativeMILPSolver::addEqIndicatorConstraint( const String binVarName,
+                                                 const int binVal,
+                                                 const List<Term> &terms,
+                                                 double scalar )
+{
+    addIndicatorConstraint( binVarName, binVal, terms, FloatUtils::negativeInfinity(), scalar );
+    addIndicatorConstraint( binVarName, binVal, terms, scalar, FloatUtils::infinity() );
+}
+
+void NativeMILPSolver::addIndicatorConstraint(
+    const String &binVarName, int binVal, const List<Term> &terms, double lb, double ub )
+{
+    ASSERT( _nameToVariable.exists( binVarName ) );
+    ASSERT( binVal == 0 || binVal == 1 );
+
+    IndicatorConstraint indicator;
+    indicator._binaryVariable = _nameToVariable[binVarName];
+    indicator._binaryValue = binVal;
+    indicator._terms = toIndexedTerms( terms );
+    indicator._lb = lb;
+    indicator._ub = ub;
+    _indicatorConstraints.append( indicator );
+}
+
+List<NativeMILPSolver::IndexedTerm> NativeMILPSolver::toIndexedTerms( const List<Term> &terms )
+{
+    List<IndexedTerm> indexedTerms;
+    for ( const auto &term : terms )
+    {
+        ASSERT( _nameToVariable.exists( term._variable ) );
+        indexedTerms.append( IndexedTerm( term._coefficient, _nameToVariable[term._variable] ) );
+    }
+    return indexedTerms;
+}
+
+void NativeMILPSolver::addBilinearConstraint( const String /* input1 */,
+                                              const String /* input2 */,
+                                              const String /* output */ )
+{
+    throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                        "NativeMILPSolver does not support bilinear constraints" );
+}
+
+void NativeMILPSolver::nonConvex()
+{
+}
+
+void NativeMILPSolver::setCost( const List<Term> &terms, double constant )
+{
+    _objectiveTerms = terms;
+    _objectiveConstant = constant;
+    _maximize = false;
+}
+
+void NativeMILPSolver::setObjective( const List<Term> &terms, double constant )
+{
+    _objectiveTerms = terms;
+    _objectiveConstant = constant;
+    _maximize = true;
+}
+
+double NativeMILPSolver::getOptimalCostOrObjective()
+{
+    return _haveIncumbent ? toMinimization( _incumbentValue ) : 0;
+}
+
+void NativeMILPSolver::setCutoff( double cutoff )
+{
+    _cutoffInUse = true;
+    _cutoff = cutoff;
+}
+
+bool NativeMILPSolver::optimal()
+{
+    return _status == OPTIMAL;
+}
+
+bool NativeMILPSolver::cutoffOccurred()
+{
+    return _status == CUTOFF;
+}
+
+bool NativeMILPSolver::infeasible()
+{
+    return _status == INFEASIBLE;
+}
+
+bool NativeMILPSolver::timeout()
+{
+    return _status == TIME_LIMIT;
+}
+
+bool NativeMILPSolver::haveFeasibleSolution()
+{
+    return _haveIncumbent;
+}
+
+void NativeMILPSolver::setTimeLimit( double seconds )
+{
+    _timeoutInSeconds = seconds;
+}
+
+void NativeMILPSolver::setVerbosity( unsigned /* verbosity */ )
+{
+}
+
+bool NativeMILPSolver::containsVariable( String name ) const
+{
+    return _nameToVariable.exists( name );
+}
+
+void NativeMILPSolver::setNumberOfThreads( unsigned /* threads */ )
+{
+}
+
+void NativeMILPSolver::extractSolution( Map<String, double> &values, double &costOrObjective )
+{
+    values.clear();
+
+    if ( _haveIncumbent )
+    {
+        for ( unsigned i = 0; i < _variableNames.size(); ++i )
+        {
+            if ( !_internalVariables.exists( i ) )
+                values[_variableNames[i]] = _incumbent[i];
+        }
+    }
+
+    costOrObjective = getOptimalCostOrObjective();
+}
+
+double NativeMILPSolver::getObjectiveBound()
+{
+    return toMinimization( _objectiveBound );
+}
+
+double NativeMILPSolver::getAssignment( const String &variable )
+{
+    if ( !existsAssignment( variable ) )
+        throw MarabouError( MarabouError::VARIABLE_DOESNT_EXIST_IN_SOLUTION,
+                            Stringf( "Variable %s does not exist in the solution",
+                                     variable.ascii() )
+                                .ascii() );
+
+    return _incumbent[_nameToVariable[variable]];
+}
+
+bool NativeMILPSolver::existsAssignment( const String &variable )
+{
+    return _haveIncumbent && _nameToVariable.exists( variable ) &&
+           _nameToVariable[variable] < _incumbent.size();
+}
+
+unsigned NativeMILPSolver::getNumberOfSimplexIterations()
+{
+    return _numberOfIterations;
+}
+
+unsigned NativeMILPSolver::getNumberOfNodes()
+{
+    return _numberOfNodes;
+}
+
+unsigned NativeMILPSolver::getStatusCode()
+{
+    return _status;
+}
+
+void NativeMILPSolver::updateModel()
+{
+}
+
+void NativeMILPSolver::solve()
+{
+    struct timespec start = TimeUtils::sampleMicro();
+
+    reset();
+    _incumbentValue = FloatUtils::infinity();
+    _objectiveBound = FloatUtils::negativeInfinity();
+
+    _integerVariables.clear();
+    _variableToIntegerIndex = Vector<int>( _variableNames.size(), -1 );
+    for ( unsigned i = 0; i < _variableNames.size(); ++i )
+    {
+        if ( _variableTypes[i] != CONTINUOUS )
+        {
+            _variableToIntegerIndex[i] = _integerVariables.size();
+            _integerVariables.append( i );
+        }
+    }
+
+    Node root;
+    if ( !initializeRoot( root ) )
+    {
+        _status = INFEASIBLE;
+        return;
+    }
+
+    initializeRelaxation();
+
+    double cutoff = _cutoffInUse ? toMinimization( _cutoff ) : FloatUtils::infinity();
+    bool cutoffOccurred = false;
+
+    // Depth-first: the last node of the list is explored next
+    List<Node> nodes;
+    nodes.append( root );
+
+    Vector<double> values;
+    while ( !nodes.empty() )
+    {
+        double remainingTime = FloatUtils::infinity();
+        if ( _timeoutInSeconds > 0 && FloatUtils::isFinite( _timeoutInSeconds ) )
+            remainingTime = _timeoutInSeconds -
+                            TimeUtils::timePassed( start, TimeUtils::sampleMicro() ) / 1000000.0;
+
+        if ( remainingTime <= 0 ||
+             _numberOfNodes >= GlobalConfiguration::NATIVE_MILP_SOLVER_MAX_NODES )
+        {
+            _status = TIME_LIMIT;
+            break;
+        }
+
+        Node node = nodes.back();
+        nodes.popBack();
+
+        // The bound of the node may have been superseded since it was created
+        if ( _haveIncumbent && FloatUtils::gte( node._bound, _incumbentValue ) )
+            continue;
+        if ( FloatUtils::gt( node._bound, cutoff ) )
+        {
+            cutoffOccurred = true;
+            continue;
+        }
+
+        ++_numberOfNodes;
+        solveRelaxation( node, remainingTime, values );
+
+        if ( _lpSolver.infeasible() )
+            continue;
+
+        if ( _lpSolver.timeout() )
+        {
+            nodes.append( node );
+            _status = TIME_LIMIT;
+            break;
+        }
+
+        if ( !_lpSolver.optimal() )
+        {
+            // The relaxation could not be solved
+            _status = _lpSolver.failed() ? LP_FAILURE : UNBOUNDED;
+            break;
+        }
+
+        double value = toMinimization( _lpSolver.getOptimalCostOrObjective() );
+        if ( _haveIncumbent && FloatUtils::gte( value, _incumbentValue ) )
+            continue;
+        if ( FloatUtils::gt( value, cutoff ) )
+        {
+            cutoffOccurred = true;
+            continue;
+        }
+
+        unsigned index;
+        if ( !pickBranchingVariable( node, values, index ) )
+        {
+            _haveIncumbent = true;
+            _incumbentValue = value;
+            _incumbent = values;
+            continue;
+        }
+
+        double branchingValue = values[_integerVariables[index]];
+        Node down = node;
+        Node up = node;
+        down._bound = value;
+        up._bound = value;
+
+        if ( FloatUtils::isZero( branchingValue - std::round( branchingValue ),
+                                 GlobalConfiguration::NATIVE_MILP_SOLVER_INTEGRALITY_TOLERANCE ) )
+        {
+            // The binary variable of a violated indicator constraint
+            down._upperBounds[index] = node._lowerBounds[index];
+            up._lowerBounds[index] = node._lowerBounds[index] + 1;
+        }
+        else
+        {
+            down._upperBounds[index] = std::floor( branchingValue );
+            up._lowerBounds[index] = std::ceil( branchingValue );
+        }
+
+        // Explore the child that is closer to the value of the relaxation first
+        bool downFirst = branchingValue - std::floor( branchingValue ) < 0.5;
+        const Node &first = downFirst ? down : up;
+        const Node &second = downFirst ? up : down;
+
+        if ( second._lowerBounds[index] <= second._upperBounds[index] )
+            nodes.append( second );
+        if ( first._lowerBounds[index] <= first._upperBounds[index] )
+            nodes.append( first );
+    }
+
+    if ( _status == TIME_LIMIT )
+    {
+        // The best solution may lie in any of the open nodes
+        double bound = _incumbentValue;
+        for ( const auto &node : nodes )
+            bound = FloatUtils::min( bound, node._bound );
+        if ( cutoffOccurred )
+            bound = FloatUtils::min( bound, cutoff );
+        _objectiveBound = bound;
+    }
+    else if ( _status != UNBOUNDED && _status != LP_FAILURE )
+    {
+        if ( _haveIncumbent )
+        {
+            _status = OPTIMAL;
+            _objectiveBound = _incumbentValue;
+        }
+        else
+            _status = cutoffOccurred ? CUTOFF : INFEASIBLE;
+    }
+}
+
+bool NativeMILPSolver::initializeRoot( Node &root )
+{
+    root._bound = FloatUtils::negativeInfinity();
+
+    for ( unsigned variable : _integerVariables )
+    {
+        double lb = _lowerBounds[variable];
+        double ub = _upperBounds[variable];
+
+        double tolerance = GlobalConfiguration::NATIVE_MILP_SOLVER_INTEGRALITY_TOLERANCE;
+        if ( FloatUtils::isFinite( lb ) )
+            lb = std::ceil( lb - tolerance );
+        if ( FloatUtils::isFinite( ub ) )
+            ub = std::floor( ub + tolerance );
+
+        if ( lb > ub )
+            return false;
+
+        root._lowerBounds.append( lb );
+        root._upperBounds.append( ub );
+    }
+
+    return true;
+}
+
+void NativeMILPSolver::initializeRelaxation()
+{
+    // The LP solver keeps its last basis across resets, so the root is
+    // warm-started from the previous solve
+    _lpSolver.resetModel();
+
+    for ( unsigned i = 0; i < _variableNames.size(); ++i )
+        _lpSolver.addVariable( _variableNames[i], _lowerBounds[i], _upperBounds[i] );
+
+    for ( const auto &constraint : _constraints )
+        _lpSolver.addConstraint( constraint._terms, constraint._lb, constraint._ub );
+
+    // Exactly one row per indicator constraint, so that the dimensions of
+    // the LP do not depend on the node. The rows are set for every node.
+    for ( const auto &indicator : _indicatorConstraints )
+        _lpSolver.addConstraint(
+            indicator._terms, FloatUtils::negativeInfinity(), FloatUtils::infinity() );
+
+    if ( _maximize )
+        _lpSolver.setObjective( _objectiveTerms, _objectiveConstant );
+    else
+        _lpSolver.setCost( _objectiveTerms, _objectiveConstant );
+}
+
+void NativeMILPSolver::solveRelaxation( const Node &node,
+                                        double timeoutInSeconds,
+                                        Vector<double> &values )
+{
+    for ( unsigned i = 0; i < _integerVariables.size(); ++i )
+        _lpSolver.setVariableBounds(
+            _integerVariables[i], node._lowerBounds[i], node._upperBounds[i] );
+
+    // Rows that do not apply are free
+    unsigned row = _constraints.size();
+    for ( const auto &indicator : _indicatorConstraints )
+    {
+        unsigned binary = indicator._binaryVariable;
+        double binLb = getNodeLowerBound( node, binary );
+        double binUb = getNodeUpperBound( node, binary );
+        bool active = binLb == binUb && binLb == indicator._binaryValue;
+        bool inactive = binLb == binUb && binLb != indicator._binaryValue;
+
+        double min;
+        double max;
+        computeTermsRange( node, indicator._terms, min, max );
+
+        List<IndexedTerm> terms = indicator._terms;
+        bool isUpperBound = FloatUtils::isFinite( indicator._ub );
+        double scalar = isUpperBound ? indicator._ub : indicator._lb;
+        double bigM = isUpperBound ? max - indicator._ub : indicator._lb - min;
+
+        if ( inactive || ( !active && !FloatUtils::isFinite( bigM ) ) )
+        {
+            _lpSolver.setConstraint(
+                row++, terms, FloatUtils::negativeInfinity(), FloatUtils::infinity() );
+            continue;
+        }
+
+        if ( !active && FloatUtils::isPositive( bigM ) )
+        {
+            // For an upper bound and a binary value of 1:
+            //   terms + M * b <= ub + M
+            // and symmetrically for the other cases
+            double sign = isUpperBound ? 1 : -1;
+            if ( indicator._binaryValue == 1 )
+            {
+                terms.append( IndexedTerm( sign * bigM, binary ) );
+                scalar += sign * bigM;
+            }
+            else
+                terms.append( IndexedTerm( -sign * bigM, binary ) );
+        }
+
+        if ( isUpperBound )
+            _lpSolver.setConstraint( row++, terms, FloatUtils::negativeInfinity(), scalar );
+        else
+            _lpSolver.setConstraint( row++, terms, scalar, FloatUtils::infinity() );
+    }
+
+    _lpSolver.setTimeLimit( timeoutInSeconds );
+    _lpSolver.solve();
+    _numberOfIterations += _lpSolver.getNumberOfSimplexIterations();
+
+    values.clear();
+    if ( !_lpSolver.optimal() )
+        return;
+
+    for ( unsigned i = 0; i < _variableNames.size(); ++i )
+        values.append( _lpSolver.getValue( i ) );
+}
+
+double NativeMILPSolver::getNodeLowerBound( const Node &node, unsigned variable ) const
+{
+    int index = _variableToIntegerIndex[variable];
+    return index < 0 ? _lowerBounds[variable] : node._lowerBounds[index];
+}
+
+double NativeMILPSolver::getNodeUpperBound( const Node &node, unsigned variable ) const
+{
+    int index = _variableToIntegerIndex[variable];
+    return index < 0 ? _upperBounds[variable] : node._upperBounds[index];
+}
+
+void NativeMILPSolver::computeTermsRange( const Node &node,
+                                          const List<IndexedTerm> &terms,
+                                          double &min,
+                                          double &max ) const
+{
+    min = 0;
+    max = 0;
+    for ( const auto &term : terms )
+    {
+        unsigned variable = term._variable;
+        double lb = getNodeLowerBound( node, variable );
+        double ub = getNodeUpperBound( node, variable );
+
+        if ( FloatUtils::isZero( term._coefficient ) )
+            continue;
+
+        if ( term._coefficient > 0 )
+        {
+            min += term._coefficient * lb;
+            max += term._coefficient * ub;
+        }
+        else
+        {
+            min += term._coefficient * ub;
+            max += term._coefficient * lb;
+        }
+    }
+}
+
+bool NativeMILPSolver::pickBranchingVariable( const Node &node,
+                                              const Vector<double> &values,
+                                              unsigned &index )
+{
+    double tolerance = GlobalConfiguration::NATIVE_MILP_SOLVER_INTEGRALITY_TOLERANCE;
+
+    // The most fractional integer variable
+    double maxFractionality = tolerance;
+    bool found = false;
+    for ( unsigned i = 0; i < _integerVariables.size(); ++i )
+    {
+        double value = values[_integerVariables[i]];
+        double fractionality = std::min( value - std::floor( value ), std::ceil( value ) - value );
+        if ( fractionality > maxFractionality )
+        {
+            maxFractionality = fractionality;
+            index = i;
+            found = true;
+        }
+    }
+
+    if ( found )
+        return true;
+
+    // Indicator constraints that were left out of the relaxation
+    for ( const auto &indicator : _indicatorConstraints )
+    {
+        int integerIndex = _variableToIntegerIndex[indicator._binaryVariable];
+        if ( integerIndex < 0 ||
+             node._lowerBounds[integerIndex] == node._upperBounds[integerIndex] ||
+             !FloatUtils::isZero( values[indicator._binaryVariable] - indicator._binaryValue,
+                                  tolerance ) )
+            continue;
+
+        double min;
+        double max;
+        computeTermsRange( node, indicator._terms, min, max );
+        if ( FloatUtils::isFinite( indicator._ub ) ? FloatUtils::isFinite( max )
+                                                   : FloatUtils::isFinite( min ) )
+            continue;
+
+        double sum = 0;
+        for ( const auto &term : indicator._terms )
+            sum += term._coefficient * values[term._variable];
+
+        if ( FloatUtils::gt( sum, indicator._ub, tolerance ) ||
+             FloatUtils::lt( sum, indicator._lb, tolerance ) )
+        {
+            index = integerIndex;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+double NativeMILPSolver::toMinimization( double value ) const
+{
+    // Negation converts in both directions
+    return _maximize ? -value : value;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
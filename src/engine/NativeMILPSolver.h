@@ -0,0 +1,249 @@
+/*********************                                                        */
+/*! \file NativeMILPSolver.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __NativeMILPSolver_h__
+#define __NativeMILPSolver_h__
+
+#include "ILPSolver.h"
+#include "NativeLPSolver.h"
+#include "Set.h"
+#include "Vector.h"
+
+/*
+  A MILP solver that does not depend on an external library. Binary
+  and integer variables are handled by a depth-first branch and bound,
+  whose LP relaxations are solved by a NativeLPSolver. Since every
+  node has the same number of variables and constraints, the LP is
+  built once per solve, and every node only updates the bounds of the
+  integer variables and the rows of the indicator constraints, by
+  index, before it is warm-started from the final basis of the
+  previous node.
+
+  An indicator constraint is relaxed with a big-M term, computed from
+  the bounds of the node; it is exact once its binary variable is
+  fixed. If M is unbounded, the constraint is left out of the
+  relaxation until its binary variable is fixed, and a solution that
+  violates it is branched on. A piecewise-linear constraint is encoded
+  with one binary variable per segment, and indicator constraints that
+  select the segment.
+
+  Bilinear constraints are not supported.
+*/
+class NativeMILPSolver : public ILPSolver
+{
+public:
+    NativeMILPSolver();
+    ~NativeMILPSolver();
+
+    void addVariable( String name, double lb, double ub, VariableType type = CONTINUOUS ) override;
+
+    void setLowerBound( String name, double lb ) override;
+    void setUpperBound( String name, double ub ) override;
+    double getLowerBound( const String &name ) override;
+    double getUpperBound( const String &name ) override;
+
+    void addLeqConstraint( const List<Term> &terms, double scalar ) override;
+    void addGeqConstraint( const List<Term> &terms, double scalar ) override;
+    void addEqConstraint( const List<Term> &terms, double scalar ) override;
+
+    void addPiecewiseLinearConstraint( String sourceVariable,
+                                       String targetVariable,
+                                       unsigned numPoints,
+                                       const double *xPoints,
+                                       const double *yPoints ) override;
+    void addLeqIndicatorConstraint( const String binVarName,
+                                    const int binVal,
+                                    const List<Term> &terms,
+                                    double scalar ) override;
+    void addGeqIndicatorConstraint( const String binVarName,
+                                    const int binVal,
+                                    const List<Term> &terms,
+                                    double scalar ) override;
+    void addEqIndicatorConstraint( const String binVarName,
+                                   const int binVal,
+                                   const List<Term> &terms,
+                                   double scalar ) override;
+    void
+    addBilinearConstraint( const String input1, const String input2, const String output ) override;
+    void nonConvex() override;
+
+    void setCost( const List<Term> &terms, double constant = 0 ) override;
+    void setObjective( const List<Term> &terms, double constant = 0 ) override;
+    double getOptimalCostOrObjective() override;
+
+    void setCutoff( double cutoff ) override;
+
+    bool optimal() override;
+    bool cutoffOccurred() override;
+    bool infeasible() override;
+    bool timeout() override;
+    bool haveFeasibleSolution() override;
+
+    void setTimeLimit( double seconds ) override;
+
+    void setVerbosity( unsigned verbosity ) override;
+    bool containsVariable( String name ) const override;
+    void setNumberOfThreads( unsigned threads ) override;
+
+    void solve() override;
+    void extractSolution( Map<String, double> &values, double &costOrObjective ) override;
+    double getObjectiveBound() override;
+    double getAssignment( const String &variable ) override;
+    bool existsAssignment( const String &variable ) override;
+    unsigned getNumberOfSimplexIterations() override;
+    unsigned getNumberOfNodes() override;
+    unsigned getStatusCode() override;
+    void updateModel() override;
+
+    void reset() override;
+    void resetModel() override;
+
+private:
+    enum Status {
+        NOT_SOLVED = 0,
+        OPTIMAL = 1,
+        INFEASIBLE = 2,
+        UNBOUNDED = 3,
+        CUTOFF = 4,
+        TIME_LIMIT = 5,
+        LP_FAILURE = 6,
+    };
+
+    typedef NativeLPSolver::IndexedTerm IndexedTerm;
+
+    struct Constraint
+    {
+        List<IndexedTerm> _terms;
+        double _lb;
+        double _ub;
+    };
+
+    /*
+      An indicator constraint, lb <= terms <= ub when the binary
+      variable equals binaryValue. One of the bounds is infinite.
+    */
+    struct IndicatorConstraint
+    {
+        unsigned _binaryVariable;
+        int _binaryValue;
+        List<IndexedTerm> _terms;
+        double _lb;
+        double _ub;
+    };
+
+    /*
+      A branch-and-bound node: the bounds of the integer variables, and
+      a lower bound on the (minimization) objective of the node, which
+      is the optimal value of the LP relaxation of its parent
+    */
+    struct Node
+    {
+        Vector<double> _lowerBounds;
+        Vector<double> _upperBounds;
+        double _bound;
+    };
+
+    /*
+      The model
+    */
+    Map<String, unsigned> _nameToVariable;
+    Vector<String> _variableNames;
+    Vector<double> _lowerBounds;
+    Vector<double> _upperBounds;
+    Vector<VariableType> _variableTypes;
+    Set<unsigned> _internalVariables;
+    Vector<Constraint> _constraints;
+    Vector<IndicatorConstraint> _indicatorConstraints;
+    List<Term> _objectiveTerms;
+    double _objectiveConstant;
+    bool _maximize;
+    bool _cutoffInUse;
+    double _cutoff;
+    double _timeoutInSeconds;
+    unsigned _numberOfPiecewiseLinearConstraints;
+
+    /*
+      The result of the last solve. Objective values are kept in
+      minimization form, i.e., negated when maximizing.
+    */
+    Status _status;
+    bool _haveIncumbent;
+    double _incumbentValue;
+    Vector<double> _incumbent;
+    double _objectiveBound;
+    unsigned _numberOfIterations;
+    unsigned _numberOfNodes;
+
+    /*
+      The solver of the LP relaxations, and the integer variables that
+      are branched on
+    */
+    NativeLPSolver _lpSolver;
+    Vector<unsigned> _integerVariables;
+    Vector<int> _variableToIntegerIndex;
+
+    void addConstraint( const List<Term> &terms, double lb, double ub );
+    void addIndicatorConstraint(
+        const String &binVarName, int binVal, const List<Term> &terms, double lb, double ub );
+    List<IndexedTerm> toIndexedTerms( const List<Term> &terms );
+
+    /*
+      Build the root node from the bounds of the integer variables.
+      Returns false if some integer variable has no integer value within
+      its bounds.
+    */
+    bool initializeRoot( Node &root );
+
+    /*
+      Build the LP relaxation shared by all the nodes: the variables and
+      constraints of the model, one row per indicator constraint, and
+      the objective
+    */
+    void initializeRelaxation();
+
+    /*
+      Solve the LP relaxation of a node, and store the values of all the
+      variables if it is feasible
+    */
+    void solveRelaxation( const Node &node, double timeoutInSeconds, Vector<double> &values );
+
+    /*
+      The bounds of a variable, or of a linear expression, within a node
+    */
+    double getNodeLowerBound( const Node &node, unsigned variable ) const;
+    double getNodeUpperBound( const Node &node, unsigned variable ) const;
+    void computeTermsRange( const Node &node,
+                            const List<IndexedTerm> &terms,
+                            double &min,
+                            double &max ) const;
+
+    /*
+      Pick a variable to branch on: an integer variable with a
+      fractional value, or else the binary variable of a violated
+      indicator constraint that has been left out of the relaxation.
+      Returns false if the values are a solution of the model.
+    */
+    bool pickBranchingVariable( const Node &node, const Vector<double> &values, unsigned &index );
+
+    double toMinimization( double value ) const;
+};
+
+#endif // __NativeMILPSolver_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,126 @@
+/*********************                                                        */
+/*! \file PLConstraintChangeTracker.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "PLConstraintChangeTracker.h"
+
+PLConstraintChangeTracker::PLConstraintChangeTracker()
+    : _currentStamp( 1 )
+    , _allChanged( true )
+{
+}
+
+void PLConstraintChangeTracker::initialize( const List<PiecewiseLinearConstraint *> &plConstraints )
+{
+    _plConstraints.clear();
+    for ( const auto &constraint : plConstraints )
+        _plConstraints.append( constraint );
+
+    // Count the constraints of each variable
+    unsigned numberOfVariables = 0;
+    Vector<List<unsigned>> participatingVariables;
+    for ( const auto &constraint : _plConstraints )
+    {
+        List<unsigned> variables = constraint->getParticipatingVariables();
+        for ( unsigned variable : variables )
+            if ( variable + 1 > numberOfVariables )
+                numberOfVariables = variable + 1;
+        participatingVariables.append( variables );
+    }
+
+    _variableStart.assign( numberOfVariables + 1, 0 );
+    for ( const auto &variables : participatingVariables )
+        for ( unsigned variable : variables )
+            ++_variableStart[variable + 1];
+
+    for ( unsigned i = 0; i < numberOfVariables; ++i )
+        _variableStart[i + 1] += _variableStart[i];
+
+    // Fill in the constraint indices, using a copy of the starts as
+    // insertion points
+    Vector<unsigned> next = _variableStart;
+    _variableConstraints.assign( _variableStart[numberOfVariables], 0 );
+    for ( unsigned i = 0; i < participatingVariables.size(); ++i )
+        for ( unsigned variable : participatingVariables[i] )
+            _variableConstraints[next[variable]++] = i;
+
+    _stamp.assign( _plConstraints.size(), 0 );
+    _currentStamp = 1;
+    _changed.clear();
+    _allChanged = true;
+}
+
+void PLConstraintChangeTracker::notifyLowerBound( unsigned variable, double /* bound */ )
+{
+    markVariableChanged( variable );
+}
+
+void PLConstraintChangeTracker::notifyUpperBound( unsigned variable, double /* bound */ )
+{
+    markVariableChanged( variable );
+}
+
+void PLConstraintChangeTracker::markAllChanged()
+{
+    _allChanged = true;
+}
+
+void PLConstraintChangeTracker::extractChangedConstraints(
+    Vector<PiecewiseLinearConstraint *> &changed )
+{
+    changed.clear();
+
+    if ( _allChanged )
+    {
+        changed = _plConstraints;
+    }
+    else
+    {
+        _changed.sort();
+        for ( unsigned index : _changed )
+            changed.append( _plConstraints[index] );
+    }
+
+    ++_currentStamp;
+    _changed.clear();
+    _allChanged = false;
+}
+
+bool PLConstraintChangeTracker::hasChanges() const
+{
+    return _allChanged || !_changed.empty();
+}
+
+void PLConstraintChangeTracker::markVariableChanged( unsigned variable )
+{
+    // Variables beyond the index do not participate in any constraint
+    if ( _allChanged || variable + 1 >= _variableStart.size() )
+        return;
+
+    for ( unsigned i = _variableStart[variable]; i < _variableStart[variable + 1]; ++i )
+    {
+        unsigned index = _variableConstraints[i];
+        if ( _stamp[index] != _currentStamp )
+        {
+            _stamp[index] = _currentStamp;
+            _changed.append( index );
+        }
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
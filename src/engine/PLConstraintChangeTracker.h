@@ -0,0 +1,90 @@
+/*********************                                                        */
+/*! \file PLConstraintChangeTracker.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __PLConstraintChangeTracker_h__
+#define __PLConstraintChangeTracker_h__
+
+#include "ITableau.h"
+#include "List.h"
+#include "PiecewiseLinearConstraint.h"
+#include "Vector.h"
+
+/*
+  Keeps track of the piecewise-linear constraints whose participating
+  variables had their bounds changed. A constraint's phase can only
+  become fixed as a result of such a change, so the engine only needs
+  to look for new valid case splits among these constraints, rather
+  than among all of them.
+
+  The tracker watches all variables in the tableau. When the state of
+  the constraints is restored wholesale (e.g., when backtracking), all
+  constraints should be marked as changed.
+*/
+class PLConstraintChangeTracker : public ITableau::VariableWatcher
+{
+public:
+    PLConstraintChangeTracker();
+
+    /*
+      Index the given constraints by their participating variables,
+      and mark all of them as changed.
+    */
+    void initialize( const List<PiecewiseLinearConstraint *> &plConstraints );
+
+    void notifyLowerBound( unsigned variable, double bound );
+    void notifyUpperBound( unsigned variable, double bound );
+
+    void markAllChanged();
+
+    /*
+      Move the constraints that changed since the last call into the
+      given vector, in the order in which they were passed to
+      initialize(), and clear the changes.
+    */
+    void extractChangedConstraints( Vector<PiecewiseLinearConstraint *> &changed );
+
+    bool hasChanges() const;
+
+private:
+    Vector<PiecewiseLinearConstraint *> _plConstraints;
+
+    /*
+      The indices of the constraints watching each variable, stored
+      contiguously: the constraints of variable v are at positions
+      _variableStart[v] to _variableStart[v + 1] - 1 of
+      _variableConstraints.
+    */
+    Vector<unsigned> _variableStart;
+    Vector<unsigned> _variableConstraints;
+
+    /*
+      A constraint is in _changed iff its stamp equals the current
+      stamp, which is advanced whenever the changes are extracted
+    */
+    Vector<unsigned> _stamp;
+    unsigned _currentStamp;
+    Vector<unsigned> _changed;
+    bool _allChanged;
+
+    void markVariableChanged( unsigned variable );
+};
+
+#endif // __PLConstraintChangeTracker_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
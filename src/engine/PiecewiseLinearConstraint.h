@@ -140,6 +140,17 @@ public:
     */
     virtual void restoreState( const PiecewiseLinearConstraint *state ) = 0;
 
+    /*
+      Return true if, once its CDOs are initialized, all of the search
+      state of the constraint is context-dependent. Such a constraint is
+      backtracked by popping the context, and the engine does not need to
+      store a copy of it before every split.
+    */
+    virtual bool searchStateIsContextDependent() const
+    {
+        return false;
+    }
+
     /*
       Register/unregister the constraint with a talbeau.
     */
@@ -36,6 +36,7 @@ Preprocessor::Preprocessor()
     , _statistics( NULL )
     , _lowerBounds( NULL )
     , _upperBounds( NULL )
+    , _equationIndexValid( false )
 {
 }
 
@@ -139,6 +140,8 @@ std::unique_ptr<Query> Preprocessor::preprocess( const IQuery &query,
 
       Then, eliminate fixed variables.
     */
+    clearEquationIndex();
+
     unsigned tighteningRound = 0;
     bool continueTightening = true;
     while ( continueTightening &&
@@ -157,6 +160,8 @@ std::unique_ptr<Query> Preprocessor::preprocess( const IQuery &query,
             _statistics->incUnsignedAttribute( Statistics::PP_NUM_TIGHTENING_ITERATIONS );
     }
 
+    clearEquationIndex();
+
     collectFixedValues();
     separateMergedAndFixed();
 
@@ -243,6 +248,79 @@ void Preprocessor::makeAllEquationsEqualities()
     }
 }
 
+void Preprocessor::buildEquationIndex()
+{
+    clearEquationIndex();
+
+    List<Equation> &equations( _preprocessed->getEquations() );
+    unsigned numberOfVariables = _preprocessed->getNumberOfVariables();
+
+    // Count the occurrences of every variable, and then lay out the
+    // equations of each variable contiguously
+    _equationsOfVariableStart.assign( numberOfVariables + 1, 0 );
+    for ( auto equation = equations.begin(); equation != equations.end(); ++equation )
+    {
+        _equations.append( equation );
+        for ( const auto &addend : equation->_addends )
+            ++_equationsOfVariableStart[addend._variable + 1];
+    }
+
+    for ( unsigned i = 0; i < numberOfVariables; ++i )
+        _equationsOfVariableStart[i + 1] += _equationsOfVariableStart[i];
+
+    Vector<unsigned> next( numberOfVariables );
+    for ( unsigned i = 0; i < numberOfVariables; ++i )
+        next[i] = _equationsOfVariableStart[i];
+
+    _equationsOfVariable.assign( _equationsOfVariableStart[numberOfVariables], 0 );
+    for ( unsigned i = 0; i < _equations.size(); ++i )
+    {
+        for ( const auto &addend : _equations[i]->_addends )
+            _equationsOfVariable[next[addend._variable]++] = i;
+    }
+
+    _equationRemoved.assign( _equations.size(), false );
+    _equationQueued.assign( _equations.size(), true );
+    for ( unsigned i = 0; i < _equations.size(); ++i )
+        _equationQueue.append( i );
+
+    _boundChanged.assign( numberOfVariables, false );
+    _equationIndexValid = true;
+}
+
+void Preprocessor::clearEquationIndex()
+{
+    _equationIndexValid = false;
+    _equations.clear();
+    _equationRemoved.clear();
+    _equationsOfVariableStart.clear();
+    _equationsOfVariable.clear();
+    _equationQueue.clear();
+    _equationQueued.clear();
+    _boundChanged.clear();
+    _variablesWithChangedBounds.clear();
+}
+
+void Preprocessor::queueEquationsOfChangedVariables()
+{
+    for ( unsigned var : _variablesWithChangedBounds )
+    {
+        _boundChanged[var] = false;
+        for ( unsigned i = _equationsOfVariableStart[var]; i < _equationsOfVariableStart[var + 1];
+              ++i )
+        {
+            unsigned equation = _equationsOfVariable[i];
+            if ( !_equationQueued[equation] && !_equationRemoved[equation] )
+            {
+                _equationQueued[equation] = true;
+                _equationQueue.append( equation );
+            }
+        }
+    }
+
+    _variablesWithChangedBounds.clear();
+}
+
 bool Preprocessor::processEquations()
 {
     enum {
@@ -254,31 +332,57 @@ bool Preprocessor::processEquations()
 
     bool tighterBoundFound = false;
 
+    if ( !_equationIndexValid )
+        buildEquationIndex();
+    else
+        queueEquationsOfChangedVariables();
+
     List<Equation> &equations( _preprocessed->getEquations() );
-    List<Equation>::iterator equation = equations.begin();
+    double epsilon = Options::get()->getFloat( Options::PREPROCESSOR_BOUND_TOLERANCE );
 
-    while ( equation != equations.end() )
+    /*
+      Take this round's equations off the queue. Equations that contain
+      a variable tightened during this round are queued for the next
+      one, unless they are still waiting to be processed in this round.
+    */
+    Vector<unsigned> round;
+    round = _equationQueue;
+    _equationQueue.clear();
+
+    for ( unsigned equationIndex : round )
     {
+        _equationQueued[equationIndex] = false;
+        if ( _equationRemoved[equationIndex] )
+            continue;
+
+        List<Equation>::iterator equation = _equations[equationIndex];
+
         // The equation is of the form sum (ci * xi) - b ? 0
         Equation::EquationType type = equation->_type;
 
-        unsigned maxVar = equation->_addends.begin()->_variable;
-        for ( const auto &addend : equation->_addends )
+        unsigned numberOfAddends = equation->_addends.size();
+        if ( _ciSign.size() < numberOfAddends )
         {
-            if ( addend._variable > maxVar )
-                maxVar = addend._variable;
+            _ciTimesLb.assign( numberOfAddends, 0 );
+            _ciTimesUb.assign( numberOfAddends, 0 );
+            _ciSign.assign( numberOfAddends, ZERO );
         }
 
-        ++maxVar;
-
-        double *ciTimesLb = new double[maxVar];
-        double *ciTimesUb = new double[maxVar];
-        char *ciSign = new char[maxVar];
-
-        Set<unsigned> excludedFromLB;
-        Set<unsigned> excludedFromUB;
+        /*
+          Variables whose bounds are infinite are excluded from auxLb or
+          auxUb. Bounds can only be derived if at most one variable was
+          excluded, so only the number of excluded variables and the
+          position of the last one are needed. An infinite bound leaves
+          a zero in ciTimesLb or ciTimesUb, so that removing the addend
+          from the sum works regardless.
+        */
+        unsigned excludedFromLb = 0;
+        unsigned excludedFromUb = 0;
+        unsigned lastExcludedFromLb = 0;
+        unsigned lastExcludedFromUb = 0;
 
         unsigned xi;
+        unsigned position;
         double xiLB;
         double xiUB;
         double ci;
@@ -291,66 +395,86 @@ bool Preprocessor::processEquations()
         // For this we first identify unbounded variables
         double auxLb = -equation->_scalar;
         double auxUb = -equation->_scalar;
+        position = 0;
         for ( const auto &addend : equation->_addends )
         {
             ci = addend._coefficient;
             xi = addend._variable;
 
+            _ciTimesLb[position] = 0;
+            _ciTimesUb[position] = 0;
+
             if ( FloatUtils::isZero( ci ) )
             {
-                ciSign[xi] = ZERO;
-                ciTimesLb[xi] = 0;
-                ciTimesUb[xi] = 0;
+                _ciSign[position++] = ZERO;
                 continue;
             }
 
-            ciSign[xi] = ci > 0 ? POSITIVE : NEGATIVE;
+            _ciSign[position] = ci > 0 ? POSITIVE : NEGATIVE;
 
             xiLB = getLowerBound( xi );
             xiUB = getUpperBound( xi );
 
             if ( FloatUtils::isFinite( xiLB ) )
             {
-                ciTimesLb[xi] = ci * xiLB;
-                if ( ciSign[xi] == POSITIVE )
-                    auxLb += ciTimesLb[xi];
+                _ciTimesLb[position] = ci * xiLB;
+                if ( ci > 0 )
+                    auxLb += _ciTimesLb[position];
                 else
-                    auxUb += ciTimesLb[xi];
+                    auxUb += _ciTimesLb[position];
             }
             else
             {
                 if ( ci > 0 )
-                    excludedFromLB.insert( xi );
+                {
+                    ++excludedFromLb;
+                    lastExcludedFromLb = position;
+                }
                 else
-                    excludedFromUB.insert( xi );
+                {
+                    ++excludedFromUb;
+                    lastExcludedFromUb = position;
+                }
             }
 
             if ( FloatUtils::isFinite( xiUB ) )
             {
-                ciTimesUb[xi] = ci * xiUB;
-                if ( ciSign[xi] == POSITIVE )
-                    auxUb += ciTimesUb[xi];
+                _ciTimesUb[position] = ci * xiUB;
+                if ( ci > 0 )
+                    auxUb += _ciTimesUb[position];
                 else
-                    auxLb += ciTimesUb[xi];
+                    auxLb += _ciTimesUb[position];
             }
             else
             {
                 if ( ci > 0 )
-                    excludedFromUB.insert( xi );
+                {
+                    ++excludedFromUb;
+                    lastExcludedFromUb = position;
+                }
                 else
-                    excludedFromLB.insert( xi );
+                {
+                    ++excludedFromLb;
+                    lastExcludedFromLb = position;
+                }
             }
+
+            ++position;
         }
 
         // Now, go over each addend in sum (ci * xi) - b ? 0, and see what can be done
+        position = 0;
         for ( const auto &addend : equation->_addends )
         {
             ci = addend._coefficient;
             xi = addend._variable;
 
             // If ci = 0, nothing to do.
-            if ( ciSign[xi] == ZERO )
+            if ( _ciSign[position] == ZERO )
+            {
+                ++position;
                 continue;
+            }
 
             /*
               The expression for xi is:
@@ -369,43 +493,31 @@ bool Preprocessor::processEquations()
 
               In case "?" is GE or LE, only one direction can be computed.
             */
-            if ( ciSign[xi] == NEGATIVE )
+            bool onlyXiExcludedFromLb =
+                excludedFromLb == 0 || ( excludedFromLb == 1 && lastExcludedFromLb == position );
+            bool onlyXiExcludedFromUb =
+                excludedFromUb == 0 || ( excludedFromUb == 1 && lastExcludedFromUb == position );
+
+            if ( _ciSign[position] == NEGATIVE )
             {
                 validLb = ( ( type == Equation::LE ) || ( type == Equation::EQ ) ) &&
-                          ( excludedFromLB.empty() ||
-                            ( excludedFromLB.size() == 1 && excludedFromLB.exists( xi ) ) );
+                          onlyXiExcludedFromLb;
                 validUb = ( ( type == Equation::GE ) || ( type == Equation::EQ ) ) &&
-                          ( excludedFromUB.empty() ||
-                            ( excludedFromUB.size() == 1 && excludedFromUB.exists( xi ) ) );
+                          onlyXiExcludedFromUb;
             }
             else
             {
                 validLb = ( ( type == Equation::GE ) || ( type == Equation::EQ ) ) &&
-                          ( excludedFromUB.empty() ||
-                            ( excludedFromUB.size() == 1 && excludedFromUB.exists( xi ) ) );
+                          onlyXiExcludedFromUb;
                 validUb = ( ( type == Equation::LE ) || ( type == Equation::EQ ) ) &&
-                          ( excludedFromLB.empty() ||
-                            ( excludedFromLB.size() == 1 && excludedFromLB.exists( xi ) ) );
+                          onlyXiExcludedFromLb;
             }
 
             // Now compute the actual bounds and see if they are tighter
-            double epsilon = Options::get()->getFloat( Options::PREPROCESSOR_BOUND_TOLERANCE );
-
             if ( validLb )
             {
-                if ( ciSign[xi] == NEGATIVE )
-                {
-                    lowerBound = auxLb;
-                    if ( !excludedFromLB.exists( xi ) )
-                        lowerBound -= ciTimesUb[xi];
-                }
-                else
-                {
-                    lowerBound = auxUb;
-                    if ( !excludedFromUB.exists( xi ) )
-                        lowerBound -= ciTimesUb[xi];
-                }
-
+                lowerBound = _ciSign[position] == NEGATIVE ? auxLb : auxUb;
+                lowerBound -= _ciTimesUb[position];
                 lowerBound /= -ci;
 
                 if ( FloatUtils::gt( lowerBound, getLowerBound( xi ), epsilon ) )
@@ -417,19 +529,8 @@ bool Preprocessor::processEquations()
 
             if ( validUb )
             {
-                if ( ciSign[xi] == NEGATIVE )
-                {
-                    upperBound = auxUb;
-                    if ( !excludedFromUB.exists( xi ) )
-                        upperBound -= ciTimesLb[xi];
-                }
-                else
-                {
-                    upperBound = auxLb;
-                    if ( !excludedFromLB.exists( xi ) )
-                        upperBound -= ciTimesLb[xi];
-                }
-
+                upperBound = _ciSign[position] == NEGATIVE ? auxUb : auxLb;
+                upperBound -= _ciTimesLb[position];
                 upperBound /= -ci;
 
                 if ( FloatUtils::lt( upperBound, getUpperBound( xi ), epsilon ) )
@@ -443,17 +544,11 @@ bool Preprocessor::processEquations()
                                  getUpperBound( xi ),
                                  GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
             {
-                delete[] ciTimesLb;
-                delete[] ciTimesUb;
-                delete[] ciSign;
-
                 throw InfeasibleQueryException();
             }
-        }
 
-        delete[] ciTimesLb;
-        delete[] ciTimesUb;
-        delete[] ciSign;
+            ++position;
+        }
 
         /*
           Next, do another sweep over the equation.
@@ -474,11 +569,7 @@ bool Preprocessor::processEquations()
                 allFixed = false;
         }
 
-        if ( !allFixed )
-        {
-            ++equation;
-        }
-        else
+        if ( allFixed )
         {
             double sum = 0;
             for ( const auto &addend : equation->_addends )
@@ -491,8 +582,11 @@ bool Preprocessor::processEquations()
             {
                 throw InfeasibleQueryException();
             }
-            equation = equations.erase( equation );
+            equations.erase( equation );
+            _equationRemoved[equationIndex] = true;
         }
+
+        queueEquationsOfChangedVariables();
     }
 
     return tighterBoundFound;
@@ -646,6 +740,10 @@ bool Preprocessor::processIdenticalVariables()
         _mergedVariables[v1] = v2;
     }
 
+    // Merging changes the equations, so the equation index is rebuilt
+    if ( found )
+        clearEquationIndex();
+
     return found;
 }
 
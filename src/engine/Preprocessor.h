@@ -23,6 +23,7 @@
 #include "PiecewiseLinearConstraint.h"
 #include "Query.h"
 #include "Set.h"
+#include "Vector.h"
 
 class Preprocessor
 {
@@ -88,14 +89,31 @@ private:
 
     inline void setLowerBound( unsigned var, double value )
     {
+        if ( _lowerBounds[var] != value )
+            noteBoundChange( var );
         _lowerBounds[var] = value;
     }
 
     inline void setUpperBound( unsigned var, double value )
     {
+        if ( _upperBounds[var] != value )
+            noteBoundChange( var );
         _upperBounds[var] = value;
     }
 
+    /*
+      Remember that the bounds of a variable have changed, so that the
+      equations in which it occurs are processed again
+    */
+    inline void noteBoundChange( unsigned var )
+    {
+        if ( var < _boundChanged.size() && !_boundChanged[var] )
+        {
+            _boundChanged[var] = true;
+            _variablesWithChangedBounds.append( var );
+        }
+    }
+
     /*
       Transform each equation so that any two addends have different variables
       and no addends have zero coefficients
@@ -121,10 +139,27 @@ private:
     void setMissingBoundsToInfinity();
 
     /*
-      Tighten bounds using the linear equations
+      Tighten bounds using the linear equations. Every call is one
+      round, which only processes the equations that contain a
+      variable whose bounds have changed since the equation was last
+      processed.
     */
     bool processEquations();
 
+    /*
+      Build the index from variables to the equations in which they
+      occur, and queue all equations. This has to be done again
+      whenever the equations themselves change.
+    */
+    void buildEquationIndex();
+    void clearEquationIndex();
+
+    /*
+      Queue the equations that contain a variable whose bounds have
+      changed, and forget about these changes
+    */
+    void queueEquationsOfChangedVariables();
+
     /*
       Tighten the bounds using the piecewise linear and nonlinear constraints
     */
@@ -174,6 +209,31 @@ private:
     double *_lowerBounds;
     double *_upperBounds;
 
+    /*
+      The worklist of processEquations(). The equations are indexed by
+      their position in the query when the index was built, and
+      _equationsOfVariable[_equationsOfVariableStart[x]] to
+      _equationsOfVariable[_equationsOfVariableStart[x + 1] - 1] are the
+      equations that contain variable x.
+    */
+    bool _equationIndexValid;
+    Vector<List<Equation>::iterator> _equations;
+    Vector<char> _equationRemoved;
+    Vector<unsigned> _equationsOfVariableStart;
+    Vector<unsigned> _equationsOfVariable;
+    Vector<unsigned> _equationQueue;
+    Vector<char> _equationQueued;
+    Vector<char> _boundChanged;
+    Vector<unsigned> _variablesWithChangedBounds;
+
+    /*
+      Scratch space for processing a single equation, indexed by the
+      position of the addend in the equation
+    */
+    Vector<double> _ciTimesLb;
+    Vector<double> _ciTimesUb;
+    Vector<char> _ciSign;
+
     /*
       Variables that have become fixed during preprocessing, and the
       values that they have been fixed to.
@@ -17,9 +17,12 @@
 
 #include "AutoFile.h"
 #include "BilinearConstraint.h"
+#include "BinaryQueryFormat.h"
+#include "BufferedFileWriter.h"
 #include "Debug.h"
 #include "FloatUtils.h"
 #include "LeakyReluConstraint.h"
+#include "LittleEndian.h"
 #include "MStringf.h"
 #include "MarabouError.h"
 #include "MaxConstraint.h"
@@ -581,6 +584,164 @@ void Query::saveQuery( const String &fileName )
     queryFile->close();
 }
 
+void Query::saveQueryAsBinary( const String &fileName ) const
+{
+    BinaryQueryFormat::Header header;
+    memset( &header, 0, sizeof( header ) );
+    header._version = BinaryQueryFormat::VERSION;
+    header._numberOfVariables = _numberOfVariables;
+    header._numberOfInputVariables = getNumInputVariables();
+    header._numberOfOutputVariables = getNumOutputVariables();
+    header._numberOfEquations = _equations.size();
+    header._numberOfConstraints = _plConstraints.size() + _nlConstraints.size();
+
+    // Bounds
+    Vector<double> lowerBounds( _numberOfVariables, FloatUtils::negativeInfinity() );
+    Vector<double> upperBounds( _numberOfVariables, FloatUtils::infinity() );
+    for ( const auto &lb : _lowerBounds )
+        lowerBounds[lb.first] = lb.second;
+    for ( const auto &ub : _upperBounds )
+        upperBounds[ub.first] = ub.second;
+
+    // Input and output variables
+    Vector<uint32_t> inputVariables;
+    for ( const auto &pair : _inputIndexToVariable )
+    {
+        inputVariables.append( pair.first );
+        inputVariables.append( pair.second );
+    }
+
+    Vector<uint32_t> outputVariables;
+    for ( const auto &pair : _outputIndexToVariable )
+    {
+        outputVariables.append( pair.first );
+        outputVariables.append( pair.second );
+    }
+
+    // Equations, in CSR form
+    Vector<double> equationScalars;
+    Vector<uint32_t> equationTypes;
+    Vector<uint32_t> equationStarts;
+    Vector<uint32_t> addendVariables;
+    Vector<double> addendCoefficients;
+    for ( const auto &equation : _equations )
+    {
+        equationScalars.append( equation._scalar );
+        equationTypes.append( equation._type );
+        equationStarts.append( addendVariables.size() );
+        for ( const auto &addend : equation._addends )
+        {
+            addendVariables.append( addend._variable );
+            addendCoefficients.append( addend._coefficient );
+        }
+    }
+    equationStarts.append( addendVariables.size() );
+    header._numberOfAddends = addendVariables.size();
+
+    // Constraints
+    List<String> constraints;
+    for ( const auto &constraint : _plConstraints )
+        constraints.append( constraint->serializeToString() );
+    for ( const auto &constraint : _nlConstraints )
+        constraints.append( constraint->serializeToString() );
+
+    // Lay out the sections
+    uint64_t offset = BinaryQueryFormat::HEADER_SIZE;
+    header._lowerBoundsOffset = offset;
+    offset += lowerBounds.size() * sizeof( double );
+    header._upperBoundsOffset = offset;
+    offset += upperBounds.size() * sizeof( double );
+    header._inputVariablesOffset = offset;
+    offset += inputVariables.size() * sizeof( uint32_t );
+    header._outputVariablesOffset = offset;
+    offset += outputVariables.size() * sizeof( uint32_t );
+    header._equationScalarsOffset = offset = BinaryQueryFormat::align( offset, sizeof( double ) );
+    offset += equationScalars.size() * sizeof( double );
+    header._equationTypesOffset = offset;
+    offset += equationTypes.size() * sizeof( uint32_t );
+    header._equationStartsOffset = offset;
+    offset += equationStarts.size() * sizeof( uint32_t );
+    header._addendVariablesOffset = offset;
+    offset += addendVariables.size() * sizeof( uint32_t );
+    header._addendCoefficientsOffset = offset =
+        BinaryQueryFormat::align( offset, sizeof( double ) );
+    offset += addendCoefficients.size() * sizeof( double );
+    header._constraintsOffset = offset;
+    for ( const auto &constraint : constraints )
+        offset += sizeof( uint32_t ) +
+                  BinaryQueryFormat::align( constraint.length(), sizeof( uint32_t ) );
+    header._fileSize = offset;
+
+    // Write the sections in little-endian byte order, padding with zeros
+    // in between
+    AutoFile queryFile( fileName );
+    queryFile->open( IFile::MODE_WRITE_TRUNCATE );
+    BufferedFileWriter out( queryFile );
+
+    char headerBytes[BinaryQueryFormat::HEADER_SIZE];
+    BinaryQueryFormat::storeHeader( header, headerBytes );
+    out.write( headerBytes, sizeof( headerBytes ) );
+
+    uint64_t written = sizeof( headerBytes );
+    auto padTo = [&]( uint64_t sectionOffset ) {
+        ASSERT( written <= sectionOffset && sectionOffset - written < sizeof( double ) );
+        const char padding[sizeof( double )] = { 0 };
+        out.write( padding, sectionOffset - written );
+        written = sectionOffset;
+    };
+
+    auto writeUint32 = [&]( uint32_t value ) {
+        char bytes[sizeof( uint32_t )];
+        LittleEndian::storeUint32( value, bytes );
+        out.write( bytes, sizeof( bytes ) );
+        written += sizeof( bytes );
+    };
+
+    auto writeDouble = [&]( double value ) {
+        char bytes[sizeof( double )];
+        LittleEndian::storeDouble( value, bytes );
+        out.write( bytes, sizeof( bytes ) );
+        written += sizeof( bytes );
+    };
+
+    auto writeUint32Section = [&]( uint64_t sectionOffset, const Vector<uint32_t> &values ) {
+        padTo( sectionOffset );
+        for ( unsigned i = 0; i < values.size(); ++i )
+            writeUint32( values[i] );
+    };
+
+    auto writeDoubleSection = [&]( uint64_t sectionOffset, const Vector<double> &values ) {
+        padTo( sectionOffset );
+        for ( unsigned i = 0; i < values.size(); ++i )
+            writeDouble( values[i] );
+    };
+
+    writeDoubleSection( header._lowerBoundsOffset, lowerBounds );
+    writeDoubleSection( header._upperBoundsOffset, upperBounds );
+    writeUint32Section( header._inputVariablesOffset, inputVariables );
+    writeUint32Section( header._outputVariablesOffset, outputVariables );
+    writeDoubleSection( header._equationScalarsOffset, equationScalars );
+    writeUint32Section( header._equationTypesOffset, equationTypes );
+    writeUint32Section( header._equationStartsOffset, equationStarts );
+    writeUint32Section( header._addendVariablesOffset, addendVariables );
+    writeDoubleSection( header._addendCoefficientsOffset, addendCoefficients );
+
+    offset = header._constraintsOffset;
+    for ( const auto &constraint : constraints )
+    {
+        padTo( offset );
+        writeUint32( constraint.length() );
+        out.write( constraint.ascii(), constraint.length() );
+        written += constraint.length();
+        offset += sizeof( uint32_t ) +
+                  BinaryQueryFormat::align( constraint.length(), sizeof( uint32_t ) );
+    }
+    padTo( header._fileSize );
+
+    out.flush();
+    queryFile->close();
+}
+
 void Query::saveQueryAsSmtLib( const String &fileName ) const
 {
     if ( !_nlConstraints.empty() )
@@ -822,7 +983,10 @@ bool Query::constructNetworkLevelReasoner( List<Equation> &unhandledEquations,
     INPUT_QUERY_LOG( "PP: constructing an NLR... " );
 
     if ( _networkLevelReasoner )
+    {
         delete _networkLevelReasoner;
+        _networkLevelReasoner = NULL;
+    }
     NLR::NetworkLevelReasoner *nlr = new NLR::NetworkLevelReasoner;
 
     Map<unsigned, unsigned> handledVariableToLayer;
@@ -883,6 +1047,8 @@ bool Query::constructNetworkLevelReasoner( List<Equation> &unhandledEquations,
 
     if ( success )
     {
+        nlr->finalizeWeights();
+
         unsigned count = 0;
         for ( unsigned i = 0; i < nlr->getNumberOfLayers(); ++i )
             count += nlr->getLayer( i )->getSize();
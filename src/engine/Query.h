@@ -125,6 +125,7 @@ public:
       Serializes the query to a file which can then be loaded using QueryLoader.
     */
     void saveQuery( const String &fileName );
+    void saveQueryAsBinary( const String &fileName ) const;
     void saveQueryAsSmtLib( const String &fileName ) const;
 
     /*
@@ -161,78 +161,7 @@ void ReluConstraint::notifyLowerBound( unsigned variable, double newBound )
         double bound = getLowerBound( variable );
         checkIfLowerBoundUpdateFixesPhase( variable, bound );
         if ( isActive() )
-        {
-            bool proofs = _boundManager->shouldProduceProofs();
-
-            if ( proofs )
-                createTighteningRow();
-
-            // A positive lower bound is always propagated between f and b
-            if ( ( variable == _f || variable == _b ) && bound > 0 )
-            {
-                // If we're in the active phase, aux should be 0
-                if ( proofs && _auxVarInUse )
-                    _boundManager->addLemmaExplanationAndTightenBound(
-                        _aux, 0, Tightening::UB, { variable }, Tightening::LB, getType() );
-                else if ( !proofs && _auxVarInUse )
-                    _boundManager->tightenUpperBound( _aux, 0 );
-
-                // After updating to active phase
-                unsigned partner = ( variable == _f ) ? _b : _f;
-                _boundManager->tightenLowerBound( partner, bound, *_tighteningRow );
-            }
-
-            // If b is non-negative, we're in the active phase
-            else if ( _auxVarInUse && variable == _b && FloatUtils::isZero( bound ) )
-            {
-                if ( proofs && _auxVarInUse )
-                    _boundManager->addLemmaExplanationAndTightenBound(
-                        _aux, 0, Tightening::UB, { variable }, Tightening::LB, getType() );
-                else if ( !proofs && _auxVarInUse )
-                    _boundManager->tightenUpperBound( _aux, 0 );
-            }
-
-            // A positive lower bound for aux means we're inactive: f is 0, b is
-            // non-positive When inactive, b = -aux
-            else if ( _auxVarInUse && variable == _aux && bound > 0 )
-            {
-                if ( proofs )
-                    _boundManager->addLemmaExplanationAndTightenBound(
-                        _f, 0, Tightening::UB, { variable }, Tightening::LB, getType() );
-                else
-                    _boundManager->tightenUpperBound( _f, 0 );
-
-                // After updating to inactive phase
-                _boundManager->tightenUpperBound( _b, -bound, *_tighteningRow );
-            }
-
-            // A negative lower bound for b could tighten aux's upper bound
-            else if ( _auxVarInUse && variable == _b && bound < 0 )
-            {
-                if ( proofs )
-                {
-                    // If already inactive, tightening is linear
-                    if ( _phaseStatus == RELU_PHASE_INACTIVE )
-                        _boundManager->tightenUpperBound( _aux, -bound, *_tighteningRow );
-                    else if ( _phaseStatus == PHASE_NOT_FIXED )
-                        _boundManager->addLemmaExplanationAndTightenBound(
-                            _aux, -bound, Tightening::UB, { variable }, Tightening::LB, getType() );
-                }
-                else
-                    _boundManager->tightenUpperBound( _aux, -bound );
-            }
-
-            // Also, if for some reason we only know a negative lower bound for
-            // f, we attempt to tighten it to 0
-            else if ( bound < 0 && variable == _f )
-            {
-                if ( proofs )
-                    _boundManager->addLemmaExplanationAndTightenBound(
-                        _f, 0, Tightening::LB, { variable }, Tightening::LB, getType() );
-                else
-                    _boundManager->tightenLowerBound( _f, 0 );
-            }
-        }
+            propagateLowerBound( variable, bound );
     }
 }
 
@@ -257,87 +186,206 @@ void ReluConstraint::notifyUpperBound( unsigned variable, double newBound )
         checkIfUpperBoundUpdateFixesPhase( variable, bound );
 
         if ( isActive() )
+            propagateUpperBound( variable, bound );
+    }
+}
+
+void ReluConstraint::notifyBounds( const Tightening *tightenings, unsigned count )
+{
+    // Proof explanations depend on the phase at the time each bound is
+    // learned, so with proofs the changes are handled one at a time
+    if ( _boundManager == nullptr || _boundManager->shouldProduceProofs() )
+    {
+        PiecewiseLinearConstraint::notifyBounds( tightenings, count );
+        return;
+    }
+
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS,
+                                       count );
+
+    if ( phaseFixed() )
+        return;
+
+    for ( unsigned i = 0; i < count; ++i )
+    {
+        unsigned variable = tightenings[i]._variable;
+        if ( tightenings[i]._type == Tightening::LB )
+            checkIfLowerBoundUpdateFixesPhase( variable, getLowerBound( variable ) );
+        else
+            checkIfUpperBoundUpdateFixesPhase( variable, getUpperBound( variable ) );
+    }
+
+    if ( !isActive() )
+        return;
+
+    // A propagation round reports each bound at most once, so every
+    // bound is propagated once. Bounds tightened here are reported in
+    // the next round.
+    for ( unsigned i = 0; i < count; ++i )
+    {
+        unsigned variable = tightenings[i]._variable;
+        if ( tightenings[i]._type == Tightening::LB )
+            propagateLowerBound( variable, getLowerBound( variable ) );
+        else
+            propagateUpperBound( variable, getUpperBound( variable ) );
+    }
+}
+
+void ReluConstraint::propagateLowerBound( unsigned variable, double bound )
+{
+    bool proofs = _boundManager->shouldProduceProofs();
+
+    if ( proofs )
+        createTighteningRow();
+
+    // A positive lower bound is always propagated between f and b
+    if ( ( variable == _f || variable == _b ) && bound > 0 )
+    {
+        // If we're in the active phase, aux should be 0
+        if ( proofs && _auxVarInUse )
+            _boundManager->addLemmaExplanationAndTightenBound(
+                _aux, 0, Tightening::UB, { variable }, Tightening::LB, getType() );
+        else if ( !proofs && _auxVarInUse )
+            _boundManager->tightenUpperBound( _aux, 0 );
+
+        // After updating to active phase
+        unsigned partner = ( variable == _f ) ? _b : _f;
+        _boundManager->tightenLowerBound( partner, bound, *_tighteningRow );
+    }
+
+    // If b is non-negative, we're in the active phase
+    else if ( _auxVarInUse && variable == _b && FloatUtils::isZero( bound ) )
+    {
+        if ( proofs && _auxVarInUse )
+            _boundManager->addLemmaExplanationAndTightenBound(
+                _aux, 0, Tightening::UB, { variable }, Tightening::LB, getType() );
+        else if ( !proofs && _auxVarInUse )
+            _boundManager->tightenUpperBound( _aux, 0 );
+    }
+
+    // A positive lower bound for aux means we're inactive: f is 0, b is
+    // non-positive When inactive, b = -aux
+    else if ( _auxVarInUse && variable == _aux && bound > 0 )
+    {
+        if ( proofs )
+            _boundManager->addLemmaExplanationAndTightenBound(
+                _f, 0, Tightening::UB, { variable }, Tightening::LB, getType() );
+        else
+            _boundManager->tightenUpperBound( _f, 0 );
+
+        // After updating to inactive phase
+        _boundManager->tightenUpperBound( _b, -bound, *_tighteningRow );
+    }
+
+    // A negative lower bound for b could tighten aux's upper bound
+    else if ( _auxVarInUse && variable == _b && bound < 0 )
+    {
+        if ( proofs )
         {
-            bool proofs = _boundManager->shouldProduceProofs();
+            // If already inactive, tightening is linear
+            if ( getPhaseStatus() == RELU_PHASE_INACTIVE )
+                _boundManager->tightenUpperBound( _aux, -bound, *_tighteningRow );
+            else if ( getPhaseStatus() == PHASE_NOT_FIXED )
+                _boundManager->addLemmaExplanationAndTightenBound(
+                    _aux, -bound, Tightening::UB, { variable }, Tightening::LB, getType() );
+        }
+        else
+            _boundManager->tightenUpperBound( _aux, -bound );
+    }
 
-            if ( proofs )
-                createTighteningRow();
+    // Also, if for some reason we only know a negative lower bound for
+    // f, we attempt to tighten it to 0
+    else if ( bound < 0 && variable == _f )
+    {
+        if ( proofs )
+            _boundManager->addLemmaExplanationAndTightenBound(
+                _f, 0, Tightening::LB, { variable }, Tightening::LB, getType() );
+        else
+            _boundManager->tightenLowerBound( _f, 0 );
+    }
+}
+
+void ReluConstraint::propagateUpperBound( unsigned variable, double bound )
+{
+    bool proofs = _boundManager->shouldProduceProofs();
+
+    if ( proofs )
+        createTighteningRow();
 
-            if ( variable == _f )
+    if ( variable == _f )
+    {
+        if ( proofs )
+        {
+            if ( getPhaseStatus() != RELU_PHASE_INACTIVE )
+                _boundManager->tightenUpperBound( _b, bound, *_tighteningRow );
+            else
             {
-                if ( proofs )
-                {
-                    if ( _phaseStatus != RELU_PHASE_INACTIVE )
-                        _boundManager->tightenUpperBound( _b, bound, *_tighteningRow );
-                    else
-                    {
-                        if ( FloatUtils::isZero( bound ) )
-                            _boundManager->addLemmaExplanationAndTightenBound(
-                                _b, 0, Tightening::UB, { variable }, Tightening::UB, getType() );
-                        // Bound cannot be negative if ReLU is inactive
-                        else if ( FloatUtils::isNegative( bound ) )
-                            throw InfeasibleQueryException();
-                    }
-                }
-                else
-                    _boundManager->tightenUpperBound( _b, bound );
+                if ( FloatUtils::isZero( bound ) )
+                    _boundManager->addLemmaExplanationAndTightenBound(
+                        _b, 0, Tightening::UB, { variable }, Tightening::UB, getType() );
+                // Bound cannot be negative if ReLU is inactive
+                else if ( FloatUtils::isNegative( bound ) )
+                    throw InfeasibleQueryException();
             }
-            else if ( variable == _b )
+        }
+        else
+            _boundManager->tightenUpperBound( _b, bound );
+    }
+    else if ( variable == _b )
+    {
+        if ( !FloatUtils::isPositive( bound ) )
+        {
+            // If b has a non-positive upper bound, f's upper bound is 0
+            if ( proofs )
+                _boundManager->addLemmaExplanationAndTightenBound(
+                    _f, 0, Tightening::UB, { variable }, Tightening::UB, getType() );
+            else
+                _boundManager->tightenUpperBound( _f, 0 );
+
+            // Aux's range is minus the range of b
+            // After updating to inactive phase
+            if ( _auxVarInUse )
+                _boundManager->tightenLowerBound( _aux, -bound, *_tighteningRow );
+        }
+        else
+        {
+            // b has a positive upper bound, propagate to f
+            if ( proofs )
             {
-                if ( !FloatUtils::isPositive( bound ) )
-                {
-                    // If b has a non-positive upper bound, f's upper bound is 0
-                    if ( proofs )
-                        _boundManager->addLemmaExplanationAndTightenBound(
-                            _f, 0, Tightening::UB, { variable }, Tightening::UB, getType() );
-                    else
-                        _boundManager->tightenUpperBound( _f, 0 );
-
-                    // Aux's range is minus the range of b
-                    // After updating to inactive phase
-                    if ( _auxVarInUse )
-                        _boundManager->tightenLowerBound( _aux, -bound, *_tighteningRow );
-                }
-                else
-                {
-                    // b has a positive upper bound, propagate to f
-                    if ( proofs )
-                    {
-                        // If already inactive, tightening is linear
-                        if ( _phaseStatus == RELU_PHASE_ACTIVE )
-                            _boundManager->tightenUpperBound( _f, bound, *_tighteningRow );
-                        else if ( _phaseStatus == PHASE_NOT_FIXED )
-                            _boundManager->addLemmaExplanationAndTightenBound( _f,
-                                                                               bound,
-                                                                               Tightening::UB,
-                                                                               { variable },
-                                                                               Tightening::UB,
-                                                                               getType() );
-                    }
-                    else
-                        _boundManager->tightenUpperBound( _f, bound );
-                }
+                // If already inactive, tightening is linear
+                if ( getPhaseStatus() == RELU_PHASE_ACTIVE )
+                    _boundManager->tightenUpperBound( _f, bound, *_tighteningRow );
+                else if ( getPhaseStatus() == PHASE_NOT_FIXED )
+                    _boundManager->addLemmaExplanationAndTightenBound( _f,
+                                                                       bound,
+                                                                       Tightening::UB,
+                                                                       { variable },
+                                                                       Tightening::UB,
+                                                                       getType() );
             }
-            else if ( _auxVarInUse && variable == _aux )
+            else
+                _boundManager->tightenUpperBound( _f, bound );
+        }
+    }
+    else if ( _auxVarInUse && variable == _aux )
+    {
+        if ( proofs )
+        {
+            if ( getPhaseStatus() != RELU_PHASE_ACTIVE )
+                _boundManager->tightenLowerBound( _b, -bound, *_tighteningRow );
+            else
             {
-                if ( proofs )
-                {
-                    if ( _phaseStatus != RELU_PHASE_ACTIVE )
-                        _boundManager->tightenLowerBound( _b, -bound, *_tighteningRow );
-                    else
-                    {
-                        if ( FloatUtils::isZero( bound ) )
-                            _boundManager->addLemmaExplanationAndTightenBound(
-                                _b, 0, Tightening::LB, { variable }, Tightening::UB, getType() );
-                        // Bound cannot be negative if ReLU is active
-                        else if ( FloatUtils::isNegative( bound ) )
-                            throw InfeasibleQueryException();
-                    }
-                }
-                else
-                    _boundManager->tightenLowerBound( _b, -bound );
+                if ( FloatUtils::isZero( bound ) )
+                    _boundManager->addLemmaExplanationAndTightenBound(
+                        _b, 0, Tightening::LB, { variable }, Tightening::UB, getType() );
+                // Bound cannot be negative if ReLU is active
+                else if ( FloatUtils::isNegative( bound ) )
+                    throw InfeasibleQueryException();
             }
         }
+        else
+            _boundManager->tightenLowerBound( _b, -bound );
     }
 }
 
@@ -554,7 +602,7 @@ List<PiecewiseLinearConstraint::Fix> ReluConstraint::getSmartFixes( ITableau *ta
 
 List<PiecewiseLinearCaseSplit> ReluConstraint::getCaseSplits() const
 {
-    if ( _phaseStatus != PHASE_NOT_FIXED )
+    if ( getPhaseStatus() != PHASE_NOT_FIXED )
         throw MarabouError( MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
 
     List<PiecewiseLinearCaseSplit> splits;
@@ -664,14 +712,14 @@ PiecewiseLinearCaseSplit ReluConstraint::getActiveSplit() const
 
 bool ReluConstraint::phaseFixed() const
 {
-    return _phaseStatus != PHASE_NOT_FIXED;
+    return getPhaseStatus() != PHASE_NOT_FIXED;
 }
 
 PiecewiseLinearCaseSplit ReluConstraint::getImpliedCaseSplit() const
 {
-    ASSERT( _phaseStatus != PHASE_NOT_FIXED );
+    ASSERT( getPhaseStatus() != PHASE_NOT_FIXED );
 
-    if ( _phaseStatus == RELU_PHASE_ACTIVE )
+    if ( getPhaseStatus() == RELU_PHASE_ACTIVE )
         return getActiveSplit();
 
     return getInactiveSplit();
@@ -687,9 +735,9 @@ void ReluConstraint::dump( String &output ) const
     output = Stringf( "ReluConstraint: x%u = ReLU( x%u ). Active? %s. PhaseStatus = %u (%s).\n",
                       _f,
                       _b,
-                      _constraintActive ? "Yes" : "No",
-                      _phaseStatus,
-                      phaseToString( _phaseStatus ).ascii() );
+                      isActive() ? "Yes" : "No",
+                      getPhaseStatus(),
+                      phaseToString( getPhaseStatus() ).ascii() );
 
     output +=
         Stringf( "b in [%s, %s], ",
@@ -756,11 +804,11 @@ void ReluConstraint::eliminateVariable( __attribute__( ( unused ) ) unsigned var
         {
             if ( FloatUtils::gt( fixedValue, 0 ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_INACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_INACTIVE );
             }
             else if ( FloatUtils::lt( fixedValue, 0 ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_ACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_ACTIVE );
             }
         }
         else
@@ -768,7 +816,7 @@ void ReluConstraint::eliminateVariable( __attribute__( ( unused ) ) unsigned var
             // This is the aux variable
             if ( FloatUtils::isPositive( fixedValue ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_ACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_ACTIVE );
             }
         }
     } );
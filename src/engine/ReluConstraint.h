@@ -80,6 +80,15 @@ public:
     */
     void restoreState( const PiecewiseLinearConstraint *state ) override;
 
+    /*
+      The search state of the constraint consists of its phase and
+      active status, both of which are context-dependent.
+    */
+    bool searchStateIsContextDependent() const override
+    {
+        return true;
+    }
+
     /*
       Register/unregister the constraint with a talbeau.
      */
@@ -93,6 +102,12 @@ public:
     void notifyLowerBound( unsigned variable, double bound ) override;
     void notifyUpperBound( unsigned variable, double bound ) override;
 
+    /*
+      Handle a batch of bound changes: the phase is fixed according to
+      all of them before any bound is propagated.
+    */
+    void notifyBounds( const Tightening *tightenings, unsigned count ) override;
+
     /*
        Check conditions that fix Phase and met update phase status
      */
@@ -288,6 +303,13 @@ private:
 
     static String phaseToString( PhaseStatus phase );
 
+    /*
+      Propagate a new bound of a participating variable to the other
+      participating variables, through the bound manager
+    */
+    void propagateLowerBound( unsigned variable, double bound );
+    void propagateUpperBound( unsigned variable, double bound );
+
     /*
       Return true iff b or f are out of bounds.
     */
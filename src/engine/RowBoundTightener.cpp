@@ -28,6 +28,7 @@ RowBoundTightener::RowBoundTightener( const ITableau &tableau )
     , _upperBounds( nullptr )
     , _rows( NULL )
     , _z( NULL )
+    , _aColumn( NULL )
     , _ciTimesLb( NULL )
     , _ciTimesUb( NULL )
     , _ciSign( NULL )
@@ -57,6 +58,7 @@ void RowBoundTightener::setDimensions()
             _rows[i] = new TableauRow( _n - _m );
 
         _z = new double[_m];
+        _aColumn = new double[_m];
     }
 
     _ciTimesLb = new double[_n];
@@ -85,6 +87,12 @@ void RowBoundTightener::freeMemoryIfNeeded()
         _z = NULL;
     }
 
+    if ( _aColumn )
+    {
+        delete[] _aColumn;
+        _aColumn = NULL;
+    }
+
     if ( _ciTimesLb )
     {
         delete[] _ciTimesLb;
@@ -125,8 +133,8 @@ void RowBoundTightener::examineImplicitInvertedBasisMatrix( bool untilSaturation
     for ( unsigned i = 0; i < _n - _m; ++i )
     {
         unsigned nonBasic = _tableau.nonBasicIndexToVariable( i );
-        const double *ANColumn = _tableau.getAColumn( nonBasic );
-        _tableau.forwardTransformation( ANColumn, _z );
+        _tableau.getAColumn( nonBasic, _aColumn );
+        _tableau.forwardTransformation( _aColumn, _z );
 
         for ( unsigned j = 0; j < _m; ++j )
         {
@@ -177,6 +177,7 @@ private:
     */
     TableauRow **_rows;
     double *_z;
+    double *_aColumn;
     double *_ciTimesLb;
     double *_ciTimesUb;
     char *_ciSign;
@@ -71,6 +71,15 @@ public:
     */
     void restoreState( const PiecewiseLinearConstraint *state ) override;
 
+    /*
+      The search state of the constraint consists of its phase and
+      active status, both of which are context-dependent.
+    */
+    bool searchStateIsContextDependent() const override
+    {
+        return true;
+    }
+
     /*
       Register/unregister the constraint with a talbeau.
      */
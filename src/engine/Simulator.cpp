@@ -18,12 +18,38 @@
 #include "Debug.h"
 #include "FloatUtils.h"
 #include "MarabouError.h"
+#include "NetworkLevelReasoner.h"
 #include "Preprocessor.h"
 
+#include <list>
+#include <thread>
+
 #ifdef _WIN32
 #include <time.h>
 #endif
 
+Simulator::Simulator()
+    : _numberOfWorkers( 1 )
+    , _batchSimulation( true )
+    , _usedBatchSimulation( false )
+{
+}
+
+void Simulator::setNumberOfWorkers( unsigned numberOfWorkers )
+{
+    _numberOfWorkers = numberOfWorkers;
+}
+
+void Simulator::setBatchSimulation( bool batchSimulation )
+{
+    _batchSimulation = batchSimulation;
+}
+
+bool Simulator::usedBatchSimulation() const
+{
+    return _usedBatchSimulation;
+}
+
 void Simulator::runSimulations( const Query &inputQuery, unsigned numberOfSimulations )
 {
     unsigned seed = time( NULL );
@@ -41,6 +67,13 @@ void Simulator::runSimulations( const Query &inputQuery,
     srand( seed );
 
     // Perform the actual simulations
+    _usedBatchSimulation = _batchSimulation && canSimulateWithNetworkLevelReasoner();
+    if ( _usedBatchSimulation )
+    {
+        runBatchSimulations( numberOfSimulations );
+        return;
+    }
+
     for ( unsigned i = 0; i < numberOfSimulations; ++i )
         runSingleSimulation();
 }
@@ -111,6 +144,145 @@ void Simulator::runSingleSimulation()
     _results.append( result );
 }
 
+bool Simulator::canSimulateWithNetworkLevelReasoner()
+{
+    _variableToNeuron.clear();
+
+    // Build a network level reasoner for the preprocessed query, and make
+    // sure that it captures all of the query's equations and constraints
+    List<Equation> unhandledEquations;
+    Set<unsigned> varsInUnhandledConstraints;
+    if ( !_originalQuery.constructNetworkLevelReasoner( unhandledEquations,
+                                                         varsInUnhandledConstraints ) )
+        return false;
+
+    if ( !unhandledEquations.empty() || !varsInUnhandledConstraints.empty() )
+        return false;
+
+    const NLR::NetworkLevelReasoner *nlr = _originalQuery.getNetworkLevelReasoner();
+    for ( unsigned i = 0; i < nlr->getNumberOfLayers(); ++i )
+    {
+        const NLR::Layer *layer = nlr->getLayer( i );
+        for ( unsigned j = 0; j < layer->getSize(); ++j )
+        {
+            if ( !layer->neuronEliminated( j ) )
+                _variableToNeuron[layer->neuronToVariable( j )] = NLR::NeuronIndex( i, j );
+        }
+    }
+
+    for ( unsigned i = 0; i < _originalQuery.getNumberOfVariables(); ++i )
+    {
+        if ( !_variableToNeuron.exists( i ) &&
+             !FloatUtils::areEqual( _originalQuery.getLowerBound( i ),
+                                    _originalQuery.getUpperBound( i ) ) )
+        {
+            _variableToNeuron.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Simulator::runBatchSimulations( unsigned numberOfSimulations )
+{
+    NLR::NetworkLevelReasoner *nlr = _originalQuery.getNetworkLevelReasoner();
+    const NLR::Layer *inputLayer = nlr->getLayer( 0 );
+
+    // Draw the random inputs in the same order as runSingleSimulation(),
+    // so that a given seed produces the same samples on both paths
+    Vector<double> inputs( inputLayer->getSize() * numberOfSimulations );
+    List<unsigned> inputVariables = _originalQuery.getInputVariables();
+    for ( unsigned i = 0; i < numberOfSimulations; ++i )
+    {
+        for ( const auto &input : inputVariables )
+        {
+            double lb = _originalQuery.getLowerBound( input );
+            double ub = _originalQuery.getUpperBound( input );
+
+            double factor = ( (double)rand() ) / RAND_MAX;
+            unsigned neuron = inputLayer->variableToNeuron( input );
+            inputs[neuron * numberOfSimulations + i] = lb + factor * ( ub - lb );
+        }
+    }
+
+    Vector<Simulator::Result> results( numberOfSimulations );
+
+    unsigned numberOfWorkers = std::min( _numberOfWorkers, numberOfSimulations );
+    if ( numberOfWorkers <= 1 )
+        simulateBatch( nlr, inputs, numberOfSimulations, 0, numberOfSimulations, results );
+    else
+    {
+        // Every worker simulates a contiguous block of samples, using its
+        // own copy of the network level reasoner
+        Vector<NLR::NetworkLevelReasoner *> copies( numberOfWorkers );
+        std::list<std::thread> threads;
+        unsigned blockSize = numberOfSimulations / numberOfWorkers;
+        unsigned first = 0;
+        for ( unsigned i = 0; i < numberOfWorkers; ++i )
+        {
+            unsigned count = blockSize + ( i < numberOfSimulations % numberOfWorkers ? 1 : 0 );
+
+            copies[i] = new NLR::NetworkLevelReasoner;
+            nlr->storeIntoOther( *copies[i] );
+
+            threads.push_back( std::thread( &Simulator::simulateBatch,
+                                            this,
+                                            copies[i],
+                                            std::cref( inputs ),
+                                            numberOfSimulations,
+                                            first,
+                                            count,
+                                            std::ref( results ) ) );
+            first += count;
+        }
+
+        for ( auto &thread : threads )
+            thread.join();
+
+        for ( const auto &copy : copies )
+            delete copy;
+    }
+
+    for ( const auto &result : results )
+        _results.append( result );
+}
+
+void Simulator::simulateBatch( NLR::NetworkLevelReasoner *nlr,
+                               const Vector<double> &inputs,
+                               unsigned numberOfSimulations,
+                               unsigned first,
+                               unsigned count,
+                               Vector<Simulator::Result> &results ) const
+{
+    unsigned inputSize = nlr->getLayer( 0 )->getSize();
+    Vector<double> block( inputSize * count );
+    for ( unsigned i = 0; i < inputSize; ++i )
+    {
+        for ( unsigned j = 0; j < count; ++j )
+            block[i * count + j] = inputs.get( i * numberOfSimulations + first + j );
+    }
+
+    nlr->simulate( block.data(), count );
+
+    for ( unsigned i = 0; i < _originalQuery.getNumberOfVariables(); ++i )
+    {
+        if ( _variableToNeuron.exists( i ) )
+        {
+            NLR::NeuronIndex index = _variableToNeuron.get( i );
+            const double *simulations =
+                nlr->getLayer( index._layer )->getSimulations( index._neuron );
+            for ( unsigned j = 0; j < count; ++j )
+                results[first + j][i] = simulations[j];
+        }
+        else
+        {
+            for ( unsigned j = 0; j < count; ++j )
+                results[first + j][i] = _originalQuery.getLowerBound( i );
+        }
+    }
+}
+
 const List<Simulator::Result> *Simulator::getResults()
 {
     return &_results;
@@ -16,8 +16,9 @@
 #ifndef __Simulator_h__
 #define __Simulator_h__
 
+#include "NeuronIndex.h"
 #include "Query.h"
-#include "Simulator.h"
+#include "Vector.h"
 
 /*
   This class takes an input query, with marked input variables,
@@ -25,6 +26,12 @@
   The simulations are performed by selecting values for the
   input variables uniformly at random, evaluating the network,
   and then storing the results.
+
+  When the query is entirely captured by a network level reasoner,
+  all the simulations are evaluated as a single batch by the network
+  level reasoner, optionally split among several worker threads.
+  Otherwise, each simulation is evaluated by fixing the inputs and
+  preprocessing the query.
 */
 
 class Simulator
@@ -32,6 +39,26 @@ class Simulator
 public:
     typedef Map<unsigned, double> Result;
 
+    Simulator();
+
+    /*
+      The number of threads among which batch simulations are split
+    */
+    void setNumberOfWorkers( unsigned numberOfWorkers );
+
+    /*
+      Whether to evaluate the simulations as a single batch when the
+      query allows it (the default), or to always preprocess a copy of
+      the query per simulation
+    */
+    void setBatchSimulation( bool batchSimulation );
+
+    /*
+      Whether the last call to runSimulations() evaluated the
+      simulations as a single batch
+    */
+    bool usedBatchSimulation() const;
+
     /*
       Perform a given number of simulation runs on the input query.
       The seed will be used to initialize randomness. A specific seed can be
@@ -48,6 +75,16 @@ public:
 private:
     Query _originalQuery;
     List<Simulator::Result> _results;
+    unsigned _numberOfWorkers;
+    bool _batchSimulation;
+    bool _usedBatchSimulation;
+
+    /*
+      The neuron of the network level reasoner that corresponds to
+      each variable of the preprocessed query. Variables without a
+      neuron are fixed.
+    */
+    Map<unsigned, NLR::NeuronIndex> _variableToNeuron;
 
     /*
       Store a copy of the original input query, and run an initial
@@ -60,6 +97,31 @@ private:
       query.
     */
     void runSingleSimulation();
+
+    /*
+      Check whether every variable of the preprocessed query is either
+      fixed or computed by a network level reasoner that accounts for
+      all of the query's constraints. If so, populate _variableToNeuron.
+    */
+    bool canSimulateWithNetworkLevelReasoner();
+
+    /*
+      Evaluate all the simulations as one batch, using the network
+      level reasoner
+    */
+    void runBatchSimulations( unsigned numberOfSimulations );
+
+    /*
+      Simulate the samples [first, first + count) of the inputs, a
+      row-major matrix with one row per input neuron, and store the
+      results in the matching entries of results.
+    */
+    void simulateBatch( NLR::NetworkLevelReasoner *nlr,
+                        const Vector<double> &inputs,
+                        unsigned numberOfSimulations,
+                        unsigned first,
+                        unsigned count,
+                        Vector<Simulator::Result> &results ) const;
 };
 
 #endif // __Simulator_h__
@@ -33,10 +33,12 @@
 #include "TableauRow.h"
 #include "TableauState.h"
 
+#include <algorithm>
 #include <string.h>
 
 Tableau::Tableau( IBoundManager &boundManager )
-    : _boundManager( boundManager )
+    : _watcherIndexValid( true )
+    , _boundManager( boundManager )
     , _lowerBounds( _boundManager.getLowerBounds() )
     , _upperBounds( _boundManager.getUpperBounds() )
     , _n( 0 )
@@ -44,8 +46,10 @@ Tableau::Tableau( IBoundManager &boundManager )
     , _A( NULL )
     , _sparseColumnsOfA( NULL )
     , _sparseRowsOfA( NULL )
-    , _denseA( NULL )
+    , _denseAColumn( NULL )
     , _changeColumn( NULL )
+    , _changeColumnNonZeros( NULL )
+    , _changeColumnNnz( 0 )
     , _pivotRow( NULL )
     , _b( NULL )
     , _workM( NULL )
@@ -53,6 +57,10 @@ Tableau::Tableau( IBoundManager &boundManager )
     , _unitVector( NULL )
     , _basisFactorization( NULL )
     , _multipliers( NULL )
+    , _multipliersNonZeros( NULL )
+    , _multipliersNnz( 0 )
+    , _changeColumnDensity( 0 )
+    , _multipliersDensity( 0 )
     , _basicIndexToVariable( NULL )
     , _nonBasicIndexToVariable( NULL )
     , _variableToIndex( NULL )
@@ -64,7 +72,7 @@ Tableau::Tableau( IBoundManager &boundManager )
     , _costFunctionManager( NULL )
     , _rhsIsAllZeros( true )
     , _lpSolverType( Options::get()->getLPSolverType() )
-    , _gurobi( nullptr )
+    , _solver( nullptr )
 {
 }
 
@@ -111,10 +119,10 @@ void Tableau::freeMemoryIfNeeded()
         _sparseRowsOfA = NULL;
     }
 
-    if ( _denseA )
+    if ( _denseAColumn )
     {
-        delete[] _denseA;
-        _denseA = NULL;
+        delete[] _denseAColumn;
+        _denseAColumn = NULL;
     }
 
     if ( _changeColumn )
@@ -123,6 +131,12 @@ void Tableau::freeMemoryIfNeeded()
         _changeColumn = NULL;
     }
 
+    if ( _changeColumnNonZeros )
+    {
+        delete[] _changeColumnNonZeros;
+        _changeColumnNonZeros = NULL;
+    }
+
     if ( _pivotRow )
     {
         delete _pivotRow;
@@ -147,6 +161,12 @@ void Tableau::freeMemoryIfNeeded()
         _multipliers = NULL;
     }
 
+    if ( _multipliersNonZeros )
+    {
+        delete[] _multipliersNonZeros;
+        _multipliersNonZeros = NULL;
+    }
+
     if ( _basicIndexToVariable )
     {
         delete[] _basicIndexToVariable;
@@ -236,13 +256,19 @@ void Tableau::setDimensions( unsigned m, unsigned n )
                 throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::sparseRowOfA[i]" );
         }
 
-        _denseA = new double[m * n];
-        if ( !_denseA )
-            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::denseA" );
+        _denseAColumn = new double[m];
+        if ( !_denseAColumn )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::denseAColumn" );
 
         _changeColumn = new double[m];
         if ( !_changeColumn )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::changeColumn" );
+        std::fill_n( _changeColumn, m, 0.0 );
+        _changeColumnNnz = 0;
+
+        _changeColumnNonZeros = new unsigned[m];
+        if ( !_changeColumnNonZeros )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::changeColumnNonZeros" );
 
         _pivotRow = new TableauRow( n - m );
         if ( !_pivotRow )
@@ -259,6 +285,12 @@ void Tableau::setDimensions( unsigned m, unsigned n )
         _multipliers = new double[m];
         if ( !_multipliers )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::multipliers" );
+        std::fill_n( _multipliers, m, 0.0 );
+        _multipliersNnz = 0;
+
+        _multipliersNonZeros = new unsigned[m];
+        if ( !_multipliersNonZeros )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::multipliersNonZeros" );
 
         _basicIndexToVariable = new unsigned[m];
         if ( !_basicIndexToVariable )
@@ -310,16 +342,32 @@ void Tableau::setConstraintMatrix( const double *A )
 {
     _A->initialize( A, _m, _n );
 
-    for ( unsigned column = 0; column < _n; ++column )
-    {
-        for ( unsigned row = 0; row < _m; ++row )
-            _denseA[column * _m + row] = A[row * _n + column];
+    for ( unsigned row = 0; row < _m; ++row )
+        _sparseRowsOfA[row]->initialize( A + ( row * _n ), _n );
 
-        _sparseColumnsOfA[column]->initialize( _denseA + ( column * _m ), _m );
-    }
+    initializeSparseColumnsFromRows();
+}
+
+void Tableau::setConstraintMatrix( const SparseUnsortedList **A )
+{
+    _A->initialize( A, _m, _n );
 
     for ( unsigned row = 0; row < _m; ++row )
-        _sparseRowsOfA[row]->initialize( A + ( row * _n ), _n );
+        A[row]->storeIntoOther( _sparseRowsOfA[row] );
+
+    initializeSparseColumnsFromRows();
+}
+
+void Tableau::initializeSparseColumnsFromRows()
+{
+    for ( unsigned column = 0; column < _n; ++column )
+        _sparseColumnsOfA[column]->clear();
+
+    for ( unsigned row = 0; row < _m; ++row )
+    {
+        for ( const auto &entry : *_sparseRowsOfA[row] )
+            _sparseColumnsOfA[entry._index]->append( row, entry._value );
+    }
 }
 
 void Tableau::markAsBasic( unsigned variable )
@@ -469,7 +517,7 @@ bool Tableau::existsValue( unsigned variable ) const
 {
     if ( _lpSolverType == LPSolverType::GUROBI )
     {
-        return _gurobi && _gurobi->existsAssignment( Stringf( "x%u", variable ) );
+        return _solver && _solver->existsAssignment( Stringf( "x%u", variable ) );
     }
     else
     {
@@ -482,8 +530,8 @@ double Tableau::getValue( unsigned variable ) const
 {
     if ( _lpSolverType == LPSolverType::GUROBI )
     {
-        ASSERT( _gurobi );
-        return _gurobi->getAssignment( Stringf( "x%u", variable ) );
+        ASSERT( _solver );
+        return _solver->getAssignment( Stringf( "x%u", variable ) );
     }
     else
     {
@@ -581,6 +629,7 @@ void Tableau::computeCostFunction()
 void Tableau::computeMultipliers( double *rowCoefficients )
 {
     _basisFactorization->backwardTransformation( rowCoefficients, _multipliers );
+    _multipliersNnz = collectNonZeros( _multipliers, _multipliersNonZeros );
 }
 
 unsigned Tableau::getBasicStatus( unsigned basic )
@@ -789,8 +838,8 @@ void Tableau::performPivot()
 
     // Update the basis factorization. The column corresponding to the
     // leaving variable is the one that has changed
-    _basisFactorization->updateToAdjacentBasis(
-        _leavingVariable, _changeColumn, getAColumn( currentNonBasic ) );
+    getAColumn( currentNonBasic, _denseAColumn );
+    _basisFactorization->updateToAdjacentBasis( _leavingVariable, _changeColumn, _denseAColumn );
 
     if ( _statistics )
     {
@@ -831,8 +880,8 @@ void Tableau::performDegeneratePivot()
     _variableToIndex[currentNonBasic] = _leavingVariable;
 
     // Update the basis factorization
-    _basisFactorization->updateToAdjacentBasis(
-        _leavingVariable, _changeColumn, getAColumn( currentNonBasic ) );
+    getAColumn( currentNonBasic, _denseAColumn );
+    _basisFactorization->updateToAdjacentBasis( _leavingVariable, _changeColumn, _denseAColumn );
 
     // Switch assignment values. No call to notify is required,
     // because values haven't changed.
@@ -1449,11 +1498,54 @@ void Tableau::setChangeRatio( double changeRatio )
     _changeRatio = changeRatio;
 }
 
+unsigned Tableau::collectNonZeros( const double *vector, unsigned *nonZeros ) const
+{
+    unsigned nnz = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( vector[i] != 0.0 )
+            nonZeros[nnz++] = i;
+    }
+    return nnz;
+}
+
+bool Tableau::useSparseTransformation( double density ) const
+{
+    return _basisFactorization->supportsSparseTransformations() &&
+           density < GlobalConfiguration::HYPERSPARSE_SOLVE_DENSITY_THRESHOLD;
+}
+
+void Tableau::updateDensity( double &density, unsigned nnz ) const
+{
+    // An exponential moving average, which follows the sparsity of the
+    // basis as it changes over the course of the search
+    if ( _m > 0 )
+        density = 0.9 * density + 0.1 * ( (double)nnz / _m );
+}
+
 void Tableau::computeChangeColumn()
 {
     // Compute d = inv(B) * a using the basis factorization
-    const double *a = getAColumn( _nonBasicIndexToVariable[_enteringVariable] );
-    _basisFactorization->forwardTransformation( a, _changeColumn );
+    unsigned variable = _nonBasicIndexToVariable[_enteringVariable];
+
+    if ( useSparseTransformation( _changeColumnDensity ) )
+    {
+        // The result is scattered into the change column, so the
+        // entries of the previous change column are cleared first
+        for ( unsigned i = 0; i < _changeColumnNnz; ++i )
+            _changeColumn[_changeColumnNonZeros[i]] = 0;
+
+        _basisFactorization->sparseForwardTransformation(
+            *_sparseColumnsOfA[variable], _changeColumn, _changeColumnNonZeros, _changeColumnNnz );
+    }
+    else
+    {
+        getAColumn( variable, _denseAColumn );
+        _basisFactorization->forwardTransformation( _denseAColumn, _changeColumn );
+        _changeColumnNnz = collectNonZeros( _changeColumn, _changeColumnNonZeros );
+    }
+
+    updateDensity( _changeColumnDensity, _changeColumnNnz );
 }
 
 const double *Tableau::getChangeColumn() const
@@ -1464,6 +1556,7 @@ const double *Tableau::getChangeColumn() const
 void Tableau::setChangeColumn( const double *column )
 {
     memcpy( _changeColumn, column, _m * sizeof( double ) );
+    _changeColumnNnz = collectNonZeros( _changeColumn, _changeColumnNonZeros );
 }
 
 void Tableau::computePivotRow()
@@ -1498,8 +1591,9 @@ void Tableau::setNonBasicAssignment( unsigned variable, double value, bool updat
     computeChangeColumn();
 
     // Update all the affected basic variables
-    for ( unsigned i = 0; i < _m; ++i )
+    for ( unsigned j = 0; j < _changeColumnNnz; ++j )
     {
+        unsigned i = _changeColumnNonZeros[j];
         _basicAssignment[i] -= _changeColumn[i] * delta;
 
         unsigned oldStatus = _basicStatus[i];
@@ -1509,9 +1603,9 @@ void Tableau::setNonBasicAssignment( unsigned variable, double value, bool updat
         // the cost function is invalidated
         if ( oldStatus != _basicStatus[i] )
             _costFunctionManager->invalidateCostFunction();
-
-        _basicAssignmentStatus = ITableau::BASIC_ASSIGNMENT_UPDATED;
     }
+
+    _basicAssignmentStatus = ITableau::BASIC_ASSIGNMENT_UPDATED;
 }
 
 void Tableau::dumpAssignment()
@@ -1575,19 +1669,65 @@ void Tableau::getTableauRow( unsigned index, TableauRow *row )
 
     ASSERT( index < _m );
 
-    std::fill( _unitVector, _unitVector + _m, 0.0 );
-    _unitVector[index] = 1;
-    computeMultipliers( _unitVector );
+    if ( useSparseTransformation( _multipliersDensity ) )
+    {
+        for ( unsigned i = 0; i < _multipliersNnz; ++i )
+            _multipliers[_multipliersNonZeros[i]] = 0;
+
+        _sparseUnitVector.clear();
+        _sparseUnitVector.append( index, 1 );
+        _basisFactorization->sparseBackwardTransformation(
+            _sparseUnitVector, _multipliers, _multipliersNonZeros, _multipliersNnz );
+        updateDensity( _multipliersDensity, _multipliersNnz );
 
-    for ( unsigned i = 0; i < _n - _m; ++i )
+        /*
+          With few multipliers, the row is computed from the rows of A
+          that they multiply, instead of from all the columns of
+          non-basic variables. The rows are visited in ascending
+          order.
+        */
+        for ( unsigned i = 0; i < _n - _m; ++i )
+        {
+            row->_row[i]._var = _nonBasicIndexToVariable[i];
+            row->_row[i]._coefficient = 0;
+        }
+
+        std::sort( _multipliersNonZeros, _multipliersNonZeros + _multipliersNnz );
+        for ( unsigned i = 0; i < _multipliersNnz; ++i )
+        {
+            unsigned rowIndex = _multipliersNonZeros[i];
+            double multiplier = _multipliers[rowIndex];
+            if ( multiplier == 0.0 )
+                continue;
+
+            for ( const auto &entry : *_sparseRowsOfA[rowIndex] )
+            {
+                // Skip the basic variables
+                unsigned nonBasic = _variableToIndex[entry._index];
+                if ( nonBasic >= _n - _m || _nonBasicIndexToVariable[nonBasic] != entry._index )
+                    continue;
+
+                row->_row[nonBasic]._coefficient -= ( multiplier * entry._value );
+            }
+        }
+    }
+    else
     {
-        row->_row[i]._var = _nonBasicIndexToVariable[i];
-        row->_row[i]._coefficient = 0;
+        std::fill( _unitVector, _unitVector + _m, 0.0 );
+        _unitVector[index] = 1;
+        computeMultipliers( _unitVector );
+        updateDensity( _multipliersDensity, _multipliersNnz );
+
+        for ( unsigned i = 0; i < _n - _m; ++i )
+        {
+            row->_row[i]._var = _nonBasicIndexToVariable[i];
+            row->_row[i]._coefficient = 0;
 
-        SparseUnsortedList *column = _sparseColumnsOfA[_nonBasicIndexToVariable[i]];
+            SparseUnsortedList *column = _sparseColumnsOfA[_nonBasicIndexToVariable[i]];
 
-        for ( const auto &entry : *column )
-            row->_row[i]._coefficient -= ( _multipliers[entry._index] * entry._value );
+            for ( const auto &entry : *column )
+                row->_row[i]._coefficient -= ( _multipliers[entry._index] * entry._value );
+        }
     }
 
     /*
@@ -1611,9 +1751,9 @@ const SparseMatrix *Tableau::getSparseA() const
     return _A;
 }
 
-const double *Tableau::getAColumn( unsigned variable ) const
+void Tableau::getAColumn( unsigned variable, double *result ) const
 {
-    return _denseA + ( variable * _m );
+    _sparseColumnsOfA[variable]->toDense( result );
 }
 
 void Tableau::getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const
@@ -1667,7 +1807,6 @@ void Tableau::storeState( TableauState &state, TableauStateStorageLevel level )
             _sparseColumnsOfA[i]->storeIntoOther( state._sparseColumnsOfA[i] );
         for ( unsigned i = 0; i < _m; ++i )
             _sparseRowsOfA[i]->storeIntoOther( state._sparseRowsOfA[i] );
-        memcpy( state._denseA, _denseA, sizeof( double ) * _m * _n );
 
         // Store right hand side vector _b
         memcpy( state._b, _b, sizeof( double ) * _m );
@@ -1734,7 +1873,6 @@ void Tableau::restoreState( const TableauState &state, TableauStateStorageLevel
             state._sparseColumnsOfA[i]->storeIntoOther( _sparseColumnsOfA[i] );
         for ( unsigned i = 0; i < _m; ++i )
             state._sparseRowsOfA[i]->storeIntoOther( _sparseRowsOfA[i] );
-        memcpy( _denseA, state._denseA, sizeof( double ) * _m * _n );
 
         // Restore right hand side vector _b
         memcpy( _b, state._b, sizeof( double ) * _m );
@@ -1876,13 +2014,11 @@ unsigned Tableau::addEquation( const Equation &equation )
         _workN[addend._variable] = addend._coefficient;
         _sparseColumnsOfA[addend._variable]->set( _m - 1, addend._coefficient );
         _sparseRowsOfA[_m - 1]->set( addend._variable, addend._coefficient );
-        _denseA[( addend._variable * _m ) + _m - 1] = addend._coefficient;
     }
 
     _workN[auxVariable] = 1;
     _sparseColumnsOfA[auxVariable]->set( _m - 1, 1 );
     _sparseRowsOfA[_m - 1]->set( auxVariable, 1 );
-    _denseA[( auxVariable * _m ) + _m - 1] = 1;
     _A->addLastRow( _workN );
 
     // Invalidate the cost function, so that it is recomputed in the next iteration.
@@ -1960,7 +2096,7 @@ unsigned Tableau::addEquation( const Equation &equation )
     else
     {
         ConstraintMatrixAnalyzer analyzer;
-        analyzer.analyze( (const SparseUnsortedList **)_sparseRowsOfA, _m, _n );
+        analyzer.analyze( const_cast<const SparseUnsortedList **>( _sparseRowsOfA ), _m, _n );
         List<unsigned> independentColumns = analyzer.getIndependentColumns();
 
         try
@@ -2028,28 +2164,28 @@ void Tableau::addRow()
     delete[] _sparseRowsOfA;
     _sparseRowsOfA = newSparseRowsOfA;
 
-    // Allocate a larger _denseA, keep old entries
-    double *newDenseA = new double[newM * newN];
-    if ( !newDenseA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newDenseA" );
-
-    for ( unsigned column = 0; column < _n; ++column )
-    {
-        memcpy( newDenseA + ( column * newM ), _denseA + ( column * _m ), sizeof( double ) * _m );
-        newDenseA[column * newM + newM - 1] = 0.0;
-    }
-    std::fill_n( newDenseA + ( newN - 1 ) * newM, newM, 0.0 );
-
-    delete[] _denseA;
-    _denseA = newDenseA;
+    // Allocate a new denseAColumn. Don't need to initialize
+    double *newDenseAColumn = new double[newM];
+    if ( !newDenseAColumn )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newDenseAColumn" );
+    delete[] _denseAColumn;
+    _denseAColumn = newDenseAColumn;
 
-    // Allocate a new changeColumn. Don't need to initialize
+    // Allocate a new changeColumn, which is all zeros
     double *newChangeColumn = new double[newM];
     if ( !newChangeColumn )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newChangeColumn" );
+    std::fill_n( newChangeColumn, newM, 0.0 );
     delete[] _changeColumn;
     _changeColumn = newChangeColumn;
 
+    unsigned *newChangeColumnNonZeros = new unsigned[newM];
+    if ( !newChangeColumnNonZeros )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newChangeColumnNonZeros" );
+    delete[] _changeColumnNonZeros;
+    _changeColumnNonZeros = newChangeColumnNonZeros;
+    _changeColumnNnz = 0;
+
     // Allocate a new b and copy the old values
     double *newB = new double[newM];
     if ( !newB )
@@ -2066,13 +2202,21 @@ void Tableau::addRow()
     delete[] _unitVector;
     _unitVector = newUnitVector;
 
-    // Allocate new multipliers. Don't need to initialize
+    // Allocate new multipliers, which are all zeros
     double *newMultipliers = new double[newM];
     if ( !newMultipliers )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newMultipliers" );
+    std::fill_n( newMultipliers, newM, 0.0 );
     delete[] _multipliers;
     _multipliers = newMultipliers;
 
+    unsigned *newMultipliersNonZeros = new unsigned[newM];
+    if ( !newMultipliersNonZeros )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newMultipliersNonZeros" );
+    delete[] _multipliersNonZeros;
+    _multipliersNonZeros = newMultipliersNonZeros;
+    _multipliersNnz = 0;
+
     // Allocate new index arrays. Copy old indices, but don't assign indices to new variables yet.
     unsigned *newBasicIndexToVariable = new unsigned[newM];
     if ( !newBasicIndexToVariable )
@@ -2145,12 +2289,67 @@ void Tableau::addRow()
 
 void Tableau::registerToWatchVariable( VariableWatcher *watcher, unsigned variable )
 {
-    _variableToWatchers[variable].append( watcher );
+    _registeredVariables.append( variable );
+    _registeredWatchers.append( watcher );
+    _watcherIndexValid = false;
 }
 
 void Tableau::unregisterToWatchVariable( VariableWatcher *watcher, unsigned variable )
 {
-    _variableToWatchers[variable].erase( watcher );
+    for ( unsigned i = 0; i < _registeredVariables.size(); ++i )
+    {
+        if ( _registeredVariables[i] == variable && _registeredWatchers[i] == watcher )
+        {
+            _registeredVariables.eraseAt( i );
+            _registeredWatchers.eraseAt( i );
+            _watcherIndexValid = false;
+            return;
+        }
+    }
+}
+
+void Tableau::buildWatcherIndexIfNeeded()
+{
+    if ( _watcherIndexValid )
+        return;
+
+    unsigned numberOfVariables = 0;
+    for ( unsigned variable : _registeredVariables )
+        if ( variable + 1 > numberOfVariables )
+            numberOfVariables = variable + 1;
+
+    // Count the watchers of each variable, and turn the counts into
+    // start positions. Registrations are placed in the order in which
+    // they arrived.
+    _watcherStart.assign( numberOfVariables + 1, 0 );
+    for ( unsigned variable : _registeredVariables )
+        ++_watcherStart[variable + 1];
+    for ( unsigned i = 0; i < numberOfVariables; ++i )
+        _watcherStart[i + 1] += _watcherStart[i];
+
+    Vector<unsigned> next = _watcherStart;
+    Map<VariableWatcher *, unsigned> watcherToId;
+    _watchers.assign( _registeredWatchers.size(), NULL );
+    _watcherIds.assign( _registeredWatchers.size(), 0 );
+    _uniqueWatchers.clear();
+    for ( unsigned i = 0; i < _registeredWatchers.size(); ++i )
+    {
+        VariableWatcher *watcher = _registeredWatchers[i];
+        if ( !watcherToId.exists( watcher ) )
+        {
+            watcherToId[watcher] = _uniqueWatchers.size();
+            _uniqueWatchers.append( watcher );
+        }
+
+        unsigned position = next[_registeredVariables[i]]++;
+        _watchers[position] = watcher;
+        _watcherIds[position] = watcherToId[watcher];
+    }
+
+    _batchCounts.assign( _uniqueWatchers.size(), 0 );
+    _batchPositions.assign( _uniqueWatchers.size(), 0 );
+
+    _watcherIndexValid = true;
 }
 
 void Tableau::registerToWatchAllVariables( VariableWatcher *watcher )
@@ -2168,10 +2367,11 @@ void Tableau::notifyLowerBound( unsigned variable, double bound )
     for ( auto &watcher : _globalWatchers )
         watcher->notifyLowerBound( variable, bound );
 
-    if ( _variableToWatchers.exists( variable ) )
+    buildWatcherIndexIfNeeded();
+    if ( variable + 1 < _watcherStart.size() )
     {
-        for ( auto &watcher : _variableToWatchers[variable] )
-            watcher->notifyLowerBound( variable, bound );
+        for ( unsigned i = _watcherStart[variable]; i < _watcherStart[variable + 1]; ++i )
+            _watchers[i]->notifyLowerBound( variable, bound );
     }
 }
 
@@ -2180,10 +2380,83 @@ void Tableau::notifyUpperBound( unsigned variable, double bound )
     for ( auto &watcher : _globalWatchers )
         watcher->notifyUpperBound( variable, bound );
 
-    if ( _variableToWatchers.exists( variable ) )
+    buildWatcherIndexIfNeeded();
+    if ( variable + 1 < _watcherStart.size() )
+    {
+        for ( unsigned i = _watcherStart[variable]; i < _watcherStart[variable + 1]; ++i )
+            _watchers[i]->notifyUpperBound( variable, bound );
+    }
+}
+
+void Tableau::notifyBounds( const Vector<Tightening> &tightenings )
+{
+    if ( tightenings.empty() )
+        return;
+
+    // Global watchers receive the entire batch
+    for ( auto &watcher : _globalWatchers )
+        watcher->notifyBounds( tightenings.data(), tightenings.size() );
+
+    // Count the changes relevant to each watcher, and remember the
+    // watchers involved in the order in which they are first reached
+    buildWatcherIndexIfNeeded();
+    _batchWatchers.clear();
+    unsigned total = 0;
+    for ( const auto &tightening : tightenings )
+    {
+        unsigned variable = tightening._variable;
+        if ( variable + 1 >= _watcherStart.size() )
+            continue;
+
+        for ( unsigned i = _watcherStart[variable]; i < _watcherStart[variable + 1]; ++i )
+        {
+            unsigned id = _watcherIds[i];
+            if ( _batchCounts[id] == 0 )
+                _batchWatchers.append( id );
+            ++_batchCounts[id];
+            ++total;
+        }
+    }
+
+    if ( total == 0 )
+        return;
+
+    // Group the changes by watcher
+    unsigned position = 0;
+    for ( unsigned id : _batchWatchers )
+    {
+        _batchPositions[id] = position;
+        position += _batchCounts[id];
+    }
+
+    _batchTightenings.assign( total, Tightening( 0, 0, Tightening::LB ) );
+    for ( const auto &tightening : tightenings )
+    {
+        unsigned variable = tightening._variable;
+        if ( variable + 1 >= _watcherStart.size() )
+            continue;
+
+        for ( unsigned i = _watcherStart[variable]; i < _watcherStart[variable + 1]; ++i )
+            _batchTightenings[_batchPositions[_watcherIds[i]]++] = tightening;
+    }
+
+    // Resolve the watchers before dispatching, as a watcher may
+    // register or unregister watchers, and so rebuild the index
+    _batchTargets.clear();
+    _batchTargetCounts.clear();
+    for ( unsigned id : _batchWatchers )
+    {
+        _batchTargets.append( _uniqueWatchers[id] );
+        _batchTargetCounts.append( _batchCounts[id] );
+        _batchCounts[id] = 0;
+    }
+
+    position = 0;
+    for ( unsigned i = 0; i < _batchTargets.size(); ++i )
     {
-        for ( auto &watcher : _variableToWatchers[variable] )
-            watcher->notifyUpperBound( variable, bound );
+        _batchTargets[i]->notifyBounds( _batchTightenings.data() + position,
+                                        _batchTargetCounts[i] );
+        position += _batchTargetCounts[i];
     }
 }
 
@@ -2216,9 +2489,9 @@ double Tableau::getSumOfInfeasibilities() const
     return result;
 }
 
-void Tableau::setGurobi( GurobiWrapper *gurobi )
+void Tableau::setILPSolver( ILPSolver *solver )
 {
-    _gurobi = gurobi;
+    _solver = solver;
 }
 
 void Tableau::setStatistics( Statistics *statistics )
@@ -2389,8 +2662,9 @@ void Tableau::updateAssignmentForPivot()
             nonBasicDelta = getUpperBound( nonBasic ) - _nonBasicAssignment[_enteringVariable];
 
         // Update all the affected basic variables
-        for ( unsigned i = 0; i < _m; ++i )
+        for ( unsigned j = 0; j < _changeColumnNnz; ++j )
         {
+            unsigned i = _changeColumnNonZeros[j];
             if ( FloatUtils::isZero( _changeColumn[i] ) )
                 continue;
 
@@ -2437,9 +2711,11 @@ void Tableau::updateAssignmentForPivot()
         // to change.
         double nonBasicDelta = basicDelta / -_changeColumn[_leavingVariable];
 
-        // Update all the other basic variables
-        for ( unsigned i = 0; i < _m; ++i )
+        // Update all the other basic variables. The others do not
+        // change, as their entries of the change column are zero.
+        for ( unsigned j = 0; j < _changeColumnNnz; ++j )
         {
+            unsigned i = _changeColumnNonZeros[j];
             if ( i == _leavingVariable )
                 continue;
 
@@ -2584,11 +2860,6 @@ void Tableau::mergeColumns( unsigned x1, unsigned x2 )
     for ( unsigned i = 0; i < _m; ++i )
         _sparseRowsOfA[i]->mergeEntries( x2, x1 );
 
-    // And the dense ones, too
-    for ( unsigned i = 0; i < _m; ++i )
-        _denseA[x1 * _m + i] += _denseA[x2 * _m + i];
-    std::fill_n( _denseA + x2 * _m, _m, 0 );
-
     computeAssignment();
     computeCostFunction();
 
@@ -2614,8 +2885,8 @@ bool Tableau::areLinearlyDependent( unsigned x1,
     unsigned nonBasic = oneIsBasic ? x2 : x1;
 
     // Find the column of the non-basic
-    const double *a = getAColumn( nonBasic );
-    _basisFactorization->forwardTransformation( a, _workM );
+    getAColumn( nonBasic, _denseAColumn );
+    _basisFactorization->forwardTransformation( _denseAColumn, _workM );
 
     // Find the correct entry in the column
     unsigned basicIndex = _variableToIndex[basic];
@@ -16,9 +16,9 @@
 #ifndef __Tableau_h__
 #define __Tableau_h__
 
-#include "GurobiWrapper.h"
 #include "IBasisFactorization.h"
 #include "IBoundManager.h"
+#include "ILPSolver.h"
 #include "ITableau.h"
 #include "LPSolverType.h"
 #include "MString.h"
@@ -31,6 +31,7 @@
 
 #define TABLEAU_LOG( x, ... ) LOG( GlobalConfiguration::TABLEAU_LOGGING, "Tableau: %s\n", x )
 
+class CSRMatrix;
 class Equation;
 class ICostFunctionManager;
 class PiecewiseLinearCaseSplit;
@@ -52,9 +53,11 @@ public:
     void setDimensions( unsigned m, unsigned n );
 
     /*
-      Initialize the constraint matrix
+      Initialize the constraint matrix, either from a dense (row-major)
+      matrix or from its sparse rows
     */
     void setConstraintMatrix( const double *A );
+    void setConstraintMatrix( const SparseUnsortedList **A );
 
     /*
       Set which variable will enter the basis. The input is the
@@ -335,11 +338,12 @@ public:
     void getTableauRow( unsigned index, TableauRow *row );
 
     /*
-      Get the original constraint matrix A or a column thereof,
-      in dense form.
+      Get the original constraint matrix A or a column thereof.
+      getAColumn() stores the dense column in result, which is of
+      size m.
     */
     const SparseMatrix *getSparseA() const;
-    const double *getAColumn( unsigned variable ) const;
+    void getAColumn( unsigned variable, double *result ) const;
     void getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const;
     void getSparseARow( unsigned row, SparseUnsortedList *result ) const;
     const SparseUnsortedList *getSparseAColumn( unsigned variable ) const;
@@ -384,7 +388,13 @@ public:
     void notifyLowerBound( unsigned variable, double bound );
     void notifyUpperBound( unsigned variable, double bound );
 
-    void setGurobi( GurobiWrapper *gurobi );
+    /*
+      Notify the watchers of a batch of bound changes. Each watcher
+      is invoked once, with the changes to the variables it watches.
+    */
+    void notifyBounds( const Vector<Tightening> &tightenings );
+
+    void setILPSolver( ILPSolver *solver );
 
     /*
       Have the Tableau start reporting statistics.
@@ -486,12 +496,35 @@ public:
 
 private:
     /*
-      Variable watchers
-    */
-    typedef List<VariableWatcher *> VariableWatchers;
-    HashMap<unsigned, VariableWatchers> _variableToWatchers;
+      Variable watchers. Registrations are recorded as they arrive, and
+      are compiled into a contiguous index before the next
+      notification: the watchers of variable v are at positions
+      _watcherStart[v] to _watcherStart[v + 1] - 1 of _watchers, and
+      _watcherIds holds the dense id of each of these watchers.
+    */
+    Vector<unsigned> _registeredVariables;
+    Vector<VariableWatcher *> _registeredWatchers;
+    bool _watcherIndexValid;
+    Vector<unsigned> _watcherStart;
+    Vector<VariableWatcher *> _watchers;
+    Vector<unsigned> _watcherIds;
+    Vector<VariableWatcher *> _uniqueWatchers;
     List<VariableWatcher *> _globalWatchers;
 
+    /*
+      Work memory for batched notifications: the number of changes
+      and the next write position of each watcher, the changes
+      grouped by watcher, and the watchers to dispatch them to
+    */
+    Vector<unsigned> _batchCounts;
+    Vector<unsigned> _batchPositions;
+    Vector<unsigned> _batchWatchers;
+    Vector<Tightening> _batchTightenings;
+    Vector<VariableWatcher *> _batchTargets;
+    Vector<unsigned> _batchTargetCounts;
+
+    void buildWatcherIndexIfNeeded();
+
     /*
       Resize watchers
     */
@@ -516,18 +549,22 @@ private:
 
     /*
       The constraint matrix A, and a collection of its
-      sparse columns. The matrix is also stored in dense
-      form (column-major).
+      sparse columns and rows. Columns of A are only
+      densified on demand, into _denseAColumn.
     */
-    SparseMatrix *_A;
+    CSRMatrix *_A;
     SparseUnsortedList **_sparseColumnsOfA;
     SparseUnsortedList **_sparseRowsOfA;
-    double *_denseA;
+    double *_denseAColumn;
 
     /*
-      Used to compute inv(B)*a
+      Used to compute inv(B)*a. The change column is zero everywhere
+      except at the first _changeColumnNnz entries of
+      _changeColumnNonZeros.
     */
     double *_changeColumn;
+    unsigned *_changeColumnNonZeros;
+    unsigned _changeColumnNnz;
 
     /*
       Used to store the pivot row
@@ -556,9 +593,23 @@ private:
     IBasisFactorization *_basisFactorization;
 
     /*
-      The multiplier vector
+      The multiplier vector, which is zero everywhere except at the
+      first _multipliersNnz entries of _multipliersNonZeros.
     */
     double *_multipliers;
+    unsigned *_multipliersNonZeros;
+    unsigned _multipliersNnz;
+
+    /*
+      Running averages of the fraction of non-zero entries in the
+      change column and in the multipliers of tableau rows, which
+      decide whether to compute them with hypersparse transformations.
+      The unit vector for these transformations is kept as a sparse
+      vector.
+    */
+    double _changeColumnDensity;
+    double _multipliersDensity;
+    SparseUnsortedList _sparseUnitVector;
 
     /*
       Mapping between basic variables and indices (length m)
@@ -650,13 +701,18 @@ private:
     */
     LPSolverType _lpSolverType;
 
-    GurobiWrapper *_gurobi;
+    ILPSolver *_solver;
 
     /*
       Free all allocated memory.
     */
     void freeMemoryIfNeeded();
 
+    /*
+      Populate the sparse columns of A from its sparse rows.
+    */
+    void initializeSparseColumnsFromRows();
+
     /*
       Resize the relevant data structures to add a new row to the tableau.
     */
@@ -674,6 +730,17 @@ private:
     void standardRatioTest( double *changeColumn );
     void harrisRatioTest( double *changeColumn );
 
+    /*
+      Helpers for the sparsity patterns of the change column and the
+      multipliers: collect the non-zero entries of a dense vector,
+      decide whether a hypersparse transformation is worthwhile given
+      the running average of the density of its results, and update
+      that average.
+    */
+    unsigned collectNonZeros( const double *vector, unsigned *nonZeros ) const;
+    bool useSparseTransformation( double density ) const;
+    void updateDensity( double &density, unsigned nnz ) const;
+
     /*
       For debugging purposes only
     */
@@ -0,0 +1,204 @@
+/*********************                                                        */
+/*! \file WorkStealingScheduler.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "WorkStealingScheduler.h"
+
+#include "Debug.h"
+#include "MarabouError.h"
+
+#include <algorithm>
+#include <chrono>
+
+WorkStealingScheduler::WorkStealingScheduler( unsigned numWorkers,
+                                              unsigned minSearchTimeInMilliseconds,
+                                              unsigned initialBackoffInMilliseconds,
+                                              unsigned maxBackoffInMilliseconds )
+    : _numWorkers( numWorkers )
+    , _deques( NULL )
+    , _minSearchTime( minSearchTimeInMilliseconds )
+    , _initialBackoff( initialBackoffInMilliseconds )
+    , _maxBackoff( maxBackoffInMilliseconds )
+    , _numberOfSteals( 0 )
+    , _numberOfSplitRequests( 0 )
+{
+    _deques = new WorkerDeque[_numWorkers];
+    if ( !_deques )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "WorkStealingScheduler::deques" );
+
+    for ( unsigned i = 0; i < _numWorkers; ++i )
+    {
+        _deques[i]._busy = false;
+        _deques[i]._splitRequested = NULL;
+        _deques[i]._busySince = 0;
+        _deques[i]._backoff = 0;
+        _deques[i]._nextSplitRequest = 0;
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    if ( _deques )
+    {
+        for ( unsigned i = 0; i < _numWorkers; ++i )
+        {
+            for ( const auto &subQuery : _deques[i]._subQueries )
+                delete subQuery;
+        }
+
+        delete[] _deques;
+        _deques = NULL;
+    }
+}
+
+void WorkStealingScheduler::registerSplitRequestFlag( unsigned worker, std::atomic_bool *flag )
+{
+    ASSERT( worker < _numWorkers );
+    _deques[worker]._splitRequested = flag;
+}
+
+void WorkStealingScheduler::distribute( const SubQueries &subQueries )
+{
+    unsigned worker = 0;
+    for ( const auto &subQuery : subQueries )
+    {
+        push( worker, subQuery );
+        worker = ( worker + 1 ) % _numWorkers;
+    }
+}
+
+void WorkStealingScheduler::push( unsigned worker, SubQuery *subQuery )
+{
+    ASSERT( worker < _numWorkers );
+    std::lock_guard<std::mutex> lock( _deques[worker]._mutex );
+    _deques[worker]._subQueries.push_back( subQuery );
+}
+
+SubQuery *WorkStealingScheduler::pop( unsigned worker )
+{
+    ASSERT( worker < _numWorkers );
+
+    WorkerDeque &deque = _deques[worker];
+    SubQuery *subQuery = NULL;
+    if ( popBack( worker, subQuery ) )
+    {
+        deque._backoff = 0;
+        return subQuery;
+    }
+
+    // Our deque is empty, try to steal from the other workers
+    for ( unsigned i = 1; i < _numWorkers; ++i )
+    {
+        if ( popFront( ( worker + i ) % _numWorkers, subQuery ) )
+        {
+            ++_numberOfSteals;
+            deque._backoff = 0;
+            return subQuery;
+        }
+    }
+
+    // Nothing to steal, ask a busy worker to split its search, unless
+    // we did so too recently
+    long long now = currentTime();
+    if ( deque._backoff == 0 || now >= deque._nextSplitRequest )
+    {
+        requestSplit( worker, now );
+        deque._backoff = ( deque._backoff == 0 ? _initialBackoff
+                                               : std::min( 2 * deque._backoff, _maxBackoff ) );
+        deque._nextSplitRequest = now + deque._backoff;
+    }
+    return NULL;
+}
+
+void WorkStealingScheduler::setBusy( unsigned worker, bool busy )
+{
+    ASSERT( worker < _numWorkers );
+
+    // A split request that arrived while the worker was idle refers
+    // to a search that is already over
+    if ( busy && _deques[worker]._splitRequested )
+        *_deques[worker]._splitRequested = false;
+
+    if ( busy )
+        _deques[worker]._busySince = currentTime();
+    _deques[worker]._busy = busy;
+}
+
+unsigned WorkStealingScheduler::getNumberOfSteals() const
+{
+    return _numberOfSteals.load();
+}
+
+unsigned WorkStealingScheduler::getNumberOfSplitRequests() const
+{
+    return _numberOfSplitRequests.load();
+}
+
+bool WorkStealingScheduler::popBack( unsigned worker, SubQuery *&subQuery )
+{
+    std::lock_guard<std::mutex> lock( _deques[worker]._mutex );
+    if ( _deques[worker]._subQueries.empty() )
+        return false;
+
+    subQuery = _deques[worker]._subQueries.back();
+    _deques[worker]._subQueries.pop_back();
+    return true;
+}
+
+bool WorkStealingScheduler::popFront( unsigned worker, SubQuery *&subQuery )
+{
+    std::lock_guard<std::mutex> lock( _deques[worker]._mutex );
+    if ( _deques[worker]._subQueries.empty() )
+        return false;
+
+    subQuery = _deques[worker]._subQueries.front();
+    _deques[worker]._subQueries.pop_front();
+    return true;
+}
+
+bool WorkStealingScheduler::requestSplit( unsigned worker, long long now )
+{
+    for ( unsigned i = 1; i < _numWorkers; ++i )
+    {
+        WorkerDeque &victim = _deques[( worker + i ) % _numWorkers];
+        if ( !victim._busy.load() || !victim._splitRequested )
+            continue;
+
+        // Searches that have only just started are left alone
+        if ( now - victim._busySince.load() < (long long)_minSearchTime )
+            continue;
+
+        // A request that is still pending will serve us as well
+        if ( victim._splitRequested->exchange( true ) )
+            return true;
+
+        ++_numberOfSplitRequests;
+        return true;
+    }
+
+    return false;
+}
+
+long long WorkStealingScheduler::currentTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch() )
+        .count();
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
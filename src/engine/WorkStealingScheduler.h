@@ -0,0 +1,140 @@
+/*********************                                                        */
+/*! \file WorkStealingScheduler.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __WorkStealingScheduler_h__
+#define __WorkStealingScheduler_h__
+
+#include "GlobalConfiguration.h"
+#include "SubQuery.h"
+#include "Vector.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+/*
+  A scheduler for DnC sub-queries, used as an alternative to the single
+  shared WorkerQueue. Every worker owns a deque of sub-queries: the
+  owner pushes and pops at the back (so that it keeps working on the
+  most recent, and smallest, sub-queries it created), whereas idle
+  workers steal from the front (the oldest, and largest, sub-queries).
+
+  When there is nothing to steal, an idle worker asks one of the busy
+  workers to split its current search on demand, by raising the split
+  request flag of that worker's engine. The busy worker then divides
+  its sub-query and pushes the new sub-queries into its own deque,
+  where they become available for stealing. Only workers that have
+  searched for a minimal amount of time are asked to split, and idle
+  workers back off exponentially between their requests, so that
+  searches are not split before they had a chance to progress.
+*/
+class WorkStealingScheduler
+{
+public:
+    WorkStealingScheduler(
+        unsigned numWorkers,
+        unsigned minSearchTimeInMilliseconds =
+            GlobalConfiguration::DNC_MIN_SEARCH_TIME_BEFORE_SPLIT_IN_MILLISECONDS,
+        unsigned initialBackoffInMilliseconds =
+            GlobalConfiguration::DNC_SPLIT_REQUEST_INITIAL_BACKOFF_IN_MILLISECONDS,
+        unsigned maxBackoffInMilliseconds =
+            GlobalConfiguration::DNC_SPLIT_REQUEST_MAX_BACKOFF_IN_MILLISECONDS );
+    ~WorkStealingScheduler();
+
+    /*
+      Register the flag through which the engine of a worker can be
+      asked to interrupt its search, so that it can be split
+    */
+    void registerSplitRequestFlag( unsigned worker, std::atomic_bool *flag );
+
+    /*
+      Spread the initial sub-queries over the deques of all workers,
+      in a round-robin fashion
+    */
+    void distribute( const SubQueries &subQueries );
+
+    /*
+      Push a sub-query into the deque of the given worker
+    */
+    void push( unsigned worker, SubQuery *subQuery );
+
+    /*
+      Get the next sub-query for the given worker: first from its own
+      deque, and otherwise stolen from the deque of another worker. If
+      no sub-query is available, a split is requested from a busy
+      worker (unless the given worker is backing off) and NULL is
+      returned.
+    */
+    SubQuery *pop( unsigned worker );
+
+    /*
+      Mark whether the given worker is currently solving a sub-query.
+      Only busy workers are asked to split.
+    */
+    void setBusy( unsigned worker, bool busy );
+
+    unsigned getNumberOfSteals() const;
+    unsigned getNumberOfSplitRequests() const;
+
+private:
+    struct WorkerDeque
+    {
+        std::mutex _mutex;
+        std::deque<SubQuery *> _subQueries;
+        std::atomic_bool _busy;
+        std::atomic_bool *_splitRequested;
+
+        // When the worker last became busy
+        std::atomic_llong _busySince;
+
+        // The back-off of the worker when idle. Only accessed by the
+        // worker itself.
+        unsigned _backoff;
+        long long _nextSplitRequest;
+    };
+
+    unsigned _numWorkers;
+    WorkerDeque *_deques;
+
+    unsigned _minSearchTime;
+    unsigned _initialBackoff;
+    unsigned _maxBackoff;
+
+    std::atomic_uint _numberOfSteals;
+    std::atomic_uint _numberOfSplitRequests;
+
+    bool popBack( unsigned worker, SubQuery *&subQuery );
+    bool popFront( unsigned worker, SubQuery *&subQuery );
+
+    /*
+      Ask a busy worker other than the given one, which has searched for
+      at least the minimal time, to split its search. Returns true if a
+      request was made.
+    */
+    bool requestSplit( unsigned worker, long long now );
+
+    /*
+      The current time, in milliseconds
+    */
+    static long long currentTime();
+};
+
+#endif // __WorkStealingScheduler_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -152,6 +152,13 @@ public:
         memcpy( lastEntries, A, sizeof( double ) * lastM * lastN );
     }
 
+    void setConstraintMatrix( const SparseUnsortedList **A )
+    {
+        TS_ASSERT( setDimensionsCalled );
+        for ( unsigned i = 0; i < lastM; ++i )
+            A[i]->toDense( lastEntries + ( i * lastN ) );
+    }
+
     double *lastRightHandSide;
     void setRightHandSide( const double *b )
     {
@@ -488,11 +495,11 @@ public:
     }
 
     Map<unsigned, const double *> nextAColumn;
-    const double *getAColumn( unsigned index ) const
+    void getAColumn( unsigned index, double *result ) const
     {
         TS_ASSERT( nextAColumn.exists( index ) );
         TS_ASSERT( nextAColumn.get( index ) );
-        return nextAColumn.get( index );
+        memcpy( result, nextAColumn.get( index ), sizeof( double ) * lastM );
     }
 
     void getSparseAColumn( unsigned index, SparseUnsortedList *result ) const
@@ -606,7 +613,7 @@ public:
     {
     }
 
-    void setGurobi( GurobiWrapper * /* gurobi */ )
+    void setILPSolver( ILPSolver * /* solver */ )
     {
     }
 
@@ -704,6 +711,10 @@ public:
     {
     }
 
+    void notifyBounds( const Vector<Tightening> & /*tightenings*/ )
+    {
+    }
+
     void updateVariablesToComplyWithBounds()
     {
     }
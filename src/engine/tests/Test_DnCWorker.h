@@ -292,6 +292,100 @@ public:
         TS_ASSERT( numUnsolvedSubQueries.load() == 1 );
         TS_ASSERT( shouldQuitSolving.load() );
     }
+
+    void test_pop_one_sub_query_and_solve_with_work_stealing()
+    {
+        //  The subqueries are obtained from, and pushed into, the deque of
+        //  the worker instead of the shared workload
+        WorkStealingScheduler scheduler( 2 );
+        createPlaceHolderSubQuery();
+        SubQuery *subQuery = NULL;
+        TS_ASSERT( _workload->pop( subQuery ) );
+        scheduler.push( 1, subQuery );
+
+        _engine->setTimeToSolve( 10 );
+        _engine->setExitCode( IEngine::TIMEOUT );
+        std::atomic_int numUnsolvedSubQueries( 1 );
+        std::atomic_bool shouldQuitSolving( false );
+        DnCWorker dncWorker( _workload,
+                             _engine,
+                             numUnsolvedSubQueries,
+                             shouldQuitSolving,
+                             0,
+                             2,
+                             1,
+                             SnCDivideStrategy::LargestInterval,
+                             0,
+                             false,
+                             &scheduler );
+
+        // The subquery is stolen from worker 1, and split into 4
+        dncWorker.popOneSubQueryAndSolve();
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSteals(), 1U );
+        TS_ASSERT( numUnsolvedSubQueries.load() == 4 );
+        TS_ASSERT( clearSubQueries() == 0 );
+
+        unsigned numSubQueries = 0;
+        while ( ( subQuery = scheduler.pop( 0 ) ) )
+        {
+            delete subQuery;
+            ++numSubQueries;
+        }
+        TS_ASSERT_EQUALS( numSubQueries, 4U );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSteals(), 1U );
+        TS_ASSERT( !shouldQuitSolving.load() );
+    }
+
+    void checkTimeoutAndDepthOfSubQueries( IEngine::ExitCode exitCode,
+                                           unsigned expectedTimeout,
+                                           unsigned expectedDepth )
+    {
+        createPlaceHolderSubQuery();
+        SubQuery *subQuery = NULL;
+        TS_ASSERT( _workload->pop( subQuery ) );
+        subQuery->_depth = 3;
+        TS_ASSERT( _workload->push( std::move( subQuery ) ) );
+
+        _engine->setTimeToSolve( 10 );
+        _engine->setExitCode( exitCode );
+        std::atomic_int numUnsolvedSubQueries( 1 );
+        std::atomic_bool shouldQuitSolving( false );
+        DnCWorker dncWorker( _workload,
+                             _engine,
+                             numUnsolvedSubQueries,
+                             shouldQuitSolving,
+                             0,
+                             2,
+                             1.5,
+                             SnCDivideStrategy::LargestInterval,
+                             0,
+                             false );
+
+        dncWorker.popOneSubQueryAndSolve();
+        TS_ASSERT( numUnsolvedSubQueries.load() == 4 );
+        TS_ASSERT( !shouldQuitSolving.load() );
+
+        unsigned numSubQueries = 0;
+        while ( !_workload->empty() )
+        {
+            TS_ASSERT( _workload->pop( subQuery ) );
+            TS_ASSERT_EQUALS( subQuery->_timeoutInSeconds, expectedTimeout );
+            TS_ASSERT_EQUALS( subQuery->_depth, expectedDepth );
+            delete subQuery;
+            ++numSubQueries;
+        }
+        TS_ASSERT_EQUALS( numSubQueries, 4U );
+    }
+
+    void test_split_request_keeps_timeout_and_depth()
+    {
+        //  A subQuery with timeout 5 and depth 3 is interrupted because an
+        //  idle worker asked for a split. The new subQueries get the same
+        //  timeout and depth, whereas a timeout scales the former by the
+        //  timeout factor and increments the latter
+        checkTimeoutAndDepthOfSubQueries( IEngine::SPLIT_REQUESTED, 5, 3 );
+        checkTimeoutAndDepthOfSubQueries( IEngine::TIMEOUT, 7, 4 );
+    }
 };
 
 //
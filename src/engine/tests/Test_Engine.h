@@ -571,6 +571,77 @@ public:
         TS_ASSERT_EQUALS( *( ++caseSplits.begin() ), interval2 );
     }
 
+    void test_constraints_backtracked_by_context()
+    {
+        // x2 = x0 + x1, x3 = x0 - x1
+        // x4 = relu( x2 ), x5 = relu( x3 )
+        Query inputQuery;
+        inputQuery.setNumberOfVariables( 6 );
+
+        Equation equation1;
+        equation1.addAddend( 1, 0 );
+        equation1.addAddend( 1, 1 );
+        equation1.addAddend( -1, 2 );
+        equation1.setScalar( 0 );
+        inputQuery.addEquation( equation1 );
+
+        Equation equation2;
+        equation2.addAddend( 1, 0 );
+        equation2.addAddend( -1, 1 );
+        equation2.addAddend( -1, 3 );
+        equation2.setScalar( 0 );
+        inputQuery.addEquation( equation2 );
+
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( 2, 4 ) );
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( 3, 5 ) );
+
+        for ( unsigned i = 0; i < 2; ++i )
+        {
+            inputQuery.setLowerBound( i, -1 );
+            inputQuery.setUpperBound( i, 1 );
+        }
+        for ( unsigned i = 2; i < 4; ++i )
+        {
+            inputQuery.setLowerBound( i, -2 );
+            inputQuery.setUpperBound( i, 2 );
+        }
+        for ( unsigned i = 4; i < 6; ++i )
+        {
+            inputQuery.setLowerBound( i, 0 );
+            inputQuery.setUpperBound( i, 2 );
+        }
+
+        Engine engine;
+        engine.processInputQuery( inputQuery, false );
+        CVC4::context::Context &context = ( (IEngine &)engine ).getContext();
+
+        const List<PiecewiseLinearConstraint *> &constraints =
+            engine.getQuery()->getPiecewiseLinearConstraints();
+        TS_ASSERT_EQUALS( constraints.size(), 2U );
+
+        // No copies of the constraints are stored
+        EngineState state;
+        engine.storeState( state, TableauStateStorageLevel::STORE_BOUNDS_ONLY );
+        TS_ASSERT( state._plConstraintToState.empty() );
+
+        PiecewiseLinearConstraint *constraint = *constraints.begin();
+        TS_ASSERT_EQUALS( constraint->getContext(), &context );
+        TS_ASSERT( constraint->isActive() );
+        TS_ASSERT( !constraint->phaseFixed() );
+
+        // Popping the context restores the constraint
+        context.push();
+        constraint->setActiveConstraint( false );
+        constraint->setPhaseStatus( RELU_PHASE_ACTIVE );
+        TS_ASSERT( !constraint->isActive() );
+        TS_ASSERT( constraint->phaseFixed() );
+
+        context.pop();
+        TS_ASSERT_THROWS_NOTHING( engine.restoreState( state ) );
+        TS_ASSERT( constraint->isActive() );
+        TS_ASSERT( !constraint->phaseFixed() );
+    }
+
     void test_calculate_bounds()
     {
         Query inputQuery;
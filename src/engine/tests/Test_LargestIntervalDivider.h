@@ -203,6 +203,60 @@ public:
             delete subQuery;
         }
     }
+
+    void test_create_subqueries_keeps_other_constraints()
+    {
+        //   Input Region:
+        //   -2 <= x1 <= 2
+        //    3 <= x2 <= 5
+        //    2 <= x3 <= 5
+        //
+        //   Other constraints:
+        //    x4 >= 1
+        //    x1 + x4 <= 3
+        //
+        //   Bisecting the region must keep the other constraints in both halves
+
+        auto previousSplit =
+            std::unique_ptr<PiecewiseLinearCaseSplit>( new PiecewiseLinearCaseSplit );
+        previousSplit->storeBoundTightening( Tightening( 1, -2.0, Tightening::LB ) );
+        previousSplit->storeBoundTightening( Tightening( 1, 2.0, Tightening::UB ) );
+        previousSplit->storeBoundTightening( Tightening( 4, 1.0, Tightening::LB ) );
+        previousSplit->storeBoundTightening( Tightening( 2, 3.0, Tightening::LB ) );
+        previousSplit->storeBoundTightening( Tightening( 2, 5.0, Tightening::UB ) );
+        previousSplit->storeBoundTightening( Tightening( 3, 2.0, Tightening::LB ) );
+        previousSplit->storeBoundTightening( Tightening( 3, 5.0, Tightening::UB ) );
+
+        Equation equation( Equation::LE );
+        equation.addAddend( 1, 1 );
+        equation.addAddend( 1, 4 );
+        equation.setScalar( 3 );
+        previousSplit->addEquation( equation );
+
+        SubQueries subQueries;
+        queryDivider->createSubQueries( 2, "mock", 0, *previousSplit, 5, subQueries );
+
+        TS_ASSERT( subQueries.size() == 2 );
+        double lowerBoundOfX1 = -2.0;
+        for ( const auto &subQuery : subQueries )
+        {
+            PiecewiseLinearCaseSplit expectedSplit;
+            expectedSplit.storeBoundTightening( Tightening( 1, lowerBoundOfX1, Tightening::LB ) );
+            expectedSplit.storeBoundTightening(
+                Tightening( 1, lowerBoundOfX1 + 2, Tightening::UB ) );
+            expectedSplit.storeBoundTightening( Tightening( 2, 3.0, Tightening::LB ) );
+            expectedSplit.storeBoundTightening( Tightening( 2, 5.0, Tightening::UB ) );
+            expectedSplit.storeBoundTightening( Tightening( 3, 2.0, Tightening::LB ) );
+            expectedSplit.storeBoundTightening( Tightening( 3, 5.0, Tightening::UB ) );
+            expectedSplit.storeBoundTightening( Tightening( 4, 1.0, Tightening::LB ) );
+            expectedSplit.addEquation( equation );
+
+            TS_ASSERT( *( subQuery->_split ) == expectedSplit );
+            lowerBoundOfX1 += 2;
+
+            delete subQuery;
+        }
+    }
 };
 
 //
@@ -17,21 +17,33 @@
 #include "GlobalConfiguration.h"
 #include "MILPEncoder.h"
 #include "MarabouError.h"
+#include "MockErrno.h"
 #include "MockTableau.h"
+#include "NativeMILPSolver.h"
 #include "Query.h"
+#include "ReluConstraint.h"
 
 #include <cxxtest/TestSuite.h>
 #include <string.h>
 
+class MockForMILPEncoder : public MockErrno
+{
+public:
+};
+
 class MILPEncoderTestSuite : public CxxTest::TestSuite
 {
 public:
+    MockForMILPEncoder *mock;
+
     void setUp()
     {
+        TS_ASSERT( mock = new MockForMILPEncoder );
     }
 
     void tearDown()
     {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
     }
 
     void test_encode_max_constraint()
@@ -367,6 +379,79 @@ public:
 #endif // ENABLE_GUROBI
     }
 
+    void test_encode_with_native_milp_solver()
+    {
+        //
+        // x1 = relu(x0)
+        // x2 = leaky_relu(x0)
+        // x1 - x2 = 0.2, which only holds for x0 = -1
+        //
+        double slope = 0.2;
+
+        Query inputQuery = Query();
+        inputQuery.setNumberOfVariables( 3 );
+
+        MockTableau tableau = MockTableau();
+        tableau.setDimensions( 2, 4 );
+
+        // -1 <= x0 <= 1
+        inputQuery.setLowerBound( 0, -1 );
+        inputQuery.setUpperBound( 0, 1 );
+        tableau.setLowerBound( 0, -1 );
+        tableau.setUpperBound( 0, 1 );
+
+        // 0 <= x1 <= 1
+        inputQuery.setLowerBound( 1, 0 );
+        inputQuery.setUpperBound( 1, 1 );
+        tableau.setLowerBound( 1, 0 );
+        tableau.setUpperBound( 1, 1 );
+
+        // -0.2 <= x2 <= 1
+        inputQuery.setLowerBound( 2, -slope );
+        inputQuery.setUpperBound( 2, 1 );
+        tableau.setLowerBound( 2, -slope );
+        tableau.setUpperBound( 2, 1 );
+
+        ReluConstraint *relu = new ReluConstraint( 0, 1 );
+        relu->transformToUseAuxVariables( inputQuery );
+        inputQuery.addPiecewiseLinearConstraint( relu );
+
+        // 0 <= aux <= 1
+        tableau.setLowerBound( 3, 0 );
+        tableau.setUpperBound( 3, 1 );
+
+        LeakyReluConstraint *leakyRelu = new LeakyReluConstraint( 0, 2, slope );
+        inputQuery.addPiecewiseLinearConstraint( leakyRelu );
+
+        Equation equation;
+        equation.addAddend( 1, 1 );
+        equation.addAddend( -1, 2 );
+        equation.setScalar( slope );
+        inputQuery.addEquation( equation );
+
+        NativeMILPSolver solver1;
+        MILPEncoder milp1( tableau );
+        TS_ASSERT_THROWS_NOTHING( milp1.encodeQuery( solver1, inputQuery ) );
+        TS_ASSERT_THROWS_NOTHING( solver1.solve() );
+        TS_ASSERT( solver1.haveFeasibleSolution() );
+        TS_ASSERT( FloatUtils::areEqual( solver1.getAssignment( "x0" ), -1 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver1.getAssignment( "x2" ), -slope ) );
+
+        // x1 - x2 = 0.3 has no solution
+        Query inputQuery2 = inputQuery;
+        Equation equation2;
+        equation2.addAddend( 1, 1 );
+        equation2.addAddend( -1, 2 );
+        equation2.setScalar( 0.3 );
+        inputQuery2.addEquation( equation2 );
+
+        NativeMILPSolver solver2;
+        MILPEncoder milp2( tableau );
+        TS_ASSERT_THROWS_NOTHING( milp2.encodeQuery( solver2, inputQuery2 ) );
+        TS_ASSERT_THROWS_NOTHING( solver2.solve() );
+        TS_ASSERT( solver2.infeasible() );
+    }
+
     void test_eoncode_leaky_relu_constraint()
     {
 #ifdef ENABLE_GUROBI
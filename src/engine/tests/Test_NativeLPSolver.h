@@ -0,0 +1,288 @@
+/*********************                                                        */
+/*! \file Test_NativeLPSolver.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "MockErrno.h"
+#include "NativeLPSolver.h"
+
+#include <cxxtest/TestSuite.h>
+
+class MockForNativeLPSolver : public MockErrno
+{
+public:
+};
+
+class NativeLPSolverTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForNativeLPSolver *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForNativeLPSolver );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void populateModel( NativeLPSolver &solver )
+    {
+        /*
+          x + 2y <= 4
+          3x + y <= 6
+          0 <= x, y <= 10
+        */
+        solver.addVariable( "x", 0, 10 );
+        solver.addVariable( "y", 0, 10 );
+
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, "x" ) );
+        terms.append( ILPSolver::Term( 2, "y" ) );
+        solver.addLeqConstraint( terms, 4 );
+
+        terms.clear();
+        terms.append( ILPSolver::Term( 3, "x" ) );
+        terms.append( ILPSolver::Term( 1, "y" ) );
+        solver.addLeqConstraint( terms, 6 );
+    }
+
+    void test_maximize()
+    {
+        NativeLPSolver solver;
+        populateModel( solver );
+
+        List<ILPSolver::Term> objective;
+        objective.append( ILPSolver::Term( 1, "x" ) );
+        objective.append( ILPSolver::Term( 1, "y" ) );
+        solver.setObjective( objective );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( solver.haveFeasibleSolution() );
+
+        Map<String, double> solution;
+        double value;
+        solver.extractSolution( solution, value );
+
+        TS_ASSERT( FloatUtils::areEqual( value, 2.8 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["x"], 1.6 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["y"], 1.2 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 2.8 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "x" ), 1.6 ) );
+    }
+
+    void test_minimize_with_equalities_and_infinite_bounds()
+    {
+        NativeLPSolver solver;
+
+        /*
+          x - y = 1
+          x free, y >= -3
+        */
+        solver.addVariable( "x", FloatUtils::negativeInfinity(), FloatUtils::infinity() );
+        solver.addVariable( "y", -3, FloatUtils::infinity() );
+
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, "x" ) );
+        terms.append( ILPSolver::Term( -1, "y" ) );
+        solver.addEqConstraint( terms, 1 );
+
+        List<ILPSolver::Term> cost;
+        cost.append( ILPSolver::Term( 1, "x" ) );
+        solver.setCost( cost, 5 );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 3 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "x" ), -2 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "y" ), -3 ) );
+
+        // Maximizing x is unbounded
+        solver.setObjective( cost );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( !solver.optimal() );
+        TS_ASSERT( !solver.infeasible() );
+        TS_ASSERT( !solver.haveFeasibleSolution() );
+        TS_ASSERT( !FloatUtils::isFinite( solver.getObjectiveBound() ) );
+    }
+
+    void test_infeasible()
+    {
+        NativeLPSolver solver;
+        solver.addVariable( "x", 0, 2 );
+        solver.addVariable( "y", 0, 2 );
+
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, "x" ) );
+        terms.append( ILPSolver::Term( 1, "y" ) );
+        solver.addGeqConstraint( terms, 5 );
+        solver.setCost( terms );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.infeasible() );
+        TS_ASSERT( !solver.haveFeasibleSolution() );
+
+        // Relaxing a bound makes the model feasible
+        solver.setUpperBound( "y", 4 );
+        solver.reset();
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 5 ) );
+    }
+
+    void test_cutoff()
+    {
+        NativeLPSolver solver;
+        populateModel( solver );
+
+        List<ILPSolver::Term> objective;
+        objective.append( ILPSolver::Term( 1, "y" ) );
+        solver.setObjective( objective );
+        solver.setCutoff( 3 );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.cutoffOccurred() );
+        TS_ASSERT( !solver.optimal() );
+
+        solver.setCutoff( 1 );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 2 ) );
+    }
+
+    void test_warm_start()
+    {
+        NativeLPSolver solver;
+        populateModel( solver );
+
+        List<ILPSolver::Term> objective;
+        objective.append( ILPSolver::Term( 1, "x" ) );
+        solver.setObjective( objective );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 2 ) );
+
+        // Re-create the same model with another objective: the previous
+        // basis is already optimal for it
+        solver.resetModel();
+        populateModel( solver );
+        objective.clear();
+        objective.append( ILPSolver::Term( 3, "x" ) );
+        objective.append( ILPSolver::Term( 1, "y" ) );
+        solver.setObjective( objective );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 6 ) );
+        TS_ASSERT_EQUALS( solver.getNumberOfSimplexIterations(), 0U );
+
+        // Extend the model with a new variable and constraint
+        solver.addVariable( "z", -10, 10 );
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, "z" ) );
+        terms.append( ILPSolver::Term( -1, "x" ) );
+        solver.addEqConstraint( terms, 0 );
+
+        objective.clear();
+        objective.append( ILPSolver::Term( -1, "z" ) );
+        solver.setObjective( objective );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 0 ) );
+
+        solver.setCost( objective );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), -2 ) );
+    }
+
+    void test_no_constraints()
+    {
+        // Only bounds, as when the input layer is encoded on its own
+        NativeLPSolver solver;
+        solver.addVariable( "x", -1, 2 );
+        solver.addVariable( "y", 0, 3 );
+
+        List<ILPSolver::Term> objective;
+        objective.append( ILPSolver::Term( 1, "x" ) );
+        objective.append( ILPSolver::Term( -1, "y" ) );
+        solver.setObjective( objective );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 2 ) );
+
+        solver.setCost( objective );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), -4 ) );
+    }
+
+    void test_many_pivots()
+    {
+        /*
+          max sum x_i
+          x_i + x_i+1 <= 1
+          0 <= x_i <= 1
+
+          The solve takes more pivots than the number after which the
+          basic variables are recomputed from scratch
+        */
+        NativeLPSolver solver;
+        unsigned n = 300;
+        for ( unsigned i = 0; i < n; ++i )
+            solver.addVariable( Stringf( "x%u", i ), 0, 1 );
+
+        List<ILPSolver::Term> objective;
+        for ( unsigned i = 0; i < n; ++i )
+        {
+            objective.append( ILPSolver::Term( 1, Stringf( "x%u", i ) ) );
+            if ( i + 1 < n )
+            {
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", i ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", i + 1 ) ) );
+                solver.addLeqConstraint( terms, 1 );
+            }
+        }
+        solver.setObjective( objective );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( !solver.timeout() );
+        TS_ASSERT( !solver.failed() );
+        TS_ASSERT( solver.getNumberOfSimplexIterations() >
+                   GlobalConfiguration::NATIVE_LP_SOLVER_ASSIGNMENT_RECOMPUTATION_FREQUENCY );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), n / 2 ) );
+
+        for ( unsigned i = 0; i + 1 < n; ++i )
+        {
+            TS_ASSERT( FloatUtils::lte( solver.getAssignment( Stringf( "x%u", i ) ) +
+                                            solver.getAssignment( Stringf( "x%u", i + 1 ) ),
+                                        1 ) );
+        }
+    }
+
+    void test_only_continuous_variables_supported()
+    {
+        NativeLPSolver solver;
+        TS_ASSERT_THROWS_EQUALS( solver.addVariable( "a", 0, 1, ILPSolver::BINARY ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::FEATURE_NOT_YET_SUPPORTED );
+        TS_ASSERT( !solver.containsVariable( "a" ) );
+    }
+};
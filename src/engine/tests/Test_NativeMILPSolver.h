@@ -0,0 +1,258 @@
+/*********************                                                        */
+/*! \file Test_NativeMILPSolver.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "FloatUtils.h"
+#include "MarabouError.h"
+#include "MockErrno.h"
+#include "NativeMILPSolver.h"
+
+#include <cxxtest/TestSuite.h>
+
+class MockForNativeMILPSolver : public MockErrno
+{
+public:
+};
+
+class NativeMILPSolverTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForNativeMILPSolver *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForNativeMILPSolver );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void populateKnapsack( NativeMILPSolver &solver )
+    {
+        /*
+          max 8a + 11b + 6c + 4d
+          5a + 7b + 4c + 3d <= 14
+          a, b, c, d binary
+
+          The LP relaxation is 22 (a = b = 1, c = 0.5), and the optimum
+          is 21 (b = c = d = 1).
+        */
+        solver.addVariable( "a", 0, 1, ILPSolver::BINARY );
+        solver.addVariable( "b", 0, 1, ILPSolver::BINARY );
+        solver.addVariable( "c", 0, 1, ILPSolver::BINARY );
+        solver.addVariable( "d", 0, 1, ILPSolver::BINARY );
+
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 5, "a" ) );
+        terms.append( ILPSolver::Term( 7, "b" ) );
+        terms.append( ILPSolver::Term( 4, "c" ) );
+        terms.append( ILPSolver::Term( 3, "d" ) );
+        solver.addLeqConstraint( terms, 14 );
+
+        List<ILPSolver::Term> objective;
+        objective.append( ILPSolver::Term( 8, "a" ) );
+        objective.append( ILPSolver::Term( 11, "b" ) );
+        objective.append( ILPSolver::Term( 6, "c" ) );
+        objective.append( ILPSolver::Term( 4, "d" ) );
+        solver.setObjective( objective );
+    }
+
+    void test_binary_knapsack()
+    {
+        NativeMILPSolver solver;
+        populateKnapsack( solver );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( solver.haveFeasibleSolution() );
+        TS_ASSERT( solver.getNumberOfNodes() > 1 );
+
+        Map<String, double> solution;
+        double value;
+        solver.extractSolution( solution, value );
+
+        TS_ASSERT( FloatUtils::areEqual( value, 21 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["a"], 0 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["b"], 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["c"], 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["d"], 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 21 ) );
+    }
+
+    void test_integer_variables()
+    {
+        NativeMILPSolver solver;
+
+        /*
+          max x + y
+          -2x + 2y >= 1
+          -8x + 10y <= 13
+          x, y integer in [0, 10]
+
+          The LP relaxation is attained at (4, 4.5), and the optimum at (1, 2)
+        */
+        solver.addVariable( "x", 0, 10, ILPSolver::INTEGER );
+        solver.addVariable( "y", 0, 10, ILPSolver::INTEGER );
+
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( -2, "x" ) );
+        terms.append( ILPSolver::Term( 2, "y" ) );
+        solver.addGeqConstraint( terms, 1 );
+
+        terms.clear();
+        terms.append( ILPSolver::Term( -8, "x" ) );
+        terms.append( ILPSolver::Term( 10, "y" ) );
+        solver.addLeqConstraint( terms, 13 );
+
+        List<ILPSolver::Term> cost;
+        cost.append( ILPSolver::Term( -1, "x" ) );
+        cost.append( ILPSolver::Term( -1, "y" ) );
+        solver.setCost( cost );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), -3 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "x" ), 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "y" ), 2 ) );
+    }
+
+    void test_indicator_constraints()
+    {
+        NativeMILPSolver solver;
+
+        /*
+          max y
+          z = 1 -> y - x = 0
+          z = 0 -> y + x = 5
+          x in [0, 10], z binary
+        */
+        solver.addVariable( "x", 0, 10 );
+        solver.addVariable( "y", -100, 100 );
+        solver.addVariable( "z", 0, 1, ILPSolver::BINARY );
+
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 1, "y" ) );
+        terms.append( ILPSolver::Term( -1, "x" ) );
+        solver.addEqIndicatorConstraint( "z", 1, terms, 0 );
+
+        terms.clear();
+        terms.append( ILPSolver::Term( 1, "y" ) );
+        terms.append( ILPSolver::Term( 1, "x" ) );
+        solver.addEqIndicatorConstraint( "z", 0, terms, 5 );
+
+        List<ILPSolver::Term> objective;
+        objective.append( ILPSolver::Term( 1, "y" ) );
+        solver.setObjective( objective );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 10 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "z" ), 1 ) );
+
+        // With an unbounded y, the indicator constraints are enforced by
+        // branching instead of by big-M terms
+        solver.setLowerBound( "y", FloatUtils::negativeInfinity() );
+        solver.setUpperBound( "y", FloatUtils::infinity() );
+        terms.clear();
+        terms.append( ILPSolver::Term( 1, "y" ) );
+        solver.addLeqConstraint( terms, 20 );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 10 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "x" ), 10 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "z" ), 1 ) );
+
+        // Forcing z = 0 selects the other branch
+        solver.setUpperBound( "z", 0 );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 5 ) );
+    }
+
+    void test_piecewise_linear_constraint()
+    {
+        NativeMILPSolver solver;
+
+        // A leaky ReLU with slope 0.1
+        solver.addVariable( "x", -3, -3 );
+        solver.addVariable( "y", -10, 10 );
+
+        double xPoints[] = { -1, 0, 1 };
+        double yPoints[] = { -0.1, 0, 1 };
+        solver.addPiecewiseLinearConstraint( "x", "y", 3, xPoints, yPoints );
+
+        List<ILPSolver::Term> cost;
+        cost.append( ILPSolver::Term( 1, "y" ) );
+        solver.setCost( cost );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "y" ), -0.3 ) );
+
+        solver.setUpperBound( "x", 5 );
+        solver.setObjective( cost );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getOptimalCostOrObjective(), 5 ) );
+
+        // The binary variables of the encoding are not part of the solution
+        Map<String, double> solution;
+        double value;
+        solver.extractSolution( solution, value );
+        TS_ASSERT_EQUALS( solution.size(), 2U );
+        TS_ASSERT( FloatUtils::areEqual( solution["x"], 5 ) );
+    }
+
+    void test_infeasible_and_cutoff()
+    {
+        NativeMILPSolver solver;
+
+        // 2x = 1 has a fractional solution only
+        solver.addVariable( "x", 0, 5, ILPSolver::INTEGER );
+        List<ILPSolver::Term> terms;
+        terms.append( ILPSolver::Term( 2, "x" ) );
+        solver.addEqConstraint( terms, 1 );
+        solver.setCost( terms );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.infeasible() );
+        TS_ASSERT( !solver.haveFeasibleSolution() );
+        TS_ASSERT( !solver.existsAssignment( "x" ) );
+
+        NativeMILPSolver knapsack;
+        populateKnapsack( knapsack );
+        knapsack.setCutoff( 21.5 );
+        TS_ASSERT_THROWS_NOTHING( knapsack.solve() );
+        TS_ASSERT( knapsack.cutoffOccurred() );
+        TS_ASSERT( !knapsack.haveFeasibleSolution() );
+
+        knapsack.setCutoff( 20 );
+        TS_ASSERT_THROWS_NOTHING( knapsack.solve() );
+        TS_ASSERT( knapsack.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( knapsack.getOptimalCostOrObjective(), 21 ) );
+    }
+
+    void test_bilinear_constraints_not_supported()
+    {
+        NativeMILPSolver solver;
+        solver.addVariable( "x", 0, 1 );
+        solver.addVariable( "y", 0, 1 );
+        solver.addVariable( "z", 0, 1 );
+        TS_ASSERT_THROWS_EQUALS( solver.addBilinearConstraint( "x", "y", "z" ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::FEATURE_NOT_YET_SUPPORTED );
+    }
+};
@@ -0,0 +1,117 @@
+/*********************                                                        */
+/*! \file Test_PLConstraintChangeTracker.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "PLConstraintChangeTracker.h"
+#include "ReluConstraint.h"
+
+#include <cxxtest/TestSuite.h>
+
+class PLConstraintChangeTrackerTestSuite : public CxxTest::TestSuite
+{
+public:
+    List<PiecewiseLinearConstraint *> constraints;
+    ReluConstraint *relu1;
+    ReluConstraint *relu2;
+    ReluConstraint *relu3;
+
+    void setUp()
+    {
+        // relu1 and relu2 share variable 2
+        TS_ASSERT( relu1 = new ReluConstraint( 0, 2 ) );
+        TS_ASSERT( relu2 = new ReluConstraint( 2, 3 ) );
+        TS_ASSERT( relu3 = new ReluConstraint( 5, 6 ) );
+
+        constraints.clear();
+        constraints.append( relu1 );
+        constraints.append( relu2 );
+        constraints.append( relu3 );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete relu1 );
+        TS_ASSERT_THROWS_NOTHING( delete relu2 );
+        TS_ASSERT_THROWS_NOTHING( delete relu3 );
+    }
+
+    void test_all_constraints_changed_initially()
+    {
+        PLConstraintChangeTracker tracker;
+        tracker.initialize( constraints );
+
+        TS_ASSERT( tracker.hasChanges() );
+
+        Vector<PiecewiseLinearConstraint *> changed;
+        tracker.extractChangedConstraints( changed );
+        TS_ASSERT_EQUALS( changed.size(), 3U );
+        TS_ASSERT_EQUALS( changed[0], relu1 );
+        TS_ASSERT_EQUALS( changed[1], relu2 );
+        TS_ASSERT_EQUALS( changed[2], relu3 );
+
+        TS_ASSERT( !tracker.hasChanges() );
+        tracker.extractChangedConstraints( changed );
+        TS_ASSERT( changed.empty() );
+    }
+
+    void test_bound_changes()
+    {
+        PLConstraintChangeTracker tracker;
+        tracker.initialize( constraints );
+
+        Vector<PiecewiseLinearConstraint *> changed;
+        tracker.extractChangedConstraints( changed );
+
+        // A variable that is not in any constraint
+        tracker.notifyLowerBound( 4, 1 );
+        tracker.notifyUpperBound( 100, 1 );
+        TS_ASSERT( !tracker.hasChanges() );
+
+        // Constraints are reported once, in their original order
+        tracker.notifyUpperBound( 6, 1 );
+        tracker.notifyLowerBound( 2, 0 );
+        tracker.notifyUpperBound( 2, 3 );
+        TS_ASSERT( tracker.hasChanges() );
+
+        tracker.extractChangedConstraints( changed );
+        TS_ASSERT_EQUALS( changed.size(), 3U );
+        TS_ASSERT_EQUALS( changed[0], relu1 );
+        TS_ASSERT_EQUALS( changed[1], relu2 );
+        TS_ASSERT_EQUALS( changed[2], relu3 );
+
+        tracker.notifyLowerBound( 3, 0 );
+        tracker.extractChangedConstraints( changed );
+        TS_ASSERT_EQUALS( changed.size(), 1U );
+        TS_ASSERT_EQUALS( changed[0], relu2 );
+
+        // Marking everything as changed
+        tracker.notifyLowerBound( 0, 0 );
+        tracker.markAllChanged();
+        tracker.extractChangedConstraints( changed );
+        TS_ASSERT_EQUALS( changed.size(), 3U );
+
+        // Earlier changes were cleared as well
+        TS_ASSERT( !tracker.hasChanges() );
+        tracker.notifyLowerBound( 5, 0 );
+        tracker.extractChangedConstraints( changed );
+        TS_ASSERT_EQUALS( changed.size(), 1U );
+        TS_ASSERT_EQUALS( changed[0], relu3 );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -201,6 +201,57 @@ public:
         TS_ASSERT_EQUALS( processed.getUpperBound( 0 ), 6.5 );
     }
 
+    void test_tighten_bounds_along_a_chain_of_equations()
+    {
+        Query inputQuery;
+
+        inputQuery.setNumberOfVariables( 4 );
+        inputQuery.setLowerBound( 0, 0 );
+        inputQuery.setUpperBound( 0, 1 );
+
+        // The equations are listed against the direction of propagation,
+        // so every tightening requeues the previous equation:
+        //
+        // x3 - 2x2 = 0
+        // x2 - 2x1 = 0
+        // x1 - 2x0 = 0
+        for ( unsigned i = 3; i > 0; --i )
+        {
+            Equation equation;
+            equation.addAddend( 1, i );
+            equation.addAddend( -2, i - 1 );
+            equation.setScalar( 0 );
+            inputQuery.addEquation( equation );
+        }
+
+        Query processed = *( Preprocessor().preprocess( inputQuery, false ) );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT( FloatUtils::areEqual( processed.getLowerBound( i ), 0 ) );
+            TS_ASSERT( FloatUtils::areEqual( processed.getUpperBound( i ), 1 << i ) );
+        }
+        TS_ASSERT_EQUALS( processed.getEquations().size(), 3U );
+
+        // Once x0 is fixed, all the variables become fixed, and the
+        // equations are removed
+        inputQuery.setLowerBound( 0, 1 );
+
+        processed = *( Preprocessor().preprocess( inputQuery, false ) );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT( FloatUtils::areEqual( processed.getLowerBound( i ), 1 << i ) );
+            TS_ASSERT( FloatUtils::areEqual( processed.getUpperBound( i ), 1 << i ) );
+        }
+        TS_ASSERT( processed.getEquations().empty() );
+
+        // Bounds that contradict the chain are detected
+        inputQuery.setLowerBound( 3, 9 );
+        TS_ASSERT_THROWS( Preprocessor().preprocess( inputQuery, false ),
+                          const InfeasibleQueryException & );
+    }
+
     void test_tighten_bounds_using_constraints()
     {
         Query inputQuery;
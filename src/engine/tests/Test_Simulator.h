@@ -0,0 +1,183 @@
+/*********************                                                        */
+/*! \file Test_Simulator.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "Equation.h"
+#include "FloatUtils.h"
+#include "Query.h"
+#include "ReluConstraint.h"
+#include "Simulator.h"
+
+#include <cxxtest/TestSuite.h>
+
+class SimulatorTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+    }
+
+    void tearDown()
+    {
+    }
+
+    /*
+      x0 in [-1, 1]
+      x1 in [0, 2]
+
+      x2 = x0 + x1
+      x3 = x0 - x1 + 1
+
+      x4 = relu( x2 )
+      x5 = relu( x3 )
+
+      x6 = x4 - 2 x5
+    */
+    void populateQuery( Query &query )
+    {
+        query.setNumberOfVariables( 7 );
+
+        query.setLowerBound( 0, -1 );
+        query.setUpperBound( 0, 1 );
+        query.setLowerBound( 1, 0 );
+        query.setUpperBound( 1, 2 );
+
+        query.markInputVariable( 0, 0 );
+        query.markInputVariable( 1, 1 );
+        query.markOutputVariable( 6, 0 );
+
+        Equation equation1;
+        equation1.addAddend( 1, 0 );
+        equation1.addAddend( 1, 1 );
+        equation1.addAddend( -1, 2 );
+        equation1.setScalar( 0 );
+        query.addEquation( equation1 );
+
+        Equation equation2;
+        equation2.addAddend( 1, 0 );
+        equation2.addAddend( -1, 1 );
+        equation2.addAddend( -1, 3 );
+        equation2.setScalar( -1 );
+        query.addEquation( equation2 );
+
+        query.addPiecewiseLinearConstraint( new ReluConstraint( 2, 4 ) );
+        query.addPiecewiseLinearConstraint( new ReluConstraint( 3, 5 ) );
+
+        Equation equation3;
+        equation3.addAddend( 1, 4 );
+        equation3.addAddend( -2, 5 );
+        equation3.addAddend( -1, 6 );
+        equation3.setScalar( 0 );
+        query.addEquation( equation3 );
+    }
+
+    void checkResult( const Simulator::Result &result )
+    {
+        double x0 = result.get( 0 );
+        double x1 = result.get( 1 );
+
+        TS_ASSERT( FloatUtils::gte( x0, -1 ) && FloatUtils::lte( x0, 1 ) );
+        TS_ASSERT( FloatUtils::gte( x1, 0 ) && FloatUtils::lte( x1, 2 ) );
+
+        double x4 = FloatUtils::max( x0 + x1, 0 );
+        double x5 = FloatUtils::max( x0 - x1 + 1, 0 );
+
+        TS_ASSERT( FloatUtils::areEqual( result.get( 2 ), x0 + x1 ) );
+        TS_ASSERT( FloatUtils::areEqual( result.get( 3 ), x0 - x1 + 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( result.get( 4 ), x4 ) );
+        TS_ASSERT( FloatUtils::areEqual( result.get( 5 ), x5 ) );
+        TS_ASSERT( FloatUtils::areEqual( result.get( 6 ), x4 - 2 * x5 ) );
+    }
+
+    void test_batch_simulations()
+    {
+        Query query;
+        populateQuery( query );
+
+        Simulator simulator;
+        TS_ASSERT_THROWS_NOTHING( simulator.runSimulations( query, 20, 1 ) );
+        TS_ASSERT( simulator.usedBatchSimulation() );
+
+        const List<Simulator::Result> *results = simulator.getResults();
+        TS_ASSERT_EQUALS( results->size(), 20U );
+
+        // Preprocessing gives each ReLU an auxiliary variable, aux = f - b,
+        // and these are part of the result: x7 for x4 and x8 for x5
+        for ( const auto &result : *results )
+        {
+            TS_ASSERT_EQUALS( result.size(), 9U );
+            checkResult( result );
+            TS_ASSERT(
+                FloatUtils::areEqual( result.get( 7 ), result.get( 4 ) - result.get( 2 ) ) );
+            TS_ASSERT(
+                FloatUtils::areEqual( result.get( 8 ), result.get( 5 ) - result.get( 3 ) ) );
+        }
+    }
+
+    void test_batch_and_single_simulations_agree()
+    {
+        Query query;
+        populateQuery( query );
+
+        // With the same seed, both paths draw the same inputs
+        Simulator batchSimulator;
+        TS_ASSERT_THROWS_NOTHING( batchSimulator.runSimulations( query, 10, 3 ) );
+        TS_ASSERT( batchSimulator.usedBatchSimulation() );
+
+        Simulator singleSimulator;
+        singleSimulator.setBatchSimulation( false );
+        TS_ASSERT_THROWS_NOTHING( singleSimulator.runSimulations( query, 10, 3 ) );
+        TS_ASSERT( !singleSimulator.usedBatchSimulation() );
+
+        const List<Simulator::Result> *batchResults = batchSimulator.getResults();
+        const List<Simulator::Result> *singleResults = singleSimulator.getResults();
+        TS_ASSERT_EQUALS( batchResults->size(), 10U );
+        TS_ASSERT_EQUALS( singleResults->size(), 10U );
+
+        auto it = singleResults->begin();
+        for ( const auto &result : *batchResults )
+        {
+            TS_ASSERT_EQUALS( result.size(), it->size() );
+            checkResult( *it );
+            for ( const auto &entry : result )
+                TS_ASSERT( FloatUtils::areEqual( entry.second, it->get( entry.first ) ) );
+            ++it;
+        }
+    }
+
+    void test_batch_simulations_with_several_workers()
+    {
+        Query query;
+        populateQuery( query );
+
+        Simulator simulator;
+        TS_ASSERT_THROWS_NOTHING( simulator.runSimulations( query, 11, 7 ) );
+
+        Simulator parallelSimulator;
+        parallelSimulator.setNumberOfWorkers( 3 );
+        TS_ASSERT_THROWS_NOTHING( parallelSimulator.runSimulations( query, 11, 7 ) );
+        TS_ASSERT( parallelSimulator.usedBatchSimulation() );
+
+        const List<Simulator::Result> *results = simulator.getResults();
+        const List<Simulator::Result> *parallelResults = parallelSimulator.getResults();
+        TS_ASSERT_EQUALS( parallelResults->size(), 11U );
+
+        auto it = results->begin();
+        for ( const auto &result : *parallelResults )
+        {
+            checkResult( result );
+            for ( unsigned i = 0; i < 7; ++i )
+                TS_ASSERT( FloatUtils::areEqual( result.get( i ), it->get( i ) ) );
+            ++it;
+        }
+    }
+};
@@ -20,6 +20,7 @@
 #include "MockCostFunctionManager.h"
 #include "MockErrno.h"
 #include "Options.h"
+#include "ReluConstraint.h"
 #include "Tableau.h"
 #include "TableauRow.h"
 #include "TableauState.h"
@@ -49,6 +50,13 @@ public:
     {
         lastNotifiedUpperBounds[variable] = bound;
     }
+
+    List<unsigned> batchSizes;
+    void notifyBounds( const Tightening *tightenings, unsigned count )
+    {
+        batchSizes.append( count );
+        ITableau::VariableWatcher::notifyBounds( tightenings, count );
+    }
 };
 
 class TableauTestSuite : public CxxTest::TestSuite
@@ -1339,6 +1347,121 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void test_variable_watchers()
+    {
+        Tableau *tableau = NULL;
+        Context context;
+        BoundManager boundManager( context );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( 7 ) );
+        TS_ASSERT( tableau = new Tableau( boundManager ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        boundManager.registerTableau( tableau );
+
+        MockVariableWatcher watcher1;
+        MockVariableWatcher watcher2;
+        MockVariableWatcher globalWatcher;
+
+        tableau->registerToWatchVariable( &watcher1, 1 );
+        tableau->registerToWatchVariable( &watcher1, 3 );
+        tableau->registerToWatchVariable( &watcher2, 3 );
+        tableau->registerToWatchAllVariables( &globalWatcher );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 3, 1 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 1, 5 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 2, 7 ) );
+
+        TS_ASSERT_EQUALS( watcher1.lastNotifiedLowerBounds[3], 1 );
+        TS_ASSERT_EQUALS( watcher1.lastNotifiedUpperBounds[1], 5 );
+        TS_ASSERT( !watcher1.lastNotifiedUpperBounds.exists( 2 ) );
+        TS_ASSERT_EQUALS( watcher2.lastNotifiedLowerBounds[3], 1 );
+        TS_ASSERT( !watcher2.lastNotifiedUpperBounds.exists( 1 ) );
+        TS_ASSERT_EQUALS( globalWatcher.lastNotifiedUpperBounds[2], 7 );
+
+        // Propagated tightenings reach each watcher in a single batch
+        boundManager.clearTightenings();
+        TS_ASSERT( boundManager.setLowerBound( 1, 2 ) );
+        TS_ASSERT( boundManager.setUpperBound( 3, 4 ) );
+        TS_ASSERT( boundManager.setLowerBound( 5, 3 ) );
+        TS_ASSERT_THROWS_NOTHING( boundManager.propagateTightenings() );
+
+        TS_ASSERT( watcher1.batchSizes == List<unsigned>( { 2 } ) );
+        TS_ASSERT( watcher2.batchSizes == List<unsigned>( { 1 } ) );
+        TS_ASSERT( globalWatcher.batchSizes == List<unsigned>( { 3 } ) );
+        TS_ASSERT_EQUALS( watcher1.lastNotifiedLowerBounds[1], 2 );
+        TS_ASSERT_EQUALS( watcher1.lastNotifiedUpperBounds[3], 4 );
+        TS_ASSERT_EQUALS( watcher2.lastNotifiedUpperBounds[3], 4 );
+        TS_ASSERT_EQUALS( globalWatcher.lastNotifiedLowerBounds[5], 3 );
+
+        // Unregistered watchers are no longer notified
+        tableau->unregisterToWatchVariable( &watcher1, 3 );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 3, 2 ) );
+        TS_ASSERT_EQUALS( watcher1.lastNotifiedLowerBounds[3], 1 );
+        TS_ASSERT_EQUALS( watcher2.lastNotifiedLowerBounds[3], 2 );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
+    void test_cascaded_tightenings_in_a_batch()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+        Context context;
+        BoundManager boundManager( context );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( 7 ) );
+        TS_ASSERT( tableau = new Tableau( boundManager ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        initializeTableauValues( *tableau );
+        boundManager.registerTableau( tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, -10 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        for ( unsigned i = 4; i < 7; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, -1000 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 1000 ) );
+        }
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        // x1 = ReLU( x0 ), x2 = ReLU( x1 )
+        ReluConstraint relu1( 0, 1 );
+        ReluConstraint relu2( 1, 2 );
+        relu1.registerBoundManager( &boundManager );
+        relu2.registerBoundManager( &boundManager );
+        relu1.registerAsWatcher( tableau );
+        relu2.registerAsWatcher( tableau );
+        boundManager.clearTightenings();
+
+        // A single batch fixes the phase of the first ReLU, and the
+        // bounds it tightens while handling that batch are propagated
+        // in the next round
+        TS_ASSERT( boundManager.setLowerBound( 0, 1 ) );
+        TS_ASSERT( boundManager.setUpperBound( 1, 5 ) );
+        TS_ASSERT_THROWS_NOTHING( boundManager.propagateTightenings() );
+
+        TS_ASSERT( relu1.phaseFixed() );
+        TS_ASSERT_EQUALS( boundManager.getLowerBound( 1 ), 1 );
+        TS_ASSERT_EQUALS( boundManager.getUpperBound( 0 ), 5 );
+        TS_ASSERT_EQUALS( boundManager.getUpperBound( 2 ), 5 );
+        TS_ASSERT( !relu2.phaseFixed() );
+        TS_ASSERT_EQUALS( boundManager.getLowerBound( 2 ), -10 );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.propagateTightenings() );
+
+        TS_ASSERT( relu2.phaseFixed() );
+        TS_ASSERT_EQUALS( boundManager.getLowerBound( 2 ), 1 );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
     void test_are_dependent()
     {
         Tableau *tableau = NULL;
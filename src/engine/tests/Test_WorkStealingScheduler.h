@@ -0,0 +1,188 @@
+/*********************                                                        */
+/*! \file Test_WorkStealingScheduler.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "WorkStealingScheduler.h"
+
+#include <chrono>
+#include <cxxtest/TestSuite.h>
+#include <thread>
+
+class WorkStealingSchedulerTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+    }
+
+    void tearDown()
+    {
+    }
+
+    SubQuery *createSubQuery( String queryId )
+    {
+        SubQuery *subQuery = new SubQuery;
+        subQuery->_queryId = queryId;
+        subQuery->_split =
+            std::unique_ptr<PiecewiseLinearCaseSplit>( new PiecewiseLinearCaseSplit );
+        subQuery->_timeoutInSeconds = 5;
+        subQuery->_depth = 0;
+        return subQuery;
+    }
+
+    void popAndCheck( WorkStealingScheduler &scheduler, unsigned worker, String expectedId )
+    {
+        SubQuery *subQuery = scheduler.pop( worker );
+        TS_ASSERT( subQuery );
+        if ( subQuery )
+        {
+            TS_ASSERT_EQUALS( subQuery->_queryId, expectedId );
+            delete subQuery;
+        }
+    }
+
+    void test_owner_pops_newest_thief_steals_oldest()
+    {
+        WorkStealingScheduler scheduler( 3 );
+
+        SubQueries subQueries;
+        subQueries.append( createSubQuery( "a" ) );
+        subQueries.append( createSubQuery( "b" ) );
+        scheduler.distribute( subQueries );
+
+        scheduler.push( 0, createSubQuery( "c" ) );
+        scheduler.push( 0, createSubQuery( "d" ) );
+
+        // Worker 0 holds a, c, d; worker 1 holds b
+        popAndCheck( scheduler, 0, "d" );
+        popAndCheck( scheduler, 1, "b" );
+
+        // Worker 2 has nothing, and steals the oldest entry of worker 0
+        popAndCheck( scheduler, 2, "a" );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSteals(), 1U );
+
+        popAndCheck( scheduler, 1, "c" );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSteals(), 2U );
+
+        TS_ASSERT( !scheduler.pop( 0 ) );
+        TS_ASSERT( !scheduler.pop( 1 ) );
+
+        // Remaining subqueries are deleted with the scheduler
+        scheduler.push( 2, createSubQuery( "e" ) );
+    }
+
+    void test_split_requests()
+    {
+        // No minimal search time and no back-off
+        WorkStealingScheduler scheduler( 3, 0, 0, 0 );
+
+        std::atomic_bool splitRequested[3];
+        for ( unsigned i = 0; i < 3; ++i )
+        {
+            splitRequested[i] = false;
+            scheduler.registerSplitRequestFlag( i, &splitRequested[i] );
+        }
+
+        // Nobody is busy, so no split is requested
+        TS_ASSERT( !scheduler.pop( 0 ) );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSplitRequests(), 0U );
+
+        // Worker 2 is busy, and is asked to split by the idle workers
+        scheduler.setBusy( 2, true );
+        TS_ASSERT( !scheduler.pop( 0 ) );
+        TS_ASSERT( splitRequested[2].load() );
+        TS_ASSERT( !splitRequested[0].load() );
+        TS_ASSERT( !splitRequested[1].load() );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSplitRequests(), 1U );
+
+        // A pending request is not repeated
+        TS_ASSERT( !scheduler.pop( 1 ) );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSplitRequests(), 1U );
+
+        // A worker never asks itself to split
+        splitRequested[2] = false;
+        TS_ASSERT( !scheduler.pop( 2 ) );
+        TS_ASSERT( !splitRequested[2].load() );
+
+        // Requests that arrive while idle are dropped once work resumes
+        scheduler.setBusy( 2, false );
+        splitRequested[2] = true;
+        scheduler.setBusy( 2, true );
+        TS_ASSERT( !splitRequested[2].load() );
+    }
+
+    void test_split_requests_wait_for_minimal_search_time()
+    {
+        WorkStealingScheduler scheduler( 2, 100, 0, 0 );
+
+        std::atomic_bool splitRequested[2];
+        for ( unsigned i = 0; i < 2; ++i )
+        {
+            splitRequested[i] = false;
+            scheduler.registerSplitRequestFlag( i, &splitRequested[i] );
+        }
+
+        // Worker 1 has only just started searching, and is left alone
+        scheduler.setBusy( 1, true );
+        TS_ASSERT( !scheduler.pop( 0 ) );
+        TS_ASSERT( !splitRequested[1].load() );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSplitRequests(), 0U );
+
+        std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+        TS_ASSERT( !scheduler.pop( 0 ) );
+        TS_ASSERT( splitRequested[1].load() );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSplitRequests(), 1U );
+    }
+
+    void test_idle_workers_back_off()
+    {
+        WorkStealingScheduler scheduler( 2, 0, 100, 1000 );
+
+        std::atomic_bool splitRequested[2];
+        for ( unsigned i = 0; i < 2; ++i )
+        {
+            splitRequested[i] = false;
+            scheduler.registerSplitRequestFlag( i, &splitRequested[i] );
+        }
+
+        scheduler.setBusy( 1, true );
+        TS_ASSERT( !scheduler.pop( 0 ) );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSplitRequests(), 1U );
+
+        // The request was served, but worker 0 polls again too soon
+        splitRequested[1] = false;
+        TS_ASSERT( !scheduler.pop( 0 ) );
+        TS_ASSERT( !splitRequested[1].load() );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSplitRequests(), 1U );
+
+        std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+        TS_ASSERT( !scheduler.pop( 0 ) );
+        TS_ASSERT( splitRequested[1].load() );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSplitRequests(), 2U );
+
+        // Obtaining work resets the back-off
+        scheduler.push( 1, createSubQuery( "a" ) );
+        popAndCheck( scheduler, 0, "a" );
+        splitRequested[1] = false;
+        TS_ASSERT( !scheduler.pop( 0 ) );
+        TS_ASSERT( splitRequested[1].load() );
+        TS_ASSERT_EQUALS( scheduler.getNumberOfSplitRequests(), 3U );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
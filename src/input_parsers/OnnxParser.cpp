@@ -413,8 +413,8 @@ getNonNegativeIntsAttribute( onnx::NodeProto &node, String name, Vector<uint> &d
 Vector<double> getTensorFloatValues( const onnx::TensorProto &tensor, const TensorShape shape )
 {
     int size = tensorSize( shape );
-    std::string raw_data = tensor.raw_data();
-    Vector<double> result;
+    const std::string &raw_data = tensor.raw_data();
+    Vector<double> result( size );
     if ( raw_data.size() != 0 )
     {
         checkEndianness();
@@ -422,14 +422,14 @@ Vector<double> getTensorFloatValues( const onnx::TensorProto &tensor, const Tens
         const float *floats = reinterpret_cast<const float *>( bytes );
         for ( int i = 0; i < size; i++ )
         {
-            result.append( *( floats + i ) );
+            result[i] = *( floats + i );
         }
     }
     else
     {
         for ( int i = 0; i < size; i++ )
         {
-            result.append( tensor.float_data( i ) );
+            result[i] = tensor.float_data( i );
         }
     }
     return result;
@@ -438,8 +438,8 @@ Vector<double> getTensorFloatValues( const onnx::TensorProto &tensor, const Tens
 Vector<int64_t> getTensorIntValues( const onnx::TensorProto &tensor, const TensorShape shape )
 {
     int size = tensorSize( shape );
-    std::string raw_data = tensor.raw_data();
-    Vector<int64_t> result;
+    const std::string &raw_data = tensor.raw_data();
+    Vector<int64_t> result( size );
     if ( raw_data.size() != 0 )
     {
         checkEndianness();
@@ -448,7 +448,7 @@ Vector<int64_t> getTensorIntValues( const onnx::TensorProto &tensor, const Tenso
         for ( int i = 0; i < size; i++ )
         {
             int64_t value = *( ints + i );
-            result.append( value );
+            result[i] = value;
         }
     }
     else
@@ -456,7 +456,7 @@ Vector<int64_t> getTensorIntValues( const onnx::TensorProto &tensor, const Tenso
         for ( int i = 0; i < size; i++ )
         {
             int value = tensor.int64_data( i );
-            result.append( value );
+            result[i] = value;
         }
     }
     return result;
@@ -465,8 +465,8 @@ Vector<int64_t> getTensorIntValues( const onnx::TensorProto &tensor, const Tenso
 Vector<int32_t> getTensorInt32Values( const onnx::TensorProto &tensor, const TensorShape shape )
 {
     int size = tensorSize( shape );
-    std::string raw_data = tensor.raw_data();
-    Vector<int32_t> result;
+    const std::string &raw_data = tensor.raw_data();
+    Vector<int32_t> result( size );
     if ( raw_data.size() != 0 )
     {
         checkEndianness();
@@ -475,7 +475,7 @@ Vector<int32_t> getTensorInt32Values( const onnx::TensorProto &tensor, const Ten
         for ( int i = 0; i < size; i++ )
         {
             int32_t value = *( int32 + i );
-            result.append( value );
+            result[i] = value;
         }
     }
     else
@@ -483,7 +483,7 @@ Vector<int32_t> getTensorInt32Values( const onnx::TensorProto &tensor, const Ten
         for ( int i = 0; i < size; i++ )
         {
             int32_t value = tensor.int32_data( i );
-            result.append( value );
+            result[i] = value;
         }
     }
     return result;
@@ -505,11 +505,13 @@ void OnnxParser::insertConstant( String name,
         static_cast<onnx::TensorProto_DataType>( tensor.data_type() );
     if ( dataType == onnx::TensorProto_DataType_INT64 )
     {
-        _constantIntTensors.insert( name, getTensorIntValues( tensor, shape ) );
+        _constantIntTensors.insert(
+            name, std::make_shared<const Vector<int64_t>>( getTensorIntValues( tensor, shape ) ) );
     }
     else if ( dataType == onnx::TensorProto_DataType_FLOAT )
     {
-        _constantFloatTensors.insert( name, getTensorFloatValues( tensor, shape ) );
+        _constantFloatTensors.insert(
+            name, std::make_shared<const Vector<double>>( getTensorFloatValues( tensor, shape ) ) );
     }
     else if ( dataType == onnx::TensorProto_DataType_BOOL )
     {
@@ -517,7 +519,9 @@ void OnnxParser::insertConstant( String name,
         // BFLOAT16, FLOAT8E4M3FN, FLOAT8E4M3FNUZ, FLOAT8E5M2, FLOAT8E5M2FNUZ
         // are all represented as an int32. Support for those should be added later
         // when there is a practical need.
-        _constantInt32Tensors.insert( name, getTensorInt32Values( tensor, shape ) );
+        _constantInt32Tensors.insert(
+            name,
+            std::make_shared<const Vector<int32_t>>( getTensorInt32Values( tensor, shape ) ) );
     }
     else
     {
@@ -525,6 +529,27 @@ void OnnxParser::insertConstant( String name,
     }
 }
 
+const Vector<int64_t> &OnnxParser::getIntConstant( String name )
+{
+    if ( !_constantIntTensors.exists( name ) )
+        missingNodeError( name );
+    return *_constantIntTensors[name];
+}
+
+const Vector<double> &OnnxParser::getFloatConstant( String name )
+{
+    if ( !_constantFloatTensors.exists( name ) )
+        missingNodeError( name );
+    return *_constantFloatTensors[name];
+}
+
+const Vector<int32_t> &OnnxParser::getInt32Constant( String name )
+{
+    if ( !_constantInt32Tensors.exists( name ) )
+        missingNodeError( name );
+    return *_constantInt32Tensors[name];
+}
+
 void OnnxParser::transferValues( String oldName, String newName )
 {
     if ( _varMap.exists( oldName ) )
@@ -566,14 +591,18 @@ OnnxParser::OnnxParser( InputQueryBuilder &query,
     // move to start of file
     input.seekg( 0, std::ios::beg );
 
-    // read raw data
-    Vector<char> buffer( size );
-    input.read( buffer.data(), size );
+    // read raw data and parse protobuf. The graph is moved out of the
+    // model rather than copied, and the raw data is released right away.
+    {
+        Vector<char> buffer( size );
+        input.read( buffer.data(), size );
+
+        onnx::ModelProto model;
+        model.ParseFromArray( buffer.data(), size );
+        _network.Swap( model.mutable_graph() );
+    }
 
-    // parse protobuf
-    onnx::ModelProto model;
-    model.ParseFromArray( buffer.data(), size );
-    _network = model.graph();
+    indexNodes();
 
     _numberOfFoundInputs = 0;
 
@@ -637,17 +666,11 @@ void OnnxParser::validateUserTerminalNames( const Set<String> &terminalNames )
 {
     for ( String terminalName : terminalNames )
     {
-        for ( auto node : _network.node() )
+        if ( !_nodeWithOutput.exists( terminalName ) )
         {
-            for ( String outputNodeName : node.output() )
-            {
-                if ( terminalName == outputNodeName )
-                    return;
-            }
+            String errorMessage = Stringf( "Output %s not found in graph!", terminalName.ascii() );
+            throw MarabouError( MarabouError::ONNX_PARSER_ERROR, errorMessage.ascii() );
         }
-
-        String errorMessage = Stringf( "Output %s not found in graph!", terminalName.ascii() );
-        throw MarabouError( MarabouError::ONNX_PARSER_ERROR, errorMessage.ascii() );
     }
 }
 
@@ -700,8 +723,9 @@ void OnnxParser::initializeShapeAndConstantMaps()
         }
     }
 
-    // Initialise constants
-    for ( const onnx::TensorProto &constant : _network.initializer() )
+    // Initialise constants. Once decoded, the raw data of an initializer
+    // is no longer needed, and is released.
+    for ( onnx::TensorProto &constant : *_network.mutable_initializer() )
     {
         String constantName = constant.name();
         if ( isConstantNode( constantName ) )
@@ -717,6 +741,7 @@ void OnnxParser::initializeShapeAndConstantMaps()
             _shapeMap.insert( constantName, constantShape );
             _processedNodes.insert( constantName );
             insertConstant( constantName, constant, constantShape );
+            constant.clear_raw_data();
         }
     }
 }
@@ -767,47 +792,85 @@ void OnnxParser::processGraph()
 }
 
 /**
- * @brief Recursively processes the structure of the graph, adding the relevant
- * constraints for each node as it goes. Takes in a string rather than a NodeProto
+ * @brief Processes a node and, before it, all the nodes that it depends on, adding the
+ * relevant constraints for each node as it goes. The nodes are visited in the same
+ * depth-first order as a recursive traversal would, but with an explicit stack, so that
+ * deep graphs do not overflow the call stack. Takes in a string rather than a NodeProto
  * as we initially pass in the output which is *not* a NodeProto.
  *
- * @param node
+ * @param nodeName
  * @param makeEquations
  */
 void OnnxParser::processNode( String &nodeName, bool makeEquations )
 {
-    if ( _processedNodes.exists( nodeName ) )
-        return;
+    struct Frame
+    {
+        String _name;
+        int _node;
+        bool _makeEquations;
+        Vector<String> _inputs;
+        unsigned _nextInput;
+    };
+    Vector<Frame> stack;
+
+    // Mark a node as processed, and push it so that its inputs are processed first
+    auto visit = [&]( const String &name, bool makeNodeEquations ) {
+        if ( _processedNodes.exists( name ) )
+            return;
+
+        if ( _inputNames.exists( name ) )
+        {
+            _numberOfFoundInputs += 1;
+            // If an inputName is an intermediate layer of the network, we don't need to create
+            // Marabou equations for its inputs. However, we still need to call
+            // makeMarabouEquations in order to compute shapes. We just need to set the
+            // makeEquations flag to false
+            makeNodeEquations = false;
+        }
 
-    if ( _inputNames.exists( nodeName ) )
-    {
-        _numberOfFoundInputs += 1;
-        // If an inputName is an intermediate layer of the network, we don't need to create Marabou
-        // equations for its inputs. However, we still need to call makeMarabouEquations in order to
-        // compute shapes. We just need to set the makeEquations flag to false
-        makeEquations = false;
-    }
+        _processedNodes.insert( name );
+
+        if ( !_nodeWithOutput.exists( name ) )
+        {
+            String missingName = name;
+            missingNodeError( missingName );
+        }
 
-    _processedNodes.insert( nodeName );
+        Frame frame;
+        frame._name = name;
+        frame._node = _nodeWithOutput[name];
+        frame._makeEquations = makeNodeEquations;
+        for ( const String &inputName : getInputsToNode( _network.node( frame._node ) ) )
+            frame._inputs.append( inputName );
+        frame._nextInput = 0;
+        stack.append( frame );
+    };
 
-    List<onnx::NodeProto> nodes = getNodesWithOutput( nodeName );
-    ASSERT( nodes.size() == 1 );
-    onnx::NodeProto &node = nodes.front();
+    visit( nodeName, makeEquations );
 
-    // First recursively process the input nodes.
-    // This ensures that shapes and values of a node's inputs have been computed first.
-    for ( auto inputNode : getInputsToNode( node ) )
+    while ( !stack.empty() )
     {
-        processNode( inputNode, makeEquations );
-    }
+        Frame &frame = stack[stack.size() - 1];
 
-    // Compute node's shape and create Marabou equations as needed
-    makeMarabouEquations( node, makeEquations );
+        // First process the input nodes. This ensures that shapes and values of a node's
+        // inputs have been computed first.
+        if ( frame._nextInput < frame._inputs.size() )
+        {
+            String inputName = frame._inputs[frame._nextInput++];
+            visit( inputName, frame._makeEquations );
+            continue;
+        }
 
-    // Create new variables when we find one of the inputs
-    if ( _inputNames.exists( nodeName ) )
-    {
-        Vector<Variable> vars = makeNodeVariables( nodeName, true );
+        // Compute node's shape and create Marabou equations as needed
+        makeMarabouEquations( *_network.mutable_node( frame._node ), frame._makeEquations );
+
+        // Create new variables when we find one of the inputs
+        if ( _inputNames.exists( frame._name ) )
+        {
+            Vector<Variable> vars = makeNodeVariables( frame._name, true );
+        }
+
+        stack.pop();
     }
 }
 
@@ -834,29 +897,29 @@ Vector<Variable> OnnxParser::makeNodeVariables( String &nodeName, bool isInput )
     return variables;
 }
 
-List<onnx::NodeProto> OnnxParser::getNodesWithOutput( String &nodeName )
+/**
+ * @brief Index the nodes of the graph by their outputs, so that the node computing a
+ * given output can be found without scanning the graph.
+ */
+void OnnxParser::indexNodes()
 {
-    List<onnx::NodeProto> nodes;
-    for ( auto node : _network.node() )
+    for ( int i = 0; i < _network.node_size(); ++i )
     {
-        for ( auto outputName : node.output() )
+        for ( const std::string &outputName : _network.node( i ).output() )
         {
-            if ( outputName == nodeName.ascii() )
-            {
-                nodes.append( node );
-                break;
-            }
+            // Output names are unique in a valid graph; keep the first node otherwise
+            if ( !_nodeWithOutput.exists( outputName ) )
+                _nodeWithOutput.insert( outputName, i );
         }
     }
-    return nodes;
 }
 
-Set<String> OnnxParser::getInputsToNode( onnx::NodeProto &node )
+Set<String> OnnxParser::getInputsToNode( const onnx::NodeProto &node )
 {
     Set<String> inputNames;
     for ( String inputNodeName : node.input() )
     {
-        if ( getNodesWithOutput( inputNodeName ).size() >= 1 )
+        if ( _nodeWithOutput.exists( inputNodeName ) )
         {
             inputNames.insert( inputNodeName );
         }
@@ -1009,7 +1072,7 @@ void OnnxParser::dropout( onnx::NodeProto &node )
         {
             missingNodeError( trainingModeName );
         }
-        else if ( _constantInt32Tensors[trainingModeName][0] )
+        else if ( getInt32Constant( trainingModeName )[0] )
         {
             // training mode is set to true
             throw MarabouError( MarabouError::ONNX_PARSER_ERROR,
@@ -1048,10 +1111,10 @@ void OnnxParser::cast( onnx::NodeProto &node )
 
     if ( _constantIntTensors.exists( inputNodeName ) )
     {
-        Vector<int64_t> tensor = _constantIntTensors[inputNodeName];
+        const Vector<int64_t> &tensor = getIntConstant( inputNodeName );
         if ( to == onnx::TensorProto_DataType_INT64 )
         {
-            _constantIntTensors.insert( outputNodeName, tensor );
+            _constantIntTensors.insert( outputNodeName, _constantIntTensors[inputNodeName] );
         }
         else if ( to == onnx::TensorProto_DataType_FLOAT )
         {
@@ -1060,7 +1123,8 @@ void OnnxParser::cast( onnx::NodeProto &node )
             {
                 castTensor[i] = static_cast<double>( tensor[i] );
             }
-            _constantFloatTensors.insert( outputNodeName, castTensor );
+            _constantFloatTensors.insert( outputNodeName,
+                                          std::make_shared<const Vector<double>>( castTensor ) );
         }
         else
         {
@@ -1069,7 +1133,7 @@ void OnnxParser::cast( onnx::NodeProto &node )
     }
     else if ( _constantFloatTensors.exists( inputNodeName ) )
     {
-        Vector<double> tensor = _constantFloatTensors[inputNodeName];
+        const Vector<double> &tensor = getFloatConstant( inputNodeName );
         if ( to == onnx::TensorProto_DataType_INT64 )
         {
             Vector<int64_t> castTensor = Vector<int64_t>( tensor.size() );
@@ -1077,11 +1141,12 @@ void OnnxParser::cast( onnx::NodeProto &node )
             {
                 castTensor[i] = static_cast<int64_t>( tensor[i] );
             }
-            _constantIntTensors.insert( outputNodeName, castTensor );
+            _constantIntTensors.insert( outputNodeName,
+                                        std::make_shared<const Vector<int64_t>>( castTensor ) );
         }
         else if ( to == onnx::TensorProto_DataType_FLOAT )
         {
-            _constantFloatTensors.insert( outputNodeName, tensor );
+            _constantFloatTensors.insert( outputNodeName, _constantFloatTensors[inputNodeName] );
         }
         else
         {
@@ -1111,7 +1176,7 @@ void OnnxParser::reshape( onnx::NodeProto &node )
     bool allowZeroes = getIntAttribute( node, "allowzero", 0 ) != 0;
 
     TensorShape oldShape = _shapeMap[inputNodeName];
-    Vector<int64_t> newShapeTemplate = _constantIntTensors[shapeNodeName];
+    const Vector<int64_t> &newShapeTemplate = getIntConstant( shapeNodeName );
     TensorShape newShape = instantiateReshapeTemplate( oldShape, newShapeTemplate, allowZeroes );
     _shapeMap[outputNodeName] = newShape;
 
@@ -1183,15 +1248,17 @@ void OnnxParser::transpose( onnx::NodeProto &node )
     }
     else if ( _constantIntTensors.exists( inputNodeName ) )
     {
-        Vector<int64_t> inputConstant = _constantIntTensors[inputNodeName];
+        const Vector<int64_t> &inputConstant = getIntConstant( inputNodeName );
         _constantIntTensors.insert( outputNodeName,
-                                    transposeTensor( inputConstant, inputShape, perm ) );
+                                    std::make_shared<const Vector<int64_t>>(
+                                        transposeTensor( inputConstant, inputShape, perm ) ) );
     }
     else if ( _constantFloatTensors.exists( inputNodeName ) )
     {
-        Vector<double> inputConstant = _constantFloatTensors[inputNodeName];
+        const Vector<double> &inputConstant = getFloatConstant( inputNodeName );
         _constantFloatTensors.insert( outputNodeName,
-                                      transposeTensor( inputConstant, inputShape, perm ) );
+                                      std::make_shared<const Vector<double>>(
+                                          transposeTensor( inputConstant, inputShape, perm ) ) );
     }
     else
     {
@@ -1233,7 +1300,7 @@ void OnnxParser::squeeze( onnx::NodeProto &node )
         {
             missingNodeError( axisName );
         }
-        for ( int64_t axis : _constantIntTensors[axisName] )
+        for ( int64_t axis : getIntConstant( axisName ) )
         {
             axes.append( static_cast<int>( axis ) );
         }
@@ -1286,7 +1353,7 @@ void OnnxParser::unsqueeze( onnx::NodeProto &node )
     {
         missingNodeError( axisName );
     }
-    Vector<int64_t> axes = _constantIntTensors[axisName];
+    const Vector<int64_t> &axes = getIntConstant( axisName );
 
     // Calculate a sorted list of unsigned indices
     unsigned int outputShapeSize = inputShape.size() + axes.size();
@@ -1341,10 +1408,10 @@ void OnnxParser::batchNormEquations( onnx::NodeProto &node, bool makeEquations )
     std::string biasesName = node.input()[2];
     std::string inputMeansName = node.input()[3];
     std::string inputVariancesName = node.input()[4];
-    Vector<double> scales = _constantFloatTensors[scalesName];
-    Vector<double> biases = _constantFloatTensors[biasesName];
-    Vector<double> inputMeans = _constantFloatTensors[inputMeansName];
-    Vector<double> inputVariances = _constantFloatTensors[inputVariancesName];
+    const Vector<double> &scales = getFloatConstant( scalesName );
+    const Vector<double> &biases = getFloatConstant( biasesName );
+    const Vector<double> &inputMeans = getFloatConstant( inputMeansName );
+    const Vector<double> &inputVariances = getFloatConstant( inputVariancesName );
 
     ASSERT( scales.size() == numberOfChannels );
     ASSERT( biases.size() == numberOfChannels );
@@ -1632,7 +1699,7 @@ void OnnxParser::convEquations( onnx::NodeProto &node, [[maybe_unused]] bool mak
 
     // Generate equations
     Vector<Variable> inputVars = _varMap[inputNodeName];
-    Vector<double> filter = _constantFloatTensors[filterNodeName];
+    const Vector<double> &filter = getFloatConstant( filterNodeName );
     Vector<Variable> outputVars = makeNodeVariables( outputNodeName, false );
 
     // The third input is optional and specifies a bias for each filter
@@ -1642,7 +1709,7 @@ void OnnxParser::convEquations( onnx::NodeProto &node, [[maybe_unused]] bool mak
     if ( node.input().size() == 3 )
     {
         String biasName = node.input()[2];
-        biases = _constantFloatTensors[biasName];
+        biases = getFloatConstant( biasName );
     }
     else
     {
@@ -1745,18 +1812,20 @@ void OnnxParser::gemmEquations( onnx::NodeProto &node, bool makeEquations )
 
     // Assume that first input is variables, second is Matrix for MatMul, and third is bias addition
     Vector<Variable> inputVariables = _varMap[input1NodeName];
-    Vector<double> matrix = _constantFloatTensors[input2NodeName];
-    Vector<double> biases = _constantFloatTensors[biasNodeName];
+    const Vector<double> &weights = getFloatConstant( input2NodeName );
+    const Vector<double> &biases = getFloatConstant( biasNodeName );
 
     // Transpose inputs
     if ( transA != 0 )
     {
         inputVariables = transposeTensor( inputVariables, input1Shape, reversePerm );
     }
+    Vector<double> transposedWeights;
     if ( transB != 0 )
     {
-        matrix = transposeTensor( matrix, input2Shape, reversePerm );
+        transposedWeights = transposeTensor( weights, input2Shape, reversePerm );
     }
+    const Vector<double> &matrix = transB != 0 ? transposedWeights : weights;
 
     // Create new variables
     Vector<Variable> outputVariables = makeNodeVariables( outputNodeName, false );
@@ -1924,7 +1993,7 @@ void OnnxParser::scaleAndAddEquations( onnx::NodeProto &node,
     String variableName = input1IsConstant ? input2Name : input1Name;
     TensorShape inputConstantsShape = input1IsConstant ? input1Shape : input2Shape;
     TensorShape inputVariablesShape = input1IsConstant ? input2Shape : input1Shape;
-    Vector<double> inputConstants = _constantFloatTensors[constantName];
+    const Vector<double> &inputConstants = getFloatConstant( constantName );
     Vector<Variable> inputVariables = _varMap[variableName];
     double constantCoefficient = input1IsConstant ? coefficient1 : coefficient2;
     double variableCoefficient = input1IsConstant ? coefficient2 : coefficient1;
@@ -2039,7 +2108,7 @@ void OnnxParser::matMulEquations( onnx::NodeProto &node, bool makeEquations )
 
     String constantName = input1IsConstant ? input1Name : input2Name;
     TensorShape constantShape = input1IsConstant ? input1Shape : input2Shape;
-    Vector<double> constants = _constantFloatTensors[constantName];
+    const Vector<double> &constants = getFloatConstant( constantName );
 
     String variableName = input1IsConstant ? input2Name : input1Name;
     Vector<Variable> variables = _varMap[variableName];
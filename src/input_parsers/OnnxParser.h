@@ -25,6 +25,8 @@
 #include "Vector.h"
 #include "onnx.proto3.pb.h"
 
+#include <memory>
+
 #define ONNX_LOG( x, ... ) LOG( GlobalConfiguration::ONNX_PARSER_LOGGING, "OnnxParser: %s\n", x )
 
 
@@ -58,12 +60,22 @@ private:
 
     Map<String, TensorShape> _shapeMap;
     Map<String, Vector<Variable>> _varMap;
-    Map<String, const Vector<int64_t>> _constantIntTensors;
-    Map<String, const Vector<double>> _constantFloatTensors;
-    Map<String, const Vector<int32_t>> _constantInt32Tensors;
+
+    /*
+      The values of constant tensors are decoded once, and are then
+      shared by all the nodes that merely rename or reshape them.
+    */
+    Map<String, std::shared_ptr<const Vector<int64_t>>> _constantIntTensors;
+    Map<String, std::shared_ptr<const Vector<double>>> _constantFloatTensors;
+    Map<String, std::shared_ptr<const Vector<int32_t>>> _constantInt32Tensors;
     Set<String> _processedNodes;
     unsigned _numberOfFoundInputs;
 
+    /*
+      The index in _network.node() of the node that computes each output
+    */
+    Map<String, int> _nodeWithOutput;
+
     // Methods //
 
     const Set<String> readInputNames();
@@ -75,14 +87,17 @@ private:
     void initializeShapeAndConstantMaps();
     void validateAllInputsAndOutputsFound();
 
+    void indexNodes();
     void processGraph();
     void processNode( String &nodeName, bool makeEquations );
     void makeMarabouEquations( onnx::NodeProto &node, bool makeEquations );
-    Set<String> getInputsToNode( onnx::NodeProto &node );
-    List<onnx::NodeProto> getNodesWithOutput( String &nodeName );
+    Set<String> getInputsToNode( const onnx::NodeProto &node );
     Vector<Variable> makeNodeVariables( String &nodeName, bool isInput );
 
     bool isConstantNode( String name );
+    const Vector<int64_t> &getIntConstant( String name );
+    const Vector<double> &getFloatConstant( String name );
+    const Vector<int32_t> &getInt32Constant( String name );
 
     void transferValues( String oldName, String newName );
     void insertConstant( String name, const onnx::TensorProto &tensor, TensorShape shape );
@@ -16,7 +16,7 @@
 
 #include <math.h>
 
-TensorIndices unpackIndex( TensorShape shape, PackedTensorIndices packedIndex )
+TensorIndices unpackIndex( const TensorShape &shape, PackedTensorIndices packedIndex )
 {
     ASSERT( packedIndex < tensorSize( shape ) );
 
@@ -32,7 +32,7 @@ TensorIndices unpackIndex( TensorShape shape, PackedTensorIndices packedIndex )
     return indices;
 }
 
-PackedTensorIndices packIndex( TensorShape shape, TensorIndices indices )
+PackedTensorIndices packIndex( const TensorShape &shape, const TensorIndices &indices )
 {
     ASSERT( shape.size() == indices.size() );
 
@@ -48,7 +48,7 @@ PackedTensorIndices packIndex( TensorShape shape, TensorIndices indices )
     return index;
 }
 
-unsigned int tensorSize( TensorShape shape )
+unsigned int tensorSize( const TensorShape &shape )
 {
     unsigned int size = 1;
     for ( unsigned int dimSize : shape )
@@ -59,7 +59,8 @@ unsigned int tensorSize( TensorShape shape )
 }
 
 // See https://github.com/onnx/onnx/blob/main/docs/Broadcasting.md#multidirectional-broadcasting
-TensorShape getMultidirectionalBroadcastShape( TensorShape shape1, TensorShape shape2 )
+TensorShape getMultidirectionalBroadcastShape( const TensorShape &shape1,
+                                               const TensorShape &shape2 )
 {
     TensorShape output;
     auto it1 = shape1.rbegin();
@@ -90,9 +91,9 @@ TensorShape getMultidirectionalBroadcastShape( TensorShape shape1, TensorShape s
  * @brief Broadcasts the provided indices into those into the current tensor shape
  * from indices in the desired broadcast shape.
  */
-TensorIndices broadcastIndex( TensorShape currentShape,
-                              TensorShape broadcastShape,
-                              TensorIndices broadcastIndices )
+TensorIndices broadcastIndex( const TensorShape &currentShape,
+                              const TensorShape &broadcastShape,
+                              const TensorIndices &broadcastIndices )
 {
     ASSERT( broadcastIndices.size() == broadcastShape.size() );
 
@@ -51,18 +51,20 @@ typedef TensorIndex PackedTensorIndices;
 
 typedef Vector<unsigned int> Permutation;
 
-TensorIndices unpackIndex( TensorShape shape, PackedTensorIndices packedIndex );
+TensorIndices unpackIndex( const TensorShape &shape, PackedTensorIndices packedIndex );
 
-PackedTensorIndices packIndex( TensorShape shape, TensorIndices indices );
+PackedTensorIndices packIndex( const TensorShape &shape, const TensorIndices &indices );
 
-unsigned int tensorSize( TensorShape shape );
+unsigned int tensorSize( const TensorShape &shape );
 
-template <typename T> T tensorLookup( Vector<T> tensor, TensorShape shape, TensorIndices indices )
+template <typename T>
+T tensorLookup( const Vector<T> &tensor, const TensorShape &shape, const TensorIndices &indices )
 {
     return tensor[packIndex( shape, indices )];
 }
 
-template <typename T> Vector<T> transposeVector( Vector<T> values, Permutation permutation )
+template <typename T>
+Vector<T> transposeVector( const Vector<T> &values, const Permutation &permutation )
 {
     Vector<T> result;
     for ( unsigned int i : permutation )
@@ -74,7 +76,9 @@ template <typename T> Vector<T> transposeVector( Vector<T> values, Permutation p
 }
 
 template <typename T>
-Vector<T> transposeTensor( Vector<T> tensor, TensorShape shape, Permutation permutation )
+Vector<T> transposeTensor( const Vector<T> &tensor,
+                           const TensorShape &shape,
+                           const Permutation &permutation )
 {
     // NOTE this implementation is *very* inefficient. Eventually we might want to
     // switch to a similar implementation as NumPy arrays with internal strides etc.
@@ -94,11 +98,12 @@ Vector<T> transposeTensor( Vector<T> tensor, TensorShape shape, Permutation perm
 }
 
 // See https://github.com/onnx/onnx/blob/main/docs/Broadcasting.md#multidirectional-broadcasting
-TensorShape getMultidirectionalBroadcastShape( TensorShape shape1, TensorShape shape2 );
+TensorShape getMultidirectionalBroadcastShape( const TensorShape &shape1,
+                                               const TensorShape &shape2 );
 
-TensorIndices broadcastIndex( TensorShape currentShape,
-                              TensorShape broadcastShape,
-                              TensorIndices broadcastIndices );
+TensorIndices broadcastIndex( const TensorShape &currentShape,
+                              const TensorShape &broadcastShape,
+                              const TensorIndices &broadcastIndices );
 
 TensorIndex unsignIndex( unsigned int size, SignedTensorIndex signedIndex );
 
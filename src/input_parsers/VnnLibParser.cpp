@@ -70,6 +70,11 @@ static String readVnnlibFile( const String &vnnlibFilePath )
     return vnnlibContent;
 }
 
+VnnLibParser::VnnLibParser()
+    : _topLevelDisjuncts( NULL )
+{
+}
+
 void VnnLibParser::parse( const String &vnnlibFilePath, IQuery &inputQuery )
 {
     String vnnlibContent = readVnnlibFile( vnnlibFilePath );
@@ -77,6 +82,18 @@ void VnnLibParser::parse( const String &vnnlibFilePath, IQuery &inputQuery )
     parseVnnlib( vnnlibContent, inputQuery );
 }
 
+void VnnLibParser::parse( const String &vnnlibFilePath,
+                          IQuery &inputQuery,
+                          List<PiecewiseLinearCaseSplit> &topLevelDisjuncts )
+{
+    String vnnlibContent = readVnnlibFile( vnnlibFilePath );
+
+    topLevelDisjuncts.clear();
+    _topLevelDisjuncts = &topLevelDisjuncts;
+    parseVnnlib( vnnlibContent, inputQuery );
+    _topLevelDisjuncts = NULL;
+}
+
 void VnnLibParser::parseVnnlib( const String &vnnlibContent, IQuery &inputQuery )
 {
     boost::regex re( R"(\(|\)|[\w\-\\.]+|<=|>=|\+|-|\*)" );
@@ -281,7 +298,10 @@ int VnnLibParser::parseAssert( int index, const Vector<String> &tokens, IQuery &
             disjunctList.append( split );
         }
 
-        inputQuery.addPiecewiseLinearConstraint( new DisjunctionConstraint( disjunctList ) );
+        if ( _topLevelDisjuncts && _topLevelDisjuncts->empty() && !disjunctList.empty() )
+            *_topLevelDisjuncts = disjunctList;
+        else
+            inputQuery.addPiecewiseLinearConstraint( new DisjunctionConstraint( disjunctList ) );
         ++index;
     }
     else
@@ -17,15 +17,30 @@
 #define _VnnLibParser_h_
 
 #include "IQuery.h"
+#include "List.h"
 #include "MString.h"
 #include "Map.h"
+#include "PiecewiseLinearCaseSplit.h"
 #include "Vector.h"
 
 class VnnLibParser
 {
 public:
+    VnnLibParser();
+
     void parse( const String &vnnlibFilePath, IQuery &inputQuery );
 
+    /*
+      Parse the property, but instead of adding the first top-level
+      disjunction to the query as a DisjunctionConstraint, store its
+      disjuncts in topLevelDisjuncts. The property holds iff the query
+      holds together with one of the disjuncts, so each of them can be
+      solved as a separate sub-query.
+    */
+    void parse( const String &vnnlibFilePath,
+                IQuery &inputQuery,
+                List<PiecewiseLinearCaseSplit> &topLevelDisjuncts );
+
 private:
     class Term
     {
@@ -45,6 +60,12 @@ private:
 
     Map<String, unsigned int> _varMap;
 
+    /*
+      Where to store the disjuncts of the first top-level disjunction, or
+      NULL if it should be added to the query as a constraint
+    */
+    List<PiecewiseLinearCaseSplit> *_topLevelDisjuncts;
+
     void parseVnnlib( const String &vnnlibContent, IQuery &inputQuery );
 
     int parseScript( const Vector<String> &tokens, IQuery &inputQuery );
@@ -15,9 +15,11 @@
 #include "Engine.h"
 #include "InputQuery.h"
 #include "OnnxParser.h"
+#include "onnx.proto3.pb.h"
 
 #include <cxxtest/TestSuite.h>
 #include <filesystem>
+#include <fstream>
 
 class OnnxParserTestSuite : public CxxTest::TestSuite
 {
@@ -55,6 +57,13 @@ public:
             throw MarabouError( MarabouError::FILE_DOESNT_EXIST, networkPath.ascii() );
         }
 
+        run_test_on_file( networkPath, inputValues, expectedOutputValues );
+    }
+
+    void run_test_on_file( String networkPath,
+                           Vector<double> inputValues,
+                           Vector<double> expectedOutputValues )
+    {
         InputQueryBuilder queryBuilder;
         TS_ASSERT_THROWS_NOTHING( OnnxParser::parse( queryBuilder, networkPath, {}, {} ) );
 
@@ -443,4 +452,77 @@ public:
     {
         expect_error( "dropout_training_mode_true" );
     }
+
+    static void addTensorInfo( onnx::ValueInfoProto *info, String name, Vector<int> dims )
+    {
+        info->set_name( name.ascii() );
+        onnx::TypeProto_Tensor *tensorType = info->mutable_type()->mutable_tensor_type();
+        tensorType->set_elem_type( onnx::TensorProto_DataType_FLOAT );
+        for ( int dim : dims )
+            tensorType->mutable_shape()->add_dim()->set_dim_value( dim );
+    }
+
+    static void addNode( onnx::GraphProto *graph, String type, Vector<String> inputs, String output )
+    {
+        onnx::NodeProto *node = graph->add_node();
+        node->set_op_type( type.ascii() );
+        for ( const String &input : inputs )
+            node->add_input( input.ascii() );
+        node->add_output( output.ascii() );
+    }
+
+    void test_long_chain_of_nodes()
+    {
+        /*
+          x -> Identity -> ... -> Identity -> Gemm( ., Identity( W ), b ) -> y
+
+          The chain is deeper than a recursive traversal could handle, and
+          the nodes are stored in reverse order of evaluation.
+        */
+        unsigned chainLength = 50000;
+
+        onnx::ModelProto model;
+        model.set_ir_version( 8 );
+        model.add_opset_import()->set_version( 13 );
+        onnx::GraphProto *graph = model.mutable_graph();
+
+        addTensorInfo( graph->add_input(), "x", { 1, 2 } );
+        addTensorInfo( graph->add_output(), "y", { 1, 2 } );
+
+        onnx::TensorProto *weights = graph->add_initializer();
+        weights->set_name( "W" );
+        weights->set_data_type( onnx::TensorProto_DataType_FLOAT );
+        weights->add_dims( 2 );
+        weights->add_dims( 2 );
+        for ( float value : { 1, 2, 3, 4 } )
+            weights->add_float_data( value );
+
+        onnx::TensorProto *biases = graph->add_initializer();
+        biases->set_name( "b" );
+        biases->set_data_type( onnx::TensorProto_DataType_FLOAT );
+        biases->add_dims( 2 );
+        for ( float value : { 0.5, -1.0 } )
+            biases->add_float_data( value );
+
+        addNode( graph, "Gemm", { Stringf( "h%u", chainLength ), "W2", "b" }, "y" );
+        addNode( graph, "Identity", { "W" }, "W2" );
+        for ( unsigned i = chainLength; i > 0; --i )
+            addNode( graph,
+                     "Identity",
+                     { i == 1 ? String( "x" ) : Stringf( "h%u", i - 1 ) },
+                     Stringf( "h%u", i ) );
+
+        String networkPath =
+            ( std::filesystem::temp_directory_path() / "marabou_onnx_chain_test.onnx" ).c_str();
+        std::ofstream output( networkPath.ascii(), std::ios::binary );
+        TS_ASSERT( model.SerializeToOstream( &output ) );
+        output.close();
+
+        // [ 1 2 ] * | 1 2 | + [ 0.5 -1 ] = [ 7.5 9 ]
+        //           | 3 4 |
+        run_test_on_file( networkPath, { 1, 2 }, { 7.5, 9 } );
+
+        std::filesystem::remove( networkPath.ascii() );
+    }
 };
+
@@ -12,8 +12,11 @@
  ** Unit tests for the VnnLibParser class.
  **/
 
+#include "DnCManager.h"
 #include "Engine.h"
+#include "FloatUtils.h"
 #include "OnnxParser.h"
+#include "Options.h"
 #include "Query.h"
 #include "VnnLibParser.h"
 
@@ -49,6 +52,37 @@ public:
         TS_ASSERT_THROWS_NOTHING( VnnLibParser().parse( queryPath, *_query ) );
     }
 
+    void parseWithDisjuncts( String vnnlibFile,
+                             String onnxFile,
+                             List<PiecewiseLinearCaseSplit> &disjuncts )
+    {
+        String queryPath = Stringf( "%s/%s", RESOURCES_DIR "/onnx/vnnlib", vnnlibFile.ascii() );
+        String onnxPath = Stringf( "%s/%s", RESOURCES_DIR "/onnx/vnnlib", onnxFile.ascii() );
+
+        InputQueryBuilder queryBuilder;
+        TS_ASSERT_THROWS_NOTHING( OnnxParser::parse( queryBuilder, onnxPath, {}, {} ) );
+        queryBuilder.generateQuery( *_query );
+        TS_ASSERT_THROWS_NOTHING( VnnLibParser().parse( queryPath, *_query, disjuncts ) );
+    }
+
+    DnCManager::DnCExitCode solveDisjuncts( const List<PiecewiseLinearCaseSplit> &disjuncts )
+    {
+        int numWorkers = Options::get()->getInt( Options::NUM_WORKERS );
+        int verbosity = Options::get()->getInt( Options::VERBOSITY );
+        Options::get()->setInt( Options::NUM_WORKERS, 2 );
+        Options::get()->setInt( Options::VERBOSITY, 0 );
+
+        DnCManager dncManager( _query );
+        dncManager.setTopLevelDisjuncts( disjuncts );
+        TS_ASSERT_THROWS_NOTHING( dncManager.solve() );
+        if ( dncManager.getExitCode() == DnCManager::SAT )
+            dncManager.extractSolution( *_query );
+
+        Options::get()->setInt( Options::NUM_WORKERS, numWorkers );
+        Options::get()->setInt( Options::VERBOSITY, verbosity );
+        return dncManager.getExitCode();
+    }
+
     void test_nano_vnncomp()
     {
         parse( "test_nano_vnncomp.vnnlib", "test_nano_vnncomp.onnx" );
@@ -260,6 +294,54 @@ public:
         TS_ASSERT( engine.getExitCode() == Engine::ExitCode::UNSAT )
     }
 
+    void test_top_level_disjuncts()
+    {
+        List<PiecewiseLinearCaseSplit> disjuncts;
+        parseWithDisjuncts( "test_disjuncts_vnncomp.vnnlib", "test_sat_vnncomp.onnx", disjuncts );
+
+        // The disjunction is not added to the query
+        for ( const auto &constraint : _query->getPiecewiseLinearConstraints() )
+            TS_ASSERT( constraint->getType() != DISJUNCTION );
+
+        unsigned int input3 = _query->inputVariableByIndex( 3 );
+        TS_ASSERT_EQUALS( disjuncts.size(), 3U );
+
+        PiecewiseLinearCaseSplit expectedDisjunct;
+        expectedDisjunct.storeBoundTightening( Tightening( input3, 0.3, Tightening::LB ) );
+        expectedDisjunct.storeBoundTightening( Tightening( input3, 0.4, Tightening::UB ) );
+        TS_ASSERT( disjuncts.front() == expectedDisjunct );
+
+        expectedDisjunct = PiecewiseLinearCaseSplit();
+        expectedDisjunct.storeBoundTightening( Tightening( input3, 0.4, Tightening::LB ) );
+        expectedDisjunct.storeBoundTightening( Tightening( input3, 0.5, Tightening::UB ) );
+        TS_ASSERT( disjuncts.back() == expectedDisjunct );
+    }
+
+    void test_solve_top_level_disjuncts_sat()
+    {
+        List<PiecewiseLinearCaseSplit> disjuncts;
+        parseWithDisjuncts( "test_disjuncts_vnncomp.vnnlib", "test_sat_vnncomp.onnx", disjuncts );
+
+        TS_ASSERT_EQUALS( solveDisjuncts( disjuncts ), DnCManager::SAT );
+
+        // The solution satisfies one of the feasible disjuncts
+        double input3 = _query->getSolutionValue( _query->inputVariableByIndex( 3 ) );
+        TS_ASSERT( FloatUtils::gte( input3, 0.3 ) && FloatUtils::lte( input3, 0.5 ) );
+        double output0 = _query->getSolutionValue( _query->outputVariableByIndex( 0 ) );
+        for ( unsigned i = 1; i < 5; ++i )
+            TS_ASSERT( FloatUtils::lte(
+                output0, _query->getSolutionValue( _query->outputVariableByIndex( i ) ) ) );
+    }
+
+    void test_solve_top_level_disjuncts_unsat()
+    {
+        List<PiecewiseLinearCaseSplit> disjuncts;
+        parseWithDisjuncts(
+            "test_disjuncts_vnncomp.vnnlib", "test_unsat_vnncomp.onnx", disjuncts );
+
+        TS_ASSERT_EQUALS( solveDisjuncts( disjuncts ), DnCManager::UNSAT );
+    }
+
     void test_add_const()
     {
         parse( "test_add_const.vnnlib", "test_nano_vnncomp.onnx" );
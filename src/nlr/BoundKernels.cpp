@@ -0,0 +1,415 @@
+/*********************                                                        */
+/*! \file BoundKernels.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "BoundKernels.h"
+
+#include "NLRError.h"
+
+#include <atomic>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define BOUND_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace NLR {
+
+/*
+  Scalar kernels
+*/
+
+static inline void addIntervalTimesRowScalar( const double *row,
+                                              double lb,
+                                              double ub,
+                                              unsigned begin,
+                                              unsigned end,
+                                              double *resultLb,
+                                              double *resultUb )
+{
+    for ( unsigned j = begin; j < end; ++j )
+    {
+        double entry = row[j];
+        if ( entry > 0 )
+        {
+            resultLb[j] += entry * lb;
+            resultUb[j] += entry * ub;
+        }
+        else
+        {
+            resultLb[j] += entry * ub;
+            resultUb[j] += entry * lb;
+        }
+    }
+}
+
+static inline void addSymbolicRowScalar( double symbolicLb,
+                                         double symbolicUb,
+                                         const double *positiveRow,
+                                         const double *negativeRow,
+                                         unsigned begin,
+                                         unsigned end,
+                                         double *resultLb,
+                                         double *resultUb )
+{
+    for ( unsigned j = begin; j < end; ++j )
+    {
+        resultLb[j] += symbolicLb * positiveRow[j] + symbolicUb * negativeRow[j];
+        resultUb[j] += symbolicUb * positiveRow[j] + symbolicLb * negativeRow[j];
+    }
+}
+
+static void addIntervalTimesMatrixScalar( const double *matrix,
+                                          unsigned rows,
+                                          unsigned columns,
+                                          const double *lb,
+                                          const double *ub,
+                                          double *resultLb,
+                                          double *resultUb )
+{
+    for ( unsigned i = 0; i < rows; ++i )
+        addIntervalTimesRowScalar(
+            matrix + i * columns, lb[i], ub[i], 0, columns, resultLb, resultUb );
+}
+
+static void addSymbolicBoundsTimesWeightsScalar( const double *symbolicLb,
+                                                 const double *symbolicUb,
+                                                 const double *positiveWeights,
+                                                 const double *negativeWeights,
+                                                 unsigned rows,
+                                                 unsigned sourceSize,
+                                                 unsigned targetSize,
+                                                 double *resultLb,
+                                                 double *resultUb )
+{
+    for ( unsigned r = 0; r < rows; ++r )
+    {
+        for ( unsigned i = 0; i < sourceSize; ++i )
+        {
+            double lb = symbolicLb[r * sourceSize + i];
+            double ub = symbolicUb[r * sourceSize + i];
+            if ( lb == 0 && ub == 0 )
+                continue;
+
+            addSymbolicRowScalar( lb,
+                                  ub,
+                                  positiveWeights + i * targetSize,
+                                  negativeWeights + i * targetSize,
+                                  0,
+                                  targetSize,
+                                  resultLb + r * targetSize,
+                                  resultUb + r * targetSize );
+        }
+    }
+}
+
+#ifdef BOUND_KERNELS_X86
+
+/*
+  AVX2 kernels, 4 doubles at a time
+*/
+
+__attribute__( ( target( "avx2,fma" ) ) ) static void
+addIntervalTimesMatrixAvx2( const double *matrix,
+                            unsigned rows,
+                            unsigned columns,
+                            const double *lb,
+                            const double *ub,
+                            double *resultLb,
+                            double *resultUb )
+{
+    const __m256d zero = _mm256_setzero_pd();
+
+    for ( unsigned i = 0; i < rows; ++i )
+    {
+        const double *row = matrix + i * columns;
+        __m256d lbi = _mm256_set1_pd( lb[i] );
+        __m256d ubi = _mm256_set1_pd( ub[i] );
+
+        unsigned j = 0;
+        for ( ; j + 4 <= columns; j += 4 )
+        {
+            __m256d entry = _mm256_loadu_pd( row + j );
+            __m256d positive = _mm256_cmp_pd( entry, zero, _CMP_GT_OQ );
+            __m256d forLb = _mm256_blendv_pd( ubi, lbi, positive );
+            __m256d forUb = _mm256_blendv_pd( lbi, ubi, positive );
+
+            _mm256_storeu_pd( resultLb + j,
+                              _mm256_fmadd_pd( entry, forLb, _mm256_loadu_pd( resultLb + j ) ) );
+            _mm256_storeu_pd( resultUb + j,
+                              _mm256_fmadd_pd( entry, forUb, _mm256_loadu_pd( resultUb + j ) ) );
+        }
+
+        addIntervalTimesRowScalar( row, lb[i], ub[i], j, columns, resultLb, resultUb );
+    }
+}
+
+__attribute__( ( target( "avx2,fma" ) ) ) static void
+addSymbolicBoundsTimesWeightsAvx2( const double *symbolicLb,
+                                   const double *symbolicUb,
+                                   const double *positiveWeights,
+                                   const double *negativeWeights,
+                                   unsigned rows,
+                                   unsigned sourceSize,
+                                   unsigned targetSize,
+                                   double *resultLb,
+                                   double *resultUb )
+{
+    for ( unsigned r = 0; r < rows; ++r )
+    {
+        double *lbRow = resultLb + r * targetSize;
+        double *ubRow = resultUb + r * targetSize;
+
+        for ( unsigned i = 0; i < sourceSize; ++i )
+        {
+            double lb = symbolicLb[r * sourceSize + i];
+            double ub = symbolicUb[r * sourceSize + i];
+            if ( lb == 0 && ub == 0 )
+                continue;
+
+            const double *positiveRow = positiveWeights + i * targetSize;
+            const double *negativeRow = negativeWeights + i * targetSize;
+            __m256d lbi = _mm256_set1_pd( lb );
+            __m256d ubi = _mm256_set1_pd( ub );
+
+            unsigned j = 0;
+            for ( ; j + 4 <= targetSize; j += 4 )
+            {
+                __m256d positive = _mm256_loadu_pd( positiveRow + j );
+                __m256d negative = _mm256_loadu_pd( negativeRow + j );
+
+                __m256d newLb = _mm256_loadu_pd( lbRow + j );
+                newLb = _mm256_fmadd_pd( lbi, positive, newLb );
+                newLb = _mm256_fmadd_pd( ubi, negative, newLb );
+                _mm256_storeu_pd( lbRow + j, newLb );
+
+                __m256d newUb = _mm256_loadu_pd( ubRow + j );
+                newUb = _mm256_fmadd_pd( ubi, positive, newUb );
+                newUb = _mm256_fmadd_pd( lbi, negative, newUb );
+                _mm256_storeu_pd( ubRow + j, newUb );
+            }
+
+            addSymbolicRowScalar(
+                lb, ub, positiveRow, negativeRow, j, targetSize, lbRow, ubRow );
+        }
+    }
+}
+
+/*
+  AVX-512 kernels, 8 doubles at a time. The remainder of each row is
+  handled with masked loads and stores.
+*/
+
+__attribute__( ( target( "avx512f" ) ) ) static void
+addIntervalTimesMatrixAvx512( const double *matrix,
+                              unsigned rows,
+                              unsigned columns,
+                              const double *lb,
+                              const double *ub,
+                              double *resultLb,
+                              double *resultUb )
+{
+    const __m512d zero = _mm512_setzero_pd();
+
+    for ( unsigned i = 0; i < rows; ++i )
+    {
+        const double *row = matrix + i * columns;
+        __m512d lbi = _mm512_set1_pd( lb[i] );
+        __m512d ubi = _mm512_set1_pd( ub[i] );
+
+        for ( unsigned j = 0; j < columns; j += 8 )
+        {
+            __mmask8 mask = columns - j >= 8 ? 0xFF : ( 1u << ( columns - j ) ) - 1;
+
+            __m512d entry = _mm512_maskz_loadu_pd( mask, row + j );
+            __mmask8 positive = _mm512_cmp_pd_mask( entry, zero, _CMP_GT_OQ );
+            __m512d forLb = _mm512_mask_blend_pd( positive, ubi, lbi );
+            __m512d forUb = _mm512_mask_blend_pd( positive, lbi, ubi );
+
+            __m512d newLb = _mm512_maskz_loadu_pd( mask, resultLb + j );
+            __m512d newUb = _mm512_maskz_loadu_pd( mask, resultUb + j );
+            _mm512_mask_storeu_pd( resultLb + j, mask, _mm512_fmadd_pd( entry, forLb, newLb ) );
+            _mm512_mask_storeu_pd( resultUb + j, mask, _mm512_fmadd_pd( entry, forUb, newUb ) );
+        }
+    }
+}
+
+__attribute__( ( target( "avx512f" ) ) ) static void
+addSymbolicBoundsTimesWeightsAvx512( const double *symbolicLb,
+                                     const double *symbolicUb,
+                                     const double *positiveWeights,
+                                     const double *negativeWeights,
+                                     unsigned rows,
+                                     unsigned sourceSize,
+                                     unsigned targetSize,
+                                     double *resultLb,
+                                     double *resultUb )
+{
+    for ( unsigned r = 0; r < rows; ++r )
+    {
+        double *lbRow = resultLb + r * targetSize;
+        double *ubRow = resultUb + r * targetSize;
+
+        for ( unsigned i = 0; i < sourceSize; ++i )
+        {
+            double lb = symbolicLb[r * sourceSize + i];
+            double ub = symbolicUb[r * sourceSize + i];
+            if ( lb == 0 && ub == 0 )
+                continue;
+
+            const double *positiveRow = positiveWeights + i * targetSize;
+            const double *negativeRow = negativeWeights + i * targetSize;
+            __m512d lbi = _mm512_set1_pd( lb );
+            __m512d ubi = _mm512_set1_pd( ub );
+
+            for ( unsigned j = 0; j < targetSize; j += 8 )
+            {
+                __mmask8 mask = targetSize - j >= 8 ? 0xFF : ( 1u << ( targetSize - j ) ) - 1;
+
+                __m512d positive = _mm512_maskz_loadu_pd( mask, positiveRow + j );
+                __m512d negative = _mm512_maskz_loadu_pd( mask, negativeRow + j );
+
+                __m512d newLb = _mm512_maskz_loadu_pd( mask, lbRow + j );
+                newLb = _mm512_fmadd_pd( lbi, positive, newLb );
+                newLb = _mm512_fmadd_pd( ubi, negative, newLb );
+                _mm512_mask_storeu_pd( lbRow + j, mask, newLb );
+
+                __m512d newUb = _mm512_maskz_loadu_pd( mask, ubRow + j );
+                newUb = _mm512_fmadd_pd( ubi, positive, newUb );
+                newUb = _mm512_fmadd_pd( lbi, negative, newUb );
+                _mm512_mask_storeu_pd( ubRow + j, mask, newUb );
+            }
+        }
+    }
+}
+
+#endif // BOUND_KERNELS_X86
+
+/*
+  Dispatch
+*/
+
+static std::atomic<unsigned> &currentInstructionSet()
+{
+    static std::atomic<unsigned> instructionSet( BoundKernels::getSupportedInstructionSet() );
+    return instructionSet;
+}
+
+BoundKernels::InstructionSet BoundKernels::getSupportedInstructionSet()
+{
+#ifdef BOUND_KERNELS_X86
+    static InstructionSet supported = []() {
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports( "avx512f" ) )
+            return AVX512;
+        if ( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+            return AVX2;
+        return SCALAR;
+    }();
+    return supported;
+#else
+    return SCALAR;
+#endif
+}
+
+BoundKernels::InstructionSet BoundKernels::getInstructionSet()
+{
+    return (InstructionSet)currentInstructionSet().load();
+}
+
+void BoundKernels::setInstructionSet( InstructionSet instructionSet )
+{
+    if ( instructionSet > getSupportedInstructionSet() )
+        throw NLRError( NLRError::INSTRUCTION_SET_NOT_SUPPORTED );
+
+    currentInstructionSet() = instructionSet;
+}
+
+void BoundKernels::addIntervalTimesMatrix( const double *matrix,
+                                           unsigned rows,
+                                           unsigned columns,
+                                           const double *lb,
+                                           const double *ub,
+                                           double *resultLb,
+                                           double *resultUb )
+{
+    switch ( getInstructionSet() )
+    {
+#ifdef BOUND_KERNELS_X86
+    case AVX512:
+        addIntervalTimesMatrixAvx512( matrix, rows, columns, lb, ub, resultLb, resultUb );
+        break;
+
+    case AVX2:
+        addIntervalTimesMatrixAvx2( matrix, rows, columns, lb, ub, resultLb, resultUb );
+        break;
+#endif
+
+    default:
+        addIntervalTimesMatrixScalar( matrix, rows, columns, lb, ub, resultLb, resultUb );
+        break;
+    }
+}
+
+void BoundKernels::addSymbolicBoundsTimesWeights( const double *symbolicLb,
+                                                  const double *symbolicUb,
+                                                  const double *positiveWeights,
+                                                  const double *negativeWeights,
+                                                  unsigned rows,
+                                                  unsigned sourceSize,
+                                                  unsigned targetSize,
+                                                  double *resultLb,
+                                                  double *resultUb )
+{
+    switch ( getInstructionSet() )
+    {
+#ifdef BOUND_KERNELS_X86
+    case AVX512:
+        addSymbolicBoundsTimesWeightsAvx512( symbolicLb,
+                                             symbolicUb,
+                                             positiveWeights,
+                                             negativeWeights,
+                                             rows,
+                                             sourceSize,
+                                             targetSize,
+                                             resultLb,
+                                             resultUb );
+        break;
+
+    case AVX2:
+        addSymbolicBoundsTimesWeightsAvx2( symbolicLb,
+                                           symbolicUb,
+                                           positiveWeights,
+                                           negativeWeights,
+                                           rows,
+                                           sourceSize,
+                                           targetSize,
+                                           resultLb,
+                                           resultUb );
+        break;
+#endif
+
+    default:
+        addSymbolicBoundsTimesWeightsScalar( symbolicLb,
+                                             symbolicUb,
+                                             positiveWeights,
+                                             negativeWeights,
+                                             rows,
+                                             sourceSize,
+                                             targetSize,
+                                             resultLb,
+                                             resultUb );
+        break;
+    }
+}
+
+} // namespace NLR
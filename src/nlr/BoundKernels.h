@@ -0,0 +1,96 @@
+/*********************                                                        */
+/*! \file BoundKernels.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __BoundKernels_h__
+#define __BoundKernels_h__
+
+namespace NLR {
+
+/*
+  The dense kernels of interval arithmetic and symbolic bound
+  propagation through weighted-sum layers. Every kernel has a scalar
+  implementation, and on x86 also AVX2 and AVX-512 implementations; the
+  widest one that the CPU supports is picked at runtime.
+
+  All matrices are stored in row-major order.
+*/
+class BoundKernels
+{
+public:
+    enum InstructionSet {
+        SCALAR = 0,
+        AVX2 = 1,
+        AVX512 = 2,
+    };
+
+    /*
+      The widest instruction set that is supported by both the build
+      and the CPU
+    */
+    static InstructionSet getSupportedInstructionSet();
+
+    /*
+      The instruction set used by the kernels. By default, this is the
+      supported instruction set; setting it to a wider one than that
+      is an error.
+    */
+    static InstructionSet getInstructionSet();
+    static void setInstructionSet( InstructionSet instructionSet );
+
+    /*
+      matrix is of dimensions rows x columns. Given the bounds lb <= x
+      <= ub on a vector of size rows, add the bounds of x^T * matrix
+      into resultLb and resultUb, which are of size columns:
+
+        resultLb[j] += sum_i ( m[i][j] > 0 ? m[i][j] * lb[i] : m[i][j] * ub[i] )
+        resultUb[j] += sum_i ( m[i][j] > 0 ? m[i][j] * ub[i] : m[i][j] * lb[i] )
+    */
+    static void addIntervalTimesMatrix( const double *matrix,
+                                        unsigned rows,
+                                        unsigned columns,
+                                        const double *lb,
+                                        const double *ub,
+                                        double *resultLb,
+                                        double *resultUb );
+
+    /*
+      symbolicLb and symbolicUb are of dimensions rows x sourceSize,
+      positiveWeights and negativeWeights of dimensions sourceSize x
+      targetSize, and resultLb and resultUb of dimensions rows x
+      targetSize. Compute, in a single pass:
+
+        resultLb += symbolicLb * W^+ + symbolicUb * W^-
+        resultUb += symbolicUb * W^+ + symbolicLb * W^-
+    */
+    static void addSymbolicBoundsTimesWeights( const double *symbolicLb,
+                                               const double *symbolicUb,
+                                               const double *positiveWeights,
+                                               const double *negativeWeights,
+                                               unsigned rows,
+                                               unsigned sourceSize,
+                                               unsigned targetSize,
+                                               double *resultLb,
+                                               double *resultUb );
+};
+
+} // namespace NLR
+
+#endif // __BoundKernels_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -33,6 +33,7 @@
 #include "MStringf.h"
 #include "MatrixMultiplication.h"
 #include "NLRError.h"
+#include "Options.h"
 #include "TimeUtils.h"
 
 #include <boost/thread.hpp>
@@ -59,6 +60,16 @@ DeepPolyAnalysis::DeepPolyAnalysis( LayerOwner *layerOwner )
     }
     _maxLayerSize = maxLayerSize;
 
+    // The softmax element keeps working memory of its own when
+    // back-substituting, so it cannot be shared between threads
+    int numberOfThreads = Options::get()->getInt( Options::NUM_DEEPPOLY_THREADS );
+    _numberOfThreads = numberOfThreads > 1 ? numberOfThreads : 1;
+    for ( const auto &pair : layers )
+    {
+        if ( pair.second->getLayerType() == Layer::SOFTMAX )
+            _numberOfThreads = 1;
+    }
+
     allocateMemory();
     for ( const auto &pair : layers )
     {
@@ -129,6 +140,7 @@ void DeepPolyAnalysis::run()
     deepPolyStart = TimeUtils::sampleMicro();
 
     const Map<unsigned, Layer *> &layers = _layerOwner->getLayerIndexToLayer();
+    _analyzedLayers.clear();
     for ( const auto &pair : layers )
     {
         /*
@@ -139,9 +151,30 @@ void DeepPolyAnalysis::run()
         Layer *layer = pair.second;
 
         ASSERT( _deepPolyElements.exists( index ) );
-        log( Stringf( "Running deeppoly analysis for layer %u...", index ) );
         DeepPolyElement *deepPolyElement = _deepPolyElements[index];
+
+        /*
+          The abstract element of a layer only depends on the bounds of
+          the layer and on the elements of the layers before it. If none
+          of these has changed since the last run, the result of that run
+          still holds.
+        */
+        bool analyze = boundsChangedSinceLastAnalysis( layer );
+        for ( const auto &sourceLayer : layer->getSourceLayers() )
+        {
+            if ( _analyzedLayers.exists( sourceLayer.first ) )
+                analyze = true;
+        }
+
+        if ( !analyze )
+        {
+            log( Stringf( "Bounds of layer %u unchanged, skipping", index ) );
+            continue;
+        }
+
+        log( Stringf( "Running deeppoly analysis for layer %u...", index ) );
         deepPolyElement->execute( _deepPolyElements );
+        _analyzedLayers.insert( index );
 
         // Extract updated bounds
         for ( unsigned j = 0; j < deepPolyElement->getSize(); ++j )
@@ -173,28 +206,75 @@ void DeepPolyAnalysis::run()
                     Tightening( layer->neuronToVariable( j ), ub, Tightening::UB ) );
             }
         }
+        storeAnalyzedBounds( layer );
         log( Stringf( "Running deeppoly analysis for layer %u - done", index ) );
     }
 }
 
+const Set<unsigned> &DeepPolyAnalysis::getAnalyzedLayers() const
+{
+    return _analyzedLayers;
+}
+
+bool DeepPolyAnalysis::boundsChangedSinceLastAnalysis( const Layer *layer ) const
+{
+    unsigned index = layer->getLayerIndex();
+    if ( !_analyzedLbs.exists( index ) )
+        return true;
+
+    const Vector<double> &lbs = _analyzedLbs[index];
+    const Vector<double> &ubs = _analyzedUbs[index];
+    for ( unsigned i = 0; i < layer->getSize(); ++i )
+    {
+        if ( layer->getLb( i ) != lbs[i] || layer->getUb( i ) != ubs[i] )
+            return true;
+    }
+    return false;
+}
+
+void DeepPolyAnalysis::storeAnalyzedBounds( const Layer *layer )
+{
+    unsigned index = layer->getLayerIndex();
+    Vector<double> &lbs = _analyzedLbs[index];
+    Vector<double> &ubs = _analyzedUbs[index];
+    lbs.clear();
+    ubs.clear();
+    for ( unsigned i = 0; i < layer->getSize(); ++i )
+    {
+        lbs.append( layer->getLb( i ) );
+        ubs.append( layer->getUb( i ) );
+    }
+}
+
 void DeepPolyAnalysis::allocateMemory()
 {
     freeMemoryIfNeeded();
-    _work1SymbolicLb = new double[_maxLayerSize * _maxLayerSize];
-    _work1SymbolicUb = new double[_maxLayerSize * _maxLayerSize];
-    _work2SymbolicLb = new double[_maxLayerSize * _maxLayerSize];
-    _work2SymbolicUb = new double[_maxLayerSize * _maxLayerSize];
 
-    _workSymbolicLowerBias = new double[_maxLayerSize];
-    _workSymbolicUpperBias = new double[_maxLayerSize];
+    /*
+      When the back-substitution is divided among threads, every thread
+      works on a slice of the memory. The slices are rounded up, hence
+      the extra room.
+    */
+    unsigned columns = _maxLayerSize;
+    if ( _numberOfThreads > 1 )
+        columns += _numberOfThreads;
+    unsigned matrixSize = _maxLayerSize * columns;
+
+    _work1SymbolicLb = new double[matrixSize];
+    _work1SymbolicUb = new double[matrixSize];
+    _work2SymbolicLb = new double[matrixSize];
+    _work2SymbolicUb = new double[matrixSize];
+
+    _workSymbolicLowerBias = new double[columns];
+    _workSymbolicUpperBias = new double[columns];
 
-    std::fill_n( _work1SymbolicLb, _maxLayerSize * _maxLayerSize, 0 );
-    std::fill_n( _work1SymbolicUb, _maxLayerSize * _maxLayerSize, 0 );
-    std::fill_n( _work2SymbolicLb, _maxLayerSize * _maxLayerSize, 0 );
-    std::fill_n( _work2SymbolicUb, _maxLayerSize * _maxLayerSize, 0 );
+    std::fill_n( _work1SymbolicLb, matrixSize, 0 );
+    std::fill_n( _work1SymbolicUb, matrixSize, 0 );
+    std::fill_n( _work2SymbolicLb, matrixSize, 0 );
+    std::fill_n( _work2SymbolicUb, matrixSize, 0 );
 
-    std::fill_n( _workSymbolicLowerBias, _maxLayerSize, 0 );
-    std::fill_n( _workSymbolicUpperBias, _maxLayerSize, 0 );
+    std::fill_n( _workSymbolicLowerBias, columns, 0 );
+    std::fill_n( _workSymbolicUpperBias, columns, 0 );
 }
 
 DeepPolyElement *DeepPolyAnalysis::createDeepPolyElement( Layer *layer )
@@ -205,14 +285,17 @@ DeepPolyElement *DeepPolyAnalysis::createDeepPolyElement( Layer *layer )
         deepPolyElement = new DeepPolyInputElement( layer );
     else if ( type == Layer::WEIGHTED_SUM )
     {
-        deepPolyElement = new DeepPolyWeightedSumElement( layer );
+        DeepPolyWeightedSumElement *weightedSumElement = new DeepPolyWeightedSumElement( layer );
         // Weighted sum layers need working memory for back substitution
-        deepPolyElement->setWorkingMemory( _work1SymbolicLb,
-                                           _work1SymbolicUb,
-                                           _work2SymbolicLb,
-                                           _work2SymbolicUb,
-                                           _workSymbolicLowerBias,
-                                           _workSymbolicUpperBias );
+        weightedSumElement->setWorkingMemory( _work1SymbolicLb,
+                                              _work1SymbolicUb,
+                                              _work2SymbolicLb,
+                                              _work2SymbolicUb,
+                                              _workSymbolicLowerBias,
+                                              _workSymbolicUpperBias );
+        if ( _numberOfThreads > 1 )
+            weightedSumElement->setNumberOfThreads( _numberOfThreads, _maxLayerSize );
+        deepPolyElement = weightedSumElement;
     }
     else if ( type == Layer::RELU )
         deepPolyElement = new DeepPolyReLUElement( layer );
@@ -20,6 +20,8 @@
 #include "Layer.h"
 #include "LayerOwner.h"
 #include "Map.h"
+#include "Set.h"
+#include "Vector.h"
 
 #include <climits>
 
@@ -33,6 +35,12 @@ public:
 
     void run();
 
+    /*
+      The indices of the layers that the last call to run() analyzed,
+      as opposed to those whose abstract elements were reused
+    */
+    const Set<unsigned> &getAnalyzedLayers() const;
+
 private:
     LayerOwner *_layerOwner;
 
@@ -53,9 +61,28 @@ private:
 
     unsigned _maxLayerSize;
 
+    /*
+      The number of threads among which the back-substitution of each
+      weighted sum layer is divided
+    */
+    unsigned _numberOfThreads;
+
+    /*
+      The bounds of every layer when it was last analyzed. A layer is
+      only analyzed again if its bounds have changed since, or if one of
+      its source layers has been analyzed again; otherwise, its abstract
+      element (including its symbolic bounds) is reused as is.
+    */
+    Map<unsigned, Vector<double>> _analyzedLbs;
+    Map<unsigned, Vector<double>> _analyzedUbs;
+    Set<unsigned> _analyzedLayers;
+
     void allocateMemory();
     void freeMemoryIfNeeded();
 
+    bool boundsChangedSinceLastAnalysis( const Layer *layer ) const;
+    void storeAnalyzedBounds( const Layer *layer );
+
     DeepPolyElement *createDeepPolyElement( Layer *layer );
 
     void log( const String &message );
@@ -17,13 +17,15 @@
 
 #include "FloatUtils.h"
 
+#include <boost/thread.hpp>
+#include <exception>
 #include <string.h>
 
 namespace NLR {
 
 DeepPolyWeightedSumElement::DeepPolyWeightedSumElement( Layer *layer )
-    : _workLb( NULL )
-    , _workUb( NULL )
+    : _numberOfThreads( 1 )
+    , _maxLayerSize( 0 )
 {
     _layer = layer;
     _size = layer->getSize();
@@ -35,6 +37,14 @@ DeepPolyWeightedSumElement::~DeepPolyWeightedSumElement()
     freeMemoryIfNeeded();
 }
 
+void DeepPolyWeightedSumElement::setNumberOfThreads( unsigned numberOfThreads,
+                                                     unsigned maxLayerSize )
+{
+    ASSERT( numberOfThreads > 0 );
+    _numberOfThreads = numberOfThreads;
+    _maxLayerSize = maxLayerSize;
+}
+
 void DeepPolyWeightedSumElement::execute(
     const Map<unsigned, DeepPolyElement *> &deepPolyElementsBefore )
 {
@@ -52,6 +62,95 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution(
 {
     log( "Computing bounds with back substitution..." );
 
+    unsigned numberOfBlocks = 1;
+    if ( _numberOfThreads > 1 )
+        numberOfBlocks = std::min( _numberOfThreads,
+                                   _size / GlobalConfiguration::DEEPPOLY_MIN_NEURONS_PER_THREAD );
+
+    if ( numberOfBlocks <= 1 )
+    {
+        BackSubstitutionBlock block;
+        block._firstNeuron = 0;
+        block._size = _size;
+        block._work1SymbolicLb = _work1SymbolicLb;
+        block._work1SymbolicUb = _work1SymbolicUb;
+        block._work2SymbolicLb = _work2SymbolicLb;
+        block._work2SymbolicUb = _work2SymbolicUb;
+        block._workSymbolicLowerBias = _workSymbolicLowerBias;
+        block._workSymbolicUpperBias = _workSymbolicUpperBias;
+
+        allocateBlockMemory( block );
+        computeBoundWithBackSubstitution( block, deepPolyElementsBefore );
+        freeBlockMemory( block );
+
+        log( "Computing bounds with back substitution - done" );
+        return;
+    }
+
+    // Divide the neurons into blocks, and the working memory between them
+    unsigned blockSize = ( _size + numberOfBlocks - 1 ) / numberOfBlocks;
+    numberOfBlocks = ( _size + blockSize - 1 ) / blockSize;
+    ASSERT( numberOfBlocks <= _numberOfThreads );
+
+    Vector<BackSubstitutionBlock> blocks( numberOfBlocks );
+    for ( unsigned i = 0; i < numberOfBlocks; ++i )
+    {
+        BackSubstitutionBlock &block = blocks[i];
+        block._firstNeuron = i * blockSize;
+        block._size = std::min( blockSize, _size - block._firstNeuron );
+
+        unsigned matrixOffset = i * blockSize * _maxLayerSize;
+        block._work1SymbolicLb = _work1SymbolicLb + matrixOffset;
+        block._work1SymbolicUb = _work1SymbolicUb + matrixOffset;
+        block._work2SymbolicLb = _work2SymbolicLb + matrixOffset;
+        block._work2SymbolicUb = _work2SymbolicUb + matrixOffset;
+        block._workSymbolicLowerBias = _workSymbolicLowerBias + i * blockSize;
+        block._workSymbolicUpperBias = _workSymbolicUpperBias + i * blockSize;
+
+        allocateBlockMemory( block );
+    }
+
+    // Run the first block on this thread, and the rest on new threads
+    Vector<std::exception_ptr> errors( numberOfBlocks, nullptr );
+    auto computeBlock = [&]( unsigned i ) {
+        try
+        {
+            computeBoundWithBackSubstitution( blocks[i], deepPolyElementsBefore );
+        }
+        catch ( ... )
+        {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    Vector<boost::thread *> threads;
+    for ( unsigned i = 1; i < numberOfBlocks; ++i )
+        threads.append( new boost::thread( computeBlock, i ) );
+
+    computeBlock( 0 );
+
+    for ( const auto &thread : threads )
+    {
+        thread->join();
+        delete thread;
+    }
+
+    for ( auto &block : blocks )
+        freeBlockMemory( block );
+
+    for ( const auto &error : errors )
+    {
+        if ( error )
+            std::rethrow_exception( error );
+    }
+
+    log( "Computing bounds with back substitution - done" );
+}
+
+void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution(
+    BackSubstitutionBlock &block,
+    const Map<unsigned, DeepPolyElement *> &deepPolyElementsBefore )
+{
     // Start with the symbolic upper-/lower- bounds of this layer with
     // respect to its immediate predecessor.
     Map<unsigned, unsigned> predecessorIndices = getPredecessorIndices();
@@ -64,6 +163,9 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution(
     //                _work1SymbolicUb * currentElement + _workSymbolicUpperBias;
     // thisLayer >= ( residualLb * residualLayer for each residualLayer ) +
     //                _work1SymbolicLb * currentElement + _workSymbolicLowerBias;
+    //
+    // All symbolic bounds are restricted to the neurons of the block, i.e.,
+    // they have block._size columns.
 
     unsigned predecessorIndex = 0;
     for ( const auto &pair : predecessorIndices )
@@ -72,12 +174,11 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution(
         if ( counter < numPredecessors - 1 )
         {
             log( Stringf( "Adding residual from layer %u...", predecessorIndex ) );
-            allocateMemoryForResidualsIfNeeded( predecessorIndex, pair.second );
-            const double *weights = _layer->getWeights( predecessorIndex );
-            memcpy(
-                _residualLb[predecessorIndex], weights, _size * pair.second * sizeof( double ) );
-            memcpy(
-                _residualUb[predecessorIndex], weights, _size * pair.second * sizeof( double ) );
+            allocateMemoryForResidualsIfNeeded( block, predecessorIndex, pair.second );
+            getWeightsForBlock( predecessorIndex, block, block._residualLb[predecessorIndex] );
+            memcpy( block._residualUb[predecessorIndex],
+                    block._residualLb[predecessorIndex],
+                    block._size * pair.second * sizeof( double ) );
             ++counter;
             log( Stringf( "Adding residual from layer %u - done", pair.first ) );
         }
@@ -87,24 +188,26 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution(
     DeepPolyElement *precedingElement = deepPolyElementsBefore[predecessorIndex];
     unsigned sourceLayerSize = precedingElement->getSize();
 
-    const double *weights = _layer->getWeights( predecessorIndex );
-    memcpy( _work1SymbolicLb, weights, _size * sourceLayerSize * sizeof( double ) );
-    memcpy( _work1SymbolicUb, weights, _size * sourceLayerSize * sizeof( double ) );
+    getWeightsForBlock( predecessorIndex, block, block._work1SymbolicLb );
+    memcpy( block._work1SymbolicUb,
+            block._work1SymbolicLb,
+            block._size * sourceLayerSize * sizeof( double ) );
 
-    double *bias = _layer->getBiases();
-    memcpy( _workSymbolicLowerBias, bias, _size * sizeof( double ) );
-    memcpy( _workSymbolicUpperBias, bias, _size * sizeof( double ) );
+    double *bias = _layer->getBiases() + block._firstNeuron;
+    memcpy( block._workSymbolicLowerBias, bias, block._size * sizeof( double ) );
+    memcpy( block._workSymbolicUpperBias, bias, block._size * sizeof( double ) );
 
     DeepPolyElement *currentElement = precedingElement;
-    concretizeSymbolicBound( _work1SymbolicLb,
-                             _work1SymbolicUb,
-                             _workSymbolicLowerBias,
-                             _workSymbolicUpperBias,
+    concretizeSymbolicBound( block,
+                             block._work1SymbolicLb,
+                             block._work1SymbolicUb,
+                             block._workSymbolicLowerBias,
+                             block._workSymbolicUpperBias,
                              currentElement,
                              deepPolyElementsBefore );
     log( Stringf( "Computing symbolic bounds with respect to layer %u - done", predecessorIndex ) );
 
-    while ( currentElement->hasPredecessor() || !_residualLayerIndices.empty() )
+    while ( currentElement->hasPredecessor() || !block._residualLayerIndices.empty() )
     {
         // We have the symbolic bounds in terms of the current abstract
         // element--currentElement, stored in _work1SymbolicLb,
@@ -127,31 +230,32 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution(
                 {
                     unsigned predecessorIndex = pair.first;
                     log( Stringf( "Adding residual from layer %u...", predecessorIndex ) );
-                    allocateMemoryForResidualsIfNeeded( predecessorIndex, pair.second );
+                    allocateMemoryForResidualsIfNeeded( block, predecessorIndex, pair.second );
                     // Do we need to add bias here?
                     currentElement->symbolicBoundInTermsOfPredecessor(
-                        _work1SymbolicLb,
-                        _work1SymbolicUb,
+                        block._work1SymbolicLb,
+                        block._work1SymbolicUb,
                         NULL,
                         NULL,
-                        _residualLb[predecessorIndex],
-                        _residualUb[predecessorIndex],
-                        _size,
+                        block._residualLb[predecessorIndex],
+                        block._residualUb[predecessorIndex],
+                        block._size,
                         precedingElement );
                     ++counter;
                     log( Stringf( "Adding residual from layer %u - done", pair.first ) );
                 }
             }
 
-            std::fill_n( _work2SymbolicLb, _size * precedingElement->getSize(), 0 );
-            std::fill_n( _work2SymbolicUb, _size * precedingElement->getSize(), 0 );
-            currentElement->symbolicBoundInTermsOfPredecessor( _work1SymbolicLb,
-                                                               _work1SymbolicUb,
-                                                               _workSymbolicLowerBias,
-                                                               _workSymbolicUpperBias,
-                                                               _work2SymbolicLb,
-                                                               _work2SymbolicUb,
-                                                               _size,
+            unsigned matrixSize = block._size * precedingElement->getSize();
+            std::fill_n( block._work2SymbolicLb, matrixSize, 0 );
+            std::fill_n( block._work2SymbolicUb, matrixSize, 0 );
+            currentElement->symbolicBoundInTermsOfPredecessor( block._work1SymbolicLb,
+                                                               block._work1SymbolicUb,
+                                                               block._workSymbolicLowerBias,
+                                                               block._workSymbolicUpperBias,
+                                                               block._work2SymbolicLb,
+                                                               block._work2SymbolicUb,
+                                                               block._size,
                                                                precedingElement );
 
             // The symbolic lower-bound is
@@ -159,57 +263,58 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution(
             // residualLb2 * residualElement2 + ...
             // If the precedingElement is a residual source layer, we can merge
             // in the residualWeights, and remove it from the residual source layers.
-            if ( _residualLayerIndices.exists( predecessorIndex ) )
+            if ( block._residualLayerIndices.exists( predecessorIndex ) )
             {
                 log( Stringf( "merge residual from layer %u...", predecessorIndex ) );
                 // Add weights of this residual layer
-                for ( unsigned i = 0; i < _size * precedingElement->getSize(); ++i )
+                double *residualLb = block._residualLb[predecessorIndex];
+                double *residualUb = block._residualUb[predecessorIndex];
+                for ( unsigned i = 0; i < matrixSize; ++i )
                 {
-                    _work2SymbolicLb[i] += _residualLb[predecessorIndex][i];
-                    _work2SymbolicUb[i] += _residualUb[predecessorIndex][i];
+                    block._work2SymbolicLb[i] += residualLb[i];
+                    block._work2SymbolicUb[i] += residualUb[i];
                 }
-                _residualLayerIndices.erase( predecessorIndex );
-                std::fill_n(
-                    _residualLb[predecessorIndex], _size * precedingElement->getSize(), 0 );
-                std::fill_n(
-                    _residualUb[predecessorIndex], _size * precedingElement->getSize(), 0 );
+                block._residualLayerIndices.erase( predecessorIndex );
+                std::fill_n( residualLb, matrixSize, 0 );
+                std::fill_n( residualUb, matrixSize, 0 );
                 log( Stringf( "merge residual from layer %u - done", predecessorIndex ) );
             }
 
-            double *temp = _work1SymbolicLb;
-            _work1SymbolicLb = _work2SymbolicLb;
-            _work2SymbolicLb = temp;
+            double *temp = block._work1SymbolicLb;
+            block._work1SymbolicLb = block._work2SymbolicLb;
+            block._work2SymbolicLb = temp;
 
-            temp = _work1SymbolicUb;
-            _work1SymbolicUb = _work2SymbolicUb;
-            _work2SymbolicUb = temp;
+            temp = block._work1SymbolicUb;
+            block._work1SymbolicUb = block._work2SymbolicUb;
+            block._work2SymbolicUb = temp;
 
             currentElement = precedingElement;
-            concretizeSymbolicBound( _work1SymbolicLb,
-                                     _work1SymbolicUb,
-                                     _workSymbolicLowerBias,
-                                     _workSymbolicUpperBias,
+            concretizeSymbolicBound( block,
+                                     block._work1SymbolicLb,
+                                     block._work1SymbolicUb,
+                                     block._workSymbolicLowerBias,
+                                     block._workSymbolicUpperBias,
                                      currentElement,
                                      deepPolyElementsBefore );
         }
-        else if ( !_residualLayerIndices.empty() )
+        else if ( !block._residualLayerIndices.empty() )
         {
             // The current element has no predecessor (i.e., it has been pushed to the input layer
             // but there are still elements in the residual layers. In this case, we should swap
             // the first residual element with the current element.
 
             // Add the current element in the residual element
-            unsigned newCurrentIndex = *_residualLayerIndices.begin();
+            unsigned newCurrentIndex = *block._residualLayerIndices.begin();
             unsigned residualIndex = currentElement->getLayerIndex();
             log( Stringf( "Adding layer %u to the residual layer\n", residualIndex ).ascii() );
             ASSERT( residualIndex == 0 );
 
-            allocateMemoryForResidualsIfNeeded( residualIndex, currentElement->getSize() );
-            unsigned matrixSize = currentElement->getSize() * _size;
+            allocateMemoryForResidualsIfNeeded( block, residualIndex, currentElement->getSize() );
+            unsigned matrixSize = currentElement->getSize() * block._size;
             for ( unsigned i = 0; i < matrixSize; ++i )
             {
-                _residualLb[residualIndex][i] += _work1SymbolicLb[i];
-                _residualUb[residualIndex][i] += _work1SymbolicUb[i];
+                block._residualLb[residualIndex][i] += block._work1SymbolicLb[i];
+                block._residualUb[residualIndex][i] += block._work1SymbolicUb[i];
             }
 
             // Make the first residual element the current element and get ready for the next
@@ -218,23 +323,31 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution(
 
             currentElement = deepPolyElementsBefore[newCurrentIndex];
 
-            unsigned currentMatrixSize = currentElement->getSize() * _size;
-            memcpy( _work1SymbolicLb,
-                    _residualLb[newCurrentIndex],
+            unsigned currentMatrixSize = currentElement->getSize() * block._size;
+            memcpy( block._work1SymbolicLb,
+                    block._residualLb[newCurrentIndex],
                     currentMatrixSize * sizeof( double ) );
-            memcpy( _work1SymbolicUb,
-                    _residualUb[newCurrentIndex],
+            memcpy( block._work1SymbolicUb,
+                    block._residualUb[newCurrentIndex],
                     currentMatrixSize * sizeof( double ) );
-            _residualLayerIndices.erase( newCurrentIndex );
-            std::fill_n( _residualLb[newCurrentIndex], currentMatrixSize, 0 );
-            std::fill_n( _residualUb[newCurrentIndex], currentMatrixSize, 0 );
+            block._residualLayerIndices.erase( newCurrentIndex );
+            std::fill_n( block._residualLb[newCurrentIndex], currentMatrixSize, 0 );
+            std::fill_n( block._residualUb[newCurrentIndex], currentMatrixSize, 0 );
         }
     }
-    ASSERT( _residualLayerIndices.empty() );
-    log( "Computing bounds with back substitution - done" );
+    ASSERT( block._residualLayerIndices.empty() );
+}
+
+void DeepPolyWeightedSumElement::getWeightsForBlock( unsigned predecessorIndex,
+                                                     const BackSubstitutionBlock &block,
+                                                     double *result ) const
+{
+    const WeightMatrix *weights = _layer->getWeightMatrix( predecessorIndex );
+    weights->toDenseColumns( block._firstNeuron, block._size, result );
 }
 
 void DeepPolyWeightedSumElement::concretizeSymbolicBound(
+    BackSubstitutionBlock &block,
     const double *symbolicLb,
     const double *symbolicUb,
     double const *symbolicLowerBias,
@@ -243,35 +356,39 @@ void DeepPolyWeightedSumElement::concretizeSymbolicBound(
     const Map<unsigned, DeepPolyElement *> &deepPolyElementsBefore )
 {
     log( "Concretizing bound..." );
-    std::fill_n( _workLb, _size, 0 );
-    std::fill_n( _workUb, _size, 0 );
+    std::fill_n( block._workLb, block._size, 0 );
+    std::fill_n( block._workUb, block._size, 0 );
 
     concretizeSymbolicBoundForSourceLayer(
-        symbolicLb, symbolicUb, symbolicLowerBias, symbolicUpperBias, sourceElement );
+        block, symbolicLb, symbolicUb, symbolicLowerBias, symbolicUpperBias, sourceElement );
 
-    for ( const auto &residualLayerIndex : _residualLayerIndices )
+    for ( const auto &residualLayerIndex : block._residualLayerIndices )
     {
         DeepPolyElement *residualElement = deepPolyElementsBefore[residualLayerIndex];
-        concretizeSymbolicBoundForSourceLayer( _residualLb[residualLayerIndex],
-                                               _residualUb[residualLayerIndex],
+        concretizeSymbolicBoundForSourceLayer( block,
+                                               block._residualLb[residualLayerIndex],
+                                               block._residualUb[residualLayerIndex],
                                                NULL,
                                                NULL,
                                                residualElement );
     }
-    for ( unsigned i = 0; i < _size; ++i )
+    for ( unsigned i = 0; i < block._size; ++i )
     {
-        if ( _lb[i] < _workLb[i] )
-            _lb[i] = _workLb[i];
-        if ( _ub[i] > _workUb[i] )
-            _ub[i] = _workUb[i];
-        log( Stringf( "Neuron%u working LB: %f, UB: %f", i, _workLb[i], _workUb[i] ) );
-        log( Stringf( "Neuron%u LB: %f, UB: %f", i, _lb[i], _ub[i] ) );
+        unsigned neuron = block._firstNeuron + i;
+        if ( _lb[neuron] < block._workLb[i] )
+            _lb[neuron] = block._workLb[i];
+        if ( _ub[neuron] > block._workUb[i] )
+            _ub[neuron] = block._workUb[i];
+        log( Stringf(
+            "Neuron%u working LB: %f, UB: %f", neuron, block._workLb[i], block._workUb[i] ) );
+        log( Stringf( "Neuron%u LB: %f, UB: %f", neuron, _lb[neuron], _ub[neuron] ) );
     }
 
     log( "Concretizing bound - done" );
 }
 
 void DeepPolyWeightedSumElement::concretizeSymbolicBoundForSourceLayer(
+    BackSubstitutionBlock &block,
     const double *symbolicLb,
     const double *symbolicUb,
     const double *symbolicLowerBias,
@@ -337,42 +454,41 @@ void DeepPolyWeightedSumElement::concretizeSymbolicBoundForSourceLayer(
                       sourceLb,
                       sourceUb ) );
 
-        for ( unsigned j = 0; j < _size; ++j )
+        for ( unsigned j = 0; j < block._size; ++j )
         {
             // Compute lower bound
-            double weight = symbolicLb[i * _size + j];
+            double weight = symbolicLb[i * block._size + j];
             if ( weight >= 0 )
             {
-                _workLb[j] += ( weight * sourceLb );
+                block._workLb[j] += ( weight * sourceLb );
             }
             else
             {
-                _workLb[j] += ( weight * sourceUb );
+                block._workLb[j] += ( weight * sourceUb );
             }
 
             // Compute upper bound
-            weight = symbolicUb[i * _size + j];
+            weight = symbolicUb[i * block._size + j];
             if ( weight >= 0 )
             {
-                _workUb[j] += ( weight * sourceUb );
+                block._workUb[j] += ( weight * sourceUb );
             }
             else
             {
-                _workUb[j] += ( weight * sourceLb );
+                block._workUb[j] += ( weight * sourceLb );
             }
         }
     }
 
-    for ( unsigned i = 0; i < _size; ++i )
+    for ( unsigned i = 0; i < block._size; ++i )
     {
         if ( symbolicLowerBias )
-            _workLb[i] += symbolicLowerBias[i];
+            block._workLb[i] += symbolicLowerBias[i];
         if ( symbolicUpperBias )
-            _workUb[i] += symbolicUpperBias[i];
+            block._workUb[i] += symbolicUpperBias[i];
     }
 }
 
-
 void DeepPolyWeightedSumElement::symbolicBoundInTermsOfPredecessor(
     const double *symbolicLb,
     const double *symbolicUb,
@@ -385,25 +501,15 @@ void DeepPolyWeightedSumElement::symbolicBoundInTermsOfPredecessor(
 {
     unsigned predecessorIndex = predecessor->getLayerIndex();
     log( Stringf( "Computing symbolic bounds with respect to layer %u...", predecessorIndex ) );
-    unsigned predecessorSize = predecessor->getSize();
 
-    double *weights = _layer->getWeights( predecessorIndex );
+    const WeightMatrix *weights = _layer->getWeightMatrix( predecessorIndex );
     double *biases = _layer->getBiases();
+    ASSERT( weights->getSourceSize() == predecessor->getSize() );
 
     // newSymbolicLb = weights * symbolicLb
     // newSymbolicUb = weights * symbolicUb
-    matrixMultiplication( weights,
-                          symbolicLb,
-                          symbolicLbInTermsOfPredecessor,
-                          predecessorSize,
-                          _size,
-                          targetLayerSize );
-    matrixMultiplication( weights,
-                          symbolicUb,
-                          symbolicUbInTermsOfPredecessor,
-                          predecessorSize,
-                          _size,
-                          targetLayerSize );
+    weights->addWeightsTimesMatrix( symbolicLb, targetLayerSize, symbolicLbInTermsOfPredecessor );
+    weights->addWeightsTimesMatrix( symbolicUb, targetLayerSize, symbolicUbInTermsOfPredecessor );
 
     // symbolicLowerBias = biases * symbolicLb
     // symbolicUpperBias = biases * symbolicUb
@@ -414,62 +520,71 @@ void DeepPolyWeightedSumElement::symbolicBoundInTermsOfPredecessor(
     log( Stringf( "Computing symbolic bounds with respect to layer %u - done", predecessorIndex ) );
 }
 
-void DeepPolyWeightedSumElement::allocateMemoryForResidualsIfNeeded( unsigned residualLayerIndex,
-                                                                     unsigned residualLayerSize )
+void DeepPolyWeightedSumElement::allocateMemoryForResidualsIfNeeded(
+    BackSubstitutionBlock &block,
+    unsigned residualLayerIndex,
+    unsigned residualLayerSize )
 {
-    _residualLayerIndices.insert( residualLayerIndex );
-    unsigned matrixSize = residualLayerSize * _size;
-    if ( !_residualLb.exists( residualLayerIndex ) )
+    block._residualLayerIndices.insert( residualLayerIndex );
+    unsigned matrixSize = residualLayerSize * block._size;
+    if ( !block._residualLb.exists( residualLayerIndex ) )
     {
         double *residualLb = new double[matrixSize];
         std::fill_n( residualLb, matrixSize, 0 );
-        _residualLb[residualLayerIndex] = residualLb;
+        block._residualLb[residualLayerIndex] = residualLb;
     }
-    if ( !_residualUb.exists( residualLayerIndex ) )
+    if ( !block._residualUb.exists( residualLayerIndex ) )
     {
         double *residualUb = new double[matrixSize];
         std::fill_n( residualUb, matrixSize, 0 );
-        _residualUb[residualLayerIndex] = residualUb;
+        block._residualUb[residualLayerIndex] = residualUb;
     }
 }
 
-void DeepPolyWeightedSumElement::allocateMemory()
+void DeepPolyWeightedSumElement::allocateBlockMemory( BackSubstitutionBlock &block )
 {
-    freeMemoryIfNeeded();
+    block._workLb = new double[block._size];
+    block._workUb = new double[block._size];
 
-    DeepPolyElement::allocateMemory();
-
-    _workLb = new double[_size];
-    _workUb = new double[_size];
-
-    std::fill_n( _workLb, _size, FloatUtils::negativeInfinity() );
-    std::fill_n( _workUb, _size, FloatUtils::infinity() );
+    std::fill_n( block._workLb, block._size, FloatUtils::negativeInfinity() );
+    std::fill_n( block._workUb, block._size, FloatUtils::infinity() );
 }
 
-void DeepPolyWeightedSumElement::freeMemoryIfNeeded()
+void DeepPolyWeightedSumElement::freeBlockMemory( BackSubstitutionBlock &block )
 {
-    DeepPolyElement::freeMemoryIfNeeded();
-    if ( _workLb )
+    if ( block._workLb )
     {
-        delete[] _workLb;
-        _workLb = NULL;
+        delete[] block._workLb;
+        block._workLb = NULL;
     }
-    if ( _workUb )
+    if ( block._workUb )
     {
-        delete[] _workUb;
-        _workUb = NULL;
+        delete[] block._workUb;
+        block._workUb = NULL;
     }
-    for ( auto const &pair : _residualLb )
+    for ( auto const &pair : block._residualLb )
     {
         delete[] pair.second;
     }
-    _residualLb.clear();
-    for ( auto const &pair : _residualUb )
+    block._residualLb.clear();
+    for ( auto const &pair : block._residualUb )
     {
         delete[] pair.second;
     }
-    _residualUb.clear();
-    _residualLayerIndices.clear();
+    block._residualUb.clear();
+    block._residualLayerIndices.clear();
+}
+
+void DeepPolyWeightedSumElement::allocateMemory()
+{
+    freeMemoryIfNeeded();
+
+    DeepPolyElement::allocateMemory();
+}
+
+void DeepPolyWeightedSumElement::freeMemoryIfNeeded()
+{
+    DeepPolyElement::freeMemoryIfNeeded();
 }
 
 void DeepPolyWeightedSumElement::log( const String &message )
@@ -41,17 +41,46 @@ public:
                                             unsigned targetLayerSize,
                                             DeepPolyElement *predecessor );
 
+    /*
+      Divide the back-substitution of this layer among several threads,
+      each handling a block of consecutive neurons. The bounds of each
+      neuron depend only on its own column of the symbolic bounds, so
+      the blocks are independent. The working memory is split between
+      the blocks: its matrices must have room for
+      maxLayerSize * ( maxLayerSize + numberOfThreads ) entries, and
+      its biases for maxLayerSize + numberOfThreads entries.
+    */
+    void setNumberOfThreads( unsigned numberOfThreads, unsigned maxLayerSize );
+
 private:
     /*
-      Memory allocated to store concrete bounds computed at different stages
-      of back substitution.
+      The state of the back-substitution for a block of consecutive
+      neurons of this layer
     */
-    double *_workLb;
-    double *_workUb;
+    struct BackSubstitutionBlock
+    {
+        // The neurons handled, and the working memory
+        unsigned _firstNeuron;
+        unsigned _size;
+        double *_work1SymbolicLb;
+        double *_work1SymbolicUb;
+        double *_work2SymbolicLb;
+        double *_work2SymbolicUb;
+        double *_workSymbolicLowerBias;
+        double *_workSymbolicUpperBias;
+
+        // Memory allocated to store concrete bounds computed at different
+        // stages of back substitution.
+        double *_workLb;
+        double *_workUb;
 
-    Set<unsigned> _residualLayerIndices;
-    Map<unsigned, double *> _residualLb;
-    Map<unsigned, double *> _residualUb;
+        Set<unsigned> _residualLayerIndices;
+        Map<unsigned, double *> _residualLb;
+        Map<unsigned, double *> _residualUb;
+    };
+
+    unsigned _numberOfThreads;
+    unsigned _maxLayerSize;
 
     /*
       Compute the concrete upper- and lower- bounds of this layer by concretizing
@@ -60,25 +89,47 @@ private:
     void computeBoundWithBackSubstitution(
         const Map<unsigned, DeepPolyElement *> &deepPolyElementsBefore );
 
+    /*
+      Run the back-substitution for a single block of neurons.
+    */
+    void computeBoundWithBackSubstitution(
+        BackSubstitutionBlock &block,
+        const Map<unsigned, DeepPolyElement *> &deepPolyElementsBefore );
+
+    /*
+      Store the weights from a predecessor into the working memory of a
+      block, as a (predecessor size x block size) matrix.
+    */
+    void getWeightsForBlock( unsigned predecessorIndex,
+                             const BackSubstitutionBlock &block,
+                             double *result ) const;
+
     /*
       Compute concrete bounds using symbolic bounds with respect to a
       sourceElement.
     */
-    void concretizeSymbolicBound( const double *symbolicLb,
+    void concretizeSymbolicBound( BackSubstitutionBlock &block,
+                                  const double *symbolicLb,
                                   const double *symbolicUb,
                                   const double *symbolicLowerBias,
                                   const double *symbolicUpperBias,
                                   DeepPolyElement *sourceElement,
                                   const Map<unsigned, DeepPolyElement *> &deepPolyElementsBefore );
 
-    void concretizeSymbolicBoundForSourceLayer( const double *symbolicLb,
+    void concretizeSymbolicBoundForSourceLayer( BackSubstitutionBlock &block,
+                                                const double *symbolicLb,
                                                 const double *symbolicUb,
                                                 const double *symbolicLowerBias,
                                                 const double *symbolicUpperBias,
                                                 DeepPolyElement *sourceElement );
 
-    void allocateMemoryForResidualsIfNeeded( unsigned residualLayerIndex,
+    void allocateMemoryForResidualsIfNeeded( BackSubstitutionBlock &block,
+                                             unsigned residualLayerIndex,
                                              unsigned residualLayerSize );
+
+    void allocateBlockMemory( BackSubstitutionBlock &block );
+    void freeBlockMemory( BackSubstitutionBlock &block );
+
     void allocateMemory();
     void freeMemoryIfNeeded();
     void log( const String &message );
@@ -18,14 +18,13 @@
 #include "Debug.h"
 #include "InfeasibleQueryException.h"
 #include "Layer.h"
+#include "MILPEncoder.h"
 #include "MStringf.h"
 #include "NLRError.h"
 #include "Options.h"
 #include "TimeUtils.h"
 #include "Vector.h"
 
-#include <boost/thread.hpp>
-
 namespace NLR {
 
 IterativePropagator::IterativePropagator( LayerOwner *layerOwner )
@@ -43,33 +42,10 @@ IterativePropagator::~IterativePropagator()
 void IterativePropagator::optimizeBoundsWithIterativePropagation(
     const Map<unsigned, Layer *> &layers )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    // Time to wait if no idle worker is availble
-    boost::chrono::milliseconds waitTime( numberOfWorkers - 1 );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    std::vector<boost::thread> threads( numberOfWorkers );
-    std::mutex mtx;
-    std::atomic_bool infeasible( false );
-
-    double currentLb;
-    double currentUb;
-
-    std::atomic_uint tighterBoundCounter( 0 );
-    std::atomic_uint signChanges( 0 );
-    std::atomic_uint cutoffs( 0 );
+    SolverPool pool( Options::get()->getInt( Options::NUM_WORKERS ),
+                     MILPEncoder::createMILPSolver,
+                     GlobalConfiguration::LP_TIGHTENING_TIME_BUDGET_IN_SECONDS );
+    TighteningState state;
 
     // Variables used for early quitting
     Layer *lastLayer = layers[layers.size() - 1];
@@ -82,6 +58,68 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation(
     NeuronIndex lastFixedNeuronThisIteration = lastIndex;
     bool shouldQuit = false;
 
+    /*
+      The neurons are handed out in order, so that an iteration can stop
+      once it passes the last neuron fixed by the previous iteration.
+      Their bounds are read when they are handled.
+    */
+    Vector<NeuronTask> tasks;
+    for ( const auto &currentLayer : layers )
+    {
+        Layer *layer = currentLayer.second;
+        if ( layer->getLayerType() == Layer::INPUT )
+            continue;
+        for ( unsigned i = 0; i < layer->getSize(); ++i )
+            tasks.append( NeuronTask( layer, i, 0, 0, false, false ) );
+    }
+
+    auto task = [&]( ILPSolver &solver, unsigned t ) {
+        if ( state._infeasible )
+            return false;
+
+        NeuronTask neuron = tasks[t];
+        Layer *layer = neuron._layer;
+        unsigned i = neuron._index;
+
+        solver.resetModel();
+
+        {
+            std::lock_guard<std::mutex> lock( state._mtx );
+
+            if ( layer->neuronEliminated( i ) )
+                return true;
+
+            bool progressMade = lastFixedNeuronThisIteration != lastIndex;
+            if ( !progressMade &&
+                 lastFixedNeuronFromPreviousIteration < NeuronIndex( layer->getLayerIndex(), i ) )
+            {
+                // If we reached the last fixed neuron from the
+                // previous iteration but this iteration hasn't fixed any neurons
+                if ( Options::get()->getInt( Options::VERBOSITY ) > 0 )
+                    printf( "No progress made this iteration, quitting...\n" );
+
+                shouldQuit = true;
+                return false;
+            }
+
+            neuron._currentLb = layer->getLb( i );
+            neuron._currentUb = layer->getUb( i );
+
+            if ( _cutoffInUse &&
+                 ( neuron._currentLb > _cutoffValue || neuron._currentUb < _cutoffValue ) )
+                return true;
+
+            _milpFormulator.createMILPEncoding(
+                layers, solver, _layerOwner->getNumberOfLayers() );
+        }
+
+        if ( Options::get()->getInt( Options::VERBOSITY ) > 1 )
+            printf( "Handling layer %d neuron %d\n", layer->getLayerIndex(), i );
+
+        tightenSingleVariableBounds( solver, neuron, state, lastFixedNeuronThisIteration );
+        return !state._infeasible;
+    };
+
     struct timespec gurobiStart;
     (void)gurobiStart;
     struct timespec gurobiEnd;
@@ -94,14 +132,12 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation(
         if ( Options::get()->getInt( Options::VERBOSITY ) > 0 )
             printf( "Number of tighter bounds found by Gurobi before this iteration: %u. Sign "
                     "changes: %u. Cutoffs: %u\n",
-                    tighterBoundCounter.load(),
-                    signChanges.load(),
-                    cutoffs.load() );
+                    state._tighterBoundCounter.load(),
+                    state._signChanges.load(),
+                    state._cutoffs.load() );
 
-        mtx.lock();
         lastFixedNeuronFromPreviousIteration = lastFixedNeuronThisIteration;
         lastFixedNeuronThisIteration = lastIndex;
-        mtx.unlock();
 
         DEBUG( {
             std::cout << "Last fixed Neuron From Previous Iteration: "
@@ -109,104 +145,19 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation(
                       << lastFixedNeuronFromPreviousIteration._neuron << std::endl;
         } );
 
-        for ( const auto &currentLayer : layers )
-        {
-            if ( shouldQuit )
-                break;
-            Layer *layer = currentLayer.second;
-            if ( layer->getLayerType() == Layer::INPUT )
-                continue;
-            for ( unsigned i = 0; i < layer->getSize(); ++i )
-            {
-                if ( layer->neuronEliminated( i ) )
-                    continue;
-
-                currentLb = layer->getLb( i );
-                currentUb = layer->getUb( i );
-
-                mtx.lock();
-                bool progressMade = lastFixedNeuronThisIteration != lastIndex;
-                mtx.unlock();
-
-                if ( !progressMade && lastFixedNeuronFromPreviousIteration <
-                                          NeuronIndex( layer->getLayerIndex(), i ) )
-                {
-                    // If we reached the last fixed neuron from the
-                    // previous iteration but this iteration hasn't fixed any neurons
-                    if ( Options::get()->getInt( Options::VERBOSITY ) > 0 )
-                        printf( "No progress made this iteration, quitting...\n" );
-
-                    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-                    {
-                        threads[i].interrupt();
-                        threads[i].join();
-                    }
-                    shouldQuit = true;
-                    break;
-                }
-
-                if ( _cutoffInUse && ( currentLb > _cutoffValue || currentUb < _cutoffValue ) )
-                    continue;
-
-                if ( Options::get()->getInt( Options::VERBOSITY ) > 1 )
-                    printf( "Handling layer %d neuron %d\n", layer->getLayerIndex(), i );
-
-                if ( infeasible )
-                {
-                    // infeasibility is derived, interupt all active threads
-                    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-                    {
-                        threads[i].interrupt();
-                        threads[i].join();
-                    }
-                    clearSolverQueue( freeSolvers );
-                    throw InfeasibleQueryException();
-                }
-
-                // Wait until there is an idle solver
-                GurobiWrapper *freeSolver;
-                while ( !freeSolvers.pop( freeSolver ) )
-                    boost::this_thread::sleep_for( waitTime );
-
-                freeSolver->resetModel();
-                mtx.lock();
-                _milpFormulator.createMILPEncoding(
-                    layers, *freeSolver, _layerOwner->getNumberOfLayers() );
-                mtx.unlock();
-
-                // spawn a thread to tighten the bounds for the current variable
-                ThreadArgument argument( freeSolver,
-                                         layer,
-                                         i,
-                                         currentLb,
-                                         currentUb,
-                                         _cutoffInUse,
-                                         _cutoffValue,
-                                         _layerOwner,
-                                         std::ref( freeSolvers ),
-                                         std::ref( mtx ),
-                                         std::ref( infeasible ),
-                                         std::ref( tighterBoundCounter ),
-                                         std::ref( signChanges ),
-                                         std::ref( cutoffs ),
-                                         &lastFixedNeuronThisIteration );
-
-                threads[solverToIndex[freeSolver]] =
-                    boost::thread( tightenSingleVariableBounds, argument );
-            }
-        }
+        pool.run( tasks.size(), task );
 
-        for ( unsigned i = 0; i < numberOfWorkers; ++i )
-        {
-            threads[i].join();
-        }
+        // An iteration that fixes no neuron is not followed by another
+        if ( state._infeasible || pool.timeBudgetExhausted() ||
+             !( lastFixedNeuronThisIteration != lastIndex ) )
+            shouldQuit = true;
 
         if ( Options::get()->getInt( Options::VERBOSITY ) > 0 )
             printf( "Number of tighter bounds found by Gurobi after this iteration: %u. Sign "
                     "changes: %u. Cutoffs: %u\n",
-                    tighterBoundCounter.load(),
-                    signChanges.load(),
-                    cutoffs.load() );
+                    state._tighterBoundCounter.load(),
+                    state._signChanges.load(),
+                    state._cutoffs.load() );
     }
     while ( !shouldQuit );
 
@@ -214,17 +165,15 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation(
 
     IterativePropagator_LOG(
         Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
-                 tighterBoundCounter.load(),
-                 signChanges.load(),
-                 cutoffs.load() )
+                 state._tighterBoundCounter.load(),
+                 state._signChanges.load(),
+                 state._cutoffs.load() )
             .ascii() );
     IterativePropagator_LOG( Stringf( "Seconds spent Gurobiing: %llu\n",
                                       TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 )
                                  .ascii() );
 
-    clearSolverQueue( freeSolvers );
-
-    if ( infeasible )
+    if ( state._infeasible )
         throw InfeasibleQueryException();
 }
 
@@ -235,23 +184,23 @@ void IterativePropagator::setCutoff( double cutoff )
 }
 
 
-double IterativePropagator::optimizeWithGurobi( GurobiWrapper &gurobi,
+double IterativePropagator::optimizeWithGurobi( ILPSolver &solver,
                                                 MinOrMax minOrMax,
                                                 String variableName,
                                                 double cutoffValue,
                                                 std::atomic_bool *infeasible )
 {
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
     if ( minOrMax == MAX )
-        gurobi.setObjective( terms );
+        solver.setObjective( terms );
     else
-        gurobi.setCost( terms );
+        solver.setCost( terms );
 
-    gurobi.solve();
+    solver.solve();
 
-    if ( gurobi.infeasible() )
+    if ( solver.infeasible() )
     {
         if ( infeasible )
         {
@@ -262,70 +211,59 @@ double IterativePropagator::optimizeWithGurobi( GurobiWrapper &gurobi,
             throw InfeasibleQueryException();
     }
 
-    if ( gurobi.cutoffOccurred() )
+    if ( solver.cutoffOccurred() )
         return cutoffValue;
 
-    if ( gurobi.optimal() )
+    if ( solver.optimal() )
     {
         Map<String, double> dontCare;
         double result = 0;
-        gurobi.extractSolution( dontCare, result );
+        solver.extractSolution( dontCare, result );
         return result;
     }
-    else if ( gurobi.timeout() )
+    else if ( solver.timeout() )
     {
-        return gurobi.getObjectiveBound();
+        return solver.getObjectiveBound();
     }
 
     throw NLRError( NLRError::UNEXPECTED_RETURN_STATUS_FROM_GUROBI );
 }
 
-void IterativePropagator::tightenSingleVariableBounds( ThreadArgument &argument )
+void IterativePropagator::tightenSingleVariableBounds( ILPSolver &solver,
+                                                       const NeuronTask &task,
+                                                       TighteningState &state,
+                                                       NeuronIndex &lastFixedNeuron )
 {
-    try
+    // try the phase corresponding to the larger interval first
+    if ( -task._currentLb < task._currentUb )
     {
-        // try the phase corresponding to the larger interval first
-        if ( -argument._currentLb < argument._currentUb )
-        {
-            if ( tightenSingleVariableLowerBounds( argument ) )
-                tightenSingleVariableUpperBounds( argument );
-        }
-        else
-        {
-            if ( tightenSingleVariableUpperBounds( argument ) )
-                tightenSingleVariableLowerBounds( argument );
-        }
-        SolverQueue &freeSolvers = argument._freeSolvers;
-        GurobiWrapper *gurobi = argument._gurobi;
-        enqueueSolver( freeSolvers, gurobi );
+        if ( tightenSingleVariableLowerBounds( solver, task, state, lastFixedNeuron ) )
+            tightenSingleVariableUpperBounds( solver, task, state, lastFixedNeuron );
     }
-    catch ( boost::thread_interrupted & )
+    else
     {
-        enqueueSolver( argument._freeSolvers, argument._gurobi );
+        if ( tightenSingleVariableUpperBounds( solver, task, state, lastFixedNeuron ) )
+            tightenSingleVariableLowerBounds( solver, task, state, lastFixedNeuron );
     }
 }
 
-bool IterativePropagator::tightenSingleVariableLowerBounds( ThreadArgument &argument )
+bool IterativePropagator::tightenSingleVariableLowerBounds( ILPSolver &solver,
+                                                            const NeuronTask &task,
+                                                            TighteningState &state,
+                                                            NeuronIndex &lastFixedNeuron )
 {
-    GurobiWrapper *gurobi = argument._gurobi;
-    Layer *layer = argument._layer;
-    unsigned index = argument._index;
-    double currentLb = argument._currentLb;
-    bool cutoffInUse = argument._cutoffInUse;
-    double cutoffValue = argument._cutoffValue;
-    LayerOwner *layerOwner = argument._layerOwner;
-    std::mutex &mtx = argument._mtx;
-    std::atomic_bool &infeasible = argument._infeasible;
-    std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
-    std::atomic_uint &signChanges = argument._signChanges;
-    std::atomic_uint &cutoffs = argument._cutoffs;
-    NeuronIndex *lastFixedNeuron = argument._lastFixedNeuron;
+    Layer *layer = task._layer;
+    unsigned index = task._index;
+    double currentLb = task._currentLb;
 
     unsigned variable = layer->neuronToVariable( index );
     Stringf variableName( "x%u", variable );
-    gurobi->reset();
+    solver.reset();
     double lb =
-        optimizeWithGurobi( *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible );
+        optimizeWithGurobi( solver, MinOrMax::MIN, variableName, _cutoffValue, &state._infeasible );
+
+    if ( state._infeasible )
+        return false;
 
     // Store the new bound if it is tighter
     if ( lb > currentLb )
@@ -336,21 +274,21 @@ bool IterativePropagator::tightenSingleVariableLowerBounds( ThreadArgument &argu
                                               layer->getLayerIndex(),
                                               index )
                                          .ascii() );
-            ++signChanges;
-            mtx.lock();
-            *lastFixedNeuron = NeuronIndex( layer->getLayerIndex(), index );
-            mtx.unlock();
+            ++state._signChanges;
+            state._mtx.lock();
+            lastFixedNeuron = NeuronIndex( layer->getLayerIndex(), index );
+            state._mtx.unlock();
         }
 
-        mtx.lock();
+        state._mtx.lock();
         layer->setLb( index, lb );
-        layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
-        mtx.unlock();
-        ++tighterBoundCounter;
+        _layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
+        state._mtx.unlock();
+        ++state._tighterBoundCounter;
 
-        if ( cutoffInUse && lb > cutoffValue )
+        if ( _cutoffInUse && lb > _cutoffValue )
         {
-            ++cutoffs;
+            ++state._cutoffs;
             return true;
         }
     }
@@ -358,27 +296,23 @@ bool IterativePropagator::tightenSingleVariableLowerBounds( ThreadArgument &argu
     return false;
 }
 
-bool IterativePropagator::tightenSingleVariableUpperBounds( ThreadArgument &argument )
+bool IterativePropagator::tightenSingleVariableUpperBounds( ILPSolver &solver,
+                                                            const NeuronTask &task,
+                                                            TighteningState &state,
+                                                            NeuronIndex &lastFixedNeuron )
 {
-    GurobiWrapper *gurobi = argument._gurobi;
-    Layer *layer = argument._layer;
-    unsigned index = argument._index;
-    double currentUb = argument._currentUb;
-    bool cutoffInUse = argument._cutoffInUse;
-    double cutoffValue = argument._cutoffValue;
-    LayerOwner *layerOwner = argument._layerOwner;
-    std::mutex &mtx = argument._mtx;
-    std::atomic_bool &infeasible = argument._infeasible;
-    std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
-    std::atomic_uint &signChanges = argument._signChanges;
-    std::atomic_uint &cutoffs = argument._cutoffs;
-    NeuronIndex *lastFixedNeuron = argument._lastFixedNeuron;
+    Layer *layer = task._layer;
+    unsigned index = task._index;
+    double currentUb = task._currentUb;
 
     unsigned variable = layer->neuronToVariable( index );
     Stringf variableName( "x%u", variable );
-    gurobi->reset();
+    solver.reset();
     double ub =
-        optimizeWithGurobi( *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible );
+        optimizeWithGurobi( solver, MinOrMax::MAX, variableName, _cutoffValue, &state._infeasible );
+
+    if ( state._infeasible )
+        return false;
 
     // Store the new bound if it is tighter
     if ( ub < currentUb )
@@ -389,22 +323,22 @@ bool IterativePropagator::tightenSingleVariableUpperBounds( ThreadArgument &argu
                                               layer->getLayerIndex(),
                                               index )
                                          .ascii() );
-            ++signChanges;
-            mtx.lock();
-            *lastFixedNeuron = NeuronIndex( layer->getLayerIndex(), index );
-            mtx.unlock();
+            ++state._signChanges;
+            state._mtx.lock();
+            lastFixedNeuron = NeuronIndex( layer->getLayerIndex(), index );
+            state._mtx.unlock();
         }
 
-        mtx.lock();
+        state._mtx.lock();
         layer->setUb( index, ub );
-        layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
-        mtx.unlock();
+        _layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
+        state._mtx.unlock();
 
-        ++tighterBoundCounter;
+        ++state._tighterBoundCounter;
 
-        if ( cutoffInUse && ub < cutoffValue )
+        if ( _cutoffInUse && ub < _cutoffValue )
         {
-            ++cutoffs;
+            ++state._cutoffs;
             return true;
         }
     }
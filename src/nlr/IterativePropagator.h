@@ -19,6 +19,7 @@
 #include "GurobiWrapper.h"
 #include "LayerOwner.h"
 #include "MILPFormulator.h"
+#include "NeuronIndex.h"
 #include "ParallelSolver.h"
 
 #include <atomic>
@@ -57,22 +58,32 @@ private:
 
     /*
       Optimize for the min/max value of variableName with respect to the constraints
-      encoded in gurobi. If the query is infeasible, *infeasible is set to true.
+      encoded in solver. If the query is infeasible, *infeasible is set to true.
     */
-    static double optimizeWithGurobi( GurobiWrapper &gurobi,
+    static double optimizeWithGurobi( ILPSolver &solver,
                                       MinOrMax minOrMax,
                                       String variableName,
                                       double cutoffValue,
                                       std::atomic_bool *infeasible = NULL );
 
     /*
-      Tighten the upper- and lower- bound of a varaible
+      Tighten the upper- and lower- bound of a varaible. A neuron whose
+      phase becomes fixed is recorded in lastFixedNeuron.
     */
-    static void tightenSingleVariableBounds( ThreadArgument &argument );
-
-    static bool tightenSingleVariableLowerBounds( ThreadArgument &argument );
-
-    static bool tightenSingleVariableUpperBounds( ThreadArgument &argument );
+    void tightenSingleVariableBounds( ILPSolver &solver,
+                                      const NeuronTask &task,
+                                      TighteningState &state,
+                                      NeuronIndex &lastFixedNeuron );
+
+    bool tightenSingleVariableLowerBounds( ILPSolver &solver,
+                                           const NeuronTask &task,
+                                           TighteningState &state,
+                                           NeuronIndex &lastFixedNeuron );
+
+    bool tightenSingleVariableUpperBounds( ILPSolver &solver,
+                                           const NeuronTask &task,
+                                           TighteningState &state,
+                                           NeuronIndex &lastFixedNeuron );
 };
 
 } // namespace NLR
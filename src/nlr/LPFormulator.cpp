@@ -21,10 +21,13 @@
 #include "Layer.h"
 #include "MStringf.h"
 #include "NLRError.h"
+#include "NativeLPSolver.h"
 #include "Options.h"
 #include "TimeUtils.h"
 #include "Vector.h"
 
+#include <queue>
+
 namespace NLR {
 
 LPFormulator::LPFormulator( LayerOwner *layerOwner )
@@ -38,36 +41,43 @@ LPFormulator::~LPFormulator()
 {
 }
 
-double LPFormulator::solveLPRelaxation( GurobiWrapper &gurobi,
+ILPSolver *LPFormulator::createLPSolver()
+{
+    if ( Options::get()->gurobiEnabled() )
+        return new GurobiWrapper();
+    return new NativeLPSolver();
+}
+
+double LPFormulator::solveLPRelaxation( ILPSolver &solver,
                                         const Map<unsigned, Layer *> &layers,
                                         MinOrMax minOrMax,
                                         String variableName,
                                         unsigned lastLayer )
 {
-    gurobi.resetModel();
-    createLPRelaxation( layers, gurobi, lastLayer );
-    return optimizeWithGurobi( gurobi, minOrMax, variableName, _cutoffValue );
+    solver.resetModel();
+    createLPRelaxation( layers, solver, lastLayer );
+    return optimizeWithGurobi( solver, minOrMax, variableName, _cutoffValue );
 }
 
-double LPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
+double LPFormulator::optimizeWithGurobi( ILPSolver &solver,
                                          MinOrMax minOrMax,
                                          String variableName,
                                          double cutoffValue,
                                          std::atomic_bool *infeasible )
 {
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
     if ( minOrMax == MAX )
-        gurobi.setObjective( terms );
+        solver.setObjective( terms );
     else
-        gurobi.setCost( terms );
+        solver.setCost( terms );
 
-    gurobi.setTimeLimit( FloatUtils::infinity() );
+    solver.setTimeLimit( FloatUtils::infinity() );
 
-    gurobi.solve();
+    solver.solve();
 
-    if ( gurobi.infeasible() )
+    if ( solver.infeasible() )
     {
         if ( infeasible )
         {
@@ -78,19 +88,19 @@ double LPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
             throw InfeasibleQueryException();
     }
 
-    if ( gurobi.cutoffOccurred() )
+    if ( solver.cutoffOccurred() )
         return cutoffValue;
 
-    if ( gurobi.optimal() )
+    if ( solver.optimal() )
     {
         Map<String, double> dontCare;
         double result = 0;
-        gurobi.extractSolution( dontCare, result );
+        solver.extractSolution( dontCare, result );
         return result;
     }
-    else if ( gurobi.timeout() )
+    else if ( solver.timeout() )
     {
-        return gurobi.getObjectiveBound();
+        return solver.getObjectiveBound();
     }
 
     throw NLRError( NLRError::UNEXPECTED_RETURN_STATUS_FROM_GUROBI );
@@ -98,9 +108,10 @@ double LPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
 
 void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned, Layer *> &layers )
 {
-    GurobiWrapper gurobi;
+    std::unique_ptr<ILPSolver> lpSolver( createLPSolver() );
+    ILPSolver &solver = *lpSolver;
 
-    List<GurobiWrapper::Term> terms;
+    List<ILPSolver::Term> terms;
     Map<String, double> dontCare;
     double lb = 0;
     double ub = 0;
@@ -126,7 +137,7 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
         */
         ASSERT( layers.exists( i ) );
         Layer *layer = layers[i];
-        addLayerToModel( gurobi, layer, false );
+        addLayerToModel( solver, layer, false );
 
         for ( unsigned j = 0; j < layer->getSize(); ++j )
         {
@@ -143,27 +154,27 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
             Stringf variableName( "x%u", variable );
 
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, variableName ) );
+            terms.append( ILPSolver::Term( 1, variableName ) );
 
             // Maximize
-            gurobi.reset();
-            gurobi.setObjective( terms );
-            gurobi.solve();
+            solver.reset();
+            solver.setObjective( terms );
+            solver.solve();
 
-            if ( gurobi.infeasible() )
+            if ( solver.infeasible() )
                 throw InfeasibleQueryException();
 
-            if ( gurobi.cutoffOccurred() )
+            if ( solver.cutoffOccurred() )
             {
                 ub = _cutoffValue;
             }
-            else if ( gurobi.optimal() )
+            else if ( solver.optimal() )
             {
-                gurobi.extractSolution( dontCare, ub );
+                solver.extractSolution( dontCare, ub );
             }
-            else if ( gurobi.timeout() )
+            else if ( solver.timeout() )
             {
-                ub = gurobi.getObjectiveBound();
+                ub = solver.getObjectiveBound();
             }
             else
             {
@@ -173,7 +184,7 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
             // If the bound is tighter, store it
             if ( ub < currentUb )
             {
-                gurobi.setUpperBound( variableName, ub );
+                solver.setUpperBound( variableName, ub );
 
                 if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
                     ++signChanges;
@@ -190,24 +201,24 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
             }
 
             // Minimize
-            gurobi.reset();
-            gurobi.setCost( terms );
-            gurobi.solve();
+            solver.reset();
+            solver.setCost( terms );
+            solver.solve();
 
-            if ( gurobi.infeasible() )
+            if ( solver.infeasible() )
                 throw InfeasibleQueryException();
 
-            if ( gurobi.cutoffOccurred() )
+            if ( solver.cutoffOccurred() )
             {
                 lb = _cutoffValue;
             }
-            else if ( gurobi.optimal() )
+            else if ( solver.optimal() )
             {
-                gurobi.extractSolution( dontCare, lb );
+                solver.extractSolution( dontCare, lb );
             }
-            else if ( gurobi.timeout() )
+            else if ( solver.timeout() )
             {
-                lb = gurobi.getObjectiveBound();
+                lb = solver.getObjectiveBound();
             }
             else
             {
@@ -217,7 +228,7 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
             // If the bound is tighter, store it
             if ( lb > currentLb )
             {
-                gurobi.setLowerBound( variableName, lb );
+                solver.setLowerBound( variableName, lb );
 
                 if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
                     ++signChanges;
@@ -251,27 +262,10 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
 void LPFormulator::optimizeBoundsWithLpRelaxation( const Map<unsigned, Layer *> &layers,
                                                    bool backward )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    boost::thread *threads = new boost::thread[numberOfWorkers];
-    std::mutex mtx;
-    std::atomic_bool infeasible( false );
-
-    std::atomic_uint tighterBoundCounter( 0 );
-    std::atomic_uint signChanges( 0 );
-    std::atomic_uint cutoffs( 0 );
+    SolverPool pool( Options::get()->getInt( Options::NUM_WORKERS ),
+                     createLPSolver,
+                     GlobalConfiguration::LP_TIGHTENING_TIME_BUDGET_IN_SECONDS );
+    TighteningState state;
 
     struct timespec gurobiStart;
     (void)gurobiStart;
@@ -288,78 +282,38 @@ void LPFormulator::optimizeBoundsWithLpRelaxation( const Map<unsigned, Layer *>
         LPFormulator_LOG( Stringf( "Tightening bound for layer %u...", layerIndex ).ascii() );
         Layer *layer = layers[layerIndex];
 
-        ThreadArgument argument( layer,
-                                 &layers,
-                                 std::ref( freeSolvers ),
-                                 std::ref( mtx ),
-                                 std::ref( infeasible ),
-                                 std::ref( tighterBoundCounter ),
-                                 std::ref( signChanges ),
-                                 std::ref( cutoffs ),
-                                 layer->getLayerIndex(),
-                                 layerIndex,
-                                 threads,
-                                 &solverToIndex );
-
         // optimize every neuron of layer
-        optimizeBoundsOfNeuronsWithLpRlaxation( argument, backward );
+        optimizeBoundsOfNeuronsWithLpRelaxation(
+            pool, state, layers, layer->getLayerIndex(), layerIndex, backward );
         LPFormulator_LOG( Stringf( "Tightening bound for layer %u - done", layerIndex ).ascii() );
-    }
 
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
+        if ( state._infeasible || pool.timeBudgetExhausted() )
+            break;
     }
 
     gurobiEnd = TimeUtils::sampleMicro();
 
     LPFormulator_LOG(
         Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
-                 tighterBoundCounter.load(),
-                 signChanges.load(),
-                 cutoffs.load() )
+                 state._tighterBoundCounter.load(),
+                 state._signChanges.load(),
+                 state._cutoffs.load() )
             .ascii() );
     LPFormulator_LOG( Stringf( "Seconds spent Gurobiing: %llu\n",
                                TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 )
                           .ascii() );
 
-    // Clean up
-    clearSolverQueue( freeSolvers );
-
-    if ( threads )
-    {
-        delete[] threads;
-        threads = NULL;
-    }
-
-    if ( infeasible )
+    if ( state._infeasible )
         throw InfeasibleQueryException();
 }
 
 void LPFormulator::optimizeBoundsOfOneLayerWithLpRelaxation( const Map<unsigned, Layer *> &layers,
                                                              unsigned targetIndex )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    boost::thread *threads = new boost::thread[numberOfWorkers];
-    std::mutex mtx;
-    std::atomic_bool infeasible( false );
-
-    std::atomic_uint tighterBoundCounter( 0 );
-    std::atomic_uint signChanges( 0 );
-    std::atomic_uint cutoffs( 0 );
+    SolverPool pool( Options::get()->getInt( Options::NUM_WORKERS ),
+                     createLPSolver,
+                     GlobalConfiguration::LP_TIGHTENING_TIME_BUDGET_IN_SECONDS );
+    TighteningState state;
 
     struct timespec gurobiStart;
     (void)gurobiStart;
@@ -368,285 +322,147 @@ void LPFormulator::optimizeBoundsOfOneLayerWithLpRelaxation( const Map<unsigned,
 
     gurobiStart = TimeUtils::sampleMicro();
 
-    Layer *layer = layers[targetIndex];
-
-    ThreadArgument argument( layer,
-                             &layers,
-                             std::ref( freeSolvers ),
-                             std::ref( mtx ),
-                             std::ref( infeasible ),
-                             std::ref( tighterBoundCounter ),
-                             std::ref( signChanges ),
-                             std::ref( cutoffs ),
-                             layers.size() - 1,
-                             targetIndex,
-                             threads,
-                             &solverToIndex );
-
     // optimize every neuron of layer
-    optimizeBoundsOfNeuronsWithLpRlaxation( argument, false );
-
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
-    }
+    optimizeBoundsOfNeuronsWithLpRelaxation(
+        pool, state, layers, layers.size() - 1, targetIndex, false );
 
     gurobiEnd = TimeUtils::sampleMicro();
 
     LPFormulator_LOG(
         Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
-                 tighterBoundCounter.load(),
-                 signChanges.load(),
-                 cutoffs.load() )
+                 state._tighterBoundCounter.load(),
+                 state._signChanges.load(),
+                 state._cutoffs.load() )
             .ascii() );
     LPFormulator_LOG( Stringf( "Seconds spent Gurobiing: %llu\n",
                                TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 )
                           .ascii() );
 
-    clearSolverQueue( freeSolvers );
-
-    if ( infeasible )
+    if ( state._infeasible )
         throw InfeasibleQueryException();
 }
 
-void LPFormulator::optimizeBoundsOfNeuronsWithLpRlaxation( ThreadArgument &args, bool backward )
+void LPFormulator::optimizeBoundsOfNeuronsWithLpRelaxation( SolverPool &pool,
+                                                            TighteningState &state,
+                                                            const Map<unsigned, Layer *> &layers,
+                                                            unsigned lastIndexOfRelaxation,
+                                                            unsigned targetIndex,
+                                                            bool backward )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    // Time to wait if no idle worker is availble
-    boost::chrono::milliseconds waitTime( numberOfWorkers - 1 );
+    Layer *layer = layers[targetIndex];
 
-    Layer *layer = args._layer;
-    const Map<unsigned, Layer *> layers = *args._layers;
-    unsigned targetIndex = args._targetIndex;
-    unsigned lastIndexOfRelaxation = args._lastIndexOfRelaxation;
+    Vector<NeuronTask> tasks;
+    collectNeuronTasks(
+        layer, _layerOwner->getLayer( targetIndex ), _cutoffInUse, _cutoffValue, tasks );
+    sortByExpectedGain( tasks, _cutoffInUse, _cutoffValue );
 
-    const Map<GurobiWrapper *, unsigned> solverToIndex = *args._solverToIndex;
-    SolverQueue &freeSolvers = args._freeSolvers;
-    std::mutex &mtx = args._mtx;
-    std::atomic_bool &infeasible = args._infeasible;
-    std::atomic_uint &tighterBoundCounter = args._tighterBoundCounter;
-    std::atomic_uint &signChanges = args._signChanges;
-    std::atomic_uint &cutoffs = args._cutoffs;
-    boost::thread *threads = args._threads;
+    /*
+      Each worker encodes the relaxation once, and then reuses it for
+      all the neurons it handles. The bounds that a worker discovers
+      are also added to its own encoding.
+    */
+    auto prepare = [&]( ILPSolver &solver ) {
+        solver.resetModel();
 
-    double currentLb;
-    double currentUb;
+        std::lock_guard<std::mutex> lock( state._mtx );
+        if ( backward )
+            createLPRelaxationAfter( layers, solver, lastIndexOfRelaxation );
+        else
+            createLPRelaxation( layers, solver, lastIndexOfRelaxation );
+    };
 
-    bool skipTightenLb = false; // If true, skip lower bound tightening
-    bool skipTightenUb = false; // If true, skip upper bound tightening
+    auto task = [&]( ILPSolver &solver, unsigned i ) {
+        if ( state._infeasible )
+            return false;
 
-    // declare simulations as local var to avoid a problem which can happen due to multi thread
-    // process.
-    const Vector<Vector<double>> *simulations =
-        _layerOwner->getLayer( targetIndex )->getSimulations();
+        tightenSingleVariableBoundsWithLPRelaxation( solver, tasks[i], state );
+        return !state._infeasible;
+    };
 
-    for ( unsigned i = 0; i < layer->getSize(); ++i )
-    {
-        if ( layer->neuronEliminated( i ) )
-            continue;
+    pool.run( tasks.size(), task, prepare );
+}
 
-        currentLb = layer->getLb( i );
-        currentUb = layer->getUb( i );
+void LPFormulator::tightenSingleVariableBoundsWithLPRelaxation( ILPSolver &solver,
+                                                                const NeuronTask &task,
+                                                                TighteningState &state )
+{
+    Layer *layer = task._layer;
+    unsigned index = task._index;
 
-        if ( _cutoffInUse && ( currentLb >= _cutoffValue || currentUb <= _cutoffValue ) )
-            continue;
+    LPFormulator_LOG(
+        Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
+            .ascii() );
 
-        skipTightenLb = false;
-        skipTightenUb = false;
+    unsigned variable = layer->neuronToVariable( index );
+    Stringf variableName( "x%u", variable );
 
-        // Loop for simulation
-        for ( const auto &simValue : ( *simulations ).get( i ) )
+    if ( !task._skipTightenUb )
+    {
+        LPFormulator_LOG( Stringf( "Computing upperbound..." ).ascii() );
+        solver.reset();
+        double ub = optimizeWithGurobi(
+                        solver, MinOrMax::MAX, variableName, _cutoffValue, &state._infeasible ) +
+                    GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT;
+        LPFormulator_LOG( Stringf( "Upperbound computed %f", ub ).ascii() );
+
+        // Store the new bound if it is tighter
+        if ( ub < task._currentUb )
         {
-            if ( _cutoffInUse && _cutoffValue < simValue ) // If x_lower < 0 < x_sim, do not try to
-                                                           // call tightning upper bound.
-                skipTightenUb = true;
+            if ( FloatUtils::isPositive( task._currentUb ) && !FloatUtils::isPositive( ub ) )
+                ++state._signChanges;
 
-            if ( _cutoffInUse && simValue < _cutoffValue ) // If x_sim < 0 < x_upper, do not try to
-                                                           // call tightning lower bound.
-                skipTightenLb = true;
+            solver.setUpperBound( variableName, ub );
 
-            if ( skipTightenUb && skipTightenLb )
-                break;
-        }
+            state._mtx.lock();
+            layer->setUb( index, ub );
+            _layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
+            state._mtx.unlock();
 
-        // If no tightning is needed, continue
-        if ( skipTightenUb && skipTightenLb )
-        {
-            LPFormulator_LOG(
-                Stringf(
-                    "Skip tightening lower and upper bounds for layer %d index %u", targetIndex, i )
-                    .ascii() );
-            continue;
-        }
-        else if ( skipTightenUb )
-        {
-            LPFormulator_LOG(
-                Stringf( "Skip tightening upper bound for layer %u index %u", targetIndex, i )
-                    .ascii() );
-        }
-        else if ( skipTightenLb )
-        {
-            LPFormulator_LOG(
-                Stringf( "Skip tightening lower bound for layer %u index %u", targetIndex, i )
-                    .ascii() );
-        }
-
-        if ( infeasible )
-        {
-            // infeasibility is derived, interupt all active threads
-            for ( unsigned i = 0; i < numberOfWorkers; ++i )
-            {
-                threads[i].interrupt();
-                threads[i].join();
-            }
-
-            // Clean up
-            clearSolverQueue( freeSolvers );
+            ++state._tighterBoundCounter;
 
-            if ( threads )
+            if ( _cutoffInUse && ub < _cutoffValue )
             {
-                delete[] threads;
-                threads = NULL;
+                ++state._cutoffs;
+                return;
             }
-
-            throw InfeasibleQueryException();
         }
 
-        // Wait until there is an idle solver
-        GurobiWrapper *freeSolver;
-        while ( !freeSolvers.pop( freeSolver ) )
-            boost::this_thread::sleep_for( waitTime );
-
-        freeSolver->resetModel();
-
-        mtx.lock();
-        if ( backward )
-            createLPRelaxationAfter( layers, *freeSolver, lastIndexOfRelaxation );
-        else
-            createLPRelaxation( layers, *freeSolver, lastIndexOfRelaxation );
-        mtx.unlock();
-
-        // spawn a thread to tighten the bounds for the current variable
-        ThreadArgument argument( freeSolver,
-                                 layer,
-                                 i,
-                                 currentLb,
-                                 currentUb,
-                                 _cutoffInUse,
-                                 _cutoffValue,
-                                 _layerOwner,
-                                 std::ref( freeSolvers ),
-                                 std::ref( mtx ),
-                                 std::ref( infeasible ),
-                                 std::ref( tighterBoundCounter ),
-                                 std::ref( signChanges ),
-                                 std::ref( cutoffs ),
-                                 skipTightenLb,
-                                 skipTightenUb );
-
-        if ( numberOfWorkers == 1 )
-            tightenSingleVariableBoundsWithLPRelaxation( argument );
-        else
-            threads[solverToIndex[freeSolver]] =
-                boost::thread( tightenSingleVariableBoundsWithLPRelaxation, argument );
+        if ( state._infeasible )
+            return;
     }
-}
-
 
-void LPFormulator::tightenSingleVariableBoundsWithLPRelaxation( ThreadArgument &argument )
-{
-    try
+    if ( !task._skipTightenLb )
     {
-        GurobiWrapper *gurobi = argument._gurobi;
-        Layer *layer = argument._layer;
-        unsigned index = argument._index;
-        double currentLb = argument._currentLb;
-        double currentUb = argument._currentUb;
-        bool cutoffInUse = argument._cutoffInUse;
-        double cutoffValue = argument._cutoffValue;
-        LayerOwner *layerOwner = argument._layerOwner;
-        SolverQueue &freeSolvers = argument._freeSolvers;
-        std::mutex &mtx = argument._mtx;
-        std::atomic_bool &infeasible = argument._infeasible;
-        std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
-        std::atomic_uint &signChanges = argument._signChanges;
-        std::atomic_uint &cutoffs = argument._cutoffs;
-        bool skipTightenLb = argument._skipTightenLb;
-        bool skipTightenUb = argument._skipTightenUb;
-
-        LPFormulator_LOG(
-            Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
-                .ascii() );
-
-        unsigned variable = layer->neuronToVariable( index );
-        Stringf variableName( "x%u", variable );
-
-        if ( !skipTightenUb )
+        LPFormulator_LOG( Stringf( "Computing lowerbound..." ).ascii() );
+        solver.reset();
+        double lb = optimizeWithGurobi(
+                        solver, MinOrMax::MIN, variableName, _cutoffValue, &state._infeasible ) -
+                    GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT;
+        LPFormulator_LOG( Stringf( "Lowerbound computed: %f", lb ).ascii() );
+
+        // Store the new bound if it is tighter
+        if ( lb > task._currentLb )
         {
-            LPFormulator_LOG( Stringf( "Computing upperbound..." ).ascii() );
-            double ub = optimizeWithGurobi(
-                            *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible ) +
-                        GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT;
-            ;
-            LPFormulator_LOG( Stringf( "Upperbound computed %f", ub ).ascii() );
-
-            // Store the new bound if it is tighter
-            if ( ub < currentUb )
-            {
-                if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
-                    ++signChanges;
+            if ( FloatUtils::isNegative( task._currentLb ) && !FloatUtils::isNegative( lb ) )
+                ++state._signChanges;
 
-                mtx.lock();
-                layer->setUb( index, ub );
-                layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
-                mtx.unlock();
+            solver.setLowerBound( variableName, lb );
 
-                ++tighterBoundCounter;
+            state._mtx.lock();
+            layer->setLb( index, lb );
+            _layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
+            state._mtx.unlock();
 
-                if ( cutoffInUse && ub < cutoffValue )
-                {
-                    ++cutoffs;
-                    enqueueSolver( freeSolvers, gurobi );
-                    return;
-                }
-            }
-        }
+            ++state._tighterBoundCounter;
 
-        if ( !skipTightenLb )
-        {
-            LPFormulator_LOG( Stringf( "Computing lowerbound..." ).ascii() );
-            gurobi->reset();
-            double lb = optimizeWithGurobi(
-                            *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible ) -
-                        GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT;
-            LPFormulator_LOG( Stringf( "Lowerbound computed: %f", lb ).ascii() );
-            // Store the new bound if it is tighter
-            if ( lb > currentLb )
-            {
-                if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
-                    ++signChanges;
-
-                mtx.lock();
-                layer->setLb( index, lb );
-                layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
-                mtx.unlock();
-                ++tighterBoundCounter;
-
-                if ( cutoffInUse && lb > cutoffValue )
-                    ++cutoffs;
-            }
+            if ( _cutoffInUse && lb > _cutoffValue )
+                ++state._cutoffs;
         }
-        enqueueSolver( freeSolvers, gurobi );
-    }
-    catch ( boost::thread_interrupted & )
-    {
-        enqueueSolver( argument._freeSolvers, argument._gurobi );
     }
 }
 
 void LPFormulator::createLPRelaxation( const Map<unsigned, Layer *> &layers,
-                                       GurobiWrapper &gurobi,
+                                       ILPSolver &solver,
                                        unsigned lastLayer )
 {
     for ( const auto &layer : layers )
@@ -654,12 +470,12 @@ void LPFormulator::createLPRelaxation( const Map<unsigned, Layer *> &layers,
         if ( layer.second->getLayerIndex() > lastLayer )
             continue;
 
-        addLayerToModel( gurobi, layer.second, false );
+        addLayerToModel( solver, layer.second, false );
     }
 }
 
 void LPFormulator::createLPRelaxationAfter( const Map<unsigned, Layer *> &layers,
-                                            GurobiWrapper &gurobi,
+                                            ILPSolver &solver,
                                             unsigned firstLayer )
 {
     unsigned depth = GlobalConfiguration::BACKWARD_BOUND_PROPAGATION_DEPTH;
@@ -678,7 +494,7 @@ void LPFormulator::createLPRelaxationAfter( const Map<unsigned, Layer *> &layers
             continue;
         else
         {
-            addLayerToModel( gurobi, currentLayer, true );
+            addLayerToModel( solver, currentLayer, true );
             for ( const auto &nextLayer : currentLayer->getSuccessorLayers() )
             {
                 if ( layerToDepth.exists( nextLayer ) )
@@ -690,54 +506,54 @@ void LPFormulator::createLPRelaxationAfter( const Map<unsigned, Layer *> &layers
     }
 }
 
-void LPFormulator::addLayerToModel( GurobiWrapper &gurobi,
+void LPFormulator::addLayerToModel( ILPSolver &solver,
                                     const Layer *layer,
                                     bool createVariables )
 {
     switch ( layer->getLayerType() )
     {
     case Layer::INPUT:
-        addInputLayerToLpRelaxation( gurobi, layer );
+        addInputLayerToLpRelaxation( solver, layer );
         break;
 
     case Layer::RELU:
-        addReluLayerToLpRelaxation( gurobi, layer, createVariables );
+        addReluLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     case Layer::WEIGHTED_SUM:
-        addWeightedSumLayerToLpRelaxation( gurobi, layer, createVariables );
+        addWeightedSumLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     case Layer::ROUND:
-        addRoundLayerToLpRelaxation( gurobi, layer, createVariables );
+        addRoundLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     case Layer::LEAKY_RELU:
-        addLeakyReluLayerToLpRelaxation( gurobi, layer, createVariables );
+        addLeakyReluLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     case Layer::ABSOLUTE_VALUE:
-        addAbsoluteValueLayerToLpRelaxation( gurobi, layer, createVariables );
+        addAbsoluteValueLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     case Layer::SIGN:
-        addSignLayerToLpRelaxation( gurobi, layer, createVariables );
+        addSignLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     case Layer::MAX:
-        addMaxLayerToLpRelaxation( gurobi, layer, createVariables );
+        addMaxLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     case Layer::SIGMOID:
-        addSigmoidLayerToLpRelaxation( gurobi, layer, createVariables );
+        addSigmoidLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     case Layer::SOFTMAX:
-        addSoftmaxLayerToLpRelaxation( gurobi, layer, createVariables );
+        addSoftmaxLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     case Layer::BILINEAR:
-        addBilinearLayerToLpRelaxation( gurobi, layer, createVariables );
+        addBilinearLayerToLpRelaxation( solver, layer, createVariables );
         break;
 
     default:
@@ -746,16 +562,16 @@ void LPFormulator::addLayerToModel( GurobiWrapper &gurobi,
     }
 }
 
-void LPFormulator::addInputLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer )
+void LPFormulator::addInputLayerToLpRelaxation( ILPSolver &solver, const Layer *layer )
 {
     for ( unsigned i = 0; i < layer->getSize(); ++i )
     {
         unsigned variable = layer->neuronToVariable( i );
-        gurobi.addVariable( Stringf( "x%u", variable ), layer->getLb( i ), layer->getUb( i ) );
+        solver.addVariable( Stringf( "x%u", variable ), layer->getLb( i ), layer->getUb( i ) );
     }
 }
 
-void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addReluLayerToLpRelaxation( ILPSolver &solver,
                                                const Layer *layer,
                                                bool createVariables )
 {
@@ -775,7 +591,7 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 double sourceValue = sourceLayer->getEliminatedNeuronValue( sourceNeuron );
                 double targetValue = sourceValue > 0 ? sourceValue : 0;
 
-                gurobi.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
+                solver.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
 
                 continue;
             }
@@ -784,10 +600,10 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
             double sourceLb = sourceLayer->getLb( sourceNeuron );
             double sourceUb = sourceLayer->getUb( sourceNeuron );
             String sourceName = Stringf( "x%u", sourceVariable );
-            if ( createVariables && !gurobi.containsVariable( sourceName ) )
-                gurobi.addVariable( sourceName, sourceLb, sourceUb );
+            if ( createVariables && !solver.containsVariable( sourceName ) )
+                solver.addVariable( sourceName, sourceLb, sourceUb );
 
-            gurobi.addVariable( Stringf( "x%u", targetVariable ), 0, layer->getUb( i ) );
+            solver.addVariable( Stringf( "x%u", targetVariable ), 0, layer->getUb( i ) );
 
             if ( !FloatUtils::isNegative( sourceLb ) )
             {
@@ -795,17 +611,17 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 if ( sourceLb < 0 )
                     sourceLb = 0;
 
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addEqConstraint( terms, 0 );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                solver.addEqConstraint( terms, 0 );
             }
             else if ( !FloatUtils::isPositive( sourceUb ) )
             {
                 // The ReLU is inactive, y = 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                gurobi.addEqConstraint( terms, 0 );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                solver.addEqConstraint( terms, 0 );
             }
             else
             {
@@ -820,15 +636,15 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 */
 
                 // y >= 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                gurobi.addGeqConstraint( terms, 0 );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                solver.addGeqConstraint( terms, 0 );
 
                 // y >= x, i.e. y - x >= 0
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addGeqConstraint( terms, 0 );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                solver.addGeqConstraint( terms, 0 );
 
                 /*
                          u        ul
@@ -836,10 +652,10 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                        u - l     u - l
                 */
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -sourceUb / ( sourceUb - sourceLb ),
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -sourceUb / ( sourceUb - sourceLb ),
                                                    Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addLeqConstraint( terms,
+                solver.addLeqConstraint( terms,
                                          ( -sourceUb * sourceLb ) / ( sourceUb - sourceLb ) );
             }
         }
@@ -847,7 +663,7 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
 }
 
 
-void LPFormulator::addRoundLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addRoundLayerToLpRelaxation( ILPSolver &solver,
                                                 const Layer *layer,
                                                 bool createVariables )
 {
@@ -867,7 +683,7 @@ void LPFormulator::addRoundLayerToLpRelaxation( GurobiWrapper &gurobi,
                 double sourceValue = sourceLayer->getEliminatedNeuronValue( sourceNeuron );
                 double targetValue = FloatUtils::round( sourceValue );
 
-                gurobi.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
+                solver.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
 
                 continue;
             }
@@ -876,43 +692,43 @@ void LPFormulator::addRoundLayerToLpRelaxation( GurobiWrapper &gurobi,
             double sourceLb = sourceLayer->getLb( sourceNeuron );
             double sourceUb = sourceLayer->getUb( sourceNeuron );
             String sourceName = Stringf( "x%u", sourceVariable );
-            if ( createVariables && !gurobi.containsVariable( sourceName ) )
-                gurobi.addVariable( sourceName, sourceLb, sourceUb );
+            if ( createVariables && !solver.containsVariable( sourceName ) )
+                solver.addVariable( sourceName, sourceLb, sourceUb );
 
             double ub = std::min( FloatUtils::round( sourceUb ), layer->getUb( i ) );
             double lb = std::max( FloatUtils::round( sourceLb ), layer->getLb( i ) );
 
-            gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
+            solver.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
             // If u = l:  y = round(u)
             if ( FloatUtils::areEqual( sourceUb, sourceLb ) )
             {
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                gurobi.addEqConstraint( terms, ub );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                solver.addEqConstraint( terms, ub );
             }
 
             else
             {
-                List<GurobiWrapper::Term> terms;
+                List<ILPSolver::Term> terms;
                 // y <= x + 0.5, i.e. y - x <= 0.5
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addLeqConstraint( terms, 0.5 );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                solver.addLeqConstraint( terms, 0.5 );
 
                 // y >= x - 0.5, i.e. y - x >= -0.5
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addGeqConstraint( terms, -0.5 );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                solver.addGeqConstraint( terms, -0.5 );
             }
         }
     }
 }
 
 
-void LPFormulator::addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addAbsoluteValueLayerToLpRelaxation( ILPSolver &solver,
                                                         const Layer *layer,
                                                         bool createVariables )
 {
@@ -932,7 +748,7 @@ void LPFormulator::addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
                 double sourceValue = sourceLayer->getEliminatedNeuronValue( sourceNeuron );
                 double targetValue = sourceValue > 0 ? sourceValue : -sourceValue;
 
-                gurobi.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
+                solver.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
 
                 continue;
             }
@@ -941,8 +757,8 @@ void LPFormulator::addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
             double sourceLb = sourceLayer->getLb( sourceNeuron );
             double sourceUb = sourceLayer->getUb( sourceNeuron );
             String sourceName = Stringf( "x%u", sourceVariable );
-            if ( createVariables && !gurobi.containsVariable( sourceName ) )
-                gurobi.addVariable( sourceName, sourceLb, sourceUb );
+            if ( createVariables && !solver.containsVariable( sourceName ) )
+                solver.addVariable( sourceName, sourceLb, sourceUb );
 
             if ( !FloatUtils::isNegative( sourceLb ) )
             {
@@ -952,50 +768,50 @@ void LPFormulator::addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
 
                 double ub = std::min( sourceUb, layer->getUb( i ) );
                 double lb = std::max( sourceLb, layer->getLb( i ) );
-                gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
+                solver.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addEqConstraint( terms, 0 );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                solver.addEqConstraint( terms, 0 );
             }
             else if ( !FloatUtils::isPositive( sourceUb ) )
             {
                 double ub = std::min( -sourceLb, layer->getUb( i ) );
                 double lb = std::max( -sourceUb, layer->getLb( i ) );
-                gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
+                solver.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
                 // The AbsoluteValue is inactive, y = -x, i.e. y + x = 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addEqConstraint( terms, 0 );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", sourceVariable ) ) );
+                solver.addEqConstraint( terms, 0 );
             }
             else
             {
                 double ub = std::min( std::max( -sourceLb, sourceUb ), layer->getUb( i ) );
                 double lb = std::max( 0.0, layer->getLb( i ) );
-                gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
+                solver.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
                 /*
                   The phase of this AbsoluteValue is not yet fixed, 0 <= y <= max(-lb, ub).
                 */
                 // y >= 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                gurobi.addGeqConstraint( terms, 0 );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                solver.addGeqConstraint( terms, 0 );
 
                 // y <= max(-lb, ub)
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                gurobi.addLeqConstraint( terms, ub );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                solver.addLeqConstraint( terms, ub );
             }
         }
     }
 }
 
 
-void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addSigmoidLayerToLpRelaxation( ILPSolver &solver,
                                                   const Layer *layer,
                                                   bool createVariables )
 {
@@ -1015,7 +831,7 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
                 double sourceValue = sourceLayer->getEliminatedNeuronValue( sourceNeuron );
                 double targetValue = SigmoidConstraint::sigmoid( sourceValue );
 
-                gurobi.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
+                solver.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
 
                 continue;
             }
@@ -1024,8 +840,8 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
             double sourceLb = sourceLayer->getLb( sourceNeuron );
             double sourceUb = sourceLayer->getUb( sourceNeuron );
             String sourceName = Stringf( "x%u", sourceVariable );
-            if ( createVariables && !gurobi.containsVariable( sourceName ) )
-                gurobi.addVariable( sourceName, sourceLb, sourceUb );
+            if ( createVariables && !solver.containsVariable( sourceName ) )
+                solver.addVariable( sourceName, sourceLb, sourceUb );
 
 
             double sourceUbSigmoid = SigmoidConstraint::sigmoid( sourceUb );
@@ -1034,20 +850,20 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
             double ub = std::min( sourceUbSigmoid, layer->getUb( i ) );
             double lb = std::max( sourceLbSigmoid, layer->getLb( i ) );
 
-            gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
+            solver.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
             // If u = l:  y = sigmoid(u)
             if ( FloatUtils::areEqual( sourceUb, sourceLb ) )
             {
-                List<GurobiWrapper::Term> terms;
+                List<ILPSolver::Term> terms;
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                gurobi.addEqConstraint( terms, ub );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                solver.addEqConstraint( terms, ub );
             }
 
             else
             {
-                List<GurobiWrapper::Term> terms;
+                List<ILPSolver::Term> terms;
                 double lambda = ( ub - lb ) / ( sourceUb - sourceLb );
                 double lambdaPrime = std::min( SigmoidConstraint::sigmoidDerivative( sourceLb ),
                                                SigmoidConstraint::sigmoidDerivative( sourceUb ) );
@@ -1058,10 +874,10 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
                     // y >= lambda * (x - l) + sigmoid(lb), i.e. y - lambda * x >= sigmoid(lb) -
                     // lambda * l
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     terms.append(
-                        GurobiWrapper::Term( -lambda, Stringf( "x%u", sourceVariable ) ) );
-                    gurobi.addGeqConstraint( terms, sourceLbSigmoid - sourceLb * lambda );
+                        ILPSolver::Term( -lambda, Stringf( "x%u", sourceVariable ) ) );
+                    solver.addGeqConstraint( terms, sourceLbSigmoid - sourceLb * lambda );
                 }
 
                 else
@@ -1069,10 +885,10 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
                     // y >= lambda' * (x - l) + sigmoid(lb), i.e. y - lambda' * x >= sigmoid(lb) -
                     // lambda' * l
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     terms.append(
-                        GurobiWrapper::Term( -lambdaPrime, Stringf( "x%u", sourceVariable ) ) );
-                    gurobi.addGeqConstraint( terms, sourceLbSigmoid - sourceLb * lambdaPrime );
+                        ILPSolver::Term( -lambdaPrime, Stringf( "x%u", sourceVariable ) ) );
+                    solver.addGeqConstraint( terms, sourceLbSigmoid - sourceLb * lambdaPrime );
                 }
 
                 // update upper bound
@@ -1081,20 +897,20 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
                     // y <= lambda * (x - u) + sigmoid(ub), i.e. y - lambda * x <= sigmoid(ub) -
                     // lambda * u
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     terms.append(
-                        GurobiWrapper::Term( -lambda, Stringf( "x%u", sourceVariable ) ) );
-                    gurobi.addLeqConstraint( terms, sourceUbSigmoid - sourceUb * lambda );
+                        ILPSolver::Term( -lambda, Stringf( "x%u", sourceVariable ) ) );
+                    solver.addLeqConstraint( terms, sourceUbSigmoid - sourceUb * lambda );
                 }
                 else
                 {
                     // y <= lambda' * (x - u) + sigmoid(ub), i.e. y - lambda' * x <= sigmoid(ub) -
                     // lambda' * u
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     terms.append(
-                        GurobiWrapper::Term( -lambdaPrime, Stringf( "x%u", sourceVariable ) ) );
-                    gurobi.addLeqConstraint( terms, sourceUbSigmoid - sourceUb * lambdaPrime );
+                        ILPSolver::Term( -lambdaPrime, Stringf( "x%u", sourceVariable ) ) );
+                    solver.addLeqConstraint( terms, sourceUbSigmoid - sourceUb * lambdaPrime );
                 }
             }
         }
@@ -1102,7 +918,7 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
 }
 
 
-void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addSignLayerToLpRelaxation( ILPSolver &solver,
                                                const Layer *layer,
                                                bool createVariables )
 {
@@ -1123,7 +939,7 @@ void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
             double sourceValue = sourceLayer->getEliminatedNeuronValue( sourceNeuron );
             double targetValue = FloatUtils::isNegative( sourceValue ) ? -1 : 1;
 
-            gurobi.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
+            solver.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
 
             continue;
         }
@@ -1132,18 +948,18 @@ void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
         double sourceLb = sourceLayer->getLb( sourceNeuron );
         double sourceUb = sourceLayer->getUb( sourceNeuron );
         String sourceName = Stringf( "x%u", sourceVariable );
-        if ( createVariables && !gurobi.containsVariable( sourceName ) )
-            gurobi.addVariable( sourceName, sourceLb, sourceUb );
+        if ( createVariables && !solver.containsVariable( sourceName ) )
+            solver.addVariable( sourceName, sourceLb, sourceUb );
 
         if ( !FloatUtils::isNegative( sourceLb ) )
         {
             // The Sign is positive, y = 1
-            gurobi.addVariable( Stringf( "x%u", targetVariable ), 1, 1 );
+            solver.addVariable( Stringf( "x%u", targetVariable ), 1, 1 );
         }
         else if ( FloatUtils::isNegative( sourceUb ) )
         {
             // The Sign is negative, y = -1
-            gurobi.addVariable( Stringf( "x%u", targetVariable ), -1, -1 );
+            solver.addVariable( Stringf( "x%u", targetVariable ), -1, -1 );
         }
         else
         {
@@ -1159,17 +975,17 @@ void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
             */
 
             // -1 <= y <= 1
-            gurobi.addVariable( Stringf( "x%u", targetVariable ), -1, 1 );
+            solver.addVariable( Stringf( "x%u", targetVariable ), -1, 1 );
 
             /*
                      2
               y <= ----- x + 1
                     - l
             */
-            List<GurobiWrapper::Term> terms;
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term( 2.0 / sourceLb, Stringf( "x%u", sourceVariable ) ) );
-            gurobi.addLeqConstraint( terms, 1 );
+            List<ILPSolver::Term> terms;
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 2.0 / sourceLb, Stringf( "x%u", sourceVariable ) ) );
+            solver.addLeqConstraint( terms, 1 );
 
             /*
                      2
@@ -1177,16 +993,16 @@ void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
                      u
             */
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
             terms.append(
-                GurobiWrapper::Term( -2.0 / sourceUb, Stringf( "x%u", sourceVariable ) ) );
-            gurobi.addGeqConstraint( terms, -1 );
+                ILPSolver::Term( -2.0 / sourceUb, Stringf( "x%u", sourceVariable ) ) );
+            solver.addGeqConstraint( terms, -1 );
         }
     }
 }
 
 
-void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addMaxLayerToLpRelaxation( ILPSolver &solver,
                                               const Layer *layer,
                                               bool createVariables )
 {
@@ -1196,7 +1012,7 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             continue;
 
         unsigned targetVariable = layer->neuronToVariable( i );
-        gurobi.addVariable(
+        solver.addVariable(
             Stringf( "x%u", targetVariable ), layer->getLb( i ), layer->getUb( i ) );
 
         List<NeuronIndex> sources = layer->getActivationSources( i );
@@ -1206,7 +1022,7 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
 
         double maxConcreteUb = FloatUtils::negativeInfinity();
 
-        List<GurobiWrapper::Term> terms;
+        List<ILPSolver::Term> terms;
 
         for ( const auto &source : sources )
         {
@@ -1226,15 +1042,15 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             double sourceLb = sourceLayer->getLb( sourceNeuron );
             double sourceUb = sourceLayer->getUb( sourceNeuron );
             String sourceName = Stringf( "x%u", sourceVariable );
-            if ( createVariables && !gurobi.containsVariable( sourceName ) )
-                gurobi.addVariable( sourceName, sourceLb, sourceUb );
+            if ( createVariables && !solver.containsVariable( sourceName ) )
+                solver.addVariable( sourceName, sourceLb, sourceUb );
 
 
             // Target is at least source: target - source >= 0
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-            gurobi.addGeqConstraint( terms, 0 );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+            solver.addGeqConstraint( terms, 0 );
 
             // Find maximal concrete upper bound
             if ( sourceUb > maxConcreteUb )
@@ -1246,8 +1062,8 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             // At least one of the sources has a fixed value,
             // and this fixed value dominates other sources.
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            gurobi.addEqConstraint( terms, maxFixedSourceValue );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            solver.addEqConstraint( terms, maxFixedSourceValue );
         }
         else
         {
@@ -1255,20 +1071,20 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             if ( haveFixedSourceValue )
             {
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                gurobi.addGeqConstraint( terms, maxFixedSourceValue );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                solver.addGeqConstraint( terms, maxFixedSourceValue );
             }
 
             // Target must be smaller than greatest concrete upper bound
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            gurobi.addLeqConstraint( terms, maxConcreteUb );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            solver.addLeqConstraint( terms, maxConcreteUb );
         }
     }
 }
 
 
-void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addSoftmaxLayerToLpRelaxation( ILPSolver &solver,
                                                   const Layer *layer,
                                                   bool createVariables )
 {
@@ -1293,8 +1109,8 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             double sourceLb = sourceLayer->getLb( sourceNeuron );
             double sourceUb = sourceLayer->getUb( sourceNeuron );
             String sourceName = Stringf( "x%u", sourceVariable );
-            if ( createVariables && !gurobi.containsVariable( sourceName ) )
-                gurobi.addVariable( sourceName, sourceLb, sourceUb );
+            if ( createVariables && !solver.containsVariable( sourceName ) )
+                solver.addVariable( sourceName, sourceLb, sourceUb );
 
             sourceLbs.append( sourceLb - GlobalConfiguration::DEFAULT_EPSILON_FOR_COMPARISONS );
             sourceUbs.append( sourceUb + GlobalConfiguration::DEFAULT_EPSILON_FOR_COMPARISONS );
@@ -1326,18 +1142,18 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
         targetUbs[index] = ub;
 
         unsigned targetVariable = layer->neuronToVariable( i );
-        gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
+        solver.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
         double bias;
         SoftmaxBoundType boundType = Options::get()->getSoftmaxBoundType();
 
 
-        List<GurobiWrapper::Term> terms;
+        List<ILPSolver::Term> terms;
         if ( FloatUtils::areEqual( lb, ub ) )
         {
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            gurobi.addEqConstraint( terms, ub );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            solver.addEqConstraint( terms, ub );
         }
         else
         {
@@ -1354,7 +1170,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                 if ( !useLSE2 )
                 {
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     bias = DeepPolySoftmaxElement::LSELowerBound(
                         sourceMids, sourceLbs, sourceUbs, index );
                     for ( const auto &source : sources )
@@ -1365,16 +1181,16 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                         double dldj = DeepPolySoftmaxElement::dLSELowerBound(
                             sourceMids, sourceLbs, sourceUbs, index, inputIndex );
                         terms.append(
-                            GurobiWrapper::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
+                            ILPSolver::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
                         bias -= dldj * sourceMids[inputIndex];
                         ++inputIndex;
                     }
-                    gurobi.addGeqConstraint( terms, bias );
+                    solver.addGeqConstraint( terms, bias );
                 }
                 else
                 {
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     bias = DeepPolySoftmaxElement::LSELowerBound2(
                         sourceMids, sourceLbs, sourceUbs, index );
                     for ( const auto &source : sources )
@@ -1385,15 +1201,15 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                         double dldj = DeepPolySoftmaxElement::dLSELowerBound2(
                             sourceMids, sourceLbs, sourceUbs, index, inputIndex );
                         terms.append(
-                            GurobiWrapper::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
+                            ILPSolver::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
                         bias -= dldj * sourceMids[inputIndex];
                         ++inputIndex;
                     }
-                    gurobi.addGeqConstraint( terms, bias );
+                    solver.addGeqConstraint( terms, bias );
                 }
 
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 bias = DeepPolySoftmaxElement::LSEUpperBound(
                     sourceMids, targetLbs, targetUbs, index );
                 inputIndex = 0;
@@ -1404,16 +1220,16 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                     unsigned sourceVariable = sourceLayer->neuronToVariable( sourceNeuron );
                     double dudj = DeepPolySoftmaxElement::dLSEUpperbound(
                         sourceMids, targetLbs, targetUbs, index, inputIndex );
-                    terms.append( GurobiWrapper::Term( -dudj, Stringf( "x%u", sourceVariable ) ) );
+                    terms.append( ILPSolver::Term( -dudj, Stringf( "x%u", sourceVariable ) ) );
                     bias -= dudj * sourceMids[inputIndex];
                     ++inputIndex;
                 }
-                gurobi.addLeqConstraint( terms, bias );
+                solver.addLeqConstraint( terms, bias );
             }
             else if ( boundType == SoftmaxBoundType::EXPONENTIAL_RECIPROCAL_DECOMPOSITION )
             {
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 bias =
                     DeepPolySoftmaxElement::ERLowerBound( sourceMids, sourceLbs, sourceUbs, index );
                 unsigned inputIndex = 0;
@@ -1424,14 +1240,14 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                     unsigned sourceVariable = sourceLayer->neuronToVariable( sourceNeuron );
                     double dldj = DeepPolySoftmaxElement::dERLowerBound(
                         sourceMids, sourceLbs, sourceUbs, index, inputIndex );
-                    terms.append( GurobiWrapper::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
+                    terms.append( ILPSolver::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
                     bias -= dldj * sourceMids[inputIndex];
                     ++inputIndex;
                 }
-                gurobi.addGeqConstraint( terms, bias );
+                solver.addGeqConstraint( terms, bias );
 
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 bias =
                     DeepPolySoftmaxElement::ERUpperBound( sourceMids, targetLbs, targetUbs, index );
                 inputIndex = 0;
@@ -1442,17 +1258,17 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                     unsigned sourceVariable = sourceLayer->neuronToVariable( sourceNeuron );
                     double dudj = DeepPolySoftmaxElement::dERUpperBound(
                         sourceMids, targetLbs, targetUbs, index, inputIndex );
-                    terms.append( GurobiWrapper::Term( -dudj, Stringf( "x%u", sourceVariable ) ) );
+                    terms.append( ILPSolver::Term( -dudj, Stringf( "x%u", sourceVariable ) ) );
                     bias -= dudj * sourceMids[inputIndex];
                     ++inputIndex;
                 }
-                gurobi.addLeqConstraint( terms, bias );
+                solver.addLeqConstraint( terms, bias );
             }
         }
     }
 }
 
-void LPFormulator::addBilinearLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addBilinearLayerToLpRelaxation( ILPSolver &solver,
                                                    const Layer *layer,
                                                    bool createVariables )
 {
@@ -1482,8 +1298,8 @@ void LPFormulator::addBilinearLayerToLpRelaxation( GurobiWrapper &gurobi,
                 sourceLbs.append( sourceLb );
                 sourceUbs.append( sourceUb );
 
-                if ( createVariables && !gurobi.containsVariable( sourceName ) )
-                    gurobi.addVariable( sourceName, sourceLb, sourceUb );
+                if ( createVariables && !solver.containsVariable( sourceName ) )
+                    solver.addVariable( sourceName, sourceLb, sourceUb );
 
                 if ( !sourceLayer->neuronEliminated( sourceNeuron ) )
                 {
@@ -1500,7 +1316,7 @@ void LPFormulator::addBilinearLayerToLpRelaxation( GurobiWrapper &gurobi,
             {
                 // If the both source neurons have been eliminated, this neuron is constant
                 double targetValue = sourceValues[0] * sourceValues[1];
-                gurobi.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
+                solver.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
                 continue;
             }
 
@@ -1518,36 +1334,36 @@ void LPFormulator::addBilinearLayerToLpRelaxation( GurobiWrapper &gurobi,
                     ub = v;
             }
 
-            gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
+            solver.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
             // Lower bound: out >= l_y * x + l_x * y - l_x * l_y
-            List<GurobiWrapper::Term> terms;
+            List<ILPSolver::Term> terms;
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term(
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term(
                 -sourceLbs[1],
                 Stringf( "x%u", sourceLayer->neuronToVariable( sourceNeurons[0] ) ) ) );
-            terms.append( GurobiWrapper::Term(
+            terms.append( ILPSolver::Term(
                 -sourceLbs[0],
                 Stringf( "x%u", sourceLayer->neuronToVariable( sourceNeurons[1] ) ) ) );
-            gurobi.addGeqConstraint( terms, -sourceLbs[0] * sourceLbs[1] );
+            solver.addGeqConstraint( terms, -sourceLbs[0] * sourceLbs[1] );
 
             // Upper bound: out <= u_y * x + l_x * y - l_x * u_y
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term(
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term(
                 -sourceUbs[1],
                 Stringf( "x%u", sourceLayer->neuronToVariable( sourceNeurons[0] ) ) ) );
-            terms.append( GurobiWrapper::Term(
+            terms.append( ILPSolver::Term(
                 -sourceLbs[0],
                 Stringf( "x%u", sourceLayer->neuronToVariable( sourceNeurons[1] ) ) ) );
-            gurobi.addLeqConstraint( terms, -sourceLbs[0] * sourceUbs[1] );
+            solver.addLeqConstraint( terms, -sourceLbs[0] * sourceUbs[1] );
         }
     }
 }
 
 
-void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addWeightedSumLayerToLpRelaxation( ILPSolver &solver,
                                                       const Layer *layer,
                                                       bool createVariables )
 {
@@ -1563,9 +1379,9 @@ void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
                 if ( !sourceLayer->neuronEliminated( j ) )
                 {
                     Stringf sourceVariableName( "x%u", sourceLayer->neuronToVariable( j ) );
-                    if ( !gurobi.containsVariable( sourceVariableName ) )
+                    if ( !solver.containsVariable( sourceVariableName ) )
                     {
-                        gurobi.addVariable(
+                        solver.addVariable(
                             sourceVariableName, sourceLayer->getLb( j ), sourceLayer->getUb( j ) );
                     }
                 }
@@ -1579,10 +1395,10 @@ void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
         {
             unsigned variable = layer->neuronToVariable( i );
 
-            gurobi.addVariable( Stringf( "x%u", variable ), layer->getLb( i ), layer->getUb( i ) );
+            solver.addVariable( Stringf( "x%u", variable ), layer->getLb( i ), layer->getUb( i ) );
 
-            List<GurobiWrapper::Term> terms;
-            terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", variable ) ) );
+            List<ILPSolver::Term> terms;
+            terms.append( ILPSolver::Term( -1, Stringf( "x%u", variable ) ) );
 
             double bias = -layer->getBias( i );
 
@@ -1597,7 +1413,7 @@ void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
                     if ( !sourceLayer->neuronEliminated( j ) )
                     {
                         Stringf sourceVariableName( "x%u", sourceLayer->neuronToVariable( j ) );
-                        terms.append( GurobiWrapper::Term( weight, sourceVariableName ) );
+                        terms.append( ILPSolver::Term( weight, sourceVariableName ) );
                     }
                     else
                     {
@@ -1606,12 +1422,12 @@ void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
                 }
             }
 
-            gurobi.addEqConstraint( terms, bias );
+            solver.addEqConstraint( terms, bias );
         }
     }
 }
 
-void LPFormulator::addLeakyReluLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addLeakyReluLayerToLpRelaxation( ILPSolver &solver,
                                                     const Layer *layer,
                                                     bool createVariables )
 {
@@ -1632,7 +1448,7 @@ void LPFormulator::addLeakyReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 double sourceValue = sourceLayer->getEliminatedNeuronValue( sourceNeuron );
                 double targetValue = sourceValue > 0 ? sourceValue : 0;
 
-                gurobi.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
+                solver.addVariable( Stringf( "x%u", targetVariable ), targetValue, targetValue );
 
                 continue;
             }
@@ -1642,28 +1458,28 @@ void LPFormulator::addLeakyReluLayerToLpRelaxation( GurobiWrapper &gurobi,
             double sourceUb = sourceLayer->getUb( sourceNeuron );
 
             String sourceName = Stringf( "x%u", sourceVariable );
-            if ( createVariables && !gurobi.containsVariable( sourceName ) )
-                gurobi.addVariable( sourceName, sourceLb, sourceUb );
+            if ( createVariables && !solver.containsVariable( sourceName ) )
+                solver.addVariable( sourceName, sourceLb, sourceUb );
 
-            gurobi.addVariable(
+            solver.addVariable(
                 Stringf( "x%u", targetVariable ), layer->getLb( i ), layer->getUb( i ) );
 
             if ( !FloatUtils::isNegative( sourceLb ) )
             {
                 // The LeakyReLU is active, y = x
 
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addEqConstraint( terms, 0 );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                solver.addEqConstraint( terms, 0 );
             }
             else if ( !FloatUtils::isPositive( sourceUb ) )
             {
                 // The LeakyReLU is inactive, y = alpha * x
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addEqConstraint( terms, 0 );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
+                solver.addEqConstraint( terms, 0 );
             }
             else
             {
@@ -1680,21 +1496,21 @@ void LPFormulator::addLeakyReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 */
 
                 // y >= alpha * x
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addGeqConstraint( terms, 0 );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
+                solver.addGeqConstraint( terms, 0 );
 
                 // y >= x, i.e. y - x >= 0
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addGeqConstraint( terms, 0 );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                solver.addGeqConstraint( terms, 0 );
 
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -coeff, Stringf( "x%u", sourceVariable ) ) );
-                gurobi.addLeqConstraint( terms, bias );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -coeff, Stringf( "x%u", sourceVariable ) ) );
+                solver.addLeqConstraint( terms, bias );
             }
         }
     }
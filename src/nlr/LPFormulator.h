@@ -16,16 +16,14 @@
 #ifndef __LPFormulator_h__
 #define __LPFormulator_h__
 
-#include "GurobiWrapper.h"
+#include "ILPSolver.h"
 #include "LayerOwner.h"
 #include "Map.h"
 #include "ParallelSolver.h"
 
 #include <atomic>
-#include <boost/chrono.hpp>
-#include <boost/lockfree/queue.hpp>
-#include <boost/thread.hpp>
 #include <climits>
+#include <memory>
 #include <mutex>
 
 namespace NLR {
@@ -71,69 +69,85 @@ public:
       tightening
     */
     void createLPRelaxation( const Map<unsigned, Layer *> &layers,
-                             GurobiWrapper &gurobi,
+                             ILPSolver &solver,
                              unsigned lastLayer = UINT_MAX );
     void createLPRelaxationAfter( const Map<unsigned, Layer *> &layers,
-                                  GurobiWrapper &gurobi,
+                                  ILPSolver &solver,
                                   unsigned firstLayer );
-    double solveLPRelaxation( GurobiWrapper &gurobi,
+    double solveLPRelaxation( ILPSolver &solver,
                               const Map<unsigned, Layer *> &layers,
                               MinOrMax minOrMax,
                               String variableName,
                               unsigned lastLayer = UINT_MAX );
 
-    void addLayerToModel( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    void addLayerToModel( ILPSolver &solver, const Layer *layer, bool createVariables );
 
 private:
     LayerOwner *_layerOwner;
     bool _cutoffInUse;
     double _cutoffValue;
 
-    void addInputLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer );
+    /*
+      Create the solver used to optimize the LP relaxations: Gurobi if
+      it is available, or the native LP solver otherwise
+    */
+    static ILPSolver *createLPSolver();
+
+    void addInputLayerToLpRelaxation( ILPSolver &solver, const Layer *layer );
 
     void
-    addReluLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    addReluLayerToLpRelaxation( ILPSolver &solver, const Layer *layer, bool createVariables );
 
-    void addLeakyReluLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addLeakyReluLayerToLpRelaxation( ILPSolver &solver,
                                           const Layer *layer,
                                           bool createVariables );
 
     void
-    addSignLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    addSignLayerToLpRelaxation( ILPSolver &solver, const Layer *layer, bool createVariables );
 
     void
-    addMaxLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    addMaxLayerToLpRelaxation( ILPSolver &solver, const Layer *layer, bool createVariables );
 
     void
-    addRoundLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    addRoundLayerToLpRelaxation( ILPSolver &solver, const Layer *layer, bool createVariables );
 
-    void addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addAbsoluteValueLayerToLpRelaxation( ILPSolver &solver,
                                               const Layer *layer,
                                               bool createVariables );
 
-    void addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addSigmoidLayerToLpRelaxation( ILPSolver &solver,
                                         const Layer *layer,
                                         bool createVariables );
 
-    void addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addSoftmaxLayerToLpRelaxation( ILPSolver &solver,
                                         const Layer *layer,
                                         bool createVariables );
 
-    void addBilinearLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addBilinearLayerToLpRelaxation( ILPSolver &solver,
                                          const Layer *layer,
                                          bool createVariables );
 
-    void addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addWeightedSumLayerToLpRelaxation( ILPSolver &solver,
                                             const Layer *layer,
                                             bool createVariables );
 
-    void optimizeBoundsOfNeuronsWithLpRlaxation( ThreadArgument &args, bool backward );
+    /*
+      Tighten the bounds of the neurons of the target layer, using the
+      workers of the pool. The relaxation encodes the layers up to
+      lastIndexOfRelaxation, or the layers after it if backward is set.
+    */
+    void optimizeBoundsOfNeuronsWithLpRelaxation( SolverPool &pool,
+                                                  TighteningState &state,
+                                                  const Map<unsigned, Layer *> &layers,
+                                                  unsigned lastIndexOfRelaxation,
+                                                  unsigned targetIndex,
+                                                  bool backward );
 
     /*
       Optimize for the min/max value of variableName with respect to the constraints
-      encoded in gurobi. If the query is infeasible, *infeasible is set to true.
+      encoded in solver. If the query is infeasible, *infeasible is set to true.
     */
-    static double optimizeWithGurobi( GurobiWrapper &gurobi,
+    static double optimizeWithGurobi( ILPSolver &solver,
                                       MinOrMax minOrMax,
                                       String variableName,
                                       double cutoffValue,
@@ -142,7 +156,9 @@ private:
     /*
       Tighten the upper- and lower- bound of a varaible with LPRelaxation
     */
-    static void tightenSingleVariableBoundsWithLPRelaxation( ThreadArgument &argument );
+    void tightenSingleVariableBoundsWithLPRelaxation( ILPSolver &solver,
+                                                      const NeuronTask &task,
+                                                      TighteningState &state );
 };
 
 } // namespace NLR
@@ -15,6 +15,7 @@
 
 #include "Layer.h"
 
+#include "BoundKernels.h"
 #include "Options.h"
 #include "Query.h"
 #include "SoftmaxConstraint.h"
@@ -37,10 +38,15 @@ Layer::Layer( unsigned index, Type type, unsigned size, LayerOwner *layerOwner )
     , _type( type )
     , _size( size )
     , _layerOwner( layerOwner )
+    , _weightsFinalized( true )
     , _bias( NULL )
     , _assignment( NULL )
+    , _simulations( NULL )
+    , _numberOfSimulations( 0 )
     , _lb( NULL )
     , _ub( NULL )
+    , _workLb( NULL )
+    , _workUb( NULL )
     , _inputLayerSize( 0 )
     , _symbolicLb( NULL )
     , _symbolicUb( NULL )
@@ -60,6 +66,9 @@ void Layer::allocateMemory()
     {
         _bias = new double[_size];
         std::fill_n( _bias, _size, 0 );
+
+        _workLb = new double[_size];
+        _workUb = new double[_size];
     }
 
     _lb = new double[_size];
@@ -70,8 +79,7 @@ void Layer::allocateMemory()
 
     _assignment = new double[_size];
 
-    _simulations.assign(
-        _size, Vector<double>( Options::get()->getInt( Options::NUMBER_OF_SIMULATIONS ) ) );
+    resizeSimulations( Options::get()->getInt( Options::NUMBER_OF_SIMULATIONS ) );
 
     _inputLayerSize = ( _type == INPUT ) ? _size : _layerOwner->getLayer( 0 )->getSize();
     if ( Options::get()->getSymbolicBoundTighteningType() ==
@@ -117,14 +125,57 @@ double Layer::getAssignment( unsigned neuron ) const
     return _assignment[neuron];
 }
 
+void Layer::resizeSimulations( unsigned numberOfSimulations )
+{
+    if ( _simulations && numberOfSimulations == _numberOfSimulations )
+        return;
+
+    if ( _simulations )
+        delete[] _simulations;
+
+    _numberOfSimulations = numberOfSimulations;
+    _simulations = new double[_size * _numberOfSimulations];
+    std::fill_n( _simulations, _size * _numberOfSimulations, 0 );
+}
+
 void Layer::setSimulations( const Vector<Vector<double>> *values )
 {
-    _simulations = *values;
+    ASSERT( values->size() == _size );
+
+    resizeSimulations( _size > 0 ? values->get( 0 ).size() : 0 );
+    for ( unsigned i = 0; i < _size; ++i )
+    {
+        ASSERT( values->get( i ).size() == _numberOfSimulations );
+        memcpy( _simulations + i * _numberOfSimulations,
+                values->get( i ).data(),
+                sizeof( double ) * _numberOfSimulations );
+    }
 }
 
-const Vector<Vector<double>> *Layer::getSimulations() const
+void Layer::setSimulations( const double *values, unsigned numberOfSimulations )
 {
-    return &_simulations;
+    resizeSimulations( numberOfSimulations );
+    memcpy( _simulations, values, sizeof( double ) * _size * _numberOfSimulations );
+}
+
+unsigned Layer::getNumberOfSimulations() const
+{
+    return _numberOfSimulations;
+}
+
+const double *Layer::getSimulations() const
+{
+    return _simulations;
+}
+
+const double *Layer::getSimulations( unsigned neuron ) const
+{
+    return _simulations + neuron * _numberOfSimulations;
+}
+
+const double *Layer::getSourceSimulations( NeuronIndex sourceIndex ) const
+{
+    return _layerOwner->getLayer( sourceIndex._layer )->getSimulations( sourceIndex._neuron );
 }
 
 void Layer::computeAssignment()
@@ -141,12 +192,8 @@ void Layer::computeAssignment()
         {
             const Layer *sourceLayer = _layerOwner->getLayer( sourceLayerEntry.first );
             const double *sourceAssignment = sourceLayer->getAssignment();
-            unsigned sourceSize = sourceLayerEntry.second;
-            const double *weights = _layerToWeights[sourceLayerEntry.first];
-
-            for ( unsigned i = 0; i < sourceSize; ++i )
-                for ( unsigned j = 0; j < _size; ++j )
-                    _assignment[j] += ( sourceAssignment[i] * weights[i * _size + j] );
+            _layerToWeights[sourceLayerEntry.first]->addVectorTimesWeights( sourceAssignment,
+                                                                            _assignment );
         }
     }
 
@@ -292,87 +339,78 @@ void Layer::computeAssignment()
 void Layer::computeSimulations()
 {
     ASSERT( _type != INPUT );
+    ASSERT( !_sourceLayers.empty() );
+
+    /*
+      All source layers hold the same number of simulations, which are
+      propagated as a batch: weighted sums are computed as a single
+      matrix product, and activation functions are applied to the
+      contiguous simulations of each neuron.
+    */
+    resizeSimulations(
+        _layerOwner->getLayer( _sourceLayers.begin()->first )->getNumberOfSimulations() );
+    unsigned simulationSize = _numberOfSimulations;
 
-    unsigned simulationSize = Options::get()->getInt( Options::NUMBER_OF_SIMULATIONS );
     if ( _type == WEIGHTED_SUM )
     {
+        for ( unsigned i = 0; i < _size; ++i )
+            std::fill_n( _simulations + i * simulationSize, simulationSize, _bias[i] );
+
         // Process each of the source layers
         for ( auto &sourceLayerEntry : _sourceLayers )
         {
             const Layer *sourceLayer = _layerOwner->getLayer( sourceLayerEntry.first );
-            const Vector<Vector<double>> *sourceSimulations = sourceLayer->getSimulations();
+            ASSERT( sourceLayer->getNumberOfSimulations() == simulationSize );
 
-            unsigned sourceSize = sourceLayerEntry.second;
-            const double *weights = _layerToWeights[sourceLayerEntry.first];
-
-            for ( unsigned i = 0; i < _size; ++i )
-            {
-                for ( unsigned j = 0; j < simulationSize; ++j )
-                    _simulations[i][j] = _bias[i];
-            }
-
-            for ( unsigned i = 0; i < sourceSize; ++i )
-                for ( unsigned j = 0; j < simulationSize; ++j )
-                    for ( unsigned k = 0; k < _size; ++k )
-                        _simulations[k][j] +=
-                            ( ( *sourceSimulations ).get( i ).get( j ) * weights[i * _size + k] );
+            _layerToWeights[sourceLayerEntry.first]->addTransposedWeightsTimesMatrix(
+                sourceLayer->getSimulations(), simulationSize, _simulations );
         }
     }
     else if ( _type == RELU )
     {
         for ( unsigned i = 0; i < _size; ++i )
         {
-            NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-            const Vector<double> &simulations =
-                ( *( _layerOwner->getLayer( sourceIndex._layer )->getSimulations() ) )
-                    .get( sourceIndex._neuron );
+            const double *input = getSourceSimulations( *_neuronToActivationSources[i].begin() );
+            double *output = _simulations + i * simulationSize;
             for ( unsigned j = 0; j < simulationSize; ++j )
-                _simulations[i][j] = FloatUtils::max( simulations.get( j ), 0 );
+                output[j] = input[j] > 0 ? input[j] : 0;
         }
     }
     else if ( _type == LEAKY_RELU )
     {
+        ASSERT( _alpha > 0 && _alpha < 1 );
         for ( unsigned i = 0; i < _size; ++i )
         {
-            NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-            const Vector<double> &simulations =
-                ( *( _layerOwner->getLayer( sourceIndex._layer )->getSimulations() ) )
-                    .get( sourceIndex._neuron );
-            ASSERT( _alpha > 0 && _alpha < 1 );
+            const double *input = getSourceSimulations( *_neuronToActivationSources[i].begin() );
+            double *output = _simulations + i * simulationSize;
             for ( unsigned j = 0; j < simulationSize; ++j )
-                _simulations[i][j] =
-                    FloatUtils::max( simulations.get( j ), _alpha * simulations.get( j ) );
+                output[j] = input[j] > 0 ? input[j] : _alpha * input[j];
         }
     }
     else if ( _type == ABSOLUTE_VALUE )
     {
         for ( unsigned i = 0; i < _size; ++i )
         {
-            NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-            const Vector<double> &simulations =
-                ( *( _layerOwner->getLayer( sourceIndex._layer )->getSimulations() ) )
-                    .get( sourceIndex._neuron );
+            const double *input = getSourceSimulations( *_neuronToActivationSources[i].begin() );
+            double *output = _simulations + i * simulationSize;
             for ( unsigned j = 0; j < simulationSize; ++j )
-                _simulations[i][j] = FloatUtils::abs( simulations.get( j ) );
+                output[j] = FloatUtils::abs( input[j] );
         }
     }
     else if ( _type == MAX )
     {
         for ( unsigned i = 0; i < _size; ++i )
         {
-            for ( unsigned j = 0; j < simulationSize; ++j )
-            {
-                _simulations[i][j] = FloatUtils::negativeInfinity();
+            double *output = _simulations + i * simulationSize;
+            std::fill_n( output, simulationSize, FloatUtils::negativeInfinity() );
 
-                for ( const auto &input : _neuronToActivationSources[i] )
+            for ( const auto &sourceIndex : _neuronToActivationSources[i] )
+            {
+                const double *input = getSourceSimulations( sourceIndex );
+                for ( unsigned j = 0; j < simulationSize; ++j )
                 {
-                    // double value = ( *( _layerOwner->getLayer( input._layer )->getSimulations() )
-                    // )[input._neuron][j];
-                    double value = ( *( _layerOwner->getLayer( input._layer )->getSimulations() ) )
-                                       .get( input._neuron )
-                                       .get( j );
-                    if ( value > _simulations[i][j] )
-                        _simulations[i][j] = value;
+                    if ( input[j] > output[j] )
+                        output[j] = input[j];
                 }
             }
         }
@@ -381,61 +419,58 @@ void Layer::computeSimulations()
     {
         for ( unsigned i = 0; i < _size; ++i )
         {
-            NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-            const Vector<double> &simulations =
-                ( *( _layerOwner->getLayer( sourceIndex._layer )->getSimulations() ) ).get( i );
+            const double *input = getSourceSimulations( *_neuronToActivationSources[i].begin() );
+            double *output = _simulations + i * simulationSize;
             for ( unsigned j = 0; j < simulationSize; ++j )
-                _simulations[i][j] = FloatUtils::isNegative( simulations.get( j ) ) ? -1 : 1;
+                output[j] = FloatUtils::isNegative( input[j] ) ? -1 : 1;
         }
     }
     else if ( _type == SIGMOID )
     {
         for ( unsigned i = 0; i < _size; ++i )
         {
-            NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-            const Vector<double> &simulations =
-                ( *( _layerOwner->getLayer( sourceIndex._layer )->getSimulations() ) ).get( i );
+            const double *input = getSourceSimulations( *_neuronToActivationSources[i].begin() );
+            double *output = _simulations + i * simulationSize;
             for ( unsigned j = 0; j < simulationSize; ++j )
-                _simulations[i][j] = 1 / ( 1 + std::exp( -simulations.get( j ) ) );
+                output[j] = 1 / ( 1 + std::exp( -input[j] ) );
         }
     }
     else if ( _type == ROUND )
     {
         for ( unsigned i = 0; i < _size; ++i )
         {
-            NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-            const Vector<double> &simulations =
-                ( *( _layerOwner->getLayer( sourceIndex._layer )->getSimulations() ) ).get( i );
+            const double *input = getSourceSimulations( *_neuronToActivationSources[i].begin() );
+            double *output = _simulations + i * simulationSize;
             for ( unsigned j = 0; j < simulationSize; ++j )
-                _simulations[i][j] = FloatUtils::round( simulations.get( j ) );
+                output[j] = FloatUtils::round( input[j] );
         }
     }
     else if ( _type == SOFTMAX )
     {
+        Vector<const double *> sourceSimulations;
+        Vector<double> inputs;
+        Vector<double> outputs;
+
         for ( unsigned i = 0; i < _size; ++i )
         {
-            for ( unsigned j = 0; j < simulationSize; ++j )
+            sourceSimulations.clear();
+            unsigned outputIndex = 0;
+            for ( const auto &sourceIndex : _neuronToActivationSources[i] )
             {
-                _simulations[i][j] = FloatUtils::negativeInfinity();
-
-                Vector<double> inputs;
-                Vector<double> outputs;
-                unsigned outputIndex = 0;
-                unsigned index = 0;
+                if ( sourceIndex._neuron == i )
+                    outputIndex = sourceSimulations.size();
+                sourceSimulations.append( getSourceSimulations( sourceIndex ) );
+            }
 
-                for ( const auto &input : _neuronToActivationSources[i] )
-                {
-                    if ( input._neuron == i )
-                        outputIndex = index;
-                    double value = ( *( _layerOwner->getLayer( input._layer )->getSimulations() ) )
-                                       .get( input._neuron )
-                                       .get( j );
-                    inputs.append( value );
-                    ++index;
-                }
+            double *output = _simulations + i * simulationSize;
+            for ( unsigned j = 0; j < simulationSize; ++j )
+            {
+                inputs.clear();
+                for ( const auto &input : sourceSimulations )
+                    inputs.append( input[j] );
 
                 SoftmaxConstraint::softmax( inputs, outputs );
-                _simulations[i][j] = outputs[outputIndex];
+                output[j] = outputs[outputIndex];
             }
         }
     }
@@ -443,16 +478,14 @@ void Layer::computeSimulations()
     {
         for ( unsigned i = 0; i < _size; ++i )
         {
-            for ( unsigned j = 0; j < simulationSize; ++j )
+            double *output = _simulations + i * simulationSize;
+            std::fill_n( output, simulationSize, 1 );
+
+            for ( const auto &sourceIndex : _neuronToActivationSources[i] )
             {
-                _simulations[i][j] = 1;
-                for ( const auto &input : _neuronToActivationSources[i] )
-                {
-                    double value = ( *( _layerOwner->getLayer( input._layer )->getSimulations() ) )
-                                       .get( input._neuron )
-                                       .get( j );
-                    _simulations[i][j] *= value;
-                }
+                const double *input = getSourceSimulations( sourceIndex );
+                for ( unsigned j = 0; j < simulationSize; ++j )
+                    output[j] *= input[j];
             }
         }
     }
@@ -466,10 +499,8 @@ void Layer::computeSimulations()
     // was computed due to left-over weights, etc, their set values
     // prevail.
     for ( const auto &eliminated : _eliminatedNeurons )
-    {
-        for ( unsigned j = 0; j < simulationSize; ++j )
-            _simulations[eliminated.first][j] = eliminated.second;
-    }
+        std::fill_n(
+            _simulations + eliminated.first * simulationSize, simulationSize, eliminated.second );
 }
 
 void Layer::addSourceLayer( unsigned layerNumber, unsigned layerSize )
@@ -483,13 +514,10 @@ void Layer::addSourceLayer( unsigned layerNumber, unsigned layerSize )
 
     if ( _type == WEIGHTED_SUM )
     {
-        _layerToWeights[layerNumber] = new double[layerSize * _size];
-        _layerToPositiveWeights[layerNumber] = new double[layerSize * _size];
-        _layerToNegativeWeights[layerNumber] = new double[layerSize * _size];
-
-        std::fill_n( _layerToWeights[layerNumber], layerSize * _size, 0 );
-        std::fill_n( _layerToPositiveWeights[layerNumber], layerSize * _size, 0 );
-        std::fill_n( _layerToNegativeWeights[layerNumber], layerSize * _size, 0 );
+        // The weights are collected sparsely, and their representation
+        // is chosen once they are all known, by finalizeWeights()
+        _layerToWeights[layerNumber] = new WeightMatrix( layerSize, _size, WeightMatrix::CSR );
+        _weightsFinalized = false;
     }
 }
 
@@ -508,65 +536,59 @@ const Set<unsigned> &Layer::getSuccessorLayers() const
     return _successorLayers;
 }
 
-const double *Layer::getWeightMatrix( unsigned sourceLayer ) const
+const WeightMatrix *Layer::getWeightMatrix( unsigned sourceLayer ) const
 {
     ASSERT( _layerToWeights.exists( sourceLayer ) );
     return _layerToWeights[sourceLayer];
 }
 
-void Layer::removeSourceLayer( unsigned sourceLayer )
+void Layer::setWeightRepresentation( unsigned sourceLayer,
+                                     WeightMatrix::Representation representation )
 {
-    ASSERT( _sourceLayers.exists( sourceLayer ) );
-
-    delete[] _layerToWeights[sourceLayer];
-    delete[] _layerToPositiveWeights[sourceLayer];
-    delete[] _layerToNegativeWeights[sourceLayer];
-
-    _sourceLayers.erase( sourceLayer );
-    _layerToWeights.erase( sourceLayer );
-    _layerToPositiveWeights.erase( sourceLayer );
-    _layerToNegativeWeights.erase( sourceLayer );
+    ASSERT( _layerToWeights.exists( sourceLayer ) );
+    finalizeWeights();
+    _layerToWeights[sourceLayer]->convertTo( representation );
 }
 
-void Layer::setWeight( unsigned sourceLayer,
-                       unsigned sourceNeuron,
-                       unsigned targetNeuron,
-                       double weight )
+void Layer::finalizeWeights()
 {
-    unsigned index = sourceNeuron * _size + targetNeuron;
-    _layerToWeights[sourceLayer][index] = weight;
+    if ( _weightsFinalized )
+        return;
 
-    if ( weight > 0 )
-    {
-        _layerToPositiveWeights[sourceLayer][index] = weight;
-        _layerToNegativeWeights[sourceLayer][index] = 0;
-    }
-    else
+    for ( const auto &weights : _layerToWeights )
     {
-        _layerToPositiveWeights[sourceLayer][index] = 0;
-        _layerToNegativeWeights[sourceLayer][index] = weight;
+        weights.second->finalize();
+        weights.second->convertTo( weights.second->getPreferredRepresentation() );
     }
-}
 
-double Layer::getWeight( unsigned sourceLayer, unsigned sourceNeuron, unsigned targetNeuron ) const
-{
-    unsigned index = sourceNeuron * _size + targetNeuron;
-    return _layerToWeights[sourceLayer][index];
+    _weightsFinalized = true;
 }
 
-double *Layer::getWeights( unsigned sourceLayerIndex ) const
+void Layer::removeSourceLayer( unsigned sourceLayer )
 {
-    return _layerToWeights[sourceLayerIndex];
+    ASSERT( _sourceLayers.exists( sourceLayer ) );
+
+    if ( _layerToWeights.exists( sourceLayer ) )
+    {
+        delete _layerToWeights[sourceLayer];
+        _layerToWeights.erase( sourceLayer );
+    }
+
+    _sourceLayers.erase( sourceLayer );
 }
 
-double *Layer::getPositiveWeights( unsigned sourceLayerIndex ) const
+void Layer::setWeight( unsigned sourceLayer,
+                       unsigned sourceNeuron,
+                       unsigned targetNeuron,
+                       double weight )
 {
-    return _layerToPositiveWeights[sourceLayerIndex];
+    _layerToWeights[sourceLayer]->setWeight( sourceNeuron, targetNeuron, weight );
+    _weightsFinalized = false;
 }
 
-double *Layer::getNegativeWeights( unsigned sourceLayerIndex ) const
+double Layer::getWeight( unsigned sourceLayer, unsigned sourceNeuron, unsigned targetNeuron ) const
 {
-    return _layerToNegativeWeights[sourceLayerIndex];
+    return _layerToWeights[sourceLayer]->getWeight( sourceNeuron, targetNeuron );
 }
 
 void Layer::setBias( unsigned neuron, double bias )
@@ -758,42 +780,21 @@ void Layer::computeIntervalArithmeticBounds()
 
 void Layer::computeIntervalArithmeticBoundsForWeightedSum()
 {
-    double *newLb = new double[_size];
-    double *newUb = new double[_size];
+    double *newLb = _workLb;
+    double *newUb = _workUb;
 
-    for ( unsigned i = 0; i < _size; ++i )
-    {
-        newLb[i] = _bias[i];
-        newUb[i] = _bias[i];
-    }
+    memcpy( newLb, _bias, sizeof( double ) * _size );
+    memcpy( newUb, _bias, sizeof( double ) * _size );
 
     for ( const auto &sourceLayerEntry : _sourceLayers )
     {
         unsigned sourceLayerIndex = sourceLayerEntry.first;
-        unsigned sourceLayerSize = sourceLayerEntry.second;
         const Layer *sourceLayer = _layerOwner->getLayer( sourceLayerIndex );
-        const double *weights = _layerToWeights[sourceLayerIndex];
-
-        for ( unsigned i = 0; i < _size; ++i )
-        {
-            for ( unsigned j = 0; j < sourceLayerSize; ++j )
-            {
-                double previousLb = sourceLayer->getLb( j );
-                double previousUb = sourceLayer->getUb( j );
-                double weight = weights[j * _size + i];
 
-                if ( weight > 0 )
-                {
-                    newLb[i] += weight * previousLb;
-                    newUb[i] += weight * previousUb;
-                }
-                else
-                {
-                    newLb[i] += weight * previousUb;
-                    newUb[i] += weight * previousLb;
-                }
-            }
-        }
+        // The bounds of eliminated source neurons are kept at their
+        // values, so the bound arrays can be used as they are
+        _layerToWeights[sourceLayerIndex]->addIntervalTimesWeights(
+            sourceLayer->getLbs(), sourceLayer->getUbs(), newLb, newUb );
     }
 
     for ( unsigned i = 0; i < _size; ++i )
@@ -814,9 +815,6 @@ void Layer::computeIntervalArithmeticBoundsForWeightedSum()
                 Tightening( _neuronToVariable[i], _ub[i], Tightening::UB ) );
         }
     }
-
-    delete[] newLb;
-    delete[] newUb;
 }
 
 void Layer::computeIntervalArithmeticBoundsForRelu()
@@ -3253,7 +3251,6 @@ void Layer::computeSymbolicBoundsForWeightedSum()
     for ( const auto &sourceLayerEntry : _sourceLayers )
     {
         unsigned sourceLayerIndex = sourceLayerEntry.first;
-        unsigned sourceLayerSize = sourceLayerEntry.second;
         const Layer *sourceLayer = _layerOwner->getLayer( sourceLayerEntry.first );
 
         /*
@@ -3263,30 +3260,12 @@ void Layer::computeSymbolicBoundsForWeightedSum()
           newLB = oldUB * negWeights + oldLB * posWeights
         */
 
-        matrixMultiplication( sourceLayer->getSymbolicUb(),
-                              _layerToPositiveWeights[sourceLayerIndex],
-                              _symbolicUb,
-                              _inputLayerSize,
-                              sourceLayerSize,
-                              _size );
-        matrixMultiplication( sourceLayer->getSymbolicLb(),
-                              _layerToNegativeWeights[sourceLayerIndex],
-                              _symbolicUb,
-                              _inputLayerSize,
-                              sourceLayerSize,
-                              _size );
-        matrixMultiplication( sourceLayer->getSymbolicLb(),
-                              _layerToPositiveWeights[sourceLayerIndex],
-                              _symbolicLb,
-                              _inputLayerSize,
-                              sourceLayerSize,
-                              _size );
-        matrixMultiplication( sourceLayer->getSymbolicUb(),
-                              _layerToNegativeWeights[sourceLayerIndex],
-                              _symbolicLb,
-                              _inputLayerSize,
-                              sourceLayerSize,
-                              _size );
+        const WeightMatrix *weights = _layerToWeights[sourceLayerIndex];
+        weights->addSymbolicBoundsTimesWeights( sourceLayer->getSymbolicLb(),
+                                                sourceLayer->getSymbolicUb(),
+                                                _inputLayerSize,
+                                                _symbolicLb,
+                                                _symbolicUb );
 
         // Restore the zero bound on eliminated neurons
         unsigned index;
@@ -3301,29 +3280,18 @@ void Layer::computeSymbolicBoundsForWeightedSum()
         }
 
         /*
-          Compute the biases for the new layer
+          Compute the biases for the new layer: add the weighted bias
+          from the source layer
         */
-        for ( unsigned j = 0; j < _size; ++j )
-        {
-            if ( _eliminatedNeurons.exists( j ) )
-                continue;
-
-            // Add the weighted bias from the source layer
-            for ( unsigned k = 0; k < sourceLayerSize; ++k )
-            {
-                double weight = _layerToWeights[sourceLayerIndex][k * _size + j];
+        weights->addIntervalTimesWeights( sourceLayer->getSymbolicLowerBias(),
+                                          sourceLayer->getSymbolicUpperBias(),
+                                          _symbolicLowerBias,
+                                          _symbolicUpperBias );
 
-                if ( weight > 0 )
-                {
-                    _symbolicLowerBias[j] += sourceLayer->getSymbolicLowerBias()[k] * weight;
-                    _symbolicUpperBias[j] += sourceLayer->getSymbolicUpperBias()[k] * weight;
-                }
-                else
-                {
-                    _symbolicLowerBias[j] += sourceLayer->getSymbolicUpperBias()[k] * weight;
-                    _symbolicUpperBias[j] += sourceLayer->getSymbolicLowerBias()[k] * weight;
-                }
-            }
+        for ( const auto &eliminated : _eliminatedNeurons )
+        {
+            _symbolicLowerBias[eliminated.first] = eliminated.second;
+            _symbolicUpperBias[eliminated.first] = eliminated.second;
         }
     }
 
@@ -3334,46 +3302,36 @@ void Layer::computeSymbolicBoundsForWeightedSum()
       it. For each of these bounds, we compute an upper bound and
       a lower bound.
     */
+    std::copy_n( _symbolicLowerBias, _size, _symbolicLbOfLb );
+    std::copy_n( _symbolicLowerBias, _size, _symbolicUbOfLb );
+    std::copy_n( _symbolicUpperBias, _size, _symbolicLbOfUb );
+    std::copy_n( _symbolicUpperBias, _size, _symbolicUbOfUb );
+
+    const Layer *inputLayer = _layerOwner->getLayer( 0 );
+    BoundKernels::addIntervalTimesMatrix( _symbolicLb,
+                                          _inputLayerSize,
+                                          _size,
+                                          inputLayer->getLbs(),
+                                          inputLayer->getUbs(),
+                                          _symbolicLbOfLb,
+                                          _symbolicUbOfLb );
+    BoundKernels::addIntervalTimesMatrix( _symbolicUb,
+                                          _inputLayerSize,
+                                          _size,
+                                          inputLayer->getLbs(),
+                                          inputLayer->getUbs(),
+                                          _symbolicLbOfUb,
+                                          _symbolicUbOfUb );
+
     for ( unsigned i = 0; i < _size; ++i )
     {
         if ( _eliminatedNeurons.exists( i ) )
-            continue;
-
-        _symbolicLbOfLb[i] = _symbolicLowerBias[i];
-        _symbolicUbOfLb[i] = _symbolicLowerBias[i];
-        _symbolicLbOfUb[i] = _symbolicUpperBias[i];
-        _symbolicUbOfUb[i] = _symbolicUpperBias[i];
-
-        for ( unsigned j = 0; j < _inputLayerSize; ++j )
         {
-            double inputLb = _layerOwner->getLayer( 0 )->getLb( j );
-            double inputUb = _layerOwner->getLayer( 0 )->getUb( j );
-
-            double entry = _symbolicLb[j * _size + i];
-
-            if ( entry >= 0 )
-            {
-                _symbolicLbOfLb[i] += ( entry * inputLb );
-                _symbolicUbOfLb[i] += ( entry * inputUb );
-            }
-            else
-            {
-                _symbolicLbOfLb[i] += ( entry * inputUb );
-                _symbolicUbOfLb[i] += ( entry * inputLb );
-            }
-
-            entry = _symbolicUb[j * _size + i];
-
-            if ( entry >= 0 )
-            {
-                _symbolicLbOfUb[i] += ( entry * inputLb );
-                _symbolicUbOfUb[i] += ( entry * inputUb );
-            }
-            else
-            {
-                _symbolicLbOfUb[i] += ( entry * inputUb );
-                _symbolicUbOfUb[i] += ( entry * inputLb );
-            }
+            _symbolicLbOfLb[i] = _eliminatedNeurons[i];
+            _symbolicUbOfLb[i] = _eliminatedNeurons[i];
+            _symbolicLbOfUb[i] = _eliminatedNeurons[i];
+            _symbolicUbOfUb[i] = _eliminatedNeurons[i];
+            continue;
         }
 
         /*
@@ -3777,8 +3735,12 @@ unsigned Layer::getLayerIndex() const
 Layer::Layer( const Layer *other )
     : _bias( NULL )
     , _assignment( NULL )
+    , _simulations( NULL )
+    , _numberOfSimulations( 0 )
     , _lb( NULL )
     , _ub( NULL )
+    , _workLb( NULL )
+    , _workUb( NULL )
     , _inputLayerSize( 0 )
     , _symbolicLb( NULL )
     , _symbolicUb( NULL )
@@ -3799,25 +3761,15 @@ Layer::Layer( const Layer *other )
 
     for ( auto &sourceLayerEntry : other->_sourceLayers )
     {
-        addSourceLayer( sourceLayerEntry.first, sourceLayerEntry.second );
+        _sourceLayers[sourceLayerEntry.first] = sourceLayerEntry.second;
 
         if ( other->_layerToWeights.exists( sourceLayerEntry.first ) )
-            memcpy( _layerToWeights[sourceLayerEntry.first],
-                    other->_layerToWeights[sourceLayerEntry.first],
-                    sizeof( double ) * sourceLayerEntry.second * _size );
-
-        if ( other->_layerToPositiveWeights.exists( sourceLayerEntry.first ) )
-            memcpy( _layerToPositiveWeights[sourceLayerEntry.first],
-                    other->_layerToPositiveWeights[sourceLayerEntry.first],
-                    sizeof( double ) * sourceLayerEntry.second * _size );
-
-        if ( other->_layerToNegativeWeights.exists( sourceLayerEntry.first ) )
-            memcpy( _layerToNegativeWeights[sourceLayerEntry.first],
-                    other->_layerToNegativeWeights[sourceLayerEntry.first],
-                    sizeof( double ) * sourceLayerEntry.second * _size );
+            _layerToWeights[sourceLayerEntry.first] =
+                new WeightMatrix( *other->_layerToWeights[sourceLayerEntry.first] );
     }
 
     _successorLayers = other->_successorLayers;
+    _weightsFinalized = other->_weightsFinalized;
 
     if ( other->_bias )
         memcpy( _bias, other->_bias, sizeof( double ) * _size );
@@ -3874,29 +3826,39 @@ double Layer::getSymbolicUbOfUb( unsigned neuron ) const
 void Layer::freeMemoryIfNeeded()
 {
     for ( const auto &weights : _layerToWeights )
-        delete[] weights.second;
+        delete weights.second;
     _layerToWeights.clear();
 
-    for ( const auto &weights : _layerToPositiveWeights )
-        delete[] weights.second;
-    _layerToPositiveWeights.clear();
-
-    for ( const auto &weights : _layerToNegativeWeights )
-        delete[] weights.second;
-    _layerToNegativeWeights.clear();
-
     if ( _bias )
     {
         delete[] _bias;
         _bias = NULL;
     }
 
+    if ( _workLb )
+    {
+        delete[] _workLb;
+        _workLb = NULL;
+    }
+
+    if ( _workUb )
+    {
+        delete[] _workUb;
+        _workUb = NULL;
+    }
+
     if ( _assignment )
     {
         delete[] _assignment;
         _assignment = NULL;
     }
 
+    if ( _simulations )
+    {
+        delete[] _simulations;
+        _simulations = NULL;
+    }
+
     if ( _lb )
     {
         delete[] _lb;
@@ -4044,7 +4006,7 @@ void Layer::dump() const
                 const Layer *sourceLayer = _layerOwner->getLayer( sourceLayerEntry.first );
                 for ( unsigned j = 0; j < sourceLayer->getSize(); ++j )
                 {
-                    double weight = _layerToWeights[sourceLayerEntry.first][j * _size + i];
+                    double weight = _layerToWeights[sourceLayerEntry.first]->getWeight( j, i );
                     if ( !FloatUtils::isZero( weight ) )
                     {
                         if ( sourceLayer->_neuronToVariable.exists( j ) )
@@ -4139,8 +4101,6 @@ void Layer::reduceIndexFromAllMaps( unsigned startIndex )
 
     // Adjust all weight maps
     adjustWeightMapIndexing( _layerToWeights, startIndex );
-    adjustWeightMapIndexing( _layerToPositiveWeights, startIndex );
-    adjustWeightMapIndexing( _layerToNegativeWeights, startIndex );
 
     // Adjust the neuron activations
     for ( auto &neuronToSources : _neuronToActivationSources )
@@ -4153,9 +4113,9 @@ void Layer::reduceIndexFromAllMaps( unsigned startIndex )
     }
 }
 
-void Layer::adjustWeightMapIndexing( Map<unsigned, double *> &map, unsigned startIndex )
+void Layer::adjustWeightMapIndexing( Map<unsigned, WeightMatrix *> &map, unsigned startIndex )
 {
-    Map<unsigned, double *> copyOfWeights = map;
+    Map<unsigned, WeightMatrix *> copyOfWeights = map;
     map.clear();
     for ( const auto &pair : copyOfWeights )
         map[pair.first >= startIndex ? pair.first - 1 : pair.first] = pair.second;
@@ -4196,17 +4156,11 @@ bool Layer::operator==( const Layer &layer ) const
     if ( !compareWeights( _layerToWeights, layer._layerToWeights ) )
         return false;
 
-    if ( !compareWeights( _layerToPositiveWeights, layer._layerToPositiveWeights ) )
-        return false;
-
-    if ( !compareWeights( _layerToNegativeWeights, layer._layerToNegativeWeights ) )
-        return false;
-
     return true;
 }
 
-bool Layer::compareWeights( const Map<unsigned, double *> &map,
-                            const Map<unsigned, double *> &mapOfOtherLayer ) const
+bool Layer::compareWeights( const Map<unsigned, WeightMatrix *> &map,
+                            const Map<unsigned, WeightMatrix *> &mapOfOtherLayer ) const
 {
     if ( map.size() != mapOfOtherLayer.size() )
         return false;
@@ -4214,16 +4168,12 @@ bool Layer::compareWeights( const Map<unsigned, double *> &map,
     for ( const auto &pair : map )
     {
         unsigned key = pair.first;
-        double *value = pair.second;
 
         if ( !mapOfOtherLayer.exists( key ) )
             return false;
 
-        if ( std::memcmp(
-                 value, mapOfOtherLayer[key], _size * _sourceLayers[key] * sizeof( double ) ) != 0 )
-        {
+        if ( *pair.second != *mapOfOtherLayer[key] )
             return false;
-        }
     }
 
     return true;
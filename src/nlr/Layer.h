@@ -28,6 +28,7 @@
 #include "SigmoidConstraint.h"
 #include "SignConstraint.h"
 #include "Vector.h"
+#include "WeightMatrix.h"
 
 namespace NLR {
 
@@ -65,7 +66,22 @@ public:
     void removeSourceLayer( unsigned sourceLayer );
     const Map<unsigned, unsigned> &getSourceLayers() const;
     const Set<unsigned> &getSuccessorLayers() const;
-    const double *getWeightMatrix( unsigned sourceLayer ) const;
+    const WeightMatrix *getWeightMatrix( unsigned sourceLayer ) const;
+
+    /*
+      Change the way the weights from a given source layer are
+      stored, e.g. from a dense matrix to a sparse one
+    */
+    void setWeightRepresentation( unsigned sourceLayer,
+                                  WeightMatrix::Representation representation );
+
+    /*
+      Prepare the weights set so far for reading, storing each weight
+      matrix in the representation that suits its density. Must be
+      called once the weights of the layer are set, before the layer
+      is used for evaluation or bound propagation.
+    */
+    void finalizeWeights();
 
     /*
      Receives an index of a layer and updates all the layer maps (for weights, source layers and
@@ -77,9 +93,6 @@ public:
     void
     setWeight( unsigned sourceLayer, unsigned sourceNeuron, unsigned targetNeuron, double weight );
     double getWeight( unsigned sourceLayer, unsigned sourceNeuron, unsigned targetNeuron ) const;
-    double *getWeights( unsigned sourceLayerIndex ) const;
-    double *getPositiveWeights( unsigned sourceLayerIndex ) const;
-    double *getNegativeWeights( unsigned sourceLayerIndex ) const;
 
     void setBias( unsigned neuron, double bias );
     double getBias( unsigned neuron ) const;
@@ -107,11 +120,17 @@ public:
     void computeAssignment();
 
     /*
-      Set/get the simulations, or compute it from source layers
+      Set/get the simulations, or compute it from source layers.
+      Simulations are stored as a contiguous, row-major matrix of
+      dimensions size x numberOfSimulations, i.e. the simulated values
+      of each neuron are consecutive in memory.
     */
     void setSimulations( const Vector<Vector<double>> *values );
+    void setSimulations( const double *values, unsigned numberOfSimulations );
     void computeSimulations();
-    const Vector<Vector<double>> *getSimulations() const;
+    unsigned getNumberOfSimulations() const;
+    const double *getSimulations() const;
+    const double *getSimulations( unsigned neuron ) const;
 
     /*
       Bound related functionality: grab the current bounds from the
@@ -160,8 +179,8 @@ public:
     void dump() const;
     static String typeToString( Type type );
     bool operator==( const Layer &layer ) const;
-    bool compareWeights( const Map<unsigned, double *> &map,
-                         const Map<unsigned, double *> &mapOfOtherLayer ) const;
+    bool compareWeights( const Map<unsigned, WeightMatrix *> &map,
+                         const Map<unsigned, WeightMatrix *> &mapOfOtherLayer ) const;
 
 private:
     unsigned _layerIndex;
@@ -172,18 +191,22 @@ private:
     Map<unsigned, unsigned> _sourceLayers;
     Set<unsigned> _successorLayers;
 
-    Map<unsigned, double *> _layerToWeights;
-    Map<unsigned, double *> _layerToPositiveWeights;
-    Map<unsigned, double *> _layerToNegativeWeights;
+    Map<unsigned, WeightMatrix *> _layerToWeights;
+    bool _weightsFinalized;
     double *_bias;
 
     double *_assignment;
 
-    Vector<Vector<double>> _simulations;
+    double *_simulations;
+    unsigned _numberOfSimulations;
 
     double *_lb;
     double *_ub;
 
+    // Working memory for the interval arithmetic of weighted-sum layers
+    double *_workLb;
+    double *_workUb;
+
     Map<unsigned, List<NeuronIndex>> _neuronToActivationSources;
 
     Map<unsigned, unsigned> _neuronToVariable;
@@ -208,6 +231,16 @@ private:
     void allocateMemory();
     void freeMemoryIfNeeded();
 
+    /*
+      Make room for the given number of simulations per neuron
+    */
+    void resizeSimulations( unsigned numberOfSimulations );
+
+    /*
+      The simulated values of a neuron that feeds into this layer
+    */
+    const double *getSourceSimulations( NeuronIndex sourceIndex ) const;
+
     /*
        The following methods compute concrete softmax output bounds
        using different linear approximation, as well as the coefficients
@@ -315,7 +348,7 @@ private:
     double getSymbolicLbOfUb( unsigned neuron ) const;
     double getSymbolicUbOfUb( unsigned neuron ) const;
 
-    void adjustWeightMapIndexing( Map<unsigned, double *> &map, unsigned indexToStart );
+    void adjustWeightMapIndexing( Map<unsigned, WeightMatrix *> &map, unsigned indexToStart );
 };
 
 } // namespace NLR
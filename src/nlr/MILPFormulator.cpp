@@ -15,10 +15,10 @@
 
 #include "MILPFormulator.h"
 
-#include "GurobiWrapper.h"
 #include "InfeasibleQueryException.h"
 #include "LPFormulator.h"
 #include "Layer.h"
+#include "MILPEncoder.h"
 #include "MStringf.h"
 #include "NLRError.h"
 #include "Options.h"
@@ -26,6 +26,7 @@
 #include "Vector.h"
 
 #include <boost/thread.hpp>
+#include <memory>
 
 namespace NLR {
 
@@ -51,11 +52,12 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding(
     _signChanges = 0;
     _cutoffs = 0;
 
-    GurobiWrapper gurobi;
+    std::unique_ptr<ILPSolver> milpSolver( MILPEncoder::createMILPSolver() );
+    ILPSolver &solver = *milpSolver;
 
     double currentLb;
     double currentUb;
-    List<GurobiWrapper::Term> terms;
+    List<ILPSolver::Term> terms;
     Map<String, double> dontCare;
 
     struct timespec gurobiStart = TimeUtils::sampleMicro();
@@ -68,7 +70,7 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding(
         */
         ASSERT( layers.exists( i ) );
         Layer *layer = layers[i];
-        _lpFormulator.addLayerToModel( gurobi, layer, false );
+        _lpFormulator.addLayerToModel( solver, layer, false );
 
         /*
           The optimiziation is performed layer by layer, and for each
@@ -95,7 +97,7 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding(
             if ( _cutoffInUse && ( currentLb >= _cutoffValue || currentUb <= _cutoffValue ) )
             {
                 if ( layerRequiresMILP )
-                    addNeuronToModel( gurobi, layer, j, _layerOwner );
+                    addNeuronToModel( solver, layer, j, _layerOwner );
                 continue;
             }
 
@@ -103,21 +105,21 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding(
             Stringf variableName( "x%u", variable );
 
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, variableName ) );
+            terms.append( ILPSolver::Term( 1, variableName ) );
 
             // Maximize, using just the LP relaxation for the current layer
-            if ( tightenUpperBound( gurobi, layer, j, variable, currentUb ) )
+            if ( tightenUpperBound( solver, layer, j, variable, currentUb ) )
             {
                 if ( layerRequiresMILP )
-                    addNeuronToModel( gurobi, layer, j, _layerOwner );
+                    addNeuronToModel( solver, layer, j, _layerOwner );
                 continue;
             }
 
             // Minimize, using just the LP relaxation for the current layer
-            if ( tightenLowerBound( gurobi, layer, j, variable, currentLb ) )
+            if ( tightenLowerBound( solver, layer, j, variable, currentLb ) )
             {
                 if ( layerRequiresMILP )
-                    addNeuronToModel( gurobi, layer, j, _layerOwner );
+                    addNeuronToModel( solver, layer, j, _layerOwner );
                 continue;
             }
 
@@ -127,14 +129,14 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding(
             if ( !layerRequiresMILP )
                 continue;
 
-            addNeuronToModel( gurobi, layer, j, _layerOwner );
+            addNeuronToModel( solver, layer, j, _layerOwner );
 
             // Maximize, using just the exact MILP encoding
-            if ( tightenUpperBound( gurobi, layer, j, variable, currentUb ) )
+            if ( tightenUpperBound( solver, layer, j, variable, currentUb ) )
                 continue;
 
             // Minimize, using just the exact MILP encoding
-            if ( tightenLowerBound( gurobi, layer, j, variable, currentLb ) )
+            if ( tightenLowerBound( solver, layer, j, variable, currentLb ) )
                 continue;
         }
     }
@@ -151,27 +153,10 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding(
 
 void MILPFormulator::optimizeBoundsWithMILPEncoding( const Map<unsigned, Layer *> &layers )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    boost::thread *threads = new boost::thread[numberOfWorkers];
-    std::mutex mtx;
-    std::atomic_bool infeasible( false );
-
-    std::atomic_uint tighterBoundCounter( 0 );
-    std::atomic_uint signChanges( 0 );
-    std::atomic_uint cutoffs( 0 );
+    SolverPool pool( Options::get()->getInt( Options::NUM_WORKERS ),
+                     MILPEncoder::createMILPSolver,
+                     GlobalConfiguration::LP_TIGHTENING_TIME_BUDGET_IN_SECONDS );
+    TighteningState state;
 
     struct timespec gurobiStart = TimeUtils::sampleMicro();
 
@@ -179,422 +164,236 @@ void MILPFormulator::optimizeBoundsWithMILPEncoding( const Map<unsigned, Layer *
     {
         Layer *layer = currentLayer.second;
 
-        ThreadArgument argument( layer,
-                                 &layers,
-                                 std::ref( freeSolvers ),
-                                 std::ref( mtx ),
-                                 std::ref( infeasible ),
-                                 std::ref( tighterBoundCounter ),
-                                 std::ref( signChanges ),
-                                 std::ref( cutoffs ),
-                                 layer->getLayerIndex(),
-                                 currentLayer.first,
-                                 threads,
-                                 &solverToIndex );
-
         // optimize every neuron of layer
-        optimizeBoundsOfNeuronsWithMILPEncoding( argument );
-    }
+        optimizeBoundsOfNeuronsWithMILPEncoding(
+            pool, state, layers, layer->getLayerIndex(), currentLayer.first );
 
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
+        if ( state._infeasible || pool.timeBudgetExhausted() )
+            break;
     }
 
     struct timespec gurobiEnd = TimeUtils::sampleMicro();
 
     log( Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
-                  tighterBoundCounter.load(),
-                  signChanges.load(),
-                  cutoffs.load() ) );
+                  state._tighterBoundCounter.load(),
+                  state._signChanges.load(),
+                  state._cutoffs.load() ) );
     log( Stringf( "Seconds spent Gurobiing: %llu\n",
                   TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 ) );
-    clearSolverQueue( freeSolvers );
 
-    if ( infeasible )
+    if ( state._infeasible )
         throw InfeasibleQueryException();
 }
 
 void MILPFormulator::optimizeBoundsOfOneLayerWithMILPEncoding( const Map<unsigned, Layer *> &layers,
                                                                unsigned targetIndex )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    boost::thread *threads = new boost::thread[numberOfWorkers];
-    std::mutex mtx;
-    std::atomic_bool infeasible( false );
-
-    std::atomic_uint tighterBoundCounter( 0 );
-    std::atomic_uint signChanges( 0 );
-    std::atomic_uint cutoffs( 0 );
+    SolverPool pool( Options::get()->getInt( Options::NUM_WORKERS ),
+                     MILPEncoder::createMILPSolver,
+                     GlobalConfiguration::LP_TIGHTENING_TIME_BUDGET_IN_SECONDS );
+    TighteningState state;
 
     struct timespec gurobiStart = TimeUtils::sampleMicro();
 
-    Layer *layer = layers[targetIndex];
-
-    ThreadArgument argument( layer,
-                             &layers,
-                             std::ref( freeSolvers ),
-                             std::ref( mtx ),
-                             std::ref( infeasible ),
-                             std::ref( tighterBoundCounter ),
-                             std::ref( signChanges ),
-                             std::ref( cutoffs ),
-                             layers.size() - 1,
-                             targetIndex,
-                             threads,
-                             &solverToIndex );
-
     // optimize every neuron of layer
-    optimizeBoundsOfNeuronsWithMILPEncoding( argument );
-
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
-    }
+    optimizeBoundsOfNeuronsWithMILPEncoding( pool, state, layers, layers.size() - 1, targetIndex );
 
     struct timespec gurobiEnd = TimeUtils::sampleMicro();
 
     log( Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
-                  tighterBoundCounter.load(),
-                  signChanges.load(),
-                  cutoffs.load() ) );
+                  state._tighterBoundCounter.load(),
+                  state._signChanges.load(),
+                  state._cutoffs.load() ) );
     log( Stringf( "Seconds spent Gurobiing: %llu\n",
                   TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 ) );
-    clearSolverQueue( freeSolvers );
 
-    if ( infeasible )
+    if ( state._infeasible )
         throw InfeasibleQueryException();
 }
 
-void MILPFormulator::optimizeBoundsOfNeuronsWithMILPEncoding( ThreadArgument &args )
+void MILPFormulator::optimizeBoundsOfNeuronsWithMILPEncoding( SolverPool &pool,
+                                                              TighteningState &state,
+                                                              const Map<unsigned, Layer *> &layers,
+                                                              unsigned lastIndexOfRelaxation,
+                                                              unsigned targetIndex )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    // Time to wait if no idle worker is availble
-    boost::chrono::milliseconds waitTime( numberOfWorkers - 1 );
+    Layer *layer = layers[targetIndex];
 
-    Layer *layer = args._layer;
-    const Map<unsigned, Layer *> &layers = *args._layers;
-    unsigned targetIndex = args._targetIndex;
-    unsigned lastIndexOfRelaxation = args._lastIndexOfRelaxation;
+    Vector<NeuronTask> tasks;
+    collectNeuronTasks(
+        layer, _layerOwner->getLayer( targetIndex ), _cutoffInUse, _cutoffValue, tasks );
+    sortByExpectedGain( tasks, _cutoffInUse, _cutoffValue );
 
-    Map<GurobiWrapper *, unsigned> solverToIndex = *args._solverToIndex;
-    SolverQueue &freeSolvers = args._freeSolvers;
-    std::mutex &mtx = args._mtx;
-    std::atomic_bool &infeasible = args._infeasible;
-    std::atomic_uint &tighterBoundCounter = args._tighterBoundCounter;
-    std::atomic_uint &signChanges = args._signChanges;
-    std::atomic_uint &cutoffs = args._cutoffs;
-    boost::thread *threads = args._threads;
+    /*
+      The MILP constraints are added to the relaxation while a neuron is
+      handled, so the model is rebuilt for every neuron
+    */
+    auto task = [&]( ILPSolver &solver, unsigned i ) {
+        if ( state._infeasible )
+            return false;
 
-    double currentLb;
-    double currentUb;
+        solver.resetModel();
+        state._mtx.lock();
+        _lpFormulator.createLPRelaxation( layers, solver, lastIndexOfRelaxation );
+        state._mtx.unlock();
 
-    bool skipTightenLb = false; // If true, skip lower bound tightening
-    bool skipTightenUb = false; // If true, skip upper bound tightening
+        tightenSingleVariableBoundsWithMILPEncoding( solver, layers, tasks[i], state );
+        return !state._infeasible;
+    };
 
-    // declare simulations as local var to avoid a problem which can happen due to multi thread
-    // process.
-    const Vector<Vector<double>> *simulations =
-        _layerOwner->getLayer( targetIndex )->getSimulations();
+    pool.run( tasks.size(), task );
+}
 
-    for ( unsigned i = 0; i < layer->getSize(); ++i )
-    {
-        if ( layer->neuronEliminated( i ) )
-            continue;
+void MILPFormulator::tightenSingleVariableBoundsWithMILPEncoding(
+    ILPSolver &solver,
+    const Map<unsigned, Layer *> &layers,
+    const NeuronTask &task,
+    TighteningState &state )
+{
+    /*
+      The optimiziation is performed layer by layer, and for each
+      individual neuron. It has 4 steps:
+
+      1. Use an LP relaxation to minimize the variable
+      2. Use an LP relaxation to maximize the variable
+      3. Use a MILP encoding to minimize the variable
+      4. Use a MILP encoding to maximize the variable
+
+      We perform the steps in this order, and stop if at some
+      point we discover either an upper bound that is non-positive
+      or a lower obund that is non-negative (this is aimed at
+      ReLUs, as their phase would become fixed in these cases)
+    */
 
-        currentLb = layer->getLb( i );
-        currentUb = layer->getUb( i );
+    Layer *layer = task._layer;
+    unsigned index = task._index;
 
-        if ( _cutoffInUse && ( currentLb >= _cutoffValue || currentUb <= _cutoffValue ) )
-            continue;
+    // LP Relaxation
+    log( Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
+             .ascii() );
 
-        skipTightenLb = false;
-        skipTightenUb = false;
+    unsigned variable = layer->neuronToVariable( index );
+    Stringf variableName( "x%u", variable );
 
-        // Loop for simulation
-        for ( const auto &simValue : ( *simulations ).get( i ) )
-        {
-            if ( _cutoffInUse && _cutoffValue < simValue ) // If x_lower < 0 < x_sim, do not try to
-                                                           // call tightning upper bound.
-                skipTightenUb = true;
+    if ( !task._skipTightenLb )
+    {
+        if ( tightenLowerBoundOfTask( solver, task, variableName, state ) )
+            return;
+    }
 
-            if ( _cutoffInUse && simValue < _cutoffValue ) // If x_sim < 0 < x_upper, do not try to
-                                                           // call tightning lower bound.
-                skipTightenLb = true;
+    if ( !task._skipTightenUb )
+    {
+        solver.reset();
+        if ( tightenUpperBoundOfTask( solver, task, variableName, state ) )
+            return;
+    }
 
-            if ( skipTightenUb && skipTightenLb )
-                break;
-        }
+    if ( state._infeasible )
+        return;
 
-        // If no tightning is needed, continue
-        if ( skipTightenUb && skipTightenLb )
-        {
-            log( Stringf( "Skip tightening lower and upper bounds for layer %d index %u",
-                          targetIndex,
-                          i )
-                     .ascii() );
+    solver.reset();
+    // Exact encoding
+    // Now, add the MILP constraints
+    unsigned lastLayer = layer->getLayerIndex();
+    for ( const auto &layer : layers )
+    {
+        if ( layer.second->getLayerIndex() > lastLayer )
             continue;
-        }
-        else if ( skipTightenUb )
-        {
-            log( Stringf( "Skip tightening upper bound for layer %u index %u", targetIndex, i )
-                     .ascii() );
-        }
-        else if ( skipTightenLb )
-        {
-            log( Stringf( "Skip tightening lower bound for layer %u index %u", targetIndex, i )
-                     .ascii() );
-        }
-
-        if ( infeasible )
-        {
-            // infeasibility is derived, interupt all active threads
-            for ( unsigned i = 0; i < numberOfWorkers; ++i )
-            {
-                threads[i].interrupt();
-                threads[i].join();
-            }
-            clearSolverQueue( freeSolvers );
-            throw InfeasibleQueryException();
-        }
 
-        // Wait until there is an idle solver
-        GurobiWrapper *freeSolver;
-        while ( !freeSolvers.pop( freeSolver ) )
-            boost::this_thread::sleep_for( waitTime );
-
-        freeSolver->resetModel();
-
-        mtx.lock();
-        _lpFormulator.createLPRelaxation( layers, *freeSolver, lastIndexOfRelaxation );
-        mtx.unlock();
-
-        // spawn a thread to tighten the bounds for the current variable
-        ThreadArgument argument( freeSolver,
-                                 layer,
-                                 &layers,
-                                 i,
-                                 currentLb,
-                                 currentUb,
-                                 _cutoffInUse,
-                                 _cutoffValue,
-                                 _layerOwner,
-                                 std::ref( freeSolvers ),
-                                 std::ref( mtx ),
-                                 std::ref( infeasible ),
-                                 std::ref( tighterBoundCounter ),
-                                 std::ref( signChanges ),
-                                 std::ref( cutoffs ),
-                                 skipTightenLb,
-                                 skipTightenUb );
-
-        if ( numberOfWorkers == 1 )
-            tightenSingleVariableBoundsWithMILPEncoding( argument );
-        else
-            threads[solverToIndex[freeSolver]] =
-                boost::thread( tightenSingleVariableBoundsWithMILPEncoding, argument );
+        addLayerToModel( solver, layer.second, _layerOwner );
     }
-}
 
-void MILPFormulator::tightenSingleVariableBoundsWithMILPEncoding( ThreadArgument &argument )
-{
-    try
+    if ( !task._skipTightenLb )
     {
-        /*
-          The optimiziation is performed layer by layer, and for each
-          individual neuron. It has 4 steps:
-
-          1. Use an LP relaxation to minimize the variable
-          2. Use an LP relaxation to maximize the variable
-          3. Use a MILP encoding to minimize the variable
-          4. Use a MILP encoding to maximize the variable
+        if ( tightenLowerBoundOfTask( solver, task, variableName, state ) )
+            return;
+    }
 
-          We perform the steps in this order, and stop if at some
-          point we discover either an upper bound that is non-positive
-          or a lower obund that is non-negative (this is aimed at
-          ReLUs, as their phase would become fixed in these cases)
-        */
+    if ( !task._skipTightenUb )
+    {
+        solver.reset();
+        tightenUpperBoundOfTask( solver, task, variableName, state );
+    }
+}
 
-        GurobiWrapper *gurobi = argument._gurobi;
-        Layer *layer = argument._layer;
-        const Map<unsigned, Layer *> &layers = *( argument._layers );
-        unsigned index = argument._index;
-        double currentLb = argument._currentLb;
-        double currentUb = argument._currentUb;
-        bool cutoffInUse = argument._cutoffInUse;
-        double cutoffValue = argument._cutoffValue;
-        LayerOwner *layerOwner = argument._layerOwner;
-        SolverQueue &freeSolvers = argument._freeSolvers;
-        std::mutex &mtx = argument._mtx;
-        std::atomic_bool &infeasible = argument._infeasible;
-        std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
-        std::atomic_uint &signChanges = argument._signChanges;
-        std::atomic_uint &cutoffs = argument._cutoffs;
-        bool skipTightenLb = argument._skipTightenLb;
-        bool skipTightenUb = argument._skipTightenUb;
-
-        // LP Relaxation
-        log( Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
-                 .ascii() );
-
-        unsigned variable = layer->neuronToVariable( index );
-        Stringf variableName( "x%u", variable );
-
-        if ( !skipTightenLb )
-        {
-            log( Stringf( "Computing lowerbound..." ).ascii() );
-            double lb = optimizeWithGurobi(
-                *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible );
-            log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
+bool MILPFormulator::tightenLowerBoundOfTask( ILPSolver &solver,
+                                              const NeuronTask &task,
+                                              const String &variableName,
+                                              TighteningState &state )
+{
+    log( Stringf( "Computing lowerbound..." ).ascii() );
+    double lb =
+        optimizeWithGurobi( solver, MinOrMax::MIN, variableName, _cutoffValue, &state._infeasible );
+    log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
 
-            // Store the new bound if it is tighter
-            if ( lb > currentLb )
-            {
-                if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
-                    ++signChanges;
-
-                mtx.lock();
-                layer->setLb( index, lb );
-                layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
-                mtx.unlock();
-                ++tighterBoundCounter;
-
-                if ( cutoffInUse && lb > cutoffValue )
-                {
-                    ++cutoffs;
-                    enqueueSolver( freeSolvers, gurobi );
-                    return;
-                }
-            }
-        }
+    if ( state._infeasible )
+        return true;
 
-        if ( !skipTightenUb )
-        {
-            log( Stringf( "Computing upperbound..." ).ascii() );
-            gurobi->reset();
-            double ub = optimizeWithGurobi(
-                *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible );
-            log( Stringf( "Upperbound computed %f", ub ).ascii() );
-
-            // Store the new bound if it is tighter
-            if ( ub < currentUb )
-            {
-                if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
-                    ++signChanges;
-
-                mtx.lock();
-                layer->setUb( index, ub );
-                layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
-                mtx.unlock();
-
-                ++tighterBoundCounter;
-
-                if ( cutoffInUse && ub < cutoffValue )
-                {
-                    ++cutoffs;
-                    enqueueSolver( freeSolvers, gurobi );
-                    return;
-                }
-            }
-        }
-
-        gurobi->reset();
-        // Exact encoding
-        // Now, add the MILP constraints
-        unsigned lastLayer = layer->getLayerIndex();
-        for ( const auto &layer : layers )
-        {
-            if ( layer.second->getLayerIndex() > lastLayer )
-                continue;
+    // Store the new bound if it is tighter
+    if ( lb > task._currentLb )
+    {
+        if ( FloatUtils::isNegative( task._currentLb ) && !FloatUtils::isNegative( lb ) )
+            ++state._signChanges;
 
-            addLayerToModel( *gurobi, layer.second, layerOwner );
-        }
+        unsigned variable = task._layer->neuronToVariable( task._index );
+        state._mtx.lock();
+        task._layer->setLb( task._index, lb );
+        _layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
+        state._mtx.unlock();
+        ++state._tighterBoundCounter;
 
-        if ( !skipTightenLb )
+        if ( _cutoffInUse && lb > _cutoffValue )
         {
-            log( Stringf( "Computing lowerbound..." ).ascii() );
-            double lb = optimizeWithGurobi(
-                *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible );
-            log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
-
-            // Store the new bound if it is tighter
-            if ( lb > currentLb )
-            {
-                if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
-                    ++signChanges;
-
-                mtx.lock();
-                layer->setLb( index, lb );
-                layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
-                mtx.unlock();
-                ++tighterBoundCounter;
-
-                if ( cutoffInUse && lb > cutoffValue )
-                {
-                    ++cutoffs;
-                    enqueueSolver( freeSolvers, gurobi );
-                    return;
-                }
-            }
+            ++state._cutoffs;
+            return true;
         }
+    }
 
-        if ( !skipTightenUb )
-        {
-            log( Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
-                     .ascii() );
+    return false;
+}
 
-            log( Stringf( "Computing upperbound..." ).ascii() );
-            gurobi->reset();
-            double ub = optimizeWithGurobi(
-                *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible );
-            log( Stringf( "Upperbound computed %f", ub ).ascii() );
+bool MILPFormulator::tightenUpperBoundOfTask( ILPSolver &solver,
+                                              const NeuronTask &task,
+                                              const String &variableName,
+                                              TighteningState &state )
+{
+    log( Stringf( "Computing upperbound..." ).ascii() );
+    double ub =
+        optimizeWithGurobi( solver, MinOrMax::MAX, variableName, _cutoffValue, &state._infeasible );
+    log( Stringf( "Upperbound computed %f", ub ).ascii() );
 
-            // Store the new bound if it is tighter
-            if ( ub < currentUb )
-            {
-                if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
-                    ++signChanges;
+    if ( state._infeasible )
+        return true;
 
-                mtx.lock();
-                layer->setUb( index, ub );
-                layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
-                mtx.unlock();
+    // Store the new bound if it is tighter
+    if ( ub < task._currentUb )
+    {
+        if ( FloatUtils::isPositive( task._currentUb ) && !FloatUtils::isPositive( ub ) )
+            ++state._signChanges;
 
-                ++tighterBoundCounter;
+        unsigned variable = task._layer->neuronToVariable( task._index );
+        state._mtx.lock();
+        task._layer->setUb( task._index, ub );
+        _layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
+        state._mtx.unlock();
+        ++state._tighterBoundCounter;
 
-                if ( cutoffInUse && ub < cutoffValue )
-                    ++cutoffs;
-            }
+        if ( _cutoffInUse && ub < _cutoffValue )
+        {
+            ++state._cutoffs;
+            return true;
         }
-
-        enqueueSolver( freeSolvers, gurobi );
-    }
-    catch ( boost::thread_interrupted & )
-    {
-        enqueueSolver( argument._freeSolvers, argument._gurobi );
     }
+
+    return false;
 }
 
 void MILPFormulator::createMILPEncoding( const Map<unsigned, Layer *> &layers,
-                                         GurobiWrapper &gurobi,
+                                         ILPSolver &solver,
                                          unsigned lastLayer )
 {
     // First, create the LP relaxation of the problem
-    _lpFormulator.createLPRelaxation( layers, gurobi, lastLayer );
+    _lpFormulator.createLPRelaxation( layers, solver, lastLayer );
 
     // Now, add the MILP constraints
     for ( const auto &layer : layers )
@@ -602,11 +401,11 @@ void MILPFormulator::createMILPEncoding( const Map<unsigned, Layer *> &layers,
         if ( layer.second->getLayerIndex() > lastLayer )
             continue;
 
-        addLayerToModel( gurobi, layer.second, _layerOwner );
+        addLayerToModel( solver, layer.second, _layerOwner );
     }
 }
 
-void MILPFormulator::addLayerToModel( GurobiWrapper &gurobi,
+void MILPFormulator::addLayerToModel( ILPSolver &solver,
                                       const Layer *layer,
                                       LayerOwner *layerOwner )
 {
@@ -617,7 +416,7 @@ void MILPFormulator::addLayerToModel( GurobiWrapper &gurobi,
         break;
 
     case Layer::RELU:
-        addReluLayerToMILPFormulation( gurobi, layer, layerOwner );
+        addReluLayerToMILPFormulation( solver, layer, layerOwner );
         break;
 
     default:
@@ -626,7 +425,7 @@ void MILPFormulator::addLayerToModel( GurobiWrapper &gurobi,
     }
 }
 
-void MILPFormulator::addNeuronToModel( GurobiWrapper &gurobi,
+void MILPFormulator::addNeuronToModel( ILPSolver &solver,
                                        const Layer *layer,
                                        unsigned neuron,
                                        LayerOwner *layerOwner )
@@ -666,47 +465,47 @@ void MILPFormulator::addNeuronToModel( GurobiWrapper &gurobi,
       y - ua <= 0
     */
 
-    gurobi.addVariable( Stringf( "a%u", targetVariable ), 0, 1, GurobiWrapper::BINARY );
+    solver.addVariable( Stringf( "a%u", targetVariable ), 0, 1, ILPSolver::BINARY );
 
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-    terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-    terms.append( GurobiWrapper::Term( -sourceLb, Stringf( "a%u", targetVariable ) ) );
-    gurobi.addLeqConstraint( terms, -sourceLb );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+    terms.append( ILPSolver::Term( -sourceLb, Stringf( "a%u", targetVariable ) ) );
+    solver.addLeqConstraint( terms, -sourceLb );
 
     terms.clear();
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-    terms.append( GurobiWrapper::Term( -sourceUb, Stringf( "a%u", targetVariable ) ) );
-    gurobi.addLeqConstraint( terms, 0 );
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( -sourceUb, Stringf( "a%u", targetVariable ) ) );
+    solver.addLeqConstraint( terms, 0 );
 }
 
-void MILPFormulator::addReluLayerToMILPFormulation( GurobiWrapper &gurobi,
+void MILPFormulator::addReluLayerToMILPFormulation( ILPSolver &solver,
                                                     const Layer *layer,
                                                     LayerOwner *layerOwner )
 {
     for ( unsigned i = 0; i < layer->getSize(); ++i )
     {
-        addNeuronToModel( gurobi, layer, i, layerOwner );
+        addNeuronToModel( solver, layer, i, layerOwner );
     }
 }
 
-double MILPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
+double MILPFormulator::optimizeWithGurobi( ILPSolver &solver,
                                            MinOrMax minOrMax,
                                            String variableName,
                                            double cutoffValue,
                                            std::atomic_bool *infeasible )
 {
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
     if ( minOrMax == MAX )
-        gurobi.setObjective( terms );
+        solver.setObjective( terms );
     else
-        gurobi.setCost( terms );
+        solver.setCost( terms );
 
-    gurobi.solve();
+    solver.solve();
 
-    if ( gurobi.infeasible() )
+    if ( solver.infeasible() )
     {
         if ( infeasible )
         {
@@ -717,19 +516,19 @@ double MILPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
             throw InfeasibleQueryException();
     }
 
-    if ( gurobi.cutoffOccurred() )
+    if ( solver.cutoffOccurred() )
         return cutoffValue;
 
-    if ( gurobi.optimal() )
+    if ( solver.optimal() )
     {
         Map<String, double> dontCare;
         double result = 0;
-        gurobi.extractSolution( dontCare, result );
+        solver.extractSolution( dontCare, result );
         return result;
     }
-    else if ( gurobi.timeout() )
+    else if ( solver.timeout() )
     {
-        return gurobi.getObjectiveBound();
+        return solver.getObjectiveBound();
     }
 
     throw NLRError( NLRError::UNEXPECTED_RETURN_STATUS_FROM_GUROBI );
@@ -775,7 +574,7 @@ void MILPFormulator::setCutoff( double cutoff )
     _cutoffValue = cutoff;
 }
 
-bool MILPFormulator::tightenUpperBound( GurobiWrapper &gurobi,
+bool MILPFormulator::tightenUpperBound( ILPSolver &solver,
                                         Layer *layer,
                                         unsigned neuron,
                                         unsigned variable,
@@ -785,28 +584,28 @@ bool MILPFormulator::tightenUpperBound( GurobiWrapper &gurobi,
 
     Stringf variableName( "x%u", variable );
 
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
-    gurobi.reset();
-    gurobi.setObjective( terms );
-    gurobi.solve();
+    solver.reset();
+    solver.setObjective( terms );
+    solver.solve();
 
-    if ( gurobi.infeasible() )
+    if ( solver.infeasible() )
         throw InfeasibleQueryException();
 
-    if ( gurobi.cutoffOccurred() )
+    if ( solver.cutoffOccurred() )
     {
         newUb = _cutoffValue;
     }
-    else if ( gurobi.optimal() )
+    else if ( solver.optimal() )
     {
         Map<String, double> dontCare;
-        gurobi.extractSolution( dontCare, newUb );
+        solver.extractSolution( dontCare, newUb );
     }
-    else if ( gurobi.timeout() )
+    else if ( solver.timeout() )
     {
-        newUb = gurobi.getObjectiveBound();
+        newUb = solver.getObjectiveBound();
     }
     else
     {
@@ -814,12 +613,12 @@ bool MILPFormulator::tightenUpperBound( GurobiWrapper &gurobi,
     }
 
     Map<String, double> dontCare;
-    gurobi.extractSolution( dontCare, newUb );
+    solver.extractSolution( dontCare, newUb );
 
     // If the bound is tighter, store it
     if ( newUb < currentUb )
     {
-        gurobi.setUpperBound( variableName, newUb );
+        solver.setUpperBound( variableName, newUb );
 
         if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( newUb ) )
             ++_signChanges;
@@ -840,7 +639,7 @@ bool MILPFormulator::tightenUpperBound( GurobiWrapper &gurobi,
     return false;
 }
 
-bool MILPFormulator::tightenLowerBound( GurobiWrapper &gurobi,
+bool MILPFormulator::tightenLowerBound( ILPSolver &solver,
                                         Layer *layer,
                                         unsigned neuron,
                                         unsigned variable,
@@ -849,28 +648,28 @@ bool MILPFormulator::tightenLowerBound( GurobiWrapper &gurobi,
     double newLb = FloatUtils::negativeInfinity();
     Stringf variableName( "x%u", variable );
 
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
-    gurobi.reset();
-    gurobi.setCost( terms );
-    gurobi.solve();
+    solver.reset();
+    solver.setCost( terms );
+    solver.solve();
 
-    if ( gurobi.infeasible() )
+    if ( solver.infeasible() )
         throw InfeasibleQueryException();
 
-    if ( gurobi.cutoffOccurred() )
+    if ( solver.cutoffOccurred() )
     {
         newLb = _cutoffValue;
     }
-    else if ( gurobi.optimal() )
+    else if ( solver.optimal() )
     {
         Map<String, double> dontCare;
-        gurobi.extractSolution( dontCare, newLb );
+        solver.extractSolution( dontCare, newLb );
     }
-    else if ( gurobi.timeout() )
+    else if ( solver.timeout() )
     {
-        newLb = gurobi.getObjectiveBound();
+        newLb = solver.getObjectiveBound();
     }
     else
     {
@@ -880,7 +679,7 @@ bool MILPFormulator::tightenLowerBound( GurobiWrapper &gurobi,
     // If the bound is tighter, store it
     if ( newLb > currentLb )
     {
-        gurobi.setLowerBound( variableName, newLb );
+        solver.setLowerBound( variableName, newLb );
 
         if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( newLb ) )
             ++_signChanges;
@@ -21,8 +21,6 @@
 #include "LayerOwner.h"
 
 #include <atomic>
-#include <boost/chrono.hpp>
-#include <boost/lockfree/queue.hpp>
 #include <climits>
 #include <mutex>
 
@@ -52,7 +50,7 @@ public:
     void setCutoff( double cutoff );
 
     void createMILPEncoding( const Map<unsigned, Layer *> &layers,
-                             GurobiWrapper &gurobi,
+                             ILPSolver &solver,
                              unsigned lastLayer = UINT_MAX );
 
 private:
@@ -64,35 +62,35 @@ private:
     bool _cutoffInUse;
     double _cutoffValue;
 
-    bool tightenLowerBound( GurobiWrapper &gurobi,
+    bool tightenLowerBound( ILPSolver &solver,
                             Layer *layer,
                             unsigned neuron,
                             unsigned variable,
                             double &currentLb );
 
-    bool tightenUpperBound( GurobiWrapper &gurobi,
+    bool tightenUpperBound( ILPSolver &solver,
                             Layer *layer,
                             unsigned neuron,
                             unsigned variable,
                             double &currentUb );
 
     static void
-    addLayerToModel( GurobiWrapper &gurobi, const Layer *layer, LayerOwner *layerOwner );
+    addLayerToModel( ILPSolver &solver, const Layer *layer, LayerOwner *layerOwner );
 
-    static void addReluLayerToMILPFormulation( GurobiWrapper &gurobi,
+    static void addReluLayerToMILPFormulation( ILPSolver &solver,
                                                const Layer *layer,
                                                LayerOwner *layerOwner );
 
-    static void addNeuronToModel( GurobiWrapper &gurobi,
+    static void addNeuronToModel( ILPSolver &solver,
                                   const Layer *layer,
                                   unsigned neuron,
                                   LayerOwner *layerOwner );
 
     /*
       Optimize for the min/max value of variableName with respect to the constraints
-      encoded in gurobi. If the query is infeasible, *infeasible is set to true.
+      encoded in solver. If the query is infeasible, *infeasible is set to true.
     */
-    static double optimizeWithGurobi( GurobiWrapper &gurobi,
+    static double optimizeWithGurobi( ILPSolver &solver,
                                       MinOrMax minOrMax,
                                       String variableName,
                                       double cutoffValue,
@@ -106,12 +104,37 @@ private:
 
     static void log( const String &message );
 
-    void optimizeBoundsOfNeuronsWithMILPEncoding( ThreadArgument &args );
+    /*
+      Tighten the bounds of the neurons of the target layer, using the
+      workers of the pool
+    */
+    void optimizeBoundsOfNeuronsWithMILPEncoding( SolverPool &pool,
+                                                  TighteningState &state,
+                                                  const Map<unsigned, Layer *> &layers,
+                                                  unsigned lastIndexOfRelaxation,
+                                                  unsigned targetIndex );
 
     /*
       Tighten the upper- and lower- bound of a varaible with MILP encoding
     */
-    static void tightenSingleVariableBoundsWithMILPEncoding( ThreadArgument &argument );
+    void tightenSingleVariableBoundsWithMILPEncoding( ILPSolver &solver,
+                                                      const Map<unsigned, Layer *> &layers,
+                                                      const NeuronTask &task,
+                                                      TighteningState &state );
+
+    /*
+      Optimize a bound of the neuron of a task, and store it if it is
+      tighter. Return true if no further optimization is needed, i.e.,
+      if the bound crossed the cutoff or the query is infeasible.
+    */
+    bool tightenLowerBoundOfTask( ILPSolver &solver,
+                                  const NeuronTask &task,
+                                  const String &variableName,
+                                  TighteningState &state );
+    bool tightenUpperBoundOfTask( ILPSolver &solver,
+                                  const NeuronTask &task,
+                                  const String &variableName,
+                                  TighteningState &state );
 };
 
 } // namespace NLR
@@ -27,7 +27,8 @@ public:
         INPUT_LAYER_NOT_THE_FIRST_LAYER = 2,
         LEAKY_RELU_SLOPES_NOT_UNIFORM = 3,
         RELU_NOT_FOUND = 4,
-        LAYER_NOT_FOUND = 5
+        LAYER_NOT_FOUND = 5,
+        INSTRUCTION_SET_NOT_SUPPORTED = 6,
     };
 
     NLRError( NLRError::Code code )
@@ -100,6 +100,24 @@ void NetworkLevelReasoner::setBias( unsigned layer, unsigned neuron, double bias
     _layerIndexToLayer[layer]->setBias( neuron, bias );
 }
 
+void NetworkLevelReasoner::finalizeWeights()
+{
+    for ( const auto &layer : _layerIndexToLayer )
+        layer.second->finalizeWeights();
+}
+
+void NetworkLevelReasoner::setWeightRepresentation( WeightMatrix::Representation representation )
+{
+    for ( const auto &layer : _layerIndexToLayer )
+    {
+        if ( layer.second->getLayerType() != Layer::WEIGHTED_SUM )
+            continue;
+
+        for ( const auto &source : layer.second->getSourceLayers() )
+            layer.second->setWeightRepresentation( source.first, representation );
+    }
+}
+
 void NetworkLevelReasoner::addActivationSource( unsigned sourceLayer,
                                                 unsigned sourceNeuron,
                                                 unsigned targetLayer,
@@ -120,6 +138,7 @@ Layer *NetworkLevelReasoner::getLayer( unsigned index )
 
 void NetworkLevelReasoner::evaluate( double *input, double *output )
 {
+    finalizeWeights();
     _layerIndexToLayer[0]->setAssignment( input );
     for ( unsigned i = 1; i < _layerIndexToLayer.size(); ++i )
         _layerIndexToLayer[i]->computeAssignment();
@@ -130,6 +149,7 @@ void NetworkLevelReasoner::evaluate( double *input, double *output )
 
 void NetworkLevelReasoner::concretizeInputAssignment( Map<unsigned, double> &assignment )
 {
+    finalizeWeights();
     Layer *inputLayer = _layerIndexToLayer[0];
     ASSERT( inputLayer->getLayerType() == Layer::INPUT );
 
@@ -172,11 +192,20 @@ void NetworkLevelReasoner::concretizeInputAssignment( Map<unsigned, double> &ass
 
 void NetworkLevelReasoner::simulate( Vector<Vector<double>> *input )
 {
+    finalizeWeights();
     _layerIndexToLayer[0]->setSimulations( input );
     for ( unsigned i = 1; i < _layerIndexToLayer.size(); ++i )
         _layerIndexToLayer[i]->computeSimulations();
 }
 
+void NetworkLevelReasoner::simulate( const double *input, unsigned numberOfSimulations )
+{
+    finalizeWeights();
+    _layerIndexToLayer[0]->setSimulations( input, numberOfSimulations );
+    for ( unsigned i = 1; i < _layerIndexToLayer.size(); ++i )
+        _layerIndexToLayer[i]->computeSimulations();
+}
+
 void NetworkLevelReasoner::setNeuronVariable( NeuronIndex index, unsigned variable )
 {
     _layerIndexToLayer[index._layer]->setNeuronVariable( index._neuron, variable );
@@ -200,12 +229,14 @@ void NetworkLevelReasoner::clearConstraintTightenings()
 
 void NetworkLevelReasoner::symbolicBoundPropagation()
 {
+    finalizeWeights();
     for ( unsigned i = 0; i < _layerIndexToLayer.size(); ++i )
         _layerIndexToLayer[i]->computeSymbolicBounds();
 }
 
 void NetworkLevelReasoner::deepPolyPropagation()
 {
+    finalizeWeights();
     if ( _deepPolyAnalysis == nullptr )
         _deepPolyAnalysis = std::unique_ptr<DeepPolyAnalysis>( new DeepPolyAnalysis( this ) );
     _deepPolyAnalysis->run();
@@ -213,6 +244,7 @@ void NetworkLevelReasoner::deepPolyPropagation()
 
 void NetworkLevelReasoner::lpRelaxationPropagation()
 {
+    finalizeWeights();
     LPFormulator lpFormulator( this );
     lpFormulator.setCutoff( 0 );
 
@@ -231,6 +263,7 @@ void NetworkLevelReasoner::lpRelaxationPropagation()
 
 void NetworkLevelReasoner::LPTighteningForOneLayer( unsigned targetIndex )
 {
+    finalizeWeights();
     LPFormulator lpFormulator( this );
     lpFormulator.setCutoff( 0 );
 
@@ -243,6 +276,7 @@ void NetworkLevelReasoner::LPTighteningForOneLayer( unsigned targetIndex )
 
 void NetworkLevelReasoner::MILPPropagation()
 {
+    finalizeWeights();
     MILPFormulator milpFormulator( this );
     milpFormulator.setCutoff( 0 );
 
@@ -256,6 +290,7 @@ void NetworkLevelReasoner::MILPPropagation()
 
 void NetworkLevelReasoner::MILPTighteningForOneLayer( unsigned targetIndex )
 {
+    finalizeWeights();
     MILPFormulator milpFormulator( this );
     milpFormulator.setCutoff( 0 );
 
@@ -268,6 +303,7 @@ void NetworkLevelReasoner::MILPTighteningForOneLayer( unsigned targetIndex )
 
 void NetworkLevelReasoner::iterativePropagation()
 {
+    finalizeWeights();
     IterativePropagator iterativePropagator( this );
     iterativePropagator.setCutoff( 0 );
     iterativePropagator.optimizeBoundsWithIterativePropagation( _layerIndexToLayer );
@@ -275,6 +311,7 @@ void NetworkLevelReasoner::iterativePropagation()
 
 void NetworkLevelReasoner::intervalArithmeticBoundPropagation()
 {
+    finalizeWeights();
     for ( unsigned i = 1; i < _layerIndexToLayer.size(); ++i )
         _layerIndexToLayer[i]->computeIntervalArithmeticBounds();
 }
@@ -676,6 +713,8 @@ NetworkLevelReasoner::mergeConsecutiveWSLayers( const Map<unsigned, double> &low
                                                 const Set<unsigned> &varsInUnhandledConstraints,
                                                 Map<unsigned, LinearExpression> &eliminatedNeurons )
 {
+    finalizeWeights();
+
     // Iterate over all layers, except the input layer
     unsigned layer = 1;
 
@@ -774,10 +813,14 @@ void NetworkLevelReasoner::mergeWSLayers( unsigned secondLayerIndex,
         unsigned outputDimension = secondLayer->getSize();
 
         // Compute new weights
-        const double *firstLayerMatrix = firstLayer->getWeightMatrix( previousToFirstLayerIndex );
-        const double *secondLayerMatrix = secondLayer->getWeightMatrix( firstLayerIndex );
+        double *firstLayerMatrix = new double[inputDimension * middleDimension];
+        double *secondLayerMatrix = new double[middleDimension * outputDimension];
+        firstLayer->getWeightMatrix( previousToFirstLayerIndex )->toDense( firstLayerMatrix );
+        secondLayer->getWeightMatrix( firstLayerIndex )->toDense( secondLayerMatrix );
         double *newWeightMatrix = multiplyWeights(
             firstLayerMatrix, secondLayerMatrix, inputDimension, middleDimension, outputDimension );
+        delete[] firstLayerMatrix;
+        delete[] secondLayerMatrix;
         // Update bias for second layer
         for ( unsigned targetNeuron = 0; targetNeuron < secondLayer->getSize(); ++targetNeuron )
         {
@@ -808,6 +851,7 @@ void NetworkLevelReasoner::mergeWSLayers( unsigned secondLayerIndex,
 
     // Remove the first layer from second layer's sources
     secondLayer->removeSourceLayer( firstLayerIndex );
+    secondLayer->finalizeWeights();
 
     generateLinearExpressionForWeightedSumLayer( eliminatedNeurons, firstLayer );
 
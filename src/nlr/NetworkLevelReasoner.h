@@ -56,6 +56,20 @@ public:
                     unsigned targetNeuron,
                     double weight );
     void setBias( unsigned layer, unsigned neuron, double bias );
+
+    /*
+      Prepare the weights of all layers for reading, see
+      Layer::finalizeWeights(). Called once the network is
+      constructed, and again by the evaluation and bound propagation
+      methods below, in case weights were set in the meantime.
+    */
+    void finalizeWeights();
+
+    /*
+      Store the weights of all weighted-sum layers in the given
+      representation, instead of the one chosen by their density
+    */
+    void setWeightRepresentation( WeightMatrix::Representation representation );
     void addActivationSource( unsigned sourceLayer,
                               unsigned sourceNeuron,
                               unsigned targetLeyer,
@@ -82,9 +96,12 @@ public:
     void concretizeInputAssignment( Map<unsigned, double> &assignment );
 
     /*
-      Perform a simulation of the network for a specific input
+      Perform a simulation of the network for a batch of inputs. The
+      input is given either per input neuron, or as a contiguous,
+      row-major matrix of dimensions inputSize x numberOfSimulations.
     */
     void simulate( Vector<Vector<double>> *input );
+    void simulate( const double *input, unsigned numberOfSimulations );
 
     /*
       Bound propagation methods:
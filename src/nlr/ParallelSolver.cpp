@@ -15,31 +15,270 @@
 
 #include "ParallelSolver.h"
 
-#include "InfeasibleQueryException.h"
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
 #include "Layer.h"
-#include "MStringf.h"
-#include "NLRError.h"
-#include "Options.h"
 #include "TimeUtils.h"
 
-#include <boost/thread.hpp>
+#include <algorithm>
 
 namespace NLR {
 
-void ParallelSolver::clearSolverQueue( SolverQueue &freeSolvers )
+ParallelSolver::SolverPool::SolverPool( unsigned numberOfWorkers,
+                                        const SolverFactory &createSolver,
+                                        double timeBudgetInSeconds )
+    : _timeBudgetInSeconds( timeBudgetInSeconds )
+    , _start( TimeUtils::sampleMicro() )
+    , _timeBudgetExhausted( false )
+    , _generation( 0 )
+    , _activeWorkers( 0 )
+    , _shutdown( false )
+    , _task( NULL )
+    , _prepare( NULL )
+    , _numberOfTasks( 0 )
+    , _nextTask( 0 )
+    , _tasksPerformed( 0 )
+    , _stop( false )
 {
-    // Remove the solvers
-    GurobiWrapper *freeSolver;
-    while ( freeSolvers.pop( freeSolver ) )
-        delete freeSolver;
+    if ( numberOfWorkers == 0 )
+        numberOfWorkers = 1;
+
+    for ( unsigned i = 0; i < numberOfWorkers; ++i )
+        _solvers.append( createSolver() );
+
+    // A single worker runs the tasks on the calling thread
+    if ( numberOfWorkers > 1 )
+    {
+        for ( unsigned i = 0; i < numberOfWorkers; ++i )
+            _threads.append( new boost::thread( &SolverPool::workerLoop, this, i ) );
+    }
 }
 
-void ParallelSolver::enqueueSolver( SolverQueue &solvers, GurobiWrapper *solver )
+ParallelSolver::SolverPool::~SolverPool()
 {
-    if ( !solvers.push( solver ) )
     {
-        ASSERT( false );
+        boost::unique_lock<boost::mutex> lock( _mutex );
+        _shutdown = true;
+    }
+    _workAvailable.notify_all();
+
+    for ( auto &thread : _threads )
+    {
+        thread->join();
+        delete thread;
     }
+    _threads.clear();
+
+    for ( auto &solver : _solvers )
+        delete solver;
+    _solvers.clear();
+}
+
+unsigned ParallelSolver::SolverPool::getNumberOfWorkers() const
+{
+    return _solvers.size();
+}
+
+bool ParallelSolver::SolverPool::timeBudgetExhausted() const
+{
+    return _timeBudgetExhausted;
+}
+
+unsigned ParallelSolver::SolverPool::run( unsigned numberOfTasks,
+                                          const TaskFunction &task,
+                                          const PrepareFunction &prepare )
+{
+    if ( numberOfTasks == 0 || outOfTime() )
+        return 0;
+
+    _task = &task;
+    _prepare = prepare ? &prepare : NULL;
+    _numberOfTasks = numberOfTasks;
+    _nextTask = 0;
+    _tasksPerformed = 0;
+    _stop = false;
+    _exception = NULL;
+
+    if ( _threads.empty() )
+        work( 0 );
+    else
+    {
+        boost::unique_lock<boost::mutex> lock( _mutex );
+        _activeWorkers = _threads.size();
+        ++_generation;
+        _workAvailable.notify_all();
+
+        while ( _activeWorkers > 0 )
+            _workDone.wait( lock );
+    }
+
+    _task = NULL;
+    _prepare = NULL;
+
+    if ( _exception )
+    {
+        std::exception_ptr exception = _exception;
+        _exception = NULL;
+        std::rethrow_exception( exception );
+    }
+
+    return _tasksPerformed;
+}
+
+void ParallelSolver::SolverPool::workerLoop( unsigned worker )
+{
+    unsigned generation = 0;
+    while ( true )
+    {
+        {
+            boost::unique_lock<boost::mutex> lock( _mutex );
+            while ( !_shutdown && _generation == generation )
+                _workAvailable.wait( lock );
+
+            if ( _shutdown )
+                return;
+
+            generation = _generation;
+        }
+
+        work( worker );
+
+        {
+            boost::unique_lock<boost::mutex> lock( _mutex );
+            if ( --_activeWorkers == 0 )
+                _workDone.notify_all();
+        }
+    }
+}
+
+void ParallelSolver::SolverPool::work( unsigned worker )
+{
+    ILPSolver &solver = *_solvers[worker];
+    bool prepared = false;
+
+    try
+    {
+        while ( !_stop )
+        {
+            unsigned first = _nextTask.fetch_add( GlobalConfiguration::LP_TIGHTENING_BATCH_SIZE );
+            if ( first >= _numberOfTasks )
+                return;
+
+            if ( !prepared && _prepare )
+            {
+                ( *_prepare )( solver );
+                prepared = true;
+            }
+
+            unsigned last =
+                std::min( first + GlobalConfiguration::LP_TIGHTENING_BATCH_SIZE, _numberOfTasks );
+            for ( unsigned i = first; i < last; ++i )
+            {
+                if ( _stop || outOfTime() )
+                {
+                    _stop = true;
+                    return;
+                }
+
+                if ( !( *_task )( solver, i ) )
+                    _stop = true;
+
+                ++_tasksPerformed;
+            }
+        }
+    }
+    catch ( ... )
+    {
+        boost::unique_lock<boost::mutex> lock( _mutex );
+        if ( !_exception )
+            _exception = std::current_exception();
+        _stop = true;
+    }
+}
+
+bool ParallelSolver::SolverPool::outOfTime()
+{
+    if ( _timeBudgetExhausted )
+        return true;
+
+    if ( _timeBudgetInSeconds <= 0 )
+        return false;
+
+    unsigned long long passed = TimeUtils::timePassed( _start, TimeUtils::sampleMicro() );
+    if ( passed < _timeBudgetInSeconds * 1000000 )
+        return false;
+
+    _timeBudgetExhausted = true;
+    return true;
+}
+
+void ParallelSolver::collectNeuronTasks( Layer *layer,
+                                         const Layer *simulationLayer,
+                                         bool cutoffInUse,
+                                         double cutoffValue,
+                                         Vector<NeuronTask> &tasks )
+{
+    unsigned numberOfSimulations = simulationLayer->getNumberOfSimulations();
+
+    for ( unsigned i = 0; i < layer->getSize(); ++i )
+    {
+        if ( layer->neuronEliminated( i ) )
+            continue;
+
+        double currentLb = layer->getLb( i );
+        double currentUb = layer->getUb( i );
+
+        if ( cutoffInUse && ( currentLb >= cutoffValue || currentUb <= cutoffValue ) )
+            continue;
+
+        bool skipTightenLb = false;
+        bool skipTightenUb = false;
+
+        if ( cutoffInUse )
+        {
+            const double *simulations = simulationLayer->getSimulations( i );
+            for ( unsigned j = 0; j < numberOfSimulations; ++j )
+            {
+                // If x_lower < cutoff < x_sim, the upper bound cannot
+                // cross the cutoff
+                if ( cutoffValue < simulations[j] )
+                    skipTightenUb = true;
+
+                // If x_sim < cutoff < x_upper, the lower bound cannot
+                // cross the cutoff
+                if ( simulations[j] < cutoffValue )
+                    skipTightenLb = true;
+
+                if ( skipTightenUb && skipTightenLb )
+                    break;
+            }
+        }
+
+        if ( skipTightenUb && skipTightenLb )
+            continue;
+
+        tasks.append( NeuronTask( layer, i, currentLb, currentUb, skipTightenLb, skipTightenUb ) );
+    }
+}
+
+void ParallelSolver::sortByExpectedGain( Vector<NeuronTask> &tasks,
+                                         bool cutoffInUse,
+                                         double cutoffValue )
+{
+    // Without a cutoff, a neuron is unstable if its sign is not fixed
+    double pivot = cutoffInUse ? cutoffValue : 0;
+
+    std::stable_sort( tasks.begin(),
+                      tasks.end(),
+                      [pivot]( const NeuronTask &a, const NeuronTask &b ) {
+                          bool aUnstable = a._currentLb < pivot && pivot < a._currentUb;
+                          bool bUnstable = b._currentLb < pivot && pivot < b._currentUb;
+                          if ( aUnstable != bUnstable )
+                              return aUnstable;
+
+                          return a._currentUb - a._currentLb > b._currentUb - b._currentLb;
+                      } );
 }
 
 } // namespace NLR
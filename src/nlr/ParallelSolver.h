@@ -16,196 +16,178 @@
 #ifndef __ParallelSolver_h__
 #define __ParallelSolver_h__
 
-#include "GurobiWrapper.h"
+#include "ILPSolver.h"
+#include "Vector.h"
 
 #include <atomic>
-#include <boost/lockfree/queue.hpp>
 #include <boost/thread.hpp>
+#include <exception>
+#include <functional>
 #include <mutex>
 
 namespace NLR {
 
 class Layer;
-class LayerOwner;
-struct NeuronIndex;
 
 class ParallelSolver
 {
 public:
-    typedef boost::lockfree::queue<GurobiWrapper *, boost::lockfree::fixed_sized<true>> SolverQueue;
-
     /*
-      Arguments for the spawned thread. This is needed because Boost::thread does
-      not seem to support functions with more than 7 arguments.
+      A request to tighten the bounds of a single neuron. The current
+      bounds are the ones known when the task was created, and either
+      direction may be skipped, e.g., if a simulation has already
+      shown that it cannot cross the cutoff value.
     */
-    struct ThreadArgument
+    struct NeuronTask
     {
-        ThreadArgument( GurobiWrapper *gurobi,
-                        Layer *layer,
-                        const Map<unsigned, Layer *> *layers,
-                        unsigned index,
-                        double currentLb,
-                        double currentUb,
-                        bool cutoffInUse,
-                        double cutoffValue,
-                        LayerOwner *layerOwner,
-                        SolverQueue &freeSolvers,
-                        std::mutex &mtx,
-                        std::atomic_bool &infeasible,
-                        std::atomic_uint &tighterBoundCounter,
-                        std::atomic_uint &signChanges,
-                        std::atomic_uint &cutoffs,
-                        bool skipTightenLb,
-                        bool skipTightenUb )
-            : _gurobi( gurobi )
-            , _layer( layer )
-            , _layers( layers )
-            , _index( index )
-            , _currentLb( currentLb )
-            , _currentUb( currentUb )
-            , _cutoffInUse( cutoffInUse )
-            , _cutoffValue( cutoffValue )
-            , _layerOwner( layerOwner )
-            , _freeSolvers( freeSolvers )
-            , _mtx( mtx )
-            , _infeasible( infeasible )
-            , _tighterBoundCounter( tighterBoundCounter )
-            , _signChanges( signChanges )
-            , _cutoffs( cutoffs )
-            , _skipTightenLb( skipTightenLb )
-            , _skipTightenUb( skipTightenUb )
-            , _lastFixedNeuron( NULL )
+        NeuronTask()
+            : _layer( NULL )
+            , _index( 0 )
+            , _currentLb( 0 )
+            , _currentUb( 0 )
+            , _skipTightenLb( false )
+            , _skipTightenUb( false )
         {
         }
 
-        ThreadArgument( GurobiWrapper *gurobi,
-                        Layer *layer,
-                        unsigned index,
-                        double currentLb,
-                        double currentUb,
-                        bool cutoffInUse,
-                        double cutoffValue,
-                        LayerOwner *layerOwner,
-                        SolverQueue &freeSolvers,
-                        std::mutex &mtx,
-                        std::atomic_bool &infeasible,
-                        std::atomic_uint &tighterBoundCounter,
-                        std::atomic_uint &signChanges,
-                        std::atomic_uint &cutoffs,
-                        bool skipTightenLb,
-                        bool skipTightenUb )
-            : _gurobi( gurobi )
-            , _layer( layer )
-            , _layers( NULL )
+        NeuronTask( Layer *layer,
+                    unsigned index,
+                    double currentLb,
+                    double currentUb,
+                    bool skipTightenLb,
+                    bool skipTightenUb )
+            : _layer( layer )
             , _index( index )
             , _currentLb( currentLb )
             , _currentUb( currentUb )
-            , _cutoffInUse( cutoffInUse )
-            , _cutoffValue( cutoffValue )
-            , _layerOwner( layerOwner )
-            , _freeSolvers( freeSolvers )
-            , _mtx( mtx )
-            , _infeasible( infeasible )
-            , _tighterBoundCounter( tighterBoundCounter )
-            , _signChanges( signChanges )
-            , _cutoffs( cutoffs )
             , _skipTightenLb( skipTightenLb )
             , _skipTightenUb( skipTightenUb )
-            , _lastFixedNeuron( NULL )
-        {
-        }
-
-        ThreadArgument( GurobiWrapper *gurobi,
-                        Layer *layer,
-                        unsigned index,
-                        double currentLb,
-                        double currentUb,
-                        bool cutoffInUse,
-                        double cutoffValue,
-                        LayerOwner *layerOwner,
-                        SolverQueue &freeSolvers,
-                        std::mutex &mtx,
-                        std::atomic_bool &infeasible,
-                        std::atomic_uint &tighterBoundCounter,
-                        std::atomic_uint &signChanges,
-                        std::atomic_uint &cutoffs,
-                        NeuronIndex *lastFixedNeuron )
-            : _gurobi( gurobi )
-            , _layer( layer )
-            , _layers( NULL )
-            , _index( index )
-            , _currentLb( currentLb )
-            , _currentUb( currentUb )
-            , _cutoffInUse( cutoffInUse )
-            , _cutoffValue( cutoffValue )
-            , _layerOwner( layerOwner )
-            , _freeSolvers( freeSolvers )
-            , _mtx( mtx )
-            , _infeasible( infeasible )
-            , _tighterBoundCounter( tighterBoundCounter )
-            , _signChanges( signChanges )
-            , _cutoffs( cutoffs )
-            , _lastFixedNeuron( lastFixedNeuron )
-        {
-        }
-
-        ThreadArgument( Layer *layer,
-                        const Map<unsigned, Layer *> *layers,
-                        SolverQueue &freeSolvers,
-                        std::mutex &mtx,
-                        std::atomic_bool &infeasible,
-                        std::atomic_uint &tighterBoundCounter,
-                        std::atomic_uint &signChanges,
-                        std::atomic_uint &cutoffs,
-                        unsigned lastIndexOfRelaxation,
-                        unsigned targetIndex,
-                        boost::thread *threads,
-                        const Map<GurobiWrapper *, unsigned> *solverToIndex )
-            : _layer( layer )
-            , _layers( layers )
-            , _freeSolvers( freeSolvers )
-            , _mtx( mtx )
-            , _infeasible( infeasible )
-            , _tighterBoundCounter( tighterBoundCounter )
-            , _signChanges( signChanges )
-            , _cutoffs( cutoffs )
-            , _lastIndexOfRelaxation( lastIndexOfRelaxation )
-            , _targetIndex( targetIndex )
-            , _threads( threads )
-            , _solverToIndex( solverToIndex )
         {
         }
 
-        GurobiWrapper *_gurobi;
         Layer *_layer;
-        const Map<unsigned, Layer *> *_layers;
         unsigned _index;
         double _currentLb;
         double _currentUb;
-        bool _cutoffInUse;
-        double _cutoffValue;
-        LayerOwner *_layerOwner;
-        SolverQueue &_freeSolvers;
-        std::mutex &_mtx;
-        std::atomic_bool &_infeasible;
-        std::atomic_uint &_tighterBoundCounter;
-        std::atomic_uint &_signChanges;
-        std::atomic_uint &_cutoffs;
         bool _skipTightenLb;
         bool _skipTightenUb;
-        NeuronIndex *_lastFixedNeuron;
-        unsigned _lastIndexOfRelaxation;
-        unsigned _targetIndex;
-        boost::thread *_threads;
-        const Map<GurobiWrapper *, unsigned> *_solverToIndex;
     };
 
     /*
-      Free all the solvers in the SolverQueue
+      State shared by the workers of a tightening pass: the mutex that
+      guards the layers and their owner, and the statistics.
+    */
+    struct TighteningState
+    {
+        TighteningState()
+            : _infeasible( false )
+            , _tighterBoundCounter( 0 )
+            , _signChanges( 0 )
+            , _cutoffs( 0 )
+        {
+        }
+
+        std::mutex _mtx;
+        std::atomic_bool _infeasible;
+        std::atomic_uint _tighterBoundCounter;
+        std::atomic_uint _signChanges;
+        std::atomic_uint _cutoffs;
+    };
+
+    /*
+      A pool of worker threads, each owning its own solver, that live
+      for the duration of a tightening pass. A call to run() hands out
+      the tasks 0, ..., n-1 to the workers in batches, and returns once
+      they have all been handled. Before its first task in a run, a
+      worker calls the prepare function on its solver, e.g. to encode
+      the constraints that are shared by all the tasks.
+
+      A task returns false to stop the run: the tasks that have not
+      started yet are skipped. The same happens once the time budget of
+      the pool is exhausted. An exception thrown by a task also stops
+      the run, and is rethrown by run().
+    */
+    class SolverPool
+    {
+    public:
+        typedef std::function<ILPSolver *()> SolverFactory;
+        typedef std::function<void( ILPSolver & )> PrepareFunction;
+        typedef std::function<bool( ILPSolver &, unsigned )> TaskFunction;
+
+        /*
+          A time budget of 0 means no budget
+        */
+        SolverPool( unsigned numberOfWorkers,
+                    const SolverFactory &createSolver,
+                    double timeBudgetInSeconds = 0 );
+        ~SolverPool();
+
+        unsigned getNumberOfWorkers() const;
+
+        /*
+          Run the tasks, and return the number of tasks that were
+          performed
+        */
+        unsigned run( unsigned numberOfTasks,
+                      const TaskFunction &task,
+                      const PrepareFunction &prepare = PrepareFunction() );
+
+        bool timeBudgetExhausted() const;
+
+    private:
+        Vector<ILPSolver *> _solvers;
+        Vector<boost::thread *> _threads;
+
+        double _timeBudgetInSeconds;
+        struct timespec _start;
+        std::atomic_bool _timeBudgetExhausted;
+
+        /*
+          Synchronization between run() and the workers. Every run
+          increments the generation, which wakes the workers up.
+        */
+        boost::mutex _mutex;
+        boost::condition_variable _workAvailable;
+        boost::condition_variable _workDone;
+        unsigned _generation;
+        unsigned _activeWorkers;
+        bool _shutdown;
+
+        /*
+          The current run
+        */
+        const TaskFunction *_task;
+        const PrepareFunction *_prepare;
+        unsigned _numberOfTasks;
+        std::atomic_uint _nextTask;
+        std::atomic_uint _tasksPerformed;
+        std::atomic_bool _stop;
+        std::exception_ptr _exception;
+
+        void workerLoop( unsigned worker );
+        void work( unsigned worker );
+        bool outOfTime();
+    };
+
+    /*
+      Collect the neurons of a layer whose bounds should be tightened.
+      Neurons whose bounds are already on one side of the cutoff are
+      skipped, and a simulated value on one side of the cutoff shows
+      that the bound on that side cannot cross it.
     */
-    static void clearSolverQueue( SolverQueue &freeSolvers );
+    static void collectNeuronTasks( Layer *layer,
+                                    const Layer *simulationLayer,
+                                    bool cutoffInUse,
+                                    double cutoffValue,
+                                    Vector<NeuronTask> &tasks );
 
-    static void enqueueSolver( SolverQueue &solvers, GurobiWrapper *solver );
+    /*
+      Order the tasks so that the ones expected to gain the most are
+      handled first: neurons whose interval contains the cutoff value
+      (e.g., unstable ReLUs), and then neurons with wider intervals.
+    */
+    static void
+    sortByExpectedGain( Vector<NeuronTask> &tasks, bool cutoffInUse, double cutoffValue );
 };
 
 } // namespace NLR
@@ -0,0 +1,673 @@
+/*********************                                                        */
+/*! \file WeightMatrix.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "WeightMatrix.h"
+
+#include "BoundKernels.h"
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "MatrixMultiplication.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NLR {
+
+WeightMatrix::WeightMatrix( unsigned sourceSize,
+                            unsigned targetSize,
+                            Representation representation )
+    : _sourceSize( sourceSize )
+    , _targetSize( targetSize )
+    , _representation( representation )
+    , _weights( NULL )
+    , _positiveWeights( NULL )
+    , _negativeWeights( NULL )
+{
+    if ( _representation == DENSE )
+        allocateDense();
+    else
+        initializeEmptyCSR();
+}
+
+WeightMatrix::WeightMatrix( const WeightMatrix &other )
+    : _weights( NULL )
+    , _positiveWeights( NULL )
+    , _negativeWeights( NULL )
+{
+    copyFrom( other );
+}
+
+WeightMatrix &WeightMatrix::operator=( const WeightMatrix &other )
+{
+    if ( this != &other )
+    {
+        freeMemoryIfNeeded();
+        copyFrom( other );
+    }
+
+    return *this;
+}
+
+WeightMatrix::~WeightMatrix()
+{
+    freeMemoryIfNeeded();
+}
+
+void WeightMatrix::copyFrom( const WeightMatrix &other )
+{
+    _sourceSize = other._sourceSize;
+    _targetSize = other._targetSize;
+    _representation = other._representation;
+
+    if ( _representation == DENSE )
+    {
+        allocateDense();
+        unsigned size = _sourceSize * _targetSize;
+        memcpy( _weights, other._weights, sizeof( double ) * size );
+        memcpy( _positiveWeights, other._positiveWeights, sizeof( double ) * size );
+        memcpy( _negativeWeights, other._negativeWeights, sizeof( double ) * size );
+    }
+    else
+    {
+        _rowStart = other._rowStart;
+        _columns = other._columns;
+        _values = other._values;
+        _pendingEntries = other._pendingEntries;
+    }
+}
+
+WeightMatrix::Representation WeightMatrix::getPreferredRepresentation() const
+{
+    ASSERT( _pendingEntries.empty() );
+
+    unsigned long long size = (unsigned long long)_sourceSize * _targetSize;
+    if ( size == 0 )
+        return DENSE;
+
+    unsigned long long numberOfNonZeros = 0;
+    if ( _representation == CSR )
+        numberOfNonZeros = _values.size();
+    else
+    {
+        for ( unsigned long long i = 0; i < size; ++i )
+        {
+            if ( _weights[i] != 0 )
+                ++numberOfNonZeros;
+        }
+    }
+
+    double density = (double)numberOfNonZeros / size;
+    return density <= GlobalConfiguration::NLR_SPARSE_WEIGHTS_DENSITY_THRESHOLD ? CSR : DENSE;
+}
+
+void WeightMatrix::allocateDense()
+{
+    unsigned size = _sourceSize * _targetSize;
+
+    _weights = new double[size];
+    _positiveWeights = new double[size];
+    _negativeWeights = new double[size];
+
+    std::fill_n( _weights, size, 0 );
+    std::fill_n( _positiveWeights, size, 0 );
+    std::fill_n( _negativeWeights, size, 0 );
+}
+
+void WeightMatrix::initializeEmptyCSR()
+{
+    _rowStart.assign( _sourceSize + 1, 0 );
+    _columns.clear();
+    _values.clear();
+    _pendingEntries.clear();
+}
+
+void WeightMatrix::freeMemoryIfNeeded()
+{
+    if ( _weights )
+    {
+        delete[] _weights;
+        _weights = NULL;
+    }
+
+    if ( _positiveWeights )
+    {
+        delete[] _positiveWeights;
+        _positiveWeights = NULL;
+    }
+
+    if ( _negativeWeights )
+    {
+        delete[] _negativeWeights;
+        _negativeWeights = NULL;
+    }
+
+    _rowStart.clear();
+    _columns.clear();
+    _values.clear();
+    _pendingEntries.clear();
+}
+
+WeightMatrix::Representation WeightMatrix::getRepresentation() const
+{
+    return _representation;
+}
+
+void WeightMatrix::convertTo( Representation representation )
+{
+    if ( representation == _representation )
+        return;
+
+    if ( representation == CSR )
+    {
+        Vector<unsigned> rowStart;
+        Vector<unsigned> columns;
+        Vector<double> values;
+
+        rowStart.append( 0 );
+        for ( unsigned i = 0; i < _sourceSize; ++i )
+        {
+            for ( unsigned j = 0; j < _targetSize; ++j )
+            {
+                double weight = _weights[i * _targetSize + j];
+                if ( weight != 0 )
+                {
+                    columns.append( j );
+                    values.append( weight );
+                }
+            }
+            rowStart.append( columns.size() );
+        }
+
+        freeMemoryIfNeeded();
+        _rowStart = rowStart;
+        _columns = columns;
+        _values = values;
+    }
+    else
+    {
+        finalize();
+        double *dense = new double[_sourceSize * _targetSize];
+        toDense( dense );
+
+        freeMemoryIfNeeded();
+        allocateDense();
+        for ( unsigned i = 0; i < _sourceSize * _targetSize; ++i )
+        {
+            _weights[i] = dense[i];
+            if ( dense[i] > 0 )
+                _positiveWeights[i] = dense[i];
+            else
+                _negativeWeights[i] = dense[i];
+        }
+
+        delete[] dense;
+    }
+
+    _representation = representation;
+}
+
+unsigned WeightMatrix::getSourceSize() const
+{
+    return _sourceSize;
+}
+
+unsigned WeightMatrix::getTargetSize() const
+{
+    return _targetSize;
+}
+
+unsigned WeightMatrix::getNumberOfStoredEntries() const
+{
+    if ( _representation == DENSE )
+        return _sourceSize * _targetSize;
+
+    ASSERT( _pendingEntries.empty() );
+    return _values.size();
+}
+
+void WeightMatrix::setWeight( unsigned sourceNeuron, unsigned targetNeuron, double weight )
+{
+    ASSERT( sourceNeuron < _sourceSize );
+    ASSERT( targetNeuron < _targetSize );
+
+    if ( _representation == DENSE )
+    {
+        unsigned index = sourceNeuron * _targetSize + targetNeuron;
+        _weights[index] = weight;
+
+        if ( weight > 0 )
+        {
+            _positiveWeights[index] = weight;
+            _negativeWeights[index] = 0;
+        }
+        else
+        {
+            _positiveWeights[index] = 0;
+            _negativeWeights[index] = weight;
+        }
+        return;
+    }
+
+    // Overwrite existing entries in place, if possible
+    if ( _pendingEntries.empty() )
+    {
+        unsigned index = findEntry( sourceNeuron, targetNeuron );
+        if ( index < _columns.size() )
+        {
+            _values[index] = weight;
+            return;
+        }
+    }
+
+    if ( weight != 0 || !_pendingEntries.empty() )
+        _pendingEntries.append( PendingEntry( sourceNeuron, targetNeuron, weight ) );
+}
+
+double WeightMatrix::getWeight( unsigned sourceNeuron, unsigned targetNeuron ) const
+{
+    ASSERT( sourceNeuron < _sourceSize );
+    ASSERT( targetNeuron < _targetSize );
+
+    if ( _representation == DENSE )
+        return _weights[sourceNeuron * _targetSize + targetNeuron];
+
+    // The latest pending update of the entry, if any, prevails
+    for ( unsigned i = _pendingEntries.size(); i > 0; --i )
+    {
+        const PendingEntry &entry = _pendingEntries[i - 1];
+        if ( entry._source == sourceNeuron && entry._target == targetNeuron )
+            return entry._weight;
+    }
+
+    unsigned index = findEntry( sourceNeuron, targetNeuron );
+    return index < _columns.size() ? _values[index] : 0;
+}
+
+unsigned WeightMatrix::findEntry( unsigned sourceNeuron, unsigned targetNeuron ) const
+{
+    const unsigned *begin = _columns.data() + _rowStart[sourceNeuron];
+    const unsigned *end = _columns.data() + _rowStart[sourceNeuron + 1];
+    const unsigned *it = std::lower_bound( begin, end, targetNeuron );
+
+    if ( it != end && *it == targetNeuron )
+        return it - _columns.data();
+
+    return _columns.size();
+}
+
+void WeightMatrix::finalize()
+{
+    if ( _pendingEntries.empty() )
+        return;
+
+    // Sort the pending entries by row and column. The sort is stable, so
+    // that the last update to an entry is the one that prevails.
+    std::stable_sort( _pendingEntries.begin(),
+                      _pendingEntries.end(),
+                      []( const PendingEntry &a, const PendingEntry &b ) {
+                          if ( a._source != b._source )
+                              return a._source < b._source;
+                          return a._target < b._target;
+                      } );
+
+    Vector<unsigned> rowStart;
+    Vector<unsigned> columns;
+    Vector<double> values;
+
+    rowStart.append( 0 );
+    unsigned pending = 0;
+    unsigned numPending = _pendingEntries.size();
+    for ( unsigned i = 0; i < _sourceSize; ++i )
+    {
+        unsigned existing = _rowStart[i];
+        unsigned rowEnd = _rowStart[i + 1];
+
+        while ( existing < rowEnd ||
+                ( pending < numPending && _pendingEntries[pending]._source == i ) )
+        {
+            bool takePending = false;
+            bool overwrite = false;
+            if ( pending < numPending && _pendingEntries[pending]._source == i )
+            {
+                if ( existing >= rowEnd )
+                    takePending = true;
+                else if ( _pendingEntries[pending]._target <= _columns[existing] )
+                {
+                    takePending = true;
+                    overwrite = ( _pendingEntries[pending]._target == _columns[existing] );
+                }
+            }
+
+            if ( !takePending )
+            {
+                columns.append( _columns[existing] );
+                values.append( _values[existing] );
+                ++existing;
+                continue;
+            }
+
+            // Skip to the last pending update of this entry
+            unsigned target = _pendingEntries[pending]._target;
+            while ( pending + 1 < numPending && _pendingEntries[pending + 1]._source == i &&
+                    _pendingEntries[pending + 1]._target == target )
+                ++pending;
+
+            double weight = _pendingEntries[pending]._weight;
+            if ( weight != 0 )
+            {
+                columns.append( target );
+                values.append( weight );
+            }
+
+            ++pending;
+            if ( overwrite )
+                ++existing;
+        }
+
+        rowStart.append( columns.size() );
+    }
+
+    _rowStart = rowStart;
+    _columns = columns;
+    _values = values;
+    _pendingEntries.clear();
+}
+
+void WeightMatrix::toDense( double *result ) const
+{
+    toDenseColumns( 0, _targetSize, result );
+}
+
+void WeightMatrix::toDenseColumns( unsigned firstTarget,
+                                   unsigned numberOfTargets,
+                                   double *result ) const
+{
+    ASSERT( firstTarget + numberOfTargets <= _targetSize );
+
+    if ( _representation == DENSE )
+    {
+        for ( unsigned i = 0; i < _sourceSize; ++i )
+            memcpy( result + i * numberOfTargets,
+                    _weights + i * _targetSize + firstTarget,
+                    sizeof( double ) * numberOfTargets );
+        return;
+    }
+
+    ASSERT( _pendingEntries.empty() );
+    std::fill_n( result, _sourceSize * numberOfTargets, 0 );
+    unsigned lastTarget = firstTarget + numberOfTargets;
+    for ( unsigned i = 0; i < _sourceSize; ++i )
+    {
+        const unsigned *end = _columns.data() + _rowStart[i + 1];
+        const unsigned *it =
+            std::lower_bound( _columns.data() + _rowStart[i], end, firstTarget );
+        for ( ; it != end && *it < lastTarget; ++it )
+            result[i * numberOfTargets + *it - firstTarget] = _values[it - _columns.data()];
+    }
+}
+
+void WeightMatrix::addVectorTimesWeights( const double *vector, double *result ) const
+{
+    if ( _representation == DENSE )
+    {
+        for ( unsigned i = 0; i < _sourceSize; ++i )
+            for ( unsigned j = 0; j < _targetSize; ++j )
+                result[j] += ( vector[i] * _weights[i * _targetSize + j] );
+        return;
+    }
+
+    ASSERT( _pendingEntries.empty() );
+    for ( unsigned i = 0; i < _sourceSize; ++i )
+    {
+        double value = vector[i];
+        for ( unsigned k = _rowStart[i]; k < _rowStart[i + 1]; ++k )
+            result[_columns[k]] += ( value * _values[k] );
+    }
+}
+
+void WeightMatrix::addIntervalTimesWeights( const double *lb,
+                                            const double *ub,
+                                            double *resultLb,
+                                            double *resultUb ) const
+{
+    if ( _representation == DENSE )
+    {
+        BoundKernels::addIntervalTimesMatrix(
+            _weights, _sourceSize, _targetSize, lb, ub, resultLb, resultUb );
+        return;
+    }
+
+    ASSERT( _pendingEntries.empty() );
+    for ( unsigned i = 0; i < _sourceSize; ++i )
+    {
+        for ( unsigned k = _rowStart[i]; k < _rowStart[i + 1]; ++k )
+        {
+            unsigned j = _columns[k];
+            double weight = _values[k];
+
+            if ( weight > 0 )
+            {
+                resultLb[j] += weight * lb[i];
+                resultUb[j] += weight * ub[i];
+            }
+            else
+            {
+                resultLb[j] += weight * ub[i];
+                resultUb[j] += weight * lb[i];
+            }
+        }
+    }
+}
+
+void WeightMatrix::addMatrixTimesPositiveWeights( const double *matrix,
+                                                  unsigned rows,
+                                                  double *result ) const
+{
+    addMatrixTimesSignedWeights( matrix, rows, result, POSITIVE_WEIGHTS );
+}
+
+void WeightMatrix::addMatrixTimesNegativeWeights( const double *matrix,
+                                                  unsigned rows,
+                                                  double *result ) const
+{
+    addMatrixTimesSignedWeights( matrix, rows, result, NEGATIVE_WEIGHTS );
+}
+
+void WeightMatrix::addSymbolicBoundsTimesWeights( const double *symbolicLb,
+                                                  const double *symbolicUb,
+                                                  unsigned rows,
+                                                  double *resultLb,
+                                                  double *resultUb ) const
+{
+    if ( _representation == DENSE )
+    {
+        if ( useMatrixProductsForSymbolicBounds( rows ) )
+        {
+            matrixMultiplication(
+                symbolicLb, _positiveWeights, resultLb, rows, _sourceSize, _targetSize );
+            matrixMultiplication(
+                symbolicUb, _negativeWeights, resultLb, rows, _sourceSize, _targetSize );
+            matrixMultiplication(
+                symbolicUb, _positiveWeights, resultUb, rows, _sourceSize, _targetSize );
+            matrixMultiplication(
+                symbolicLb, _negativeWeights, resultUb, rows, _sourceSize, _targetSize );
+            return;
+        }
+
+        BoundKernels::addSymbolicBoundsTimesWeights( symbolicLb,
+                                                     symbolicUb,
+                                                     _positiveWeights,
+                                                     _negativeWeights,
+                                                     rows,
+                                                     _sourceSize,
+                                                     _targetSize,
+                                                     resultLb,
+                                                     resultUb );
+        return;
+    }
+
+    ASSERT( _pendingEntries.empty() );
+    for ( unsigned r = 0; r < rows; ++r )
+    {
+        const double *symbolicLbRow = symbolicLb + r * _sourceSize;
+        const double *symbolicUbRow = symbolicUb + r * _sourceSize;
+        double *resultLbRow = resultLb + r * _targetSize;
+        double *resultUbRow = resultUb + r * _targetSize;
+
+        for ( unsigned i = 0; i < _sourceSize; ++i )
+        {
+            double lb = symbolicLbRow[i];
+            double ub = symbolicUbRow[i];
+            if ( lb == 0 && ub == 0 )
+                continue;
+
+            for ( unsigned k = _rowStart[i]; k < _rowStart[i + 1]; ++k )
+            {
+                double weight = _values[k];
+                unsigned j = _columns[k];
+                if ( weight > 0 )
+                {
+                    resultLbRow[j] += lb * weight;
+                    resultUbRow[j] += ub * weight;
+                }
+                else
+                {
+                    resultLbRow[j] += ub * weight;
+                    resultUbRow[j] += lb * weight;
+                }
+            }
+        }
+    }
+}
+
+bool WeightMatrix::useMatrixProductsForSymbolicBounds( unsigned rows ) const
+{
+    unsigned long long multiplyAdds = (unsigned long long)rows * _sourceSize * _targetSize;
+    if ( multiplyAdds >= GlobalConfiguration::NLR_FUSED_SYMBOLIC_BOUNDS_MAX_MULTIPLY_ADDS )
+        return true;
+
+    return getMatrixMultiplicationThreads() > 1 &&
+           multiplyAdds >= GlobalConfiguration::MATRIX_MULTIPLICATION_PARALLEL_THRESHOLD;
+}
+
+void WeightMatrix::addMatrixTimesSignedWeights( const double *matrix,
+                                                unsigned rows,
+                                                double *result,
+                                                WeightSign sign ) const
+{
+    if ( _representation == DENSE )
+    {
+        matrixMultiplication( matrix,
+                              sign == POSITIVE_WEIGHTS ? _positiveWeights : _negativeWeights,
+                              result,
+                              rows,
+                              _sourceSize,
+                              _targetSize );
+        return;
+    }
+
+    ASSERT( _pendingEntries.empty() );
+    for ( unsigned r = 0; r < rows; ++r )
+    {
+        const double *matrixRow = matrix + r * _sourceSize;
+        double *resultRow = result + r * _targetSize;
+
+        for ( unsigned i = 0; i < _sourceSize; ++i )
+        {
+            double value = matrixRow[i];
+            if ( value == 0 )
+                continue;
+
+            for ( unsigned k = _rowStart[i]; k < _rowStart[i + 1]; ++k )
+            {
+                double weight = _values[k];
+                if ( ( sign == POSITIVE_WEIGHTS ) == ( weight > 0 ) )
+                    resultRow[_columns[k]] += value * weight;
+            }
+        }
+    }
+}
+
+void WeightMatrix::addWeightsTimesMatrix( const double *matrix,
+                                          unsigned columns,
+                                          double *result ) const
+{
+    if ( _representation == DENSE )
+    {
+        matrixMultiplication( _weights, matrix, result, _sourceSize, _targetSize, columns );
+        return;
+    }
+
+    ASSERT( _pendingEntries.empty() );
+    sparseMatrixMultiplication( _rowStart.data(),
+                                _columns.data(),
+                                _values.data(),
+                                matrix,
+                                result,
+                                _sourceSize,
+                                columns );
+}
+
+void WeightMatrix::addTransposedWeightsTimesMatrix( const double *matrix,
+                                                    unsigned columns,
+                                                    double *result ) const
+{
+    if ( _representation == DENSE )
+    {
+        transposedMatrixMultiplication(
+            _weights, matrix, result, _sourceSize, _targetSize, columns );
+        return;
+    }
+
+    ASSERT( _pendingEntries.empty() );
+    for ( unsigned i = 0; i < _sourceSize; ++i )
+    {
+        const double *matrixRow = matrix + i * columns;
+        for ( unsigned k = _rowStart[i]; k < _rowStart[i + 1]; ++k )
+        {
+            double weight = _values[k];
+            double *resultRow = result + _columns[k] * columns;
+            for ( unsigned c = 0; c < columns; ++c )
+                resultRow[c] += weight * matrixRow[c];
+        }
+    }
+}
+
+bool WeightMatrix::operator==( const WeightMatrix &other ) const
+{
+    if ( _sourceSize != other._sourceSize || _targetSize != other._targetSize )
+        return false;
+
+    if ( _representation == DENSE && other._representation == DENSE )
+        return memcmp( _weights, other._weights, sizeof( double ) * _sourceSize * _targetSize ) ==
+               0;
+
+    for ( unsigned i = 0; i < _sourceSize; ++i )
+    {
+        for ( unsigned j = 0; j < _targetSize; ++j )
+        {
+            if ( getWeight( i, j ) != other.getWeight( i, j ) )
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool WeightMatrix::operator!=( const WeightMatrix &other ) const
+{
+    return !( *this == other );
+}
+
+} // namespace NLR
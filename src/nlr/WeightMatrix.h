@@ -0,0 +1,228 @@
+/*********************                                                        */
+/*! \file WeightMatrix.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __WeightMatrix_h__
+#define __WeightMatrix_h__
+
+#include "Vector.h"
+
+namespace NLR {
+
+/*
+  The weights connecting a source layer to a weighted-sum layer. The
+  matrix has one row per source neuron and one column per target
+  neuron, i.e. the weight of the edge source -> target is stored at
+  (source, target).
+
+  Two representations are supported:
+
+  - DENSE: the full sourceSize x targetSize matrix is stored in
+    row-major order, together with its positive and negative parts.
+    This is the fastest option for fully connected layers, since the
+    bound computations can use the vectorized BoundKernels.
+
+  - CSR: only the non-zero entries are stored, in Compressed Sparse
+    Row format. Memory is proportional to the number of non-zero
+    weights, which is what we want for convolutional layers that
+    were flattened into weighted sums.
+
+  All the arithmetic needed by the network level reasoner is provided
+  as kernels on this class, so that callers never need to care about
+  the underlying representation.
+
+  Weights set on a CSR matrix are buffered, and only merged into the
+  CSR arrays by finalize(). The kernels may run concurrently, and so
+  they never modify the matrix: they require it to be finalized.
+*/
+class WeightMatrix
+{
+public:
+    enum Representation {
+        DENSE = 0,
+        CSR = 1,
+    };
+
+    WeightMatrix( unsigned sourceSize, unsigned targetSize, Representation representation );
+    WeightMatrix( const WeightMatrix &other );
+    WeightMatrix &operator=( const WeightMatrix &other );
+    ~WeightMatrix();
+
+    /*
+      Merge the buffered weights into the CSR arrays. Must be called
+      after the weights are set and before the matrix is read.
+    */
+    void finalize();
+
+    /*
+      The representation that suits the density of the non-zero
+      weights: sparse matrices are stored in CSR format.
+    */
+    Representation getPreferredRepresentation() const;
+
+    Representation getRepresentation() const;
+    void convertTo( Representation representation );
+
+    unsigned getSourceSize() const;
+    unsigned getTargetSize() const;
+
+    /*
+      The number of weights actually stored: sourceSize x targetSize
+      for dense matrices, the number of non-zeros for CSR matrices
+    */
+    unsigned getNumberOfStoredEntries() const;
+
+    void setWeight( unsigned sourceNeuron, unsigned targetNeuron, double weight );
+    double getWeight( unsigned sourceNeuron, unsigned targetNeuron ) const;
+
+    /*
+      Store a dense, row-major copy of the matrix in result, which
+      should have room for sourceSize x targetSize entries.
+    */
+    void toDense( double *result ) const;
+
+    /*
+      Store a dense, row-major copy of the columns firstTarget, ...,
+      firstTarget + numberOfTargets - 1 in result, which should have
+      room for sourceSize x numberOfTargets entries.
+    */
+    void toDenseColumns( unsigned firstTarget, unsigned numberOfTargets, double *result ) const;
+
+    /*
+      result[t] += sum_s vector[s] * W[s][t]
+    */
+    void addVectorTimesWeights( const double *vector, double *result ) const;
+
+    /*
+      Interval arithmetic: given lower and upper bounds for the source
+      neurons, add the lower and upper bounds of their weighted sums
+      into resultLb and resultUb.
+    */
+    void addIntervalTimesWeights( const double *lb,
+                                  const double *ub,
+                                  double *resultLb,
+                                  double *resultUb ) const;
+
+    /*
+      matrix is of dimensions rows x sourceSize, and result is of
+      dimensions rows x targetSize. Compute
+         result += matrix * W^+   or   result += matrix * W^-
+      where W^+ and W^- are the positive and negative parts of W.
+    */
+    void addMatrixTimesPositiveWeights( const double *matrix, unsigned rows, double *result ) const;
+    void addMatrixTimesNegativeWeights( const double *matrix, unsigned rows, double *result ) const;
+
+    /*
+      symbolicLb and symbolicUb are of dimensions rows x sourceSize,
+      and resultLb and resultUb of dimensions rows x targetSize.
+      Propagate symbolic bounds through the weights:
+         resultLb += symbolicLb * W^+ + symbolicUb * W^-
+         resultUb += symbolicUb * W^+ + symbolicLb * W^-
+      Small propagations are done in a single pass; large dense ones
+      with four matrix products.
+    */
+    void addSymbolicBoundsTimesWeights( const double *symbolicLb,
+                                        const double *symbolicUb,
+                                        unsigned rows,
+                                        double *resultLb,
+                                        double *resultUb ) const;
+
+    /*
+      matrix is of dimensions targetSize x columns, and result is of
+      dimensions sourceSize x columns. Compute result += W * matrix.
+    */
+    void addWeightsTimesMatrix( const double *matrix, unsigned columns, double *result ) const;
+
+    /*
+      matrix is of dimensions sourceSize x columns, and result is of
+      dimensions targetSize x columns. Compute result += W^T * matrix.
+    */
+    void addTransposedWeightsTimesMatrix( const double *matrix,
+                                          unsigned columns,
+                                          double *result ) const;
+
+    bool operator==( const WeightMatrix &other ) const;
+    bool operator!=( const WeightMatrix &other ) const;
+
+private:
+    enum WeightSign {
+        POSITIVE_WEIGHTS,
+        NEGATIVE_WEIGHTS,
+    };
+
+    struct PendingEntry
+    {
+        PendingEntry()
+        {
+        }
+
+        PendingEntry( unsigned source, unsigned target, double weight )
+            : _source( source )
+            , _target( target )
+            , _weight( weight )
+        {
+        }
+
+        unsigned _source;
+        unsigned _target;
+        double _weight;
+    };
+
+    unsigned _sourceSize;
+    unsigned _targetSize;
+    Representation _representation;
+
+    /*
+      Dense representation
+    */
+    double *_weights;
+    double *_positiveWeights;
+    double *_negativeWeights;
+
+    /*
+      CSR representation. Weights are typically set one at a time, so
+      new entries are first appended to a pending list and merged into
+      the CSR arrays in bulk, by finalize().
+    */
+    Vector<unsigned> _rowStart;
+    Vector<unsigned> _columns;
+    Vector<double> _values;
+    Vector<PendingEntry> _pendingEntries;
+
+    void allocateDense();
+    void initializeEmptyCSR();
+    void freeMemoryIfNeeded();
+    void copyFrom( const WeightMatrix &other );
+
+    /*
+      Locate an entry in the CSR arrays. Returns _columns.size() if
+      the entry is not stored.
+    */
+    unsigned findEntry( unsigned sourceNeuron, unsigned targetNeuron ) const;
+
+    void addMatrixTimesSignedWeights( const double *matrix,
+                                      unsigned rows,
+                                      double *result,
+                                      WeightSign sign ) const;
+
+    /*
+      Whether a dense symbolic bound propagation of the given number of
+      rows is large enough to be done with four matrix products, which
+      are cache-blocked and may use several threads, rather than with
+      the fused BoundKernels pass
+    */
+    bool useMatrixProductsForSymbolicBounds( unsigned rows ) const;
+};
+
+} // namespace NLR
+
+#endif // __WeightMatrix_h__
@@ -0,0 +1,169 @@
+/*********************                                                        */
+/*! \file BoundKernelsBenchmark.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A microbenchmark of symbolic bound propagation through a dense
+ ** weighted-sum layer: the fused BoundKernels pass, with each supported
+ ** instruction set, against the four matrix products it replaces (which
+ ** are OpenBLAS's dgemm if Marabou was built with it), and against
+ ** WeightMatrix, which picks between the two by size. Build it with
+ **
+ **    make BoundKernelsBenchmark
+ **
+ ** and run it with an optional number of repetitions per propagation.
+
+**/
+
+#include "BenchmarkUtils.h"
+#include "BoundKernels.h"
+#include "MatrixMultiplication.h"
+#include "Vector.h"
+#include "WeightMatrix.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using NLR::BoundKernels;
+
+static Vector<double> randomMatrix( unsigned size )
+{
+    Vector<double> matrix( size, 0 );
+    for ( unsigned i = 0; i < size; ++i )
+        matrix[i] = (double)rand() / RAND_MAX * 2 - 1;
+    return matrix;
+}
+
+int main( int argc, char **argv )
+{
+    unsigned repetitions = argc > 1 ? atoi( argv[1] ) : 5;
+    srand( 1 );
+
+    // (input size) x (source layer) x (target layer)
+    unsigned shapes[][3] = { { 2, 50, 50 },
+                             { 5, 50, 50 },
+                             { 5, 300, 300 },
+                             { 50, 100, 100 },
+                             { 100, 256, 256 },
+                             { 784, 100, 100 },
+                             { 784, 256, 256 },
+                             { 784, 512, 512 },
+                             { 784, 1024, 1024 } };
+
+    printf( "Symbolic bound propagation (ms per layer)\n" );
+    printf( "%-20s %10s %10s %10s %10s %12s\n",
+            "rows x src x tgt",
+            "scalar",
+            "avx2",
+            "avx512",
+            "4 products",
+            "WeightMatrix" );
+
+    BoundKernels::InstructionSet supported = BoundKernels::getSupportedInstructionSet();
+
+    for ( const auto &shape : shapes )
+    {
+        unsigned rows = shape[0];
+        unsigned sourceSize = shape[1];
+        unsigned targetSize = shape[2];
+
+        Vector<double> symbolicLb = randomMatrix( rows * sourceSize );
+        Vector<double> symbolicUb = randomMatrix( rows * sourceSize );
+        Vector<double> weights = randomMatrix( sourceSize * targetSize );
+        Vector<double> positiveWeights( sourceSize * targetSize, 0 );
+        Vector<double> negativeWeights( sourceSize * targetSize, 0 );
+        for ( unsigned i = 0; i < weights.size(); ++i )
+        {
+            if ( weights[i] > 0 )
+                positiveWeights[i] = weights[i];
+            else
+                negativeWeights[i] = weights[i];
+        }
+
+        NLR::WeightMatrix weightMatrix( sourceSize, targetSize, NLR::WeightMatrix::DENSE );
+        for ( unsigned i = 0; i < sourceSize; ++i )
+            for ( unsigned j = 0; j < targetSize; ++j )
+                weightMatrix.setWeight( i, j, weights[i * targetSize + j] );
+        weightMatrix.finalize();
+
+        Vector<double> resultLb( rows * targetSize, 0 );
+        Vector<double> resultUb( rows * targetSize, 0 );
+
+        printf( "%5u x %5u x %5u  ", rows, sourceSize, targetSize );
+
+        for ( unsigned i = BoundKernels::SCALAR; i <= BoundKernels::AVX512; ++i )
+        {
+            if ( i > supported )
+            {
+                printf( "%10s ", "n/a" );
+                continue;
+            }
+
+            BoundKernels::setInstructionSet( (BoundKernels::InstructionSet)i );
+            double fused = BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+                BoundKernels::addSymbolicBoundsTimesWeights( symbolicLb.data(),
+                                                             symbolicUb.data(),
+                                                             positiveWeights.data(),
+                                                             negativeWeights.data(),
+                                                             rows,
+                                                             sourceSize,
+                                                             targetSize,
+                                                             resultLb.data(),
+                                                             resultUb.data() );
+            } );
+            printf( "%10.3f ", fused );
+        }
+        BoundKernels::setInstructionSet( supported );
+
+        double products = BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+            matrixMultiplication( symbolicLb.data(),
+                                  positiveWeights.data(),
+                                  resultLb.data(),
+                                  rows,
+                                  sourceSize,
+                                  targetSize );
+            matrixMultiplication( symbolicUb.data(),
+                                  negativeWeights.data(),
+                                  resultLb.data(),
+                                  rows,
+                                  sourceSize,
+                                  targetSize );
+            matrixMultiplication( symbolicUb.data(),
+                                  positiveWeights.data(),
+                                  resultUb.data(),
+                                  rows,
+                                  sourceSize,
+                                  targetSize );
+            matrixMultiplication( symbolicLb.data(),
+                                  negativeWeights.data(),
+                                  resultUb.data(),
+                                  rows,
+                                  sourceSize,
+                                  targetSize );
+        } );
+        printf( "%10.3f ", products );
+
+        double weightMatrixTime = BenchmarkUtils::millisecondsPerRun( repetitions, [&]() {
+            weightMatrix.addSymbolicBoundsTimesWeights( symbolicLb.data(),
+                                                        symbolicUb.data(),
+                                                        rows,
+                                                        resultLb.data(),
+                                                        resultUb.data() );
+        } );
+        printf( "%12.3f\n", weightMatrixTime );
+    }
+
+    return 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
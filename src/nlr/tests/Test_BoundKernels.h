@@ -0,0 +1,227 @@
+/*********************                                                        */
+/*! \file Test_BoundKernels.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "BoundKernels.h"
+#include "FloatUtils.h"
+#include "NLRError.h"
+#include "Vector.h"
+
+#include <cstdlib>
+#include <cxxtest/TestSuite.h>
+
+using NLR::BoundKernels;
+
+class BoundKernelsTestSuite : public CxxTest::TestSuite
+{
+public:
+    BoundKernels::InstructionSet originalInstructionSet;
+
+    void setUp()
+    {
+        originalInstructionSet = BoundKernels::getInstructionSet();
+        srand( 1 );
+    }
+
+    void tearDown()
+    {
+        BoundKernels::setInstructionSet( originalInstructionSet );
+    }
+
+    /*
+      Random values in [-2, 2], a quarter of which are zero
+    */
+    Vector<double> randomVector( unsigned size )
+    {
+        Vector<double> result;
+        for ( unsigned i = 0; i < size; ++i )
+        {
+            if ( rand() % 4 == 0 )
+                result.append( 0 );
+            else
+                result.append( ( (double)rand() / RAND_MAX ) * 4 - 2 );
+        }
+        return result;
+    }
+
+    Vector<BoundKernels::InstructionSet> supportedInstructionSets()
+    {
+        Vector<BoundKernels::InstructionSet> result;
+        for ( unsigned i = BoundKernels::SCALAR; i <= BoundKernels::getSupportedInstructionSet();
+              ++i )
+            result.append( (BoundKernels::InstructionSet)i );
+        return result;
+    }
+
+    void assertEqual( const Vector<double> &a, const Vector<double> &b )
+    {
+        TS_ASSERT_EQUALS( a.size(), b.size() );
+        for ( unsigned i = 0; i < a.size(); ++i )
+            TS_ASSERT( FloatUtils::areEqual( a[i], b[i] ) );
+    }
+
+    void test_instruction_sets()
+    {
+        BoundKernels::InstructionSet supported = BoundKernels::getSupportedInstructionSet();
+        TS_ASSERT_EQUALS( originalInstructionSet, supported );
+
+        TS_ASSERT_THROWS_NOTHING( BoundKernels::setInstructionSet( BoundKernels::SCALAR ) );
+        TS_ASSERT_EQUALS( BoundKernels::getInstructionSet(), BoundKernels::SCALAR );
+
+        if ( supported != BoundKernels::AVX512 )
+        {
+            TS_ASSERT_THROWS_EQUALS( BoundKernels::setInstructionSet( BoundKernels::AVX512 ),
+                                     const NLRError &e,
+                                     e.getCode(),
+                                     NLRError::INSTRUCTION_SET_NOT_SUPPORTED );
+            TS_ASSERT_EQUALS( BoundKernels::getInstructionSet(), BoundKernels::SCALAR );
+        }
+    }
+
+    void test_interval_times_matrix()
+    {
+        // A 3 x 2 matrix
+        double matrix[] = { 1, -1, 0, 2, -3, 0 };
+        double lb[] = { -1, 0, 1 };
+        double ub[] = { 1, 1, 2 };
+
+        for ( const auto &instructionSet : supportedInstructionSets() )
+        {
+            BoundKernels::setInstructionSet( instructionSet );
+
+            double resultLb[] = { 1, 1 };
+            double resultUb[] = { 1, 1 };
+            BoundKernels::addIntervalTimesMatrix( matrix, 3, 2, lb, ub, resultLb, resultUb );
+
+            TS_ASSERT( FloatUtils::areEqual( resultLb[0], -6 ) );
+            TS_ASSERT( FloatUtils::areEqual( resultLb[1], 0 ) );
+            TS_ASSERT( FloatUtils::areEqual( resultUb[0], -1 ) );
+            TS_ASSERT( FloatUtils::areEqual( resultUb[1], 4 ) );
+        }
+    }
+
+    void test_kernels_agree_with_scalar()
+    {
+        // Sizes that do not divide the vector widths exercise the tails
+        unsigned sizes[][3] = { { 1, 1, 1 }, { 3, 5, 7 }, { 8, 16, 4 }, { 13, 17, 19 } };
+
+        for ( const auto &size : sizes )
+        {
+            unsigned rows = size[0];
+            unsigned sourceSize = size[1];
+            unsigned targetSize = size[2];
+
+            Vector<double> matrix = randomVector( sourceSize * targetSize );
+            Vector<double> lb = randomVector( sourceSize );
+            Vector<double> ub = lb;
+            for ( auto &value : ub )
+                value += 1;
+
+            Vector<double> symbolicLb = randomVector( rows * sourceSize );
+            Vector<double> symbolicUb = symbolicLb;
+            for ( auto &value : symbolicUb )
+                value += 0.5;
+
+            Vector<double> positiveWeights = matrix;
+            Vector<double> negativeWeights = matrix;
+            for ( unsigned i = 0; i < matrix.size(); ++i )
+            {
+                if ( matrix[i] > 0 )
+                    negativeWeights[i] = 0;
+                else
+                    positiveWeights[i] = 0;
+            }
+
+            Vector<double> initialLb = randomVector( rows * targetSize );
+            Vector<double> initialUb = initialLb;
+            for ( auto &value : initialUb )
+                value += 1;
+
+            Vector<double> expectedIntervalLb;
+            Vector<double> expectedIntervalUb;
+            Vector<double> expectedSymbolicLb;
+            Vector<double> expectedSymbolicUb;
+
+            for ( const auto &instructionSet : supportedInstructionSets() )
+            {
+                BoundKernels::setInstructionSet( instructionSet );
+
+                Vector<double> intervalLb( targetSize, 0 );
+                Vector<double> intervalUb( targetSize, 0 );
+                for ( unsigned i = 0; i < targetSize; ++i )
+                {
+                    intervalLb[i] = initialLb[i];
+                    intervalUb[i] = initialUb[i];
+                }
+
+                BoundKernels::addIntervalTimesMatrix( matrix.data(),
+                                                      sourceSize,
+                                                      targetSize,
+                                                      lb.data(),
+                                                      ub.data(),
+                                                      intervalLb.data(),
+                                                      intervalUb.data() );
+
+                Vector<double> symbolicResultLb = initialLb;
+                Vector<double> symbolicResultUb = initialUb;
+                BoundKernels::addSymbolicBoundsTimesWeights( symbolicLb.data(),
+                                                             symbolicUb.data(),
+                                                             positiveWeights.data(),
+                                                             negativeWeights.data(),
+                                                             rows,
+                                                             sourceSize,
+                                                             targetSize,
+                                                             symbolicResultLb.data(),
+                                                             symbolicResultUb.data() );
+
+                for ( unsigned i = 0; i < targetSize; ++i )
+                    TS_ASSERT( FloatUtils::lte( intervalLb[i], intervalUb[i] ) );
+
+                if ( instructionSet == BoundKernels::SCALAR )
+                {
+                    expectedIntervalLb = intervalLb;
+                    expectedIntervalUb = intervalUb;
+                    expectedSymbolicLb = symbolicResultLb;
+                    expectedSymbolicUb = symbolicResultUb;
+                }
+                else
+                {
+                    assertEqual( intervalLb, expectedIntervalLb );
+                    assertEqual( intervalUb, expectedIntervalUb );
+                    assertEqual( symbolicResultLb, expectedSymbolicLb );
+                    assertEqual( symbolicResultUb, expectedSymbolicUb );
+                }
+            }
+        }
+    }
+
+    void test_infinite_bounds()
+    {
+        double matrix[] = { 1, -1, 2, 0.5 };
+        double lb[] = { FloatUtils::negativeInfinity(), -1 };
+        double ub[] = { 3, FloatUtils::infinity() };
+
+        for ( const auto &instructionSet : supportedInstructionSets() )
+        {
+            BoundKernels::setInstructionSet( instructionSet );
+
+            double resultLb[] = { 0, 0 };
+            double resultUb[] = { 0, 0 };
+            BoundKernels::addIntervalTimesMatrix( matrix, 2, 2, lb, ub, resultLb, resultUb );
+
+            TS_ASSERT( resultLb[0] == FloatUtils::negativeInfinity() );
+            TS_ASSERT( FloatUtils::areEqual( resultLb[1], -3.5 ) );
+            TS_ASSERT( resultUb[0] >= FloatUtils::infinity() );
+            TS_ASSERT( resultUb[1] >= FloatUtils::infinity() );
+        }
+    }
+};
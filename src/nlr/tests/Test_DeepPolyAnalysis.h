@@ -14,6 +14,7 @@
 **/
 
 #include "../../engine/tests/MockTableau.h"
+#include "DeepPolyAnalysis.h"
 #include "DeepPolySoftmaxElement.h"
 #include "FloatUtils.h"
 #include "InputQuery.h"
@@ -211,6 +212,99 @@ public:
             TS_ASSERT( existsBound( bounds, bound ) );
     }
 
+    void applyTightenings( MockTableau &tableau, const List<Tightening> &tightenings )
+    {
+        for ( const auto &tightening : tightenings )
+        {
+            if ( tightening._type == Tightening::LB )
+                tableau.setLowerBound( tightening._variable, tightening._value );
+            else
+                tableau.setUpperBound( tightening._variable, tightening._value );
+        }
+    }
+
+    void test_deeppoly_relus_incremental()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetwork( nlr, tableau );
+        nlr.finalizeWeights();
+
+        tableau.setLowerBound( 0, -1 );
+        tableau.setUpperBound( 0, 1 );
+        tableau.setLowerBound( 1, -1 );
+        tableau.setUpperBound( 1, 1 );
+
+        NLR::DeepPolyAnalysis deepPoly( &nlr );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( deepPoly.run() );
+        TS_ASSERT_EQUALS( deepPoly.getAnalyzedLayers().size(), 6U );
+
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        applyTightenings( tableau, bounds );
+
+        // Nothing new can be learned from the tightened bounds
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( deepPoly.run() );
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( bounds.empty() );
+
+        // Nothing has changed, so no layer is analyzed
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( deepPoly.run() );
+        TS_ASSERT( deepPoly.getAnalyzedLayers().empty() );
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( bounds.empty() );
+
+        // Split on the ReLU of x7: only the layers from x7 on are analyzed
+        double x7Lb = tableau.getLowerBound( 7 );
+        tableau.setLowerBound( 7, 0 );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( deepPoly.run() );
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+
+        const Set<unsigned> &analyzedLayers = deepPoly.getAnalyzedLayers();
+        TS_ASSERT_EQUALS( analyzedLayers.size(), 3U );
+        for ( unsigned i = 0; i < 3; ++i )
+            TS_ASSERT( !analyzedLayers.exists( i ) );
+        for ( unsigned i = 3; i < 6; ++i )
+            TS_ASSERT( analyzedLayers.exists( i ) );
+
+        // The bounds match those of a fresh analysis with the same bounds
+        NLR::NetworkLevelReasoner freshNlr;
+        MockTableau freshTableau;
+        freshNlr.setTableau( &freshTableau );
+        populateNetwork( freshNlr, freshTableau );
+        for ( unsigned i = 0; i < 12; ++i )
+        {
+            freshTableau.setLowerBound( i, tableau.getLowerBound( i ) );
+            freshTableau.setUpperBound( i, tableau.getUpperBound( i ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( freshNlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( freshNlr.deepPolyPropagation() );
+
+        List<Tightening> expectedBounds;
+        TS_ASSERT_THROWS_NOTHING( freshNlr.getConstraintTightenings( expectedBounds ) );
+
+        TS_ASSERT( !expectedBounds.empty() );
+        TS_ASSERT_EQUALS( expectedBounds.size(), bounds.size() );
+        for ( const auto &bound : expectedBounds )
+            TS_ASSERT( existsBound( bounds, bound ) );
+
+        // Backtracking restores the bounds of the first run
+        tableau.setLowerBound( 7, x7Lb );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( deepPoly.run() );
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( bounds.empty() );
+    }
+
     void populateResidualNetwork1( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
     {
         /*
@@ -327,6 +421,44 @@ public:
             TS_ASSERT( existsBound( bounds, bound ) );
     }
 
+    void test_deeppoly_residual1_sparse_weights()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateResidualNetwork1( nlr, tableau );
+        nlr.setWeightRepresentation( NLR::WeightMatrix::CSR );
+
+        tableau.setLowerBound( 0, -1 );
+        tableau.setUpperBound( 0, 1 );
+
+        // Invoke DeepPoly
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.deepPolyPropagation() );
+
+        // Same bounds as with dense weights
+        List<Tightening> expectedBounds( {
+            Tightening( 1, -1, Tightening::LB ),
+            Tightening( 1, 1, Tightening::UB ),
+            Tightening( 2, 0, Tightening::LB ),
+            Tightening( 2, 1, Tightening::UB ),
+            Tightening( 3, -1, Tightening::LB ),
+            Tightening( 3, 2, Tightening::UB ),
+            Tightening( 4, -1, Tightening::LB ),
+            Tightening( 4, 2, Tightening::UB ),
+            Tightening( 5, 1, Tightening::LB ),
+            Tightening( 5, 6, Tightening::UB ),
+
+        } );
+
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+
+        TS_ASSERT_EQUALS( expectedBounds.size(), bounds.size() );
+        for ( const auto &bound : expectedBounds )
+            TS_ASSERT( existsBound( bounds, bound ) );
+    }
+
     void populateResidualNetwork2( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
     {
         /*
@@ -442,6 +574,110 @@ public:
             TS_ASSERT( existsBound( bounds, bound ) );
     }
 
+    void populateWideResidualNetwork( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
+    {
+        /*
+          x0 (3 neurons) --> x1 (40) --R--> x2 (40) --> x3 (40) --R--> x4 (40) --> x5 (5)
+          with a residual connection from x0 to x3
+        */
+        unsigned sizes[6] = { 3, 40, 40, 40, 40, 5 };
+
+        // Create the layers
+        nlr.addLayer( 0, NLR::Layer::INPUT, sizes[0] );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, sizes[1] );
+        nlr.addLayer( 2, NLR::Layer::RELU, sizes[2] );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, sizes[3] );
+        nlr.addLayer( 4, NLR::Layer::RELU, sizes[4] );
+        nlr.addLayer( 5, NLR::Layer::WEIGHTED_SUM, sizes[5] );
+
+        // Mark layer dependencies
+        for ( unsigned i = 1; i <= 5; ++i )
+            nlr.addLayerDependency( i - 1, i );
+        nlr.addLayerDependency( 0, 3 );
+
+        // Set the weights and biases for the weighted sum layers
+        unsigned weightedSumLayers[3][2] = { { 0, 1 }, { 2, 3 }, { 4, 5 } };
+        for ( const auto &layers : weightedSumLayers )
+        {
+            for ( unsigned i = 0; i < sizes[layers[0]]; ++i )
+                for ( unsigned j = 0; j < sizes[layers[1]]; ++j )
+                    nlr.setWeight(
+                        layers[0], i, layers[1], j, ( ( i * 7 + j * 13 ) % 11 - 5.0 ) / 5 );
+
+            for ( unsigned j = 0; j < sizes[layers[1]]; ++j )
+                nlr.setBias( layers[1], j, ( ( j * 3 ) % 7 - 3.0 ) / 4 );
+        }
+        for ( unsigned i = 0; i < sizes[0]; ++i )
+            for ( unsigned j = 0; j < sizes[3]; ++j )
+                nlr.setWeight( 0, i, 3, j, ( ( i + j * 5 ) % 9 - 4.0 ) / 4 );
+
+        // Mark the ReLU sources
+        for ( unsigned j = 0; j < sizes[1]; ++j )
+        {
+            nlr.addActivationSource( 1, j, 2, j );
+            nlr.addActivationSource( 3, j, 4, j );
+        }
+
+        // Variable indexing
+        unsigned variable = 0;
+        for ( unsigned layer = 0; layer < 6; ++layer )
+            for ( unsigned j = 0; j < sizes[layer]; ++j )
+                nlr.setNeuronVariable( NLR::NeuronIndex( layer, j ), variable++ );
+
+        // Very loose bounds for neurons except inputs
+        double large = 1000000;
+
+        tableau.getBoundManager().initialize( variable );
+        for ( unsigned i = 0; i < sizes[0]; ++i )
+        {
+            tableau.setLowerBound( i, -1 );
+            tableau.setUpperBound( i, 1 );
+        }
+        for ( unsigned i = sizes[0]; i < variable; ++i )
+        {
+            tableau.setLowerBound( i, -large );
+            tableau.setUpperBound( i, large );
+        }
+    }
+
+    void test_deeppoly_wide_residual_with_threads()
+    {
+        List<Tightening> serialBounds;
+        {
+            NLR::NetworkLevelReasoner nlr;
+            MockTableau tableau;
+            nlr.setTableau( &tableau );
+            populateWideResidualNetwork( nlr, tableau );
+
+            TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+            TS_ASSERT_THROWS_NOTHING( nlr.deepPolyPropagation() );
+            TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( serialBounds ) );
+        }
+
+        // Divide the back-substitution of the wide layers among threads
+        Options::get()->setInt( Options::NUM_DEEPPOLY_THREADS, 3 );
+
+        List<Tightening> parallelBounds;
+        {
+            NLR::NetworkLevelReasoner nlr;
+            MockTableau tableau;
+            nlr.setTableau( &tableau );
+            populateWideResidualNetwork( nlr, tableau );
+
+            TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+            TS_ASSERT_THROWS_NOTHING( nlr.deepPolyPropagation() );
+            TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( parallelBounds ) );
+        }
+
+        Options::get()->setInt( Options::NUM_DEEPPOLY_THREADS, 1 );
+
+        // The same bounds are obtained
+        TS_ASSERT( !serialBounds.empty() );
+        TS_ASSERT_EQUALS( serialBounds.size(), parallelBounds.size() );
+        for ( const auto &bound : serialBounds )
+            TS_ASSERT( existsBound( parallelBounds, bound ) );
+    }
+
     void populateMaxNetwork( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
     {
         /*
@@ -1969,6 +1969,49 @@ public:
         TS_ASSERT( FloatUtils::areEqual( output[1], 0 ) );
     }
 
+    void test_evaluate_relu_sparse_weights()
+    {
+        NLR::NetworkLevelReasoner nlr;
+
+        populateNetwork( nlr );
+        nlr.setWeightRepresentation( NLR::WeightMatrix::CSR );
+
+        TS_ASSERT_EQUALS( nlr.getLayer( 1 )->getWeightMatrix( 0 )->getRepresentation(),
+                          NLR::WeightMatrix::CSR );
+        TS_ASSERT_EQUALS( nlr.getLayer( 1 )->getWeightMatrix( 0 )->getNumberOfStoredEntries(),
+                          4U );
+
+        double input[2];
+        double output[2];
+
+        // With ReLUs, Inputs are zeros, only biases count
+        input[0] = 0;
+        input[1] = 0;
+
+        TS_ASSERT_THROWS_NOTHING( nlr.evaluate( input, output ) );
+
+        TS_ASSERT( FloatUtils::areEqual( output[0], 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( output[1], 4 ) );
+
+        // With ReLUs, case 1
+        input[0] = 1;
+        input[1] = 1;
+
+        TS_ASSERT_THROWS_NOTHING( nlr.evaluate( input, output ) );
+
+        TS_ASSERT( FloatUtils::areEqual( output[0], 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( output[1], 1 ) );
+
+        // With ReLUs, case 2
+        input[0] = 1;
+        input[1] = 2;
+
+        TS_ASSERT_THROWS_NOTHING( nlr.evaluate( input, output ) );
+
+        TS_ASSERT( FloatUtils::areEqual( output[0], 0 ) );
+        TS_ASSERT( FloatUtils::areEqual( output[1], 0 ) );
+    }
+
     void test_evaluate_sigmoids()
     {
         NLR::NetworkLevelReasoner nlr;
@@ -2894,15 +2937,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 4 ) );
         }
 
         // With ReLUs, case 1
@@ -2915,15 +2952,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 1 ) );
         }
 
         // With ReLUs, case 1 and 2
@@ -2936,15 +2967,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                0 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 0 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                0 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 0 ) );
         }
     }
 
@@ -2966,15 +2991,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.6750,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 3.0167,
                 0.0001 ) );
         }
@@ -2989,15 +3010,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.6032,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 2.5790,
                 0.0001 ) );
         }
@@ -3012,15 +3029,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.5045,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 2.1957,
                 0.0001 ) );
         }
@@ -3044,15 +3057,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 4 ) );
         }
 
         // With Round, case 1
@@ -3065,15 +3072,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 2,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 -4,
                 0.0001 ) );
         }
@@ -3088,15 +3091,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 -12,
                 0.0001 ) );
         }
@@ -3120,15 +3119,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 4 ) );
         }
 
         // With Sign, case 1
@@ -3141,15 +3134,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 4 ) );
         }
 
         // With Sign, case 2
@@ -3162,15 +3149,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                -1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], -1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                -4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], -4 ) );
         }
     }
 
@@ -3192,15 +3173,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 4 ) );
         }
 
         // With Abs, case 1
@@ -3213,15 +3188,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 4 ) );
         }
 
         // With Abs, case 2
@@ -3234,15 +3203,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 4 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                10 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 10 ) );
         }
     }
 
@@ -3264,15 +3227,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 4 ) );
         }
 
         // With Leaky ReLU, case 1  (alpha=0.1)
@@ -3285,15 +3242,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.9,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 0.57,
                 0.0001 ) );
         }
@@ -3308,15 +3261,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 -0.04,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 -0.76,
                 0.0001 ) );
         }
@@ -3340,10 +3289,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                -3 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], -3 ) );
         }
 
         // With Max, case 1
@@ -3356,10 +3302,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                -18 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], -18 ) );
         }
 
         // With Max, case 2
@@ -3372,10 +3315,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                -5 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], -5 ) );
         }
     }
 
@@ -3397,15 +3337,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.2999,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 2.4001,
                 0.0001 ) );
         }
@@ -3420,15 +3356,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.1192,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 2.7615,
                 0.0001 ) );
         }
@@ -3443,15 +3375,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.1206,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 2.7588,
                 0.0001 ) );
         }
@@ -3475,10 +3403,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                0 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 0 ) );
         }
 
         // With Bilinear, case 1
@@ -3491,9 +3416,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 2.8304,
                 0.0001 ) );
         }
@@ -3508,9 +3431,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.0912,
                 0.0001 ) );
         }
@@ -3571,10 +3492,7 @@ public:
 
         for ( unsigned i = 0; i < simulationSize; ++i )
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                2 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 2 ) );
 
         // Simulate2
         Vector<Vector<double>> simulations2;
@@ -3585,10 +3503,65 @@ public:
 
         for ( unsigned i = 0; i < simulationSize; ++i )
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                0 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 0 ) );
+    }
+
+    void test_simulate_batch_matches_evaluate()
+    {
+        NLR::NetworkLevelReasoner nlr;
+
+        // Create the layers
+        nlr.addLayer( 0, NLR::Layer::INPUT, 2 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, 3 );
+        nlr.addLayer( 2, NLR::Layer::SIGMOID, 3 );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, 2 );
+
+        // Mark layer dependencies
+        nlr.addLayerDependency( 0, 1 );
+        nlr.addLayerDependency( 1, 2 );
+        nlr.addLayerDependency( 2, 3 );
+        nlr.addLayerDependency( 0, 3 );
+
+        // Weights and biases. Layer 3 has two source layers.
+        nlr.setWeight( 0, 0, 1, 0, 1 );
+        nlr.setWeight( 0, 0, 1, 1, 2 );
+        nlr.setWeight( 0, 1, 1, 1, -3 );
+        nlr.setWeight( 0, 1, 1, 2, 1 );
+        nlr.setBias( 1, 0, 1 );
+        nlr.setBias( 1, 2, -2 );
+
+        // The sigmoids are connected in a permuted order
+        nlr.addActivationSource( 1, 0, 2, 2 );
+        nlr.addActivationSource( 1, 1, 2, 0 );
+        nlr.addActivationSource( 1, 2, 2, 1 );
+
+        nlr.setWeight( 2, 0, 3, 0, 1 );
+        nlr.setWeight( 2, 1, 3, 0, 2 );
+        nlr.setWeight( 2, 2, 3, 1, -2 );
+        nlr.setWeight( 0, 1, 3, 1, 1 );
+        nlr.setWeight( 0, 0, 3, 0, -1 );
+        nlr.setBias( 3, 0, 3 );
+        nlr.setBias( 3, 1, -1 );
+
+        // Each sample has a different input, given as a single
+        // contiguous matrix (one row per input neuron)
+        unsigned simulationSize = 5;
+        double input[] = { -2, -1, 0, 1, 2, 3, 1, 0, -1, 0.5 };
+
+        TS_ASSERT_THROWS_NOTHING( nlr.simulate( input, simulationSize ) );
+
+        const NLR::Layer *outputLayer = nlr.getLayer( 3 );
+        TS_ASSERT_EQUALS( outputLayer->getNumberOfSimulations(), simulationSize );
+
+        for ( unsigned i = 0; i < simulationSize; ++i )
+        {
+            double sample[2] = { input[i], input[simulationSize + i] };
+            double output[2];
+            TS_ASSERT_THROWS_NOTHING( nlr.evaluate( sample, output ) );
+
+            TS_ASSERT( FloatUtils::areEqual( outputLayer->getSimulations( 0 )[i], output[0] ) );
+            TS_ASSERT( FloatUtils::areEqual( outputLayer->getSimulations( 1 )[i], output[1] ) );
+        }
     }
 
     void test_simulate_abs_and_relu()
@@ -3609,15 +3582,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                2 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 2 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                2 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 2 ) );
         }
 
         // Simulate2
@@ -3630,15 +3597,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 4 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], 4 ) );
         }
     }
 
@@ -3660,15 +3621,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                -2 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], -2 ) );
         }
 
         // With Round/Sign, case 2
@@ -3681,15 +3636,9 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                -1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], -1 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
-                -4 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i], -4 ) );
         }
     }
 
@@ -3711,15 +3660,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.7109,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 1.4602,
                 0.0001 ) );
         }
@@ -3734,15 +3679,11 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 0.4013,
                 0.0001 ) );
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 1 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 1 )[i],
                 0.6508,
                 0.0001 ) );
         }
@@ -3766,9 +3707,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 -2.9998,
                 0.0001 ) );
         }
@@ -3783,9 +3722,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i],
                 -1,
                 0.0001 ) );
         }
@@ -3809,10 +3746,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                1 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 1 ) );
         }
 
         // With ReLU/Bilinear, case 2
@@ -3825,10 +3759,7 @@ public:
         for ( unsigned i = 0; i < simulationSize; ++i )
         {
             TS_ASSERT( FloatUtils::areEqual(
-                ( *( nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations() ) )
-                    .get( 0 )
-                    .get( i ),
-                0 ) );
+                nlr.getLayer( nlr.getNumberOfLayers() - 1 )->getSimulations( 0 )[i], 0 ) );
         }
     }
 
@@ -5789,6 +5720,68 @@ public:
         TS_ASSERT( boundsEqual( bounds, expectedBounds ) );
     }
 
+    void test_sbt_relus_all_active_sparse_weights()
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "sbt" );
+
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetworkSBTRelu( nlr, tableau );
+        nlr.setWeightRepresentation( NLR::WeightMatrix::CSR );
+
+        tableau.setLowerBound( 0, 4 );
+        tableau.setUpperBound( 0, 6 );
+        tableau.setLowerBound( 1, 1 );
+        tableau.setUpperBound( 1, 5 );
+
+        // Invoke SBT
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.symbolicBoundPropagation() );
+
+        // Same bounds as with dense weights
+        List<Tightening> expectedBounds( {
+            Tightening( 2, 11, Tightening::LB ),
+            Tightening( 2, 27, Tightening::UB ),
+            Tightening( 3, 5, Tightening::LB ),
+            Tightening( 3, 11, Tightening::UB ),
+
+            Tightening( 4, 11, Tightening::LB ),
+            Tightening( 4, 27, Tightening::UB ),
+            Tightening( 5, 5, Tightening::LB ),
+            Tightening( 5, 11, Tightening::UB ),
+
+            Tightening( 6, 6, Tightening::LB ),
+            Tightening( 6, 16, Tightening::UB ),
+        } );
+
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( boundsEqual( bounds, expectedBounds ) );
+
+        // Interval arithmetic loses the correlation between x4 and x5
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.intervalArithmeticBoundPropagation() );
+
+        List<Tightening> expectedIntervalBounds( {
+            Tightening( 2, 11, Tightening::LB ),
+            Tightening( 2, 27, Tightening::UB ),
+            Tightening( 3, 5, Tightening::LB ),
+            Tightening( 3, 11, Tightening::UB ),
+
+            Tightening( 4, 11, Tightening::LB ),
+            Tightening( 4, 27, Tightening::UB ),
+            Tightening( 5, 5, Tightening::LB ),
+            Tightening( 5, 11, Tightening::UB ),
+
+            Tightening( 6, 0, Tightening::LB ),
+            Tightening( 6, 22, Tightening::UB ),
+        } );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( boundsEqual( bounds, expectedIntervalBounds ) );
+    }
+
     void test_sbt_relus_active_and_inactive()
     {
         Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "sbt" );
@@ -13,19 +13,18 @@
 
 **/
 
-#include "GurobiWrapper.h"
-#include "IterativePropagator.h"
-#include "NetworkLevelReasoner.h"
+#include "FloatUtils.h"
+#include "MarabouError.h"
+#include "NativeLPSolver.h"
 #include "ParallelSolver.h"
+#include "Set.h"
+#include "TimeUtils.h"
 
+#include <atomic>
 #include <cxxtest/TestSuite.h>
+#include <mutex>
 
-class MockForNetworkLevelReasoner
-{
-public:
-};
-
-class NetworkLevelReasonerTestSuite : public CxxTest::TestSuite
+class ParallelSolverTestSuite : public CxxTest::TestSuite
 {
 public:
     void setUp()
@@ -36,34 +35,145 @@ public:
     {
     }
 
-    void test_enqueueSolver()
+    static ILPSolver *createSolver()
     {
-        NLR::NetworkLevelReasoner nlr;
-        NLR::IterativePropagator mock = NLR::IterativePropagator( &nlr );
-        unsigned numberOfWorkers = 4;
-        NLR::ParallelSolver::SolverQueue solvers( numberOfWorkers );
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        TS_ASSERT_THROWS_NOTHING( mock.enqueueSolver( solvers, gurobi ) );
-        TS_ASSERT( !solvers.empty() );
-        GurobiWrapper *gurobiPtr = NULL;
-        TS_ASSERT_THROWS_NOTHING( solvers.pop( gurobiPtr ) );
-        TS_ASSERT( solvers.empty() );
-        delete gurobiPtr;
+        return new NativeLPSolver();
     }
 
-    void test_clear_solver_queue()
+    void test_solver_pool_runs_every_task()
     {
-        NLR::NetworkLevelReasoner nlr;
-        NLR::IterativePropagator mock = NLR::IterativePropagator( &nlr );
-        unsigned numberOfWorkers = 4;
-        NLR::ParallelSolver::SolverQueue solvers( numberOfWorkers );
-        for ( unsigned i = 0; i < numberOfWorkers; ++i )
+        for ( unsigned numberOfWorkers : { 1, 4 } )
         {
-            GurobiWrapper *gurobi = new GurobiWrapper();
-            TS_ASSERT_THROWS_NOTHING( mock.enqueueSolver( solvers, gurobi ) );
+            NLR::ParallelSolver::SolverPool pool( numberOfWorkers, createSolver );
+            TS_ASSERT_EQUALS( pool.getNumberOfWorkers(), numberOfWorkers );
+
+            unsigned numberOfTasks = 100;
+            Vector<unsigned> hits( numberOfTasks, 0 );
+            Set<ILPSolver *> solvers;
+            std::atomic_uint preparations( 0 );
+            std::mutex mtx;
+
+            for ( unsigned round = 0; round < 2; ++round )
+            {
+                unsigned performed = 0;
+                TS_ASSERT_THROWS_NOTHING(
+                    performed = pool.run(
+                        numberOfTasks,
+                        [&]( ILPSolver &solver, unsigned i ) {
+                            std::lock_guard<std::mutex> lock( mtx );
+                            ++hits[i];
+                            solvers.insert( &solver );
+                            return true;
+                        },
+                        [&]( ILPSolver & ) { ++preparations; } ) );
+                TS_ASSERT_EQUALS( performed, numberOfTasks );
+            }
+
+            for ( unsigned i = 0; i < numberOfTasks; ++i )
+                TS_ASSERT_EQUALS( hits[i], 2U );
+
+            // The same solvers are used in every run, and prepared at most
+            // once per run
+            TS_ASSERT( solvers.size() >= 1 );
+            TS_ASSERT( solvers.size() <= numberOfWorkers );
+            TS_ASSERT( preparations >= 2U );
+            TS_ASSERT( preparations <= 2 * numberOfWorkers );
         }
-        TS_ASSERT( !solvers.empty() );
-        TS_ASSERT_THROWS_NOTHING( mock.clearSolverQueue( solvers ) );
-        TS_ASSERT( solvers.empty() );
+    }
+
+    void test_solver_pool_stops_early()
+    {
+        NLR::ParallelSolver::SolverPool pool( 1, createSolver );
+
+        Vector<unsigned> handled;
+        unsigned performed = 0;
+        TS_ASSERT_THROWS_NOTHING( performed = pool.run( 10, [&]( ILPSolver &, unsigned i ) {
+            handled.append( i );
+            return i < 5;
+        } ) );
+
+        TS_ASSERT_EQUALS( performed, 6U );
+        TS_ASSERT_EQUALS( handled, Vector<unsigned>( { 0, 1, 2, 3, 4, 5 } ) );
+        TS_ASSERT( !pool.timeBudgetExhausted() );
+
+        NLR::ParallelSolver::SolverPool parallelPool( 4, createSolver );
+        std::atomic_uint count( 0 );
+        TS_ASSERT_THROWS_NOTHING( parallelPool.run( 1000, [&]( ILPSolver &, unsigned ) {
+            ++count;
+            return false;
+        } ) );
+
+        // Every worker stops after at most one task
+        TS_ASSERT( count >= 1U );
+        TS_ASSERT( count <= 4U );
+    }
+
+    void test_solver_pool_rethrows_exceptions()
+    {
+        for ( unsigned numberOfWorkers : { 1, 3 } )
+        {
+            NLR::ParallelSolver::SolverPool pool( numberOfWorkers, createSolver );
+
+            TS_ASSERT_THROWS_EQUALS( pool.run( 20,
+                                               []( ILPSolver &, unsigned i ) {
+                                                   if ( i == 7 )
+                                                       throw MarabouError(
+                                                           MarabouError::DEBUGGING_ERROR );
+                                                   return true;
+                                               } ),
+                                     const MarabouError &e,
+                                     e.getCode(),
+                                     MarabouError::DEBUGGING_ERROR );
+
+            // The pool can still be used afterwards
+            unsigned performed = 0;
+            TS_ASSERT_THROWS_NOTHING(
+                performed = pool.run( 5, []( ILPSolver &, unsigned ) { return true; } ) );
+            TS_ASSERT_EQUALS( performed, 5U );
+        }
+    }
+
+    void test_solver_pool_time_budget()
+    {
+        NLR::ParallelSolver::SolverPool pool( 2, createSolver, 0.000001 );
+
+        // Spend the budget
+        struct timespec start = TimeUtils::sampleMicro();
+        while ( TimeUtils::timePassed( start, TimeUtils::sampleMicro() ) < 10 )
+            ;
+
+        unsigned performed = 1;
+        TS_ASSERT_THROWS_NOTHING(
+            performed = pool.run( 10, []( ILPSolver &, unsigned ) { return true; } ) );
+        TS_ASSERT_EQUALS( performed, 0U );
+        TS_ASSERT( pool.timeBudgetExhausted() );
+    }
+
+    void test_sort_by_expected_gain()
+    {
+        typedef NLR::ParallelSolver::NeuronTask NeuronTask;
+
+        Vector<NeuronTask> tasks;
+        tasks.append( NeuronTask( NULL, 0, 1, 2, false, false ) );
+        tasks.append( NeuronTask( NULL, 1, -1, 1, false, false ) );
+        tasks.append( NeuronTask( NULL, 2, 0, 10, false, false ) );
+        tasks.append( NeuronTask( NULL, 3, -5, 0.5, false, false ) );
+        tasks.append( NeuronTask( NULL, 4, -3, -2, false, false ) );
+
+        // The unstable neurons come first, and then the wider intervals
+        NLR::ParallelSolver::sortByExpectedGain( tasks, false, 0 );
+        TS_ASSERT_EQUALS( tasks[0]._index, 3U );
+        TS_ASSERT_EQUALS( tasks[1]._index, 1U );
+        TS_ASSERT_EQUALS( tasks[2]._index, 2U );
+        TS_ASSERT_EQUALS( tasks[3]._index, 0U );
+        TS_ASSERT_EQUALS( tasks[4]._index, 4U );
+
+        // A cutoff value changes which neurons are unstable
+        NLR::ParallelSolver::sortByExpectedGain( tasks, true, 1.5 );
+        TS_ASSERT_EQUALS( tasks[0]._index, 2U );
+        TS_ASSERT_EQUALS( tasks[1]._index, 0U );
+        TS_ASSERT_EQUALS( tasks[2]._index, 3U );
+        TS_ASSERT_EQUALS( tasks[3]._index, 1U );
+        TS_ASSERT_EQUALS( tasks[4]._index, 4U );
     }
 };
@@ -0,0 +1,319 @@
+/*********************                                                        */
+/*! \file Test_WeightMatrix.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "MatrixMultiplication.h"
+#include "Vector.h"
+#include "WeightMatrix.h"
+
+#include <cxxtest/TestSuite.h>
+
+using NLR::WeightMatrix;
+
+class WeightMatrixTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+    }
+
+    void tearDown()
+    {
+    }
+
+    /*
+      A 3 x 4 matrix (3 source neurons, 4 target neurons):
+
+         1   0   0  -2
+         0   0   3   0
+        -1   4   0   0
+    */
+    void populate( WeightMatrix &matrix )
+    {
+        matrix.setWeight( 0, 0, 1 );
+        matrix.setWeight( 2, 1, 4 );
+        matrix.setWeight( 0, 3, -2 );
+        matrix.setWeight( 1, 2, 3 );
+        matrix.setWeight( 2, 0, -1 );
+        matrix.finalize();
+    }
+
+    void test_set_and_get()
+    {
+        WeightMatrix dense( 3, 4, WeightMatrix::DENSE );
+        WeightMatrix csr( 3, 4, WeightMatrix::CSR );
+
+        populate( dense );
+        populate( csr );
+
+        double expected[] = { 1, 0, 0, -2, 0, 0, 3, 0, -1, 4, 0, 0 };
+        for ( unsigned i = 0; i < 3; ++i )
+        {
+            for ( unsigned j = 0; j < 4; ++j )
+            {
+                TS_ASSERT_EQUALS( dense.getWeight( i, j ), expected[i * 4 + j] );
+                TS_ASSERT_EQUALS( csr.getWeight( i, j ), expected[i * 4 + j] );
+            }
+        }
+
+        TS_ASSERT_EQUALS( dense.getNumberOfStoredEntries(), 12U );
+        TS_ASSERT_EQUALS( csr.getNumberOfStoredEntries(), 5U );
+
+        double result[12];
+        csr.toDense( result );
+        for ( unsigned i = 0; i < 12; ++i )
+            TS_ASSERT_EQUALS( result[i], expected[i] );
+
+        TS_ASSERT( dense == csr );
+    }
+
+    void test_csr_overwrite_and_delete()
+    {
+        WeightMatrix csr( 3, 4, WeightMatrix::CSR );
+        populate( csr );
+
+        // Flushed entries are overwritten in place
+        TS_ASSERT_EQUALS( csr.getWeight( 1, 2 ), 3 );
+        csr.setWeight( 1, 2, 5 );
+        TS_ASSERT_EQUALS( csr.getWeight( 1, 2 ), 5 );
+        TS_ASSERT_EQUALS( csr.getNumberOfStoredEntries(), 5U );
+
+        // The last of several pending updates prevails, zeros are dropped
+        csr.setWeight( 1, 1, 7 );
+        csr.setWeight( 1, 1, 8 );
+        csr.setWeight( 0, 0, 0 );
+        csr.setWeight( 2, 3, 0 );
+        TS_ASSERT_EQUALS( csr.getWeight( 1, 1 ), 8 );
+        TS_ASSERT_EQUALS( csr.getWeight( 0, 0 ), 0 );
+        TS_ASSERT_EQUALS( csr.getWeight( 2, 3 ), 0 );
+
+        csr.finalize();
+        TS_ASSERT_EQUALS( csr.getWeight( 1, 1 ), 8 );
+        TS_ASSERT_EQUALS( csr.getWeight( 0, 0 ), 0 );
+        TS_ASSERT_EQUALS( csr.getNumberOfStoredEntries(), 5U );
+    }
+
+    void test_convert_and_copy()
+    {
+        WeightMatrix matrix( 3, 4, WeightMatrix::DENSE );
+        populate( matrix );
+
+        WeightMatrix reference( matrix );
+
+        matrix.convertTo( WeightMatrix::CSR );
+        TS_ASSERT_EQUALS( matrix.getRepresentation(), WeightMatrix::CSR );
+        TS_ASSERT_EQUALS( matrix.getNumberOfStoredEntries(), 5U );
+        TS_ASSERT( matrix == reference );
+
+        WeightMatrix copy( matrix );
+        TS_ASSERT_EQUALS( copy.getRepresentation(), WeightMatrix::CSR );
+        TS_ASSERT( copy == reference );
+
+        copy.setWeight( 0, 1, 1 );
+        TS_ASSERT( copy != reference );
+        TS_ASSERT( matrix == reference );
+
+        matrix.convertTo( WeightMatrix::DENSE );
+        TS_ASSERT_EQUALS( matrix.getRepresentation(), WeightMatrix::DENSE );
+        TS_ASSERT( matrix == reference );
+
+        WeightMatrix assigned( 1, 1, WeightMatrix::DENSE );
+        assigned = copy;
+        TS_ASSERT_EQUALS( assigned.getRepresentation(), WeightMatrix::CSR );
+        TS_ASSERT( assigned == copy );
+
+        assigned = reference;
+        TS_ASSERT_EQUALS( assigned.getRepresentation(), WeightMatrix::DENSE );
+        TS_ASSERT( assigned == reference );
+    }
+
+    void test_preferred_representation()
+    {
+        // 5 out of 12 weights are non-zero
+        WeightMatrix matrix( 3, 4, WeightMatrix::CSR );
+        populate( matrix );
+        TS_ASSERT_EQUALS( matrix.getPreferredRepresentation(), WeightMatrix::DENSE );
+
+        // A single non-zero weight out of 100
+        WeightMatrix sparse( 10, 10, WeightMatrix::DENSE );
+        sparse.setWeight( 3, 7, 2 );
+        TS_ASSERT_EQUALS( sparse.getPreferredRepresentation(), WeightMatrix::CSR );
+    }
+
+    void test_dense_columns()
+    {
+        WeightMatrix dense( 3, 4, WeightMatrix::DENSE );
+        WeightMatrix csr( 3, 4, WeightMatrix::CSR );
+        populate( dense );
+        populate( csr );
+
+        // Columns 1 and 2
+        double expected[] = { 0, 0, 0, 3, 4, 0 };
+        double result[6];
+        WeightMatrix *matrices[] = { &dense, &csr };
+        for ( const auto &matrix : matrices )
+        {
+            std::fill_n( result, 6, 7 );
+            matrix->toDenseColumns( 1, 2, result );
+            for ( unsigned i = 0; i < 6; ++i )
+                TS_ASSERT_EQUALS( result[i], expected[i] );
+        }
+    }
+
+    void test_kernels()
+    {
+        WeightMatrix dense( 3, 4, WeightMatrix::DENSE );
+        WeightMatrix csr( 3, 4, WeightMatrix::CSR );
+        populate( dense );
+        populate( csr );
+
+        WeightMatrix *matrices[] = { &dense, &csr };
+        for ( const auto &matrix : matrices )
+        {
+            // Vector times weights
+            double vector[] = { 1, 2, 3 };
+            double result[] = { 1, 1, 1, 1 };
+            matrix->addVectorTimesWeights( vector, result );
+
+            double expectedResult[] = { -1, 13, 7, -1 };
+            for ( unsigned i = 0; i < 4; ++i )
+                TS_ASSERT( FloatUtils::areEqual( result[i], expectedResult[i] ) );
+
+            // Interval arithmetic
+            double lb[] = { -1, 0, 1 };
+            double ub[] = { 1, 2, 2 };
+            double resultLb[] = { 0, 0, 0, 0 };
+            double resultUb[] = { 0, 0, 0, 0 };
+            matrix->addIntervalTimesWeights( lb, ub, resultLb, resultUb );
+
+            double expectedLb[] = { -3, 4, 0, -2 };
+            double expectedUb[] = { 0, 8, 6, 2 };
+            for ( unsigned i = 0; i < 4; ++i )
+            {
+                TS_ASSERT( FloatUtils::areEqual( resultLb[i], expectedLb[i] ) );
+                TS_ASSERT( FloatUtils::areEqual( resultUb[i], expectedUb[i] ) );
+            }
+
+            // Matrix (2 x 3) times positive and negative weights
+            double left[] = { 1, 2, 3, -1, 0, 1 };
+            double positive[8];
+            double negative[8];
+            std::fill_n( positive, 8, 0 );
+            std::fill_n( negative, 8, 0 );
+            matrix->addMatrixTimesPositiveWeights( left, 2, positive );
+            matrix->addMatrixTimesNegativeWeights( left, 2, negative );
+
+            double expectedPositive[] = { 1, 12, 6, 0, -1, 4, 0, 0 };
+            double expectedNegative[] = { -3, 0, 0, -2, -1, 0, 0, 2 };
+            for ( unsigned i = 0; i < 8; ++i )
+            {
+                TS_ASSERT( FloatUtils::areEqual( positive[i], expectedPositive[i] ) );
+                TS_ASSERT( FloatUtils::areEqual( negative[i], expectedNegative[i] ) );
+            }
+
+            // Symbolic bounds (2 x 3) through the weights
+            double symbolicUb[] = { 2, 2, 3, 0, 1, 1 };
+            double symbolicResultLb[8];
+            double symbolicResultUb[8];
+            std::fill_n( symbolicResultLb, 8, 0 );
+            std::fill_n( symbolicResultUb, 8, 0 );
+            matrix->addSymbolicBoundsTimesWeights(
+                left, symbolicUb, 2, symbolicResultLb, symbolicResultUb );
+
+            double expectedSymbolicLb[] = { -2, 12, 6, -4, -2, 4, 0, 0 };
+            double expectedSymbolicUb[] = { -1, 12, 6, -2, -1, 4, 3, 2 };
+            for ( unsigned i = 0; i < 8; ++i )
+            {
+                TS_ASSERT( FloatUtils::areEqual( symbolicResultLb[i], expectedSymbolicLb[i] ) );
+                TS_ASSERT( FloatUtils::areEqual( symbolicResultUb[i], expectedSymbolicUb[i] ) );
+            }
+
+            // Weights times matrix (4 x 2)
+            double right[] = { 1, 0, 0, 1, 1, 1, 2, -1 };
+            double product[6];
+            std::fill_n( product, 6, 0 );
+            matrix->addWeightsTimesMatrix( right, 2, product );
+
+            double expectedProduct[] = { -3, 2, 3, 3, -1, 4 };
+            for ( unsigned i = 0; i < 6; ++i )
+                TS_ASSERT( FloatUtils::areEqual( product[i], expectedProduct[i] ) );
+
+            // Transposed weights times matrix (3 x 2)
+            double samples[] = { 1, 0, 2, 1, 3, -1 };
+            double transposedProduct[8];
+            std::fill_n( transposedProduct, 8, 0 );
+            matrix->addTransposedWeightsTimesMatrix( samples, 2, transposedProduct );
+
+            double expectedTransposedProduct[] = { -2, 1, 12, -4, 6, 3, -2, 0 };
+            for ( unsigned i = 0; i < 8; ++i )
+                TS_ASSERT(
+                    FloatUtils::areEqual( transposedProduct[i], expectedTransposedProduct[i] ) );
+        }
+    }
+
+    void test_large_symbolic_bounds()
+    {
+        // Large enough that, with two threads, the dense matrix switches from the fused
+        // kernel to four matrix products. The CSR matrix serves as the reference.
+        unsigned rows = 256;
+        unsigned size = 256;
+        TS_ASSERT( (unsigned long long)rows * size * size >=
+                   GlobalConfiguration::MATRIX_MULTIPLICATION_PARALLEL_THRESHOLD );
+
+        WeightMatrix dense( size, size, WeightMatrix::DENSE );
+        WeightMatrix csr( size, size, WeightMatrix::CSR );
+        for ( unsigned i = 0; i < size; ++i )
+        {
+            for ( unsigned j = 0; j < size; ++j )
+            {
+                double weight = (int)( ( i * 7 + j * 13 ) % 9 ) - 4;
+                dense.setWeight( i, j, weight );
+                csr.setWeight( i, j, weight );
+            }
+        }
+        dense.finalize();
+        csr.finalize();
+
+        Vector<double> symbolicLb( rows * size );
+        Vector<double> symbolicUb( rows * size );
+        for ( unsigned i = 0; i < rows * size; ++i )
+        {
+            symbolicLb[i] = (int)( i % 5 ) - 3;
+            symbolicUb[i] = symbolicLb[i] + ( i % 3 );
+        }
+
+        unsigned threads[] = { 1, 2 };
+        for ( unsigned numberOfThreads : threads )
+        {
+            setMatrixMultiplicationThreads( numberOfThreads );
+
+            Vector<double> denseLb( rows * size, 0 );
+            Vector<double> denseUb( rows * size, 0 );
+            Vector<double> csrLb( rows * size, 0 );
+            Vector<double> csrUb( rows * size, 0 );
+            dense.addSymbolicBoundsTimesWeights(
+                symbolicLb.data(), symbolicUb.data(), rows, denseLb.data(), denseUb.data() );
+            csr.addSymbolicBoundsTimesWeights(
+                symbolicLb.data(), symbolicUb.data(), rows, csrLb.data(), csrUb.data() );
+
+            for ( unsigned i = 0; i < rows * size; ++i )
+            {
+                TS_ASSERT( FloatUtils::areEqual( denseLb[i], csrLb[i] ) );
+                TS_ASSERT( FloatUtils::areEqual( denseUb[i], csrUb[i] ) );
+            }
+        }
+
+        setMatrixMultiplicationThreads( 1 );
+    }
+};
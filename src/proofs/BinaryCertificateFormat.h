@@ -0,0 +1,97 @@
+/*********************                                                        */
+/*! \file BinaryCertificateFormat.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __BinaryCertificateFormat_h__
+#define __BinaryCertificateFormat_h__
+
+#include <cstdint>
+#include <cstring>
+
+/*
+  The layout of an UNSAT certificate saved in binary form. Unlike the
+  binary query format, the file is a sequence of records that is written
+  in a single pass over the proof tree, so no section offsets are stored.
+  All values are uint32, except for bounds, coefficients and tightening
+  values, which are doubles; values are not aligned, and are stored in
+  little-endian byte order (see LittleEndian).
+
+    header            the magic string, followed by the fields of
+                        Header in order
+    tableau rows      explanationSize sparse lists
+    upper bounds      double[numberOfVariables]
+    lower bounds      double[numberOfVariables]
+    constraints       numberOfConstraints records of
+                        type, number of variables, variables
+                      (participating variables followed by tableau aux
+                      variables, as in the JSON proof)
+    proof tree        the root node record
+
+  A sparse list is a uint32 number of entries, followed by that many
+  ( uint32 index, double value ) pairs. A node record is:
+
+    flags             NODE_VISITED | NODE_HAS_SAT_SOLUTION
+    delegation status
+    head split        number of tightenings, followed by that many
+                        ( variable, bound type, double value )
+    PLC lemmas        number of lemmas, followed by that many
+                        affected variable, affected bound type,
+                        double bound, causing bound type, constraint
+                        type, number of causing variables, causing
+                        variables, number of explanations, explanations
+                        as sparse lists
+    contradiction     HAS_CONTRADICTION flag; if set, followed by the
+                        variable and the explanation as a sparse list
+    children          number of children, followed by their node
+                        records in order
+*/
+class BinaryCertificateFormat
+{
+public:
+    enum {
+        VERSION = 1,
+        MAGIC_LENGTH = 8,
+    };
+
+    enum NodeFlags {
+        NODE_VISITED = 1,
+        NODE_HAS_SAT_SOLUTION = 2,
+    };
+
+    struct Header
+    {
+        uint32_t _version;
+        uint32_t _explanationSize;
+        uint32_t _numberOfVariables;
+        uint32_t _numberOfConstraints;
+    };
+
+    static const char *magic()
+    {
+        return "MARABOUC";
+    }
+
+    static bool hasMagic( const char *data, uint64_t size )
+    {
+        return size >= MAGIC_LENGTH && memcmp( data, magic(), MAGIC_LENGTH ) == 0;
+    }
+};
+
+#endif // __BinaryCertificateFormat_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,306 @@
+/*********************                                                        */
+/*! \file BinaryCertificateReader.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "BinaryCertificateReader.h"
+
+#include "BinaryCertificateFormat.h"
+#include "LittleEndian.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "MemoryMappedFile.h"
+
+BinaryCertificateReader::BinaryCertificateReader( const String &path )
+    : _path( path )
+    , _root( NULL )
+    , _explanationSize( 0 )
+    , _data( NULL )
+    , _size( 0 )
+    , _offset( 0 )
+{
+}
+
+BinaryCertificateReader::~BinaryCertificateReader()
+{
+    freeMemoryIfNeeded();
+}
+
+void BinaryCertificateReader::freeMemoryIfNeeded()
+{
+    if ( _root )
+    {
+        delete _root;
+        _root = NULL;
+    }
+}
+
+void BinaryCertificateReader::read()
+{
+    freeMemoryIfNeeded();
+
+    MemoryMappedFile file( _path );
+    file.open();
+
+    _data = file.data();
+    _size = file.size();
+    _offset = 0;
+
+    if ( !BinaryCertificateFormat::hasMagic( _data, _size ) )
+        throw MarabouError( MarabouError::INVALID_BINARY_CERTIFICATE_FILE,
+                            "Not a binary certificate" );
+
+    BinaryCertificateFormat::Header header;
+    _offset = BinaryCertificateFormat::MAGIC_LENGTH;
+    header._version = readUint32();
+    header._explanationSize = readUint32();
+    header._numberOfVariables = readUint32();
+    header._numberOfConstraints = readUint32();
+    if ( header._version != BinaryCertificateFormat::VERSION )
+        throw MarabouError(
+            MarabouError::INVALID_BINARY_CERTIFICATE_FILE,
+            Stringf( "Unsupported binary certificate version: %u", header._version ).ascii() );
+
+    _explanationSize = header._explanationSize;
+    unsigned numberOfVariables = header._numberOfVariables;
+
+    // Initial tableau
+    Vector<SparseUnsortedList> rows( _explanationSize, SparseUnsortedList( numberOfVariables ) );
+    Vector<const SparseUnsortedList *> rowPointers( _explanationSize );
+    for ( unsigned i = 0; i < _explanationSize; ++i )
+    {
+        readSparseUnsortedList( rows[i] );
+        rowPointers[i] = &rows[i];
+    }
+    _initialTableau.initialize( rowPointers.data(), _explanationSize, numberOfVariables );
+
+    // Ground bounds
+    _upperBounds = Vector<double>( numberOfVariables );
+    _lowerBounds = Vector<double>( numberOfVariables );
+    for ( unsigned i = 0; i < numberOfVariables; ++i )
+        _upperBounds[i] = readDouble();
+    for ( unsigned i = 0; i < numberOfVariables; ++i )
+        _lowerBounds[i] = readDouble();
+
+    // Problem constraints
+    _constraintTypes = Vector<unsigned>( header._numberOfConstraints );
+    _constraintVariables = Vector<Vector<unsigned>>( header._numberOfConstraints );
+    for ( unsigned i = 0; i < header._numberOfConstraints; ++i )
+    {
+        _constraintTypes[i] = readUint32();
+        unsigned numberOfConstraintVariables = readUint32();
+        for ( unsigned j = 0; j < numberOfConstraintVariables; ++j )
+            _constraintVariables[i].append( readUint32() );
+    }
+
+    // Proof tree
+    _root = readUnsatCertificateNode( NULL );
+
+    if ( _offset != _size )
+        throw MarabouError( MarabouError::INVALID_BINARY_CERTIFICATE_FILE, "Unexpected file size" );
+
+    _data = NULL;
+    file.close();
+}
+
+bool BinaryCertificateReader::matchesConstraints(
+    const List<PiecewiseLinearConstraint *> &problemConstraints ) const
+{
+    if ( problemConstraints.size() != _constraintTypes.size() )
+        return false;
+
+    unsigned i = 0;
+    for ( const auto &constraint : problemConstraints )
+    {
+        if ( (unsigned)constraint->getType() != _constraintTypes[i] )
+            return false;
+
+        Vector<unsigned> variables;
+        for ( unsigned var : constraint->getParticipatingVariables() )
+            variables.append( var );
+        for ( unsigned var : constraint->getTableauAuxVars() )
+            variables.append( var );
+
+        if ( variables != _constraintVariables[i] )
+            return false;
+
+        ++i;
+    }
+
+    return true;
+}
+
+const UnsatCertificateNode *BinaryCertificateReader::getRoot() const
+{
+    return _root;
+}
+
+unsigned BinaryCertificateReader::getExplanationSize() const
+{
+    return _explanationSize;
+}
+
+const SparseMatrix *BinaryCertificateReader::getInitialTableau() const
+{
+    return &_initialTableau;
+}
+
+const Vector<double> &BinaryCertificateReader::getUpperBounds() const
+{
+    return _upperBounds;
+}
+
+const Vector<double> &BinaryCertificateReader::getLowerBounds() const
+{
+    return _lowerBounds;
+}
+
+uint32_t BinaryCertificateReader::readUint32()
+{
+    uint32_t value = LittleEndian::loadUint32( nextValue( sizeof( uint32_t ) ) );
+    _offset += sizeof( uint32_t );
+    return value;
+}
+
+double BinaryCertificateReader::readDouble()
+{
+    double value = LittleEndian::loadDouble( nextValue( sizeof( double ) ) );
+    _offset += sizeof( double );
+    return value;
+}
+
+const char *BinaryCertificateReader::nextValue( uint64_t valueSize ) const
+{
+    if ( _offset > _size || valueSize > _size - _offset )
+        throw MarabouError( MarabouError::INVALID_BINARY_CERTIFICATE_FILE, "Truncated file" );
+
+    return _data + _offset;
+}
+
+void BinaryCertificateReader::readSparseUnsortedList( SparseUnsortedList &list )
+{
+    unsigned nnz = readUint32();
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        unsigned index = readUint32();
+        double value = readDouble();
+        list.append( index, value );
+    }
+}
+
+UnsatCertificateNode *
+BinaryCertificateReader::readUnsatCertificateNode( UnsatCertificateNode *parent )
+{
+    unsigned flags = readUint32();
+    unsigned delegationStatus = readUint32();
+
+    PiecewiseLinearCaseSplit split;
+    unsigned numberOfTightenings = readUint32();
+    for ( unsigned i = 0; i < numberOfTightenings; ++i )
+    {
+        unsigned variable = readUint32();
+        unsigned type = readUint32();
+        double value = readDouble();
+        split.storeBoundTightening( Tightening( variable, value, (Tightening::BoundType)type ) );
+    }
+
+    // The node is owned by its parent, or by the reader if it is the root
+    UnsatCertificateNode *node = new UnsatCertificateNode( parent, split );
+    if ( !parent )
+        _root = node;
+
+    if ( flags & BinaryCertificateFormat::NODE_VISITED )
+        node->setVisited();
+    if ( flags & BinaryCertificateFormat::NODE_HAS_SAT_SOLUTION )
+        node->setSATSolutionFlag();
+    node->setDelegationStatus( (DelegationStatus)delegationStatus );
+
+    unsigned numberOfLemmas = readUint32();
+    for ( unsigned i = 0; i < numberOfLemmas; ++i )
+    {
+        std::shared_ptr<PLCLemma> lemma = readPLCLemma();
+        node->addPLCLemma( lemma );
+    }
+
+    Contradiction *contradiction = readContradiction();
+    if ( contradiction )
+        node->setContradiction( contradiction );
+
+    unsigned numberOfChildren = readUint32();
+    for ( unsigned i = 0; i < numberOfChildren; ++i )
+        readUnsatCertificateNode( node );
+
+    return node;
+}
+
+std::shared_ptr<PLCLemma> BinaryCertificateReader::readPLCLemma()
+{
+    unsigned affectedVar = readUint32();
+    unsigned affectedVarBound = readUint32();
+    double bound = readDouble();
+    unsigned causingVarBound = readUint32();
+    unsigned constraintType = readUint32();
+
+    List<unsigned> causingVars;
+    unsigned numberOfCausingVars = readUint32();
+    for ( unsigned i = 0; i < numberOfCausingVars; ++i )
+        causingVars.append( readUint32() );
+
+    unsigned numberOfExplanations = readUint32();
+    if ( numberOfExplanations != 0 && numberOfExplanations != numberOfCausingVars )
+        throw MarabouError( MarabouError::INVALID_BINARY_CERTIFICATE_FILE,
+                            "Lemma explanations do not match its causing variables" );
+
+    Vector<SparseUnsortedList> explanations( numberOfExplanations,
+                                             SparseUnsortedList( _explanationSize ) );
+    for ( unsigned i = 0; i < numberOfExplanations; ++i )
+        readSparseUnsortedList( explanations[i] );
+
+    return std::make_shared<PLCLemma>( causingVars,
+                                       affectedVar,
+                                       bound,
+                                       (Tightening::BoundType)causingVarBound,
+                                       (Tightening::BoundType)affectedVarBound,
+                                       explanations,
+                                       (PiecewiseLinearFunctionType)constraintType );
+}
+
+Contradiction *BinaryCertificateReader::readContradiction()
+{
+    if ( !readUint32() )
+        return NULL;
+
+    unsigned var = readUint32();
+    SparseUnsortedList explanation( _explanationSize );
+    readSparseUnsortedList( explanation );
+
+    if ( explanation.empty() )
+        return new Contradiction( var );
+
+    Vector<double> denseExplanation( _explanationSize, 0 );
+    for ( const auto &entry : explanation )
+    {
+        if ( entry._index >= _explanationSize )
+            throw MarabouError( MarabouError::INVALID_BINARY_CERTIFICATE_FILE,
+                                "Contradiction entry out of range" );
+        denseExplanation[entry._index] = entry._value;
+    }
+
+    return new Contradiction( denseExplanation );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
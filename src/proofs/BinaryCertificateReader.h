@@ -0,0 +1,105 @@
+/*********************                                                        */
+/*! \file BinaryCertificateReader.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __BinaryCertificateReader_h__
+#define __BinaryCertificateReader_h__
+
+#include "CSRMatrix.h"
+#include "List.h"
+#include "MString.h"
+#include "PiecewiseLinearConstraint.h"
+#include "SparseUnsortedList.h"
+#include "UnsatCertificateNode.h"
+#include "Vector.h"
+
+class MemoryMappedFile;
+
+/*
+  Reads an UNSAT certificate written by BinaryCertificateWriter, and
+  reconstructs everything a Checker needs to check it: the proof tree,
+  the initial tableau and the ground bounds. The piecewise-linear
+  constraints are not reconstructed, and should be taken from the query
+  the certificate refers to; matchesConstraints() verifies that they are
+  the constraints the certificate was written for.
+*/
+class BinaryCertificateReader
+{
+public:
+    BinaryCertificateReader( const String &path );
+    ~BinaryCertificateReader();
+
+    /*
+      Read the certificate. Throws a MarabouError if the file is not a
+      valid certificate.
+    */
+    void read();
+
+    /*
+      Check that the certificate was written for the given constraints:
+      their number, types and variables should all match.
+    */
+    bool matchesConstraints( const List<PiecewiseLinearConstraint *> &problemConstraints ) const;
+
+    /*
+      The contents of the certificate. The proof tree and the tableau are
+      owned by the reader.
+    */
+    const UnsatCertificateNode *getRoot() const;
+    unsigned getExplanationSize() const;
+    const SparseMatrix *getInitialTableau() const;
+    const Vector<double> &getUpperBounds() const;
+    const Vector<double> &getLowerBounds() const;
+
+private:
+    String _path;
+
+    UnsatCertificateNode *_root;
+    unsigned _explanationSize;
+    CSRMatrix _initialTableau;
+    Vector<double> _upperBounds;
+    Vector<double> _lowerBounds;
+    Vector<unsigned> _constraintTypes;
+    Vector<Vector<unsigned>> _constraintVariables;
+
+    /*
+      The file being read, and the offset of the next value in it
+    */
+    const char *_data;
+    uint64_t _size;
+    uint64_t _offset;
+
+    /*
+      Read a single little-endian value, or throw if the file is too
+      short to hold it
+    */
+    uint32_t readUint32();
+    double readDouble();
+    const char *nextValue( uint64_t valueSize ) const;
+
+    void readSparseUnsortedList( SparseUnsortedList &list );
+    UnsatCertificateNode *readUnsatCertificateNode( UnsatCertificateNode *parent );
+    std::shared_ptr<PLCLemma> readPLCLemma();
+    Contradiction *readContradiction();
+
+    void freeMemoryIfNeeded();
+};
+
+#endif // __BinaryCertificateReader_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,171 @@
+/*********************                                                        */
+/*! \file BinaryCertificateWriter.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "BinaryCertificateWriter.h"
+
+#include "BinaryCertificateFormat.h"
+#include "Debug.h"
+#include "LittleEndian.h"
+
+const char BinaryCertificateWriter::PROOF_FILENAME[] = "proof.mbc";
+
+void BinaryCertificateWriter::writeProof(
+    const UnsatCertificateNode *root,
+    unsigned explanationSize,
+    const SparseMatrix *initialTableau,
+    const Vector<double> &upperBounds,
+    const Vector<double> &lowerBounds,
+    const List<PiecewiseLinearConstraint *> &problemConstraints,
+    IFile &file )
+{
+    ASSERT( root );
+    ASSERT( upperBounds.size() == lowerBounds.size() );
+
+    file.open( IFile::MODE_WRITE_TRUNCATE );
+    BufferedFileWriter out( file );
+
+    out.write( BinaryCertificateFormat::magic(), BinaryCertificateFormat::MAGIC_LENGTH );
+    writeUint32( BinaryCertificateFormat::VERSION, out );
+    writeUint32( explanationSize, out );
+    writeUint32( upperBounds.size(), out );
+    writeUint32( problemConstraints.size(), out );
+
+    SparseUnsortedList tableauRow;
+    for ( unsigned i = 0; i < explanationSize; ++i )
+    {
+        initialTableau->getRow( i, &tableauRow );
+        writeSparseUnsortedList( tableauRow, out );
+    }
+
+    for ( double bound : upperBounds )
+        writeDouble( bound, out );
+    for ( double bound : lowerBounds )
+        writeDouble( bound, out );
+
+    for ( const auto &constraint : problemConstraints )
+    {
+        List<unsigned> participatingVars = constraint->getParticipatingVariables();
+        List<unsigned> tableauVars = constraint->getTableauAuxVars();
+
+        writeUint32( constraint->getType(), out );
+        writeUint32( participatingVars.size() + tableauVars.size(), out );
+        for ( unsigned var : participatingVars )
+            writeUint32( var, out );
+        for ( unsigned var : tableauVars )
+            writeUint32( var, out );
+    }
+
+    writeUnsatCertificateNode( root, out );
+
+    out.flush();
+    file.close();
+}
+
+void BinaryCertificateWriter::writeUnsatCertificateNode( const UnsatCertificateNode *node,
+                                                         BufferedFileWriter &out )
+{
+    uint32_t flags = 0;
+    if ( node->getVisited() )
+        flags |= BinaryCertificateFormat::NODE_VISITED;
+    if ( node->getSATSolutionFlag() )
+        flags |= BinaryCertificateFormat::NODE_HAS_SAT_SOLUTION;
+
+    writeUint32( flags, out );
+    writeUint32( node->getDelegationStatus(), out );
+
+    const List<Tightening> &tightenings = node->getSplit().getBoundTightenings();
+    writeUint32( tightenings.size(), out );
+    for ( const auto &tightening : tightenings )
+    {
+        writeUint32( tightening._variable, out );
+        writeUint32( tightening._type, out );
+        writeDouble( tightening._value, out );
+    }
+
+    const List<std::shared_ptr<PLCLemma>> &lemmas = node->getPLCLemmas();
+    writeUint32( lemmas.size(), out );
+    for ( const auto &lemma : lemmas )
+        writePLCLemma( *lemma, out );
+
+    writeContradiction( node->getContradiction(), out );
+
+    writeUint32( node->getChildren().size(), out );
+    for ( const auto *child : node->getChildren() )
+        writeUnsatCertificateNode( child, out );
+}
+
+void BinaryCertificateWriter::writePLCLemma( const PLCLemma &lemma, BufferedFileWriter &out )
+{
+    writeUint32( lemma.getAffectedVar(), out );
+    writeUint32( lemma.getAffectedVarBound(), out );
+    writeDouble( lemma.getBound(), out );
+    writeUint32( lemma.getCausingVarBound(), out );
+    writeUint32( lemma.getConstraintType(), out );
+
+    const List<unsigned> &causingVars = lemma.getCausingVars();
+    writeUint32( causingVars.size(), out );
+    for ( unsigned var : causingVars )
+        writeUint32( var, out );
+
+    const List<SparseUnsortedList> &explanations = lemma.getExplanations();
+    writeUint32( explanations.size(), out );
+    for ( const auto &explanation : explanations )
+        writeSparseUnsortedList( explanation, out );
+}
+
+void BinaryCertificateWriter::writeContradiction( const Contradiction *contradiction,
+                                                  BufferedFileWriter &out )
+{
+    writeUint32( contradiction ? 1 : 0, out );
+    if ( !contradiction )
+        return;
+
+    const SparseUnsortedList &explanation = contradiction->getContradiction();
+
+    // The variable is only meaningful when there is no explanation
+    writeUint32( explanation.empty() ? contradiction->getVar() : 0, out );
+    writeSparseUnsortedList( explanation, out );
+}
+
+void BinaryCertificateWriter::writeUint32( uint32_t value, BufferedFileWriter &out )
+{
+    char bytes[sizeof( uint32_t )];
+    LittleEndian::storeUint32( value, bytes );
+    out.write( bytes, sizeof( bytes ) );
+}
+
+void BinaryCertificateWriter::writeDouble( double value, BufferedFileWriter &out )
+{
+    char bytes[sizeof( double )];
+    LittleEndian::storeDouble( value, bytes );
+    out.write( bytes, sizeof( bytes ) );
+}
+
+void BinaryCertificateWriter::writeSparseUnsortedList( const SparseUnsortedList &list,
+                                                       BufferedFileWriter &out )
+{
+    writeUint32( list.getNnz(), out );
+    for ( auto entry = list.begin(); entry != list.end(); ++entry )
+    {
+        writeUint32( entry->_index, out );
+        writeDouble( entry->_value, out );
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
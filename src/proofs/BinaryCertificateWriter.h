@@ -0,0 +1,74 @@
+/*********************                                                        */
+/*! \file BinaryCertificateWriter.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __BinaryCertificateWriter_h__
+#define __BinaryCertificateWriter_h__
+
+#include "BufferedFileWriter.h"
+#include "Contradiction.h"
+#include "IFile.h"
+#include "List.h"
+#include "PiecewiseLinearConstraint.h"
+#include "PlcLemma.h"
+#include "SparseMatrix.h"
+#include "SparseUnsortedList.h"
+#include "UnsatCertificateNode.h"
+#include "Vector.h"
+
+/*
+  A class responsible for writing Marabou proof instances in the compact
+  binary format described in BinaryCertificateFormat.h. The instance is
+  streamed to the file as it is traversed.
+*/
+class BinaryCertificateWriter
+{
+public:
+    /*
+      Write an entire UNSAT proof to a binary file
+    */
+    static void writeProof( const UnsatCertificateNode *root,
+                            unsigned explanationSize,
+                            const SparseMatrix *initialTableau,
+                            const Vector<double> &upperBounds,
+                            const Vector<double> &lowerBounds,
+                            const List<PiecewiseLinearConstraint *> &problemConstraints,
+                            IFile &file );
+
+    /*
+      Configure proof file name
+    */
+    static const char PROOF_FILENAME[];
+
+private:
+    static void writeUnsatCertificateNode( const UnsatCertificateNode *node,
+                                           BufferedFileWriter &out );
+    static void writePLCLemma( const PLCLemma &lemma, BufferedFileWriter &out );
+    static void writeContradiction( const Contradiction *contradiction, BufferedFileWriter &out );
+    static void writeSparseUnsortedList( const SparseUnsortedList &list, BufferedFileWriter &out );
+
+    /*
+      Write a single value, in little-endian byte order
+    */
+    static void writeUint32( uint32_t value, BufferedFileWriter &out );
+    static void writeDouble( double value, BufferedFileWriter &out );
+};
+
+#endif // __BinaryCertificateWriter_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -14,6 +14,8 @@
 
 #include "BoundExplainer.h"
 
+#include <algorithm>
+
 using namespace CVC4::context;
 
 BoundExplainer::BoundExplainer( unsigned numberOfVariables, unsigned numberOfRows, Context &ctx )
@@ -24,11 +26,14 @@ BoundExplainer::BoundExplainer( unsigned numberOfVariables, unsigned numberOfRow
     , _lowerBoundExplanations( 0 )
     , _trivialUpperBoundExplanation( 0 )
     , _trivialLowerBoundExplanation( 0 )
+    , _accumulator( numberOfRows, 0 )
+    , _accumulatorStamps( numberOfRows, 0 )
+    , _currentStamp( 0 )
 {
     for ( unsigned i = 0; i < _numberOfVariables; ++i )
     {
-        _upperBoundExplanations.append( new ( true ) CDO<SparseUnsortedList>( &ctx ) );
-        _lowerBoundExplanations.append( new ( true ) CDO<SparseUnsortedList>( &ctx ) );
+        _upperBoundExplanations.append( new ( true ) CDO<BoundExplanation>( &ctx ) );
+        _lowerBoundExplanations.append( new ( true ) CDO<BoundExplanation>( &ctx ) );
 
         _trivialUpperBoundExplanation.append( new ( true ) CDO<bool>( &ctx, true ) );
         _trivialLowerBoundExplanation.append( new ( true ) CDO<bool>( &ctx, true ) );
@@ -37,6 +42,7 @@ BoundExplainer::BoundExplainer( unsigned numberOfVariables, unsigned numberOfRow
 
 BoundExplainer::~BoundExplainer()
 {
+    // The explanations, including the ones saved in the context, are released to the arena here
     for ( unsigned i = 0; i < _numberOfVariables; ++i )
     {
         _upperBoundExplanations[i]->deleteSelf();
@@ -55,10 +61,18 @@ BoundExplainer &BoundExplainer::operator=( const BoundExplainer &other )
     _numberOfRows = other._numberOfRows;
     _numberOfVariables = other._numberOfVariables;
 
+    _accumulator = Vector<double>( _numberOfRows, 0 );
+    _accumulatorStamps = Vector<unsigned>( _numberOfRows, 0 );
+    _currentStamp = 0;
+
+    // Explanations are copied into this explainer's arena
+    SparseUnsortedList explanation;
     for ( unsigned i = 0; i < _numberOfVariables; ++i )
     {
-        _upperBoundExplanations[i]->set( *other._upperBoundExplanations[i] );
-        _lowerBoundExplanations[i]->set( *other._lowerBoundExplanations[i] );
+        other._upperBoundExplanations[i]->get().toSparseUnsortedList( explanation );
+        _upperBoundExplanations[i]->set( _arena.allocate( explanation ) );
+        other._lowerBoundExplanations[i]->get().toSparseUnsortedList( explanation );
+        _lowerBoundExplanations[i]->set( _arena.allocate( explanation ) );
 
         _trivialUpperBoundExplanation[i]->set( other._trivialUpperBoundExplanation[i]->get() );
         _trivialLowerBoundExplanation[i]->set( other._trivialLowerBoundExplanation[i]->get() );
@@ -77,10 +91,14 @@ unsigned BoundExplainer::getNumberOfVariables() const
     return _numberOfVariables;
 }
 
-const SparseUnsortedList &BoundExplainer::getExplanation( unsigned var, bool isUpper )
+SparseUnsortedList BoundExplainer::getExplanation( unsigned var, bool isUpper ) const
 {
     ASSERT( var < _numberOfVariables );
-    return isUpper ? _upperBoundExplanations[var]->get() : _lowerBoundExplanations[var]->get();
+    SparseUnsortedList explanation;
+    ( isUpper ? _upperBoundExplanations[var] : _lowerBoundExplanations[var] )
+        ->get()
+        .toSparseUnsortedList( explanation );
+    return explanation;
 }
 
 void BoundExplainer::updateBoundExplanation( const TableauRow &row, bool isUpper )
@@ -118,9 +136,7 @@ void BoundExplainer::updateBoundExplanation( const TableauRow &row, bool isUpper
         ci = -1;
 
     ASSERT( !FloatUtils::isZero( ci ) );
-    Vector<double> rowCoefficients = Vector<double>( _numberOfRows, 0 );
-    Vector<double> sum = Vector<double>( _numberOfRows, 0 );
-    SparseUnsortedList tempBound;
+    clearAccumulator();
 
     for ( unsigned i = 0; i < row._size; ++i )
     {
@@ -144,8 +160,9 @@ void BoundExplainer::updateBoundExplanation( const TableauRow &row, bool isUpper
              ( !tempUpper && *_trivialLowerBoundExplanation[curVar] ) )
             continue;
 
-        tempBound = tempUpper ? *_upperBoundExplanations[curVar] : *_lowerBoundExplanations[curVar];
-        addVecTimesScalar( sum, tempBound, realCoefficient );
+        addExplanationTimesScalar( tempUpper ? _upperBoundExplanations[curVar]->get()
+                                             : _lowerBoundExplanations[curVar]->get(),
+                                   realCoefficient );
     }
 
     // Include lhs as well, if needed
@@ -157,19 +174,16 @@ void BoundExplainer::updateBoundExplanation( const TableauRow &row, bool isUpper
             tempUpper = ( isUpper && realCoefficient > 0 ) || ( !isUpper && realCoefficient < 0 );
             if ( !( tempUpper && *_trivialUpperBoundExplanation[row._lhs] ) &&
                  !( !tempUpper && *_trivialLowerBoundExplanation[row._lhs] ) )
-            {
-                tempBound = tempUpper ? *_upperBoundExplanations[row._lhs]
-                                      : *_lowerBoundExplanations[row._lhs];
-                addVecTimesScalar( sum, tempBound, realCoefficient );
-            }
+                addExplanationTimesScalar( tempUpper ? _upperBoundExplanations[row._lhs]->get()
+                                                     : _lowerBoundExplanations[row._lhs]->get(),
+                                           realCoefficient );
         }
     }
 
     // Update according to row coefficients
-    extractRowCoefficients( row, rowCoefficients, ci );
-    addVecTimesScalar( sum, rowCoefficients, 1 );
+    addRowCoefficients( row, ci );
 
-    setExplanation( sum, var, isUpper );
+    setExplanationFromAccumulator( var, isUpper );
 }
 
 void BoundExplainer::updateBoundExplanationSparse( const SparseUnsortedList &row,
@@ -195,9 +209,7 @@ void BoundExplainer::updateBoundExplanationSparse( const SparseUnsortedList &row
     }
 
     ASSERT( !FloatUtils::isZero( ci ) );
-    Vector<double> rowCoefficients = Vector<double>( _numberOfRows, 0 );
-    Vector<double> sum = Vector<double>( _numberOfRows, 0 );
-    SparseUnsortedList tempBound;
+    clearAccumulator();
 
     for ( const auto &entry : row )
     {
@@ -219,49 +231,88 @@ void BoundExplainer::updateBoundExplanationSparse( const SparseUnsortedList &row
              ( !tempUpper && *_trivialLowerBoundExplanation[entry._index] ) )
             continue;
 
-        tempBound = tempUpper ? *_upperBoundExplanations[entry._index]
-                              : *_lowerBoundExplanations[entry._index];
-        addVecTimesScalar( sum, tempBound, realCoefficient );
+        addExplanationTimesScalar( tempUpper ? _upperBoundExplanations[entry._index]->get()
+                                             : _lowerBoundExplanations[entry._index]->get(),
+                                   realCoefficient );
     }
 
     // Update according to row coefficients
-    extractSparseRowCoefficients( row, rowCoefficients, ci );
-    addVecTimesScalar( sum, rowCoefficients, 1 );
+    addSparseRowCoefficients( row, ci );
 
-    setExplanation( sum, var, isUpper );
+    setExplanationFromAccumulator( var, isUpper );
 }
 
-void BoundExplainer::addVecTimesScalar( Vector<double> &sum,
-                                        const SparseUnsortedList &input,
-                                        double scalar ) const
+void BoundExplainer::clearAccumulator()
 {
-    if ( input.empty() || FloatUtils::isZero( scalar ) )
-        return;
+    _touchedEntries.clear();
+    ++_currentStamp;
 
-    ASSERT( sum.size() == _numberOfRows );
+    // Once the stamps wrap around, they can no longer tell old entries from new ones
+    if ( _currentStamp == 0 )
+    {
+        std::fill( _accumulatorStamps.begin(), _accumulatorStamps.end(), 0 );
+        _currentStamp = 1;
+    }
+}
 
-    for ( const auto &entry : input )
-        sum[entry._index] += scalar * entry._value;
+void BoundExplainer::addToAccumulator( unsigned index, double value )
+{
+    ASSERT( index < _numberOfRows );
+
+    if ( _accumulatorStamps[index] != _currentStamp )
+    {
+        _accumulatorStamps[index] = _currentStamp;
+        _accumulator[index] = 0;
+        _touchedEntries.append( index );
+    }
+
+    _accumulator[index] += value;
 }
 
-void BoundExplainer::addVecTimesScalar( Vector<double> &sum,
-                                        const Vector<double> &input,
-                                        double scalar ) const
+void BoundExplainer::addExplanationTimesScalar( const BoundExplanation &explanation,
+                                                double scalar )
 {
-    if ( input.empty() || FloatUtils::isZero( scalar ) )
+    if ( explanation.empty() || FloatUtils::isZero( scalar ) )
         return;
 
-    ASSERT( sum.size() == _numberOfRows && input.size() == _numberOfRows );
+    for ( const auto &entry : explanation )
+        addToAccumulator( entry._index, scalar * entry._value );
+}
+
+void BoundExplainer::setExplanationFromAccumulator( unsigned var, bool isUpper )
+{
+    ASSERT( var < _numberOfVariables );
 
-    for ( unsigned i = 0; i < _numberOfRows; ++i )
-        sum[i] += scalar * input[i];
+    // Entries are kept in increasing order, as in a list created from a dense vector
+    std::sort( _touchedEntries.begin(), _touchedEntries.end() );
+
+    unsigned nnz = 0;
+    for ( unsigned index : _touchedEntries )
+        if ( !FloatUtils::isZero( _accumulator[index] ) )
+            ++nnz;
+
+    BoundExplanation::Entry *entries;
+    BoundExplanation explanation = _arena.allocate( _numberOfRows, nnz, entries );
+    for ( unsigned index : _touchedEntries )
+    {
+        if ( FloatUtils::isZero( _accumulator[index] ) )
+            continue;
+
+        entries->_index = index;
+        entries->_value = _accumulator[index];
+        ++entries;
+    }
+
+    isUpper ? _upperBoundExplanations[var]->set( explanation )
+            : _lowerBoundExplanations[var]->set( explanation );
+
+    isUpper ? _trivialUpperBoundExplanation[var]->set( false )
+            : _trivialLowerBoundExplanation[var]->set( false );
 }
 
-void BoundExplainer::extractRowCoefficients( const TableauRow &row,
-                                             Vector<double> &coefficients,
-                                             double ci ) const
+void BoundExplainer::addRowCoefficients( const TableauRow &row, double ci )
 {
-    ASSERT( coefficients.size() == _numberOfRows && row._size <= _numberOfVariables );
+    ASSERT( row._size <= _numberOfVariables );
     ASSERT( !FloatUtils::isZero( ci ) );
 
     // The coefficients of the row m highest-indices vars are the coefficients of slack variables
@@ -269,20 +320,17 @@ void BoundExplainer::extractRowCoefficients( const TableauRow &row,
     {
         if ( row._row[i]._var >= _numberOfVariables - _numberOfRows &&
              !FloatUtils::isZero( row._row[i]._coefficient ) )
-            coefficients[row._row[i]._var - _numberOfVariables + _numberOfRows] =
-                row._row[i]._coefficient / ci;
+            addToAccumulator( row._row[i]._var - _numberOfVariables + _numberOfRows,
+                              row._row[i]._coefficient / ci );
     }
 
     // If the lhs was part of original basis, its coefficient is -1 / ci
     if ( row._lhs >= _numberOfVariables - _numberOfRows )
-        coefficients[row._lhs - _numberOfVariables + _numberOfRows] = -1 / ci;
+        addToAccumulator( row._lhs - _numberOfVariables + _numberOfRows, -1 / ci );
 }
 
-void BoundExplainer::extractSparseRowCoefficients( const SparseUnsortedList &row,
-                                                   Vector<double> &coefficients,
-                                                   double ci ) const
+void BoundExplainer::addSparseRowCoefficients( const SparseUnsortedList &row, double ci )
 {
-    ASSERT( coefficients.size() == _numberOfRows );
     ASSERT( !FloatUtils::isZero( ci ) );
 
     // The coefficients of the row m highest-indices vars are the coefficients of slack variables
@@ -290,7 +338,8 @@ void BoundExplainer::extractSparseRowCoefficients( const SparseUnsortedList &row
     {
         if ( entry._index >= _numberOfVariables - _numberOfRows &&
              !FloatUtils::isZero( entry._value ) )
-            coefficients[entry._index - _numberOfVariables + _numberOfRows] = entry._value / ci;
+            addToAccumulator( entry._index - _numberOfVariables + _numberOfRows,
+                              entry._value / ci );
     }
 }
 
@@ -303,9 +352,11 @@ void BoundExplainer::addVariable()
     _trivialUpperBoundExplanation.append( new ( true ) CDO<bool>( &_context, true ) );
     _trivialLowerBoundExplanation.append( new ( true ) CDO<bool>( &_context, true ) );
 
-    _upperBoundExplanations.append( new ( true ) CDO<SparseUnsortedList>( &_context ) );
-    _lowerBoundExplanations.append( new ( true ) CDO<SparseUnsortedList>( &_context ) );
+    _upperBoundExplanations.append( new ( true ) CDO<BoundExplanation>( &_context ) );
+    _lowerBoundExplanations.append( new ( true ) CDO<BoundExplanation>( &_context ) );
 
+    _accumulator.append( 0 );
+    _accumulatorStamps.append( 0 );
 
     ASSERT( _upperBoundExplanations.size() == _numberOfVariables );
     ASSERT( _trivialUpperBoundExplanation.size() == _numberOfVariables );
@@ -314,8 +365,8 @@ void BoundExplainer::addVariable()
 void BoundExplainer::resetExplanation( unsigned var, bool isUpper )
 {
     ASSERT( var < _numberOfVariables );
-    isUpper ? _upperBoundExplanations[var]->set( SparseUnsortedList() )
-            : _lowerBoundExplanations[var]->set( SparseUnsortedList() );
+    isUpper ? _upperBoundExplanations[var]->set( BoundExplanation() )
+            : _lowerBoundExplanations[var]->set( BoundExplanation() );
 
     isUpper ? _trivialUpperBoundExplanation[var]->set( true )
             : _trivialLowerBoundExplanation[var]->set( true );
@@ -325,13 +376,9 @@ void BoundExplainer::setExplanation( const Vector<double> &explanation, unsigned
 {
     ASSERT( var < _numberOfVariables &&
             ( explanation.empty() || explanation.size() == _numberOfRows ) );
-    CDO<SparseUnsortedList> *temp =
-        isUpper ? _upperBoundExplanations[var] : _lowerBoundExplanations[var];
 
-    if ( explanation.empty() )
-        temp->set( SparseUnsortedList() );
-    else
-        temp->set( SparseUnsortedList( explanation.data(), explanation.size() ) );
+    isUpper ? _upperBoundExplanations[var]->set( _arena.allocate( explanation ) )
+            : _lowerBoundExplanations[var]->set( _arena.allocate( explanation ) );
 
     isUpper ? _trivialUpperBoundExplanation[var]->set( false )
             : _trivialLowerBoundExplanation[var]->set( false );
@@ -342,8 +389,8 @@ void BoundExplainer::setExplanation( const SparseUnsortedList &explanation,
                                      bool isUpper )
 {
     ASSERT( var < _numberOfVariables );
-    isUpper ? _upperBoundExplanations[var]->set( explanation )
-            : _lowerBoundExplanations[var]->set( explanation );
+    isUpper ? _upperBoundExplanations[var]->set( _arena.allocate( explanation ) )
+            : _lowerBoundExplanations[var]->set( _arena.allocate( explanation ) );
 
     isUpper ? _trivialUpperBoundExplanation[var]->set( false )
             : _trivialLowerBoundExplanation[var]->set( false );
@@ -352,4 +399,4 @@ void BoundExplainer::setExplanation( const SparseUnsortedList &explanation,
 bool BoundExplainer::isExplanationTrivial( unsigned var, bool isUpper ) const
 {
     return isUpper ? *_trivialUpperBoundExplanation[var] : *_trivialLowerBoundExplanation[var];
-}
\ No newline at end of file
+}
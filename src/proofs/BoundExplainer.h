@@ -15,6 +15,7 @@
 #ifndef __BoundsExplainer_h__
 #define __BoundsExplainer_h__
 
+#include "BoundExplanation.h"
 #include "SparseUnsortedList.h"
 #include "TableauRow.h"
 #include "Vector.h"
@@ -22,7 +23,9 @@
 #include "context/context.h"
 
 /*
-  A class which encapsulates bounds explanations of all variables of a tableau
+  A class which encapsulates bounds explanations of all variables of a tableau. Explanations are
+  kept as BoundExplanations, so that saving a context level does not copy them, and are updated
+  through a sparse accumulator, touching only their non-zero entries.
 */
 class BoundExplainer
 {
@@ -46,7 +49,7 @@ public:
     /*
       Returns a bound explanation
     */
-    const SparseUnsortedList &getExplanation( unsigned var, bool isUpper );
+    SparseUnsortedList getExplanation( unsigned var, bool isUpper ) const;
 
     /*
       Given a row, updates the values of the bound explanations of its lhs according to the row
@@ -92,37 +95,60 @@ private:
     unsigned _numberOfVariables;
     unsigned _numberOfRows;
 
-    Vector<CVC4::context::CDO<SparseUnsortedList> *> _upperBoundExplanations;
-    Vector<CVC4::context::CDO<SparseUnsortedList> *> _lowerBoundExplanations;
+    BoundExplanationArena _arena;
+
+    Vector<CVC4::context::CDO<BoundExplanation> *> _upperBoundExplanations;
+    Vector<CVC4::context::CDO<BoundExplanation> *> _lowerBoundExplanations;
 
     Vector<CVC4::context::CDO<bool> *> _trivialUpperBoundExplanation;
     Vector<CVC4::context::CDO<bool> *> _trivialLowerBoundExplanation;
 
     /*
-      Adds a multiplication of an array by scalar to another array
+      A sparse accumulator, in which new explanations are computed: the dense values of the
+      entries, the stamp of the last update that touched each entry (entries with an older stamp
+      are treated as zero), and the list of entries touched by the current update
+    */
+    Vector<double> _accumulator;
+    Vector<unsigned> _accumulatorStamps;
+    unsigned _currentStamp;
+    Vector<unsigned> _touchedEntries;
+
+    /*
+      Clear the accumulator, in time proportional to the number of entries touched since it was
+      last cleared
+    */
+    void clearAccumulator();
+
+    /*
+      Add a value to an entry of the accumulator
+    */
+    void addToAccumulator( unsigned index, double value );
+
+    /*
+      Add a multiplication of an explanation by scalar to the accumulator
     */
-    void
-    addVecTimesScalar( Vector<double> &sum, const SparseUnsortedList &input, double scalar ) const;
+    void addExplanationTimesScalar( const BoundExplanation &explanation, double scalar );
 
-    void addVecTimesScalar( Vector<double> &sum, const Vector<double> &input, double scalar ) const;
+    /*
+      Set the explanation of a variable to the contents of the accumulator
+    */
+    void setExplanationFromAccumulator( unsigned var, bool isUpper );
 
     /*
-      Upon receiving a row, extract coefficients of the original tableau's equations that create the
-      row Equivalently, extract the coefficients of the slack variables. Assumption - the slack
-      variables indices are always the last m. All coefficients are divided by ci, the coefficient
-      of the explained var, for normalization.
+      Upon receiving a row, add the coefficients of the original tableau's equations that create the
+      row to the accumulator. Equivalently, add the coefficients of the slack variables. Assumption -
+      the slack variables indices are always the last m. All coefficients are divided by ci, the
+      coefficient of the explained var, for normalization.
     */
-    void
-    extractRowCoefficients( const TableauRow &row, Vector<double> &coefficients, double ci ) const;
+    void addRowCoefficients( const TableauRow &row, double ci );
 
     /*
-      Upon receiving a row given as a SparseUnsortedList, extract coefficients of the original
-      tableau's equations that create the row Equivalently, extract the coefficients of the slack
-      variables. Assumption - the slack variables indices are always the last m. All coefficients
-      are divided by ci, the coefficient of the explained var, for normalization.
+      Upon receiving a row given as a SparseUnsortedList, add the coefficients of the original
+      tableau's equations that create the row to the accumulator. Equivalently, add the
+      coefficients of the slack variables. Assumption - the slack variables indices are always the
+      last m. All coefficients are divided by ci, the coefficient of the explained var, for
+      normalization.
     */
-    void extractSparseRowCoefficients( const SparseUnsortedList &row,
-                                       Vector<double> &coefficients,
-                                       double ci ) const;
+    void addSparseRowCoefficients( const SparseUnsortedList &row, double ci );
 };
 #endif // __BoundsExplainer_h__
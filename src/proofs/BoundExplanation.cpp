@@ -0,0 +1,204 @@
+/*********************                                                        */
+/*! \file BoundExplanation.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "BoundExplanation.h"
+
+#include "Debug.h"
+#include "FloatUtils.h"
+
+BoundExplanation::BoundExplanation()
+    : _block( NULL )
+{
+}
+
+BoundExplanation::BoundExplanation( Block *block )
+    : _block( block )
+{
+}
+
+BoundExplanation::BoundExplanation( const BoundExplanation &other )
+    : _block( other._block )
+{
+    if ( _block )
+        ++_block->_referenceCount;
+}
+
+BoundExplanation &BoundExplanation::operator=( const BoundExplanation &other )
+{
+    if ( _block == other._block )
+        return *this;
+
+    release();
+    _block = other._block;
+    if ( _block )
+        ++_block->_referenceCount;
+
+    return *this;
+}
+
+BoundExplanation::~BoundExplanation()
+{
+    release();
+}
+
+void BoundExplanation::release()
+{
+    if ( !_block )
+        return;
+
+    ASSERT( _block->_referenceCount > 0 );
+    if ( --_block->_referenceCount == 0 )
+        _block->_arena->release( _block );
+
+    _block = NULL;
+}
+
+unsigned BoundExplanation::getSize() const
+{
+    return _block ? _block->_size : 0;
+}
+
+unsigned BoundExplanation::getNnz() const
+{
+    return _block ? _block->_nnz : 0;
+}
+
+bool BoundExplanation::empty() const
+{
+    return getNnz() == 0;
+}
+
+const BoundExplanation::Entry *BoundExplanation::begin() const
+{
+    return _block ? _block->entries() : NULL;
+}
+
+const BoundExplanation::Entry *BoundExplanation::end() const
+{
+    return _block ? _block->entries() + _block->_nnz : NULL;
+}
+
+void BoundExplanation::toSparseUnsortedList( SparseUnsortedList &result ) const
+{
+    result = SparseUnsortedList( getSize() );
+    for ( const Entry &entry : *this )
+        result.append( entry._index, entry._value );
+}
+
+BoundExplanationArena::BoundExplanationArena()
+    : _slabPosition( NULL )
+    , _slabRemaining( 0 )
+{
+}
+
+BoundExplanationArena::~BoundExplanationArena()
+{
+    for ( char *slab : _slabs )
+        delete[] slab;
+}
+
+BoundExplanation
+BoundExplanationArena::allocate( unsigned size, unsigned nnz, BoundExplanation::Entry *&entries )
+{
+    unsigned sizeClass = MINIMAL_SIZE_CLASS;
+    while ( ( 1ULL << sizeClass ) < nnz )
+        ++sizeClass;
+
+    while ( _freeBlocks.size() <= sizeClass )
+        _freeBlocks.append( NULL );
+
+    BoundExplanation::Block *block = _freeBlocks[sizeClass];
+    if ( block )
+        _freeBlocks[sizeClass] = block->_nextFree;
+    else
+    {
+        unsigned long long bytes = sizeof( BoundExplanation::Block ) +
+                                   ( 1ULL << sizeClass ) * sizeof( BoundExplanation::Entry );
+
+        if ( bytes > _slabRemaining )
+        {
+            // Whatever remains of the current slab is abandoned
+            unsigned long long slabSize = std::max<unsigned long long>( bytes, SLAB_SIZE );
+            _slabPosition = new char[slabSize];
+            _slabRemaining = slabSize;
+            _slabs.append( _slabPosition );
+        }
+
+        block = (BoundExplanation::Block *)_slabPosition;
+        _slabPosition += bytes;
+        _slabRemaining -= bytes;
+    }
+
+    block->_arena = this;
+    block->_nextFree = NULL;
+    block->_referenceCount = 1;
+    block->_sizeClass = sizeClass;
+    block->_size = size;
+    block->_nnz = nnz;
+
+    entries = block->entries();
+    return BoundExplanation( block );
+}
+
+BoundExplanation BoundExplanationArena::allocate( const SparseUnsortedList &explanation )
+{
+    BoundExplanation::Entry *entries;
+    BoundExplanation result = allocate( explanation.getSize(), explanation.getNnz(), entries );
+
+    for ( const auto &entry : explanation )
+    {
+        entries->_index = entry._index;
+        entries->_value = entry._value;
+        ++entries;
+    }
+
+    return result;
+}
+
+BoundExplanation BoundExplanationArena::allocate( const Vector<double> &explanation )
+{
+    unsigned nnz = 0;
+    for ( unsigned i = 0; i < explanation.size(); ++i )
+        if ( !FloatUtils::isZero( explanation[i] ) )
+            ++nnz;
+
+    BoundExplanation::Entry *entries;
+    BoundExplanation result = allocate( explanation.size(), nnz, entries );
+
+    for ( unsigned i = 0; i < explanation.size(); ++i )
+    {
+        if ( FloatUtils::isZero( explanation[i] ) )
+            continue;
+
+        entries->_index = i;
+        entries->_value = explanation[i];
+        ++entries;
+    }
+
+    return result;
+}
+
+void BoundExplanationArena::release( BoundExplanation::Block *block )
+{
+    ASSERT( block->_arena == this && block->_referenceCount == 0 );
+    block->_nextFree = _freeBlocks[block->_sizeClass];
+    _freeBlocks[block->_sizeClass] = block;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
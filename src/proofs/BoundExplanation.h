@@ -0,0 +1,141 @@
+/*********************                                                        */
+/*! \file BoundExplanation.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __BoundExplanation_h__
+#define __BoundExplanation_h__
+
+#include "List.h"
+#include "SparseUnsortedList.h"
+#include "Vector.h"
+
+class BoundExplanationArena;
+
+/*
+  A sparse explanation of a bound, i.e. the coefficients of the rows of
+  the initial tableau that yield the bound. The entries are stored
+  contiguously in a block taken from a BoundExplanationArena, and the
+  block is shared by all copies of the explanation, with a reference
+  count. Blocks are never changed once they are filled, so copying an
+  explanation (e.g., when a context level is saved) only increments the
+  count, and an update of an explanation creates a new block instead.
+
+  The reference count is not atomic: an explanation and its copies
+  should all be used by the same thread.
+*/
+class BoundExplanation
+{
+public:
+    struct Entry
+    {
+        unsigned _index;
+        double _value;
+    };
+
+    BoundExplanation();
+    BoundExplanation( const BoundExplanation &other );
+    BoundExplanation &operator=( const BoundExplanation &other );
+    ~BoundExplanation();
+
+    /*
+      The dimension of the explanation, and its number of non-zero
+      entries
+    */
+    unsigned getSize() const;
+    unsigned getNnz() const;
+    bool empty() const;
+
+    /*
+      Retrieve entries
+    */
+    const Entry *begin() const;
+    const Entry *end() const;
+
+    /*
+      Convert the explanation to a SparseUnsortedList
+    */
+    void toSparseUnsortedList( SparseUnsortedList &result ) const;
+
+private:
+    friend class BoundExplanationArena;
+
+    struct Block
+    {
+        BoundExplanationArena *_arena;
+        Block *_nextFree;
+        unsigned _referenceCount;
+        unsigned _sizeClass;
+        unsigned _size;
+        unsigned _nnz;
+
+        Entry *entries()
+        {
+            return (Entry *)( this + 1 );
+        }
+    };
+
+    Block *_block;
+
+    BoundExplanation( Block *block );
+    void release();
+};
+
+/*
+  Allocates the blocks of bound explanations. Blocks are rounded up to
+  a power of two number of entries and carved out of large slabs;
+  released blocks are kept on a free list per size, so that they can be
+  reused without going back to the system allocator. The arena must
+  outlive all the explanations allocated from it.
+*/
+class BoundExplanationArena
+{
+public:
+    BoundExplanationArena();
+    ~BoundExplanationArena();
+
+    /*
+      Allocate an explanation of the given dimension with nnz entries.
+      The caller fills in the entries, before the explanation is copied.
+    */
+    BoundExplanation allocate( unsigned size, unsigned nnz, BoundExplanation::Entry *&entries );
+
+    /*
+      Copy a sparse list, or a dense vector, into a new explanation
+    */
+    BoundExplanation allocate( const SparseUnsortedList &explanation );
+    BoundExplanation allocate( const Vector<double> &explanation );
+
+private:
+    friend class BoundExplanation;
+
+    enum {
+        MINIMAL_SIZE_CLASS = 2,
+        SLAB_SIZE = 65536,
+    };
+
+    Vector<BoundExplanation::Block *> _freeBlocks;
+    List<char *> _slabs;
+    char *_slabPosition;
+    unsigned long long _slabRemaining;
+
+    void release( BoundExplanation::Block *block );
+};
+
+#endif // __BoundExplanation_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -14,6 +14,10 @@
 
 #include "Checker.h"
 
+#include "Options.h"
+
+#include <boost/thread.hpp>
+
 Checker::Checker( const UnsatCertificateNode *root,
                   unsigned proofSize,
                   const SparseMatrix *initialTableau,
@@ -26,35 +30,76 @@ Checker::Checker( const UnsatCertificateNode *root,
     , _groundUpperBounds( groundUpperBounds )
     , _groundLowerBounds( groundLowerBounds )
     , _problemConstraints( problemConstraints )
-    , _delegationCounter( 0 )
+    , _ownDelegationCounter( 0 )
+    , _delegationCounter( &_ownDelegationCounter )
+    , _numberOfThreads( 1 )
+    , _deferralDepth( 0 )
 {
     for ( auto constraint : problemConstraints )
         constraint->setPhaseStatus( PHASE_NOT_FIXED );
+
+    int numberOfThreads = Options::get()->getInt( Options::NUM_PROOF_CHECKING_THREADS );
+    if ( numberOfThreads > 1 )
+    {
+        // Defer subtrees at the shallowest depth at which a binary tree
+        // has enough of them to keep all threads busy
+        _numberOfThreads = numberOfThreads;
+        unsigned numberOfSubtrees = 1;
+        while ( numberOfSubtrees <
+                _numberOfThreads * GlobalConfiguration::PROOF_CHECKING_SUBTREES_PER_THREAD )
+        {
+            numberOfSubtrees *= 2;
+            ++_deferralDepth;
+        }
+    }
 }
 
-bool Checker::check()
+Checker::Checker( const Subtree &subtree,
+                  unsigned proofSize,
+                  const SparseMatrix *initialTableau,
+                  std::atomic<unsigned> *delegationCounter )
+    : _root( subtree._root )
+    , _proofSize( proofSize )
+    , _initialTableau( initialTableau )
+    , _groundUpperBounds( subtree._groundUpperBounds )
+    , _groundLowerBounds( subtree._groundLowerBounds )
+    , _problemConstraints( subtree._problemConstraints )
+    , _ownDelegationCounter( 0 )
+    , _delegationCounter( delegationCounter )
+    , _numberOfThreads( 1 )
+    , _deferralDepth( 0 )
 {
-    return checkNode( _root );
 }
 
-bool Checker::checkNode( const UnsatCertificateNode *node )
+Checker::~Checker()
 {
-    Vector<double> groundUpperBoundsBackup( _groundUpperBounds );
-    Vector<double> groundLowerBoundsBackup( _groundLowerBounds );
+    freeDeferredSubtrees();
+}
+
+bool Checker::check()
+{
+    bool answer = checkNode( _root, 0 );
+
+    if ( answer && !_deferredSubtrees.empty() )
+        answer = checkDeferredSubtrees();
+
+    freeDeferredSubtrees();
+    return answer;
+}
 
-    _upperBoundChanges.push( {} );
-    _lowerBoundChanges.push( {} );
+bool Checker::checkNode( const UnsatCertificateNode *node, unsigned depth )
+{
+    unsigned numberOfChanges = _boundChanges.size();
+    bool answer = checkNodeWithoutRestoring( node, depth );
+    restoreGroundBounds( numberOfChanges );
+    return answer;
+}
 
+bool Checker::checkNodeWithoutRestoring( const UnsatCertificateNode *node, unsigned depth )
+{
     // Update ground bounds according to head split
     for ( const auto &tightening : node->getSplit().getBoundTightenings() )
-    {
-        auto &temp = tightening._type == Tightening::UB ? _groundUpperBounds : _groundLowerBounds;
-        temp[tightening._variable] = tightening._value;
-
-        tightening._type == Tightening::UB
-            ? _upperBoundChanges.top().insert( tightening._variable )
-            : _lowerBoundChanges.top().insert( tightening._variable );
-    }
+        updateGroundBound( tightening._variable, tightening._type, tightening._value );
 
     // Check all PLC bound propagations
     if ( !checkAllPLCExplanations( node, GlobalConfiguration::LEMMA_CERTIFICATION_TOLERANCE ) )
@@ -96,11 +141,14 @@ bool Checker::checkNode( const UnsatCertificateNode *node )
     if ( !checkSingleVarSplits( childrenSplits ) && !childrenSplitConstraint )
         return false;
 
-    // Fix the constraints phase according to the child, and check each child
+    // Fix the constraints phase according to the child, and check each child. Children at the
+    // deferral depth are checked later, on other threads.
     for ( const auto &child : node->getChildren() )
     {
         fixChildSplitPhase( child, childrenSplitConstraint );
-        if ( !checkNode( child ) )
+        if ( _numberOfThreads > 1 && depth + 1 == _deferralDepth )
+            deferSubtree( child );
+        else if ( !checkNode( child, depth + 1 ) )
             answer = false;
     }
 
@@ -115,17 +163,121 @@ bool Checker::checkNode( const UnsatCertificateNode *node )
                 ->addFeasibleDisjunct( child->getSplit() );
     }
 
-    // Revert only bounds that where changed during checking the current node
-    for ( const auto &i : _upperBoundChanges.top() )
-        _groundUpperBounds[i] = groundUpperBoundsBackup[i];
+    return answer;
+}
 
-    for ( const auto &i : _lowerBoundChanges.top() )
-        _groundLowerBounds[i] = groundLowerBoundsBackup[i];
+void Checker::updateGroundBound( unsigned var, Tightening::BoundType type, double value )
+{
+    Vector<double> &groundBounds =
+        type == Tightening::UB ? _groundUpperBounds : _groundLowerBounds;
 
-    _upperBoundChanges.pop();
-    _lowerBoundChanges.pop();
+    BoundChange change;
+    change._variable = var;
+    change._type = type;
+    change._previousValue = groundBounds[var];
+    _boundChanges.append( change );
 
-    return answer;
+    groundBounds[var] = value;
+}
+
+void Checker::restoreGroundBounds( unsigned numberOfChanges )
+{
+    // Undo in reverse order, so that a bound changed several times gets
+    // its earliest value back
+    while ( _boundChanges.size() > numberOfChanges )
+    {
+        BoundChange change = _boundChanges.pop();
+        if ( change._type == Tightening::UB )
+            _groundUpperBounds[change._variable] = change._previousValue;
+        else
+            _groundLowerBounds[change._variable] = change._previousValue;
+    }
+}
+
+void Checker::deferSubtree( const UnsatCertificateNode *child )
+{
+    Subtree *subtree = new Subtree;
+    subtree->_root = child;
+    subtree->_groundUpperBounds = _groundUpperBounds;
+    subtree->_groundLowerBounds = _groundLowerBounds;
+
+    for ( const auto &constraint : _problemConstraints )
+    {
+        // The copy is used on another thread, so it must not share the
+        // context of the original. Keep the phase it has at this node.
+        PhaseStatus phaseStatus = constraint->getPhaseStatus();
+        bool active = constraint->isActive();
+
+        PiecewiseLinearConstraint *copy = constraint->duplicateConstraint();
+        copy->cdoCleanup();
+        copy->setPhaseStatus( phaseStatus );
+        copy->setActiveConstraint( active );
+        subtree->_problemConstraints.append( copy );
+    }
+
+    _deferredSubtrees.append( subtree );
+}
+
+bool Checker::checkDeferredSubtrees()
+{
+    Vector<Subtree *> subtrees;
+    for ( const auto &subtree : _deferredSubtrees )
+        subtrees.append( subtree );
+
+    // Every thread repeatedly takes the next unchecked subtree, until
+    // none are left or one of them fails
+    std::atomic<unsigned> nextSubtree( 0 );
+    std::atomic<bool> certified( true );
+    Vector<std::exception_ptr> errors( _numberOfThreads, nullptr );
+    auto checkSubtrees = [&]( unsigned i ) {
+        try
+        {
+            unsigned index;
+            while ( certified && ( index = nextSubtree++ ) < subtrees.size() )
+            {
+                Checker checker(
+                    *subtrees[index], _proofSize, _initialTableau, _delegationCounter );
+                if ( !checker.checkNode( subtrees[index]->_root, 0 ) )
+                    certified = false;
+            }
+        }
+        catch ( ... )
+        {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    Vector<boost::thread *> threads;
+    for ( unsigned i = 1; i < _numberOfThreads; ++i )
+        threads.append( new boost::thread( checkSubtrees, i ) );
+
+    checkSubtrees( 0 );
+
+    for ( const auto &thread : threads )
+    {
+        thread->join();
+        delete thread;
+    }
+
+    for ( const auto &error : errors )
+    {
+        if ( error )
+            std::rethrow_exception( error );
+    }
+
+    return certified;
+}
+
+void Checker::freeDeferredSubtrees()
+{
+    for ( const auto &subtree : _deferredSubtrees )
+    {
+        for ( const auto &constraint : subtree->_problemConstraints )
+            delete constraint;
+        delete subtree;
+    }
+
+    _deferredSubtrees.clear();
 }
 
 void Checker::fixChildSplitPhase( UnsatCertificateNode *child,
@@ -267,12 +419,7 @@ bool Checker::checkAllPLCExplanations( const UnsatCertificateNode *node, double
                            ? FloatUtils::lt( explainedBound, temp[affectedVar] )
                            : FloatUtils::gt( explainedBound, temp[affectedVar] );
         if ( isTighter )
-        {
-            temp[affectedVar] = explainedBound;
-            ASSERT( !_upperBoundChanges.empty() && !_lowerBoundChanges.empty() );
-            affectedVarBound == Tightening::UB ? _upperBoundChanges.top().insert( affectedVar )
-                                               : _lowerBoundChanges.top().insert( affectedVar );
-        }
+            updateGroundBound( affectedVar, affectedVarBound, explainedBound );
     }
     return true;
 }
@@ -309,7 +456,7 @@ Checker::getCorrespondingConstraint( const List<PiecewiseLinearCaseSplit> &split
 
 void Checker::writeToFile()
 {
-    String filename = "delegated" + std::to_string( _delegationCounter ) + ".smtlib";
+    String filename = "delegated" + std::to_string( ( *_delegationCounter )++ ) + ".smtlib";
 
     SmtLibWriter::writeToSmtLibFile( filename,
                                      _proofSize,
@@ -319,8 +466,6 @@ void Checker::writeToFile()
                                      _initialTableau,
                                      List<Equation>(),
                                      _problemConstraints );
-
-    ++_delegationCounter;
 }
 
 bool Checker::checkSingleVarSplits( const List<PiecewiseLinearCaseSplit> &splits )
@@ -20,10 +20,11 @@
 #include "LeakyReluConstraint.h"
 #include "MaxConstraint.h"
 #include "Set.h"
-#include "Stack.h"
 #include "Tightening.h"
 #include "UnsatCertificateNode.h"
 
+#include <atomic>
+
 /*
   A class responsible to certify the UnsatCertificate
 */
@@ -36,6 +37,7 @@ public:
              const Vector<double> &groundUpperBounds,
              const Vector<double> &groundLowerBounds,
              const List<PiecewiseLinearConstraint *> &_problemConstraints );
+    ~Checker();
 
     /*
       Checks if the tree is indeed a correct proof of unsatisfiability.
@@ -45,6 +47,38 @@ public:
     bool check();
 
 private:
+    /*
+      A ground bound as it was before a change, so that the change can
+      be undone
+    */
+    struct BoundChange
+    {
+        unsigned _variable;
+        Tightening::BoundType _type;
+        double _previousValue;
+    };
+
+    /*
+      A subtree whose check is deferred, together with the ground bounds
+      and the constraints (with their phases) at its root
+    */
+    struct Subtree
+    {
+        const UnsatCertificateNode *_root;
+        Vector<double> _groundUpperBounds;
+        Vector<double> _groundLowerBounds;
+        List<PiecewiseLinearConstraint *> _problemConstraints;
+    };
+
+    /*
+      Used for checking a deferred subtree. Unlike the public
+      constructor, the phases of the constraints are kept.
+    */
+    Checker( const Subtree &subtree,
+             unsigned proofSize,
+             const SparseMatrix *initialTableau,
+             std::atomic<unsigned> *delegationCounter );
+
     // The root of the tree to check
     const UnsatCertificateNode *_root;
     unsigned _proofSize;
@@ -57,17 +91,57 @@ private:
 
     List<PiecewiseLinearConstraint *> _problemConstraints;
 
-    unsigned _delegationCounter;
+    // Shared by all checkers of the same certificate, so that delegated
+    // leaves are written to distinct files
+    std::atomic<unsigned> _ownDelegationCounter;
+    std::atomic<unsigned> *_delegationCounter;
 
-    // Keeps track of bounds changes, so only stored bounds will be reverted when traversing the
-    // tree
-    Stack<Set<unsigned>> _upperBoundChanges;
-    Stack<Set<unsigned>> _lowerBoundChanges;
+    // Every change to the ground bounds, in order. When the checker
+    // backtracks from a node, it undoes the changes made below it.
+    Vector<BoundChange> _boundChanges;
+
+    // The number of threads among which subtrees are checked, and the
+    // depth at which subtrees are deferred to them
+    unsigned _numberOfThreads;
+    unsigned _deferralDepth;
+    List<Subtree *> _deferredSubtrees;
 
     /*
-      Checks a node in the certificate tree
+      Checks a node in the certificate tree, and restores the ground
+      bounds once done
     */
-    bool checkNode( const UnsatCertificateNode *node );
+    bool checkNode( const UnsatCertificateNode *node, unsigned depth );
+
+    /*
+      Checks a node in the certificate tree, leaving the changes to the
+      ground bounds in place
+    */
+    bool checkNodeWithoutRestoring( const UnsatCertificateNode *node, unsigned depth );
+
+    /*
+      Set a ground bound, logging its previous value
+    */
+    void updateGroundBound( unsigned var, Tightening::BoundType type, double value );
+
+    /*
+      Undo the changes to the ground bounds, until only the given number
+      of changes remains
+    */
+    void restoreGroundBounds( unsigned numberOfChanges );
+
+    /*
+      Store the given child with a copy of the current ground bounds and
+      constraints, to be checked later by checkDeferredSubtrees()
+    */
+    void deferSubtree( const UnsatCertificateNode *child );
+
+    /*
+      Check all deferred subtrees on _numberOfThreads threads. Return
+      true iff all of them are certified.
+    */
+    bool checkDeferredSubtrees();
+
+    void freeDeferredSubtrees();
 
     /*
       Return true iff all changes in the ground bounds are certified, with tolerance to errors with
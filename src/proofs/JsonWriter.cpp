@@ -58,70 +58,69 @@ void JsonWriter::writeProofToJson( const UnsatCertificateNode *root,
     ASSERT( lowerBounds.size() > 0 );
     ASSERT( explanationSize > 0 );
 
-    List<String> jsonLines;
-    jsonLines.append( "{\n" );
+    file.open( IFile::MODE_WRITE_TRUNCATE );
+    BufferedFileWriter out( file );
 
-    // Add initial query information to the instance
-    writeInitialTableau( initialTableau, explanationSize, jsonLines );
-    writeBounds( upperBounds, Tightening::UB, jsonLines );
-    writeBounds( lowerBounds, Tightening::LB, jsonLines );
-    writePiecewiseLinearConstraints( problemConstraints, jsonLines );
+    out.write( "{\n" );
 
-    // Add UNSAT certificate proof tree object to the instance
-    jsonLines.append( String( PROOF ) + String( "{ \n" ) );
-    writeUnsatCertificateNode( root, explanationSize, jsonLines );
-    jsonLines.append( "}\n" );
+    // Stream the initial query information to the file
+    writeInitialTableau( initialTableau, explanationSize, out );
+    writeBounds( upperBounds, Tightening::UB, out );
+    writeBounds( lowerBounds, Tightening::LB, out );
+    writePiecewiseLinearConstraints( problemConstraints, out );
 
-    jsonLines.append( "}\n" );
+    // Stream the UNSAT certificate proof tree object, node by node
+    out.write( String( PROOF ) + String( "{ \n" ) );
+    writeUnsatCertificateNode( root, explanationSize, out );
+    out.write( "}\n" );
 
-    // Wrap-up everything and write to a file
-    writeInstanceToFile( file, jsonLines );
+    out.write( "}\n" );
+
+    out.flush();
+    file.close();
 }
 
 void JsonWriter::writeBounds( const Vector<double> &bounds,
                               Tightening::BoundType isUpper,
-                              List<String> &instance )
+                              BufferedFileWriter &out )
 {
-    String boundsString = isUpper == Tightening::UB ? UPPER_BOUNDS : LOWER_BOUNDS;
-
-    boundsString += convertDoubleArrayToString( bounds.data(), bounds.size() );
-
-    instance.append( boundsString );
-    instance.append( String( ",\n" ) );
+    out.write( isUpper == Tightening::UB ? UPPER_BOUNDS : LOWER_BOUNDS );
+    writeDoubleArray( bounds.data(), bounds.size(), out );
+    out.write( String( ",\n" ) );
 }
 
 void JsonWriter::writeInitialTableau( const SparseMatrix *initialTableau,
                                       unsigned explanationSize,
-                                      List<String> &instance )
+                                      BufferedFileWriter &out )
 {
-    instance.append( String( TABLEAU ) );
-    instance.append( "[\n" );
+    out.write( String( TABLEAU ) );
+    out.write( "[\n" );
 
     SparseUnsortedList tableauRow = SparseUnsortedList();
 
     // Write each tableau row separately
     for ( unsigned i = 0; i < explanationSize; ++i )
     {
-        instance.append( "[" );
+        out.write( "[" );
         initialTableau->getRow( i, &tableauRow );
-        instance.append( convertSparseUnsortedListToString( tableauRow ) );
+        out.write( convertSparseUnsortedListToString( tableauRow ) );
 
         // Not adding a comma after the last element
         if ( i != explanationSize - 1 )
-            instance.append( "],\n" );
+            out.write( "],\n" );
         else
-            instance.append( "]\n" );
+            out.write( "]\n" );
     }
 
-    instance.append( "], \n" );
+    out.write( "], \n" );
 }
 
 void JsonWriter::writePiecewiseLinearConstraints(
     const List<PiecewiseLinearConstraint *> &problemConstraints,
-    List<String> &instance )
+    BufferedFileWriter &out )
 {
-    instance.append( CONSTRAINTS );
-    instance.append( "[\n" );
+    out.write( CONSTRAINTS );
+    out.write( "[\n" );
     String type = "";
     String vars = "";
     unsigned counter = 0;
@@ -146,58 +145,59 @@ void JsonWriter::writePiecewiseLinearConstraints(
 
         vars += "]";
 
-        instance.append( String( "{" ) + String( CONSTRAINT_TYPE ) + type + String( ", " ) +
+        out.write( String( "{" ) + String( CONSTRAINT_TYPE ) + type + String( ", " ) +
                          String( VARIABLES ) + vars );
 
         // Not adding a comma after the last element
         if ( counter != size - 1 )
-            instance.append( "},\n" );
+            out.write( "},\n" );
         else
-            instance.append( "}\n" );
+            out.write( "}\n" );
         ++counter;
     }
-    instance.append( "],\n" );
+    out.write( "],\n" );
 }
 
 void JsonWriter::writeUnsatCertificateNode( const UnsatCertificateNode *node,
                                             unsigned explanationSize,
-                                            List<String> &instance )
+                                            BufferedFileWriter &out )
 {
     // For SAT examples only (used for debugging)
     if ( !node->getVisited() || node->getSATSolutionFlag() )
         return;
 
-    writeHeadSplit( node->getSplit(), instance );
+    writeHeadSplit( node->getSplit(), out );
 
-    writePLCLemmas( node->getPLCLemmas(), instance );
+    writePLCLemmas( node->getPLCLemmas(), out );
 
     if ( node->getChildren().empty() )
-        writeContradiction( node->getContradiction(), instance );
+        writeContradiction( node->getContradiction(), out );
     else
     {
-        instance.append( CHILDREN );
-        instance.append( "[\n" );
+        out.write( CHILDREN );
+        out.write( "[\n" );
 
         unsigned counter = 0;
         unsigned size = node->getChildren().size();
         for ( auto child : node->getChildren() )
         {
-            instance.append( "{\n" );
-            writeUnsatCertificateNode( child, explanationSize, instance );
+            out.write( "{\n" );
+            writeUnsatCertificateNode( child, explanationSize, out );
 
             // Not adding a comma after the last element
             if ( counter != size - 1 )
-                instance.append( "},\n" );
+                out.write( "},\n" );
             else
-                instance.append( "}\n" );
+                out.write( "}\n" );
             ++counter;
         }
 
-        instance.append( "]\n" );
+        out.write( "]\n" );
     }
 }
 
-void JsonWriter::writeHeadSplit( const PiecewiseLinearCaseSplit &headSplit, List<String> &instance )
+void JsonWriter::writeHeadSplit( const PiecewiseLinearCaseSplit &headSplit,
+                                 BufferedFileWriter &out )
 {
     String boundTypeString;
     unsigned counter = 0;
@@ -206,11 +206,11 @@ void JsonWriter::writeHeadSplit( const PiecewiseLinearCaseSplit &headSplit, List
     if ( !size )
         return;
 
-    instance.append( SPLIT );
-    instance.append( "[" );
+    out.write( SPLIT );
+    out.write( "[" );
     for ( auto tightening : headSplit.getBoundTightenings() )
     {
-        instance.append( String( "{" ) + String( VARIABLE ) +
+        out.write( String( "{" ) + String( VARIABLE ) +
                          std::to_string( tightening._variable ) + String( ", " ) + String( VALUE ) +
                          convertDoubleToString( tightening._value ) + String( ", " ) +
                          String( BOUND ) );
@@ -220,25 +220,25 @@ void JsonWriter::writeHeadSplit( const PiecewiseLinearCaseSplit &headSplit, List
         // Not adding a comma after the last element
         if ( counter != size - 1 )
             boundTypeString += ", ";
-        instance.append( boundTypeString );
+        out.write( boundTypeString );
         ++counter;
     }
-    instance.append( "],\n" );
+    out.write( "],\n" );
 }
 
-void JsonWriter::writeContradiction( const Contradiction *contradiction, List<String> &instance )
+void JsonWriter::writeContradiction( const Contradiction *contradiction, BufferedFileWriter &out )
 {
     String contradictionString = CONTRADICTION;
-    const SparseUnsortedList explanation = contradiction->getContradiction();
+    const SparseUnsortedList &explanation = contradiction->getContradiction();
     contradictionString += "[ ";
     contradictionString += explanation.empty() ? std::to_string( contradiction->getVar() )
                                                : convertSparseUnsortedListToString( explanation );
     contradictionString += String( " ]\n" );
-    instance.append( contradictionString );
+    out.write( contradictionString );
 }
 
 void JsonWriter::writePLCLemmas( const List<std::shared_ptr<PLCLemma>> &PLCExplanations,
-                                 List<String> &instance )
+                                 BufferedFileWriter &out )
 {
     unsigned counter = 0;
     unsigned size = PLCExplanations.size();
@@ -247,88 +247,78 @@ void JsonWriter::writePLCLemmas( const List<std::shared_ptr<PLCLemma>> &PLCExpla
     String affectedBoundType = "";
     String causingBoundType = "";
 
-    instance.append( LEMMAS );
-    instance.append( "[\n" );
+    out.write( LEMMAS );
+    out.write( "[\n" );
 
     // Write all fields of each lemma
     for ( auto lemma : PLCExplanations )
     {
-        instance.append( String( "{" ) );
-        instance.append( String( AFFECTED_VAR ) + std::to_string( lemma->getAffectedVar() ) +
+        out.write( String( "{" ) );
+        out.write( String( AFFECTED_VAR ) + std::to_string( lemma->getAffectedVar() ) +
                          String( ", " ) );
         affectedBoundType = lemma->getAffectedVarBound() == Tightening::UB ? String( UPPER_BOUND )
                                                                            : String( LOWER_BOUND );
-        instance.append( String( AFFECTED_BOUND ) + affectedBoundType + String( ", " ) );
-        instance.append( String( BOUND ) + convertDoubleToString( lemma->getBound() ) );
+        out.write( String( AFFECTED_BOUND ) + affectedBoundType + String( ", " ) );
+        out.write( String( BOUND ) + convertDoubleToString( lemma->getBound() ) );
 
         if ( PROVE_LEMMAS )
         {
-            instance.append( String( ", " ) );
+            out.write( String( ", " ) );
             List<unsigned> causingVars = lemma->getCausingVars();
 
             if ( causingVars.size() == 1 )
-                instance.append( String( CAUSING_VAR ) + std::to_string( causingVars.front() ) +
+                out.write( String( CAUSING_VAR ) + std::to_string( causingVars.front() ) +
                                  String( ", " ) );
             else
             {
-                instance.append( String( CAUSING_VARS ) + "[ " );
+                out.write( String( CAUSING_VARS ) + "[ " );
                 for ( unsigned var : causingVars )
                 {
-                    instance.append( std::to_string( var ) );
+                    out.write( std::to_string( var ) );
                     if ( var != causingVars.back() )
-                        instance.append( ", " );
+                        out.write( ", " );
                 }
-                instance.append( " ]\n" );
+                out.write( " ]\n" );
             }
 
             causingBoundType = lemma->getCausingVarBound() == Tightening::UB
                                  ? String( UPPER_BOUND )
                                  : String( LOWER_BOUND );
-            instance.append( String( CAUSING_BOUND ) + causingBoundType + String( ", " ) );
-            instance.append( String( CONSTRAINT ) + std::to_string( lemma->getConstraintType() ) +
+            out.write( String( CAUSING_BOUND ) + causingBoundType + String( ", " ) );
+            out.write( String( CONSTRAINT ) + std::to_string( lemma->getConstraintType() ) +
                              String( ",\n" ) );
 
             List<SparseUnsortedList> expls = lemma->getExplanations();
             if ( expls.size() == 1 )
-                instance.append( String( EXPLANATION ) + "[ " +
+                out.write( String( EXPLANATION ) + "[ " +
                                  convertSparseUnsortedListToString( expls.front() ) + " ]" );
             else
             {
-                instance.append( String( EXPLANATIONS ) + "[ " );
+                out.write( String( EXPLANATIONS ) + "[ " );
                 unsigned innerCounter = 0;
                 for ( SparseUnsortedList &expl : expls )
                 {
-                    instance.append( "[ " );
-                    instance.append( convertSparseUnsortedListToString( expl ) );
-                    instance.append( " ]" );
+                    out.write( "[ " );
+                    out.write( convertSparseUnsortedListToString( expl ) );
+                    out.write( " ]" );
                     if ( innerCounter != expls.size() - 1 )
-                        instance.append( ",\n" );
+                        out.write( ",\n" );
 
                     ++innerCounter;
                 }
-                instance.append( " ]\n" );
+                out.write( " ]\n" );
             }
         }
 
-        instance.append( String( "}" ) );
+        out.write( String( "}" ) );
 
         // Not adding a comma after the last element
         if ( counter != size - 1 )
-            instance.append( ",\n" );
+            out.write( ",\n" );
         ++counter;
     }
 
-    instance.append( "\n],\n" );
-}
-
-void JsonWriter::writeInstanceToFile( IFile &file, const List<String> &instance )
-{
-    file.open( File::MODE_WRITE_TRUNCATE );
-
-    for ( const String &s : instance )
-        file.write( s );
-
-    file.close();
+    out.write( "\n],\n" );
 }
 
 String JsonWriter::convertDoubleToString( double value )
@@ -343,18 +333,16 @@ String JsonWriter::convertDoubleToString( double value )
     return str;
 }
 
-String JsonWriter::convertDoubleArrayToString( const double *arr, unsigned size )
+void JsonWriter::writeDoubleArray( const double *arr, unsigned size, BufferedFileWriter &out )
 {
-    String arrString = "[";
+    out.write( "[" );
     for ( unsigned i = 0; i < size - 1; ++i )
-        arrString += convertDoubleToString( arr[i] ) + ", ";
-
-    arrString += convertDoubleToString( arr[size - 1] ) + "]";
+        out.write( convertDoubleToString( arr[i] ) + ", " );
 
-    return arrString;
+    out.write( convertDoubleToString( arr[size - 1] ) + "]" );
 }
 
-String JsonWriter::convertSparseUnsortedListToString( SparseUnsortedList sparseList )
+String JsonWriter::convertSparseUnsortedListToString( const SparseUnsortedList &sparseList )
 {
     String sparseListString = "";
     unsigned counter = 0;
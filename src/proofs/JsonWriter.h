@@ -15,6 +15,7 @@
 #ifndef __JsonWriter_h__
 #define __JsonWriter_h__
 
+#include "BufferedFileWriter.h"
 #include "Contradiction.h"
 #include "File.h"
 #include "List.h"
@@ -35,7 +36,8 @@ class JsonWriter
 {
 public:
     /*
-      Write an entire UNSAT proof to a JSON file.
+      Write an entire UNSAT proof to a JSON file. The proof is streamed to the file while it is
+      traversed, rather than assembled in memory first.
       General remark - empty JSON properties (such as empty contradiction for non-leaves) will not
       be written.
     */
@@ -91,53 +93,49 @@ public:
 
 private:
     /*
-      Write the initial tableau to a JSON list of Strings
+      Write the initial tableau in JSON format
     */
     static void writeInitialTableau( const SparseMatrix *initialTableau,
                                      unsigned explanationSize,
-                                     List<String> &instance );
+                                     BufferedFileWriter &out );
 
     /*
-      Write variables bounds to a JSON String
+      Write variables bounds in JSON format
     */
     static void writeBounds( const Vector<double> &bounds,
                              Tightening::BoundType isUpper,
-                             List<String> &instance );
+                             BufferedFileWriter &out );
 
     /*
-      Write a list a piecewise-linear constraints to a JSON String
+      Write a list a piecewise-linear constraints in JSON format
     */
     static void
     writePiecewiseLinearConstraints( const List<PiecewiseLinearConstraint *> &problemConstraints,
-                                     List<String> &instance );
+                                     BufferedFileWriter &out );
 
     /*
-      Write an UNSAT certificate node to a JSON String
+      Write an UNSAT certificate node, and its offsprings, in JSON format
     */
     static void writeUnsatCertificateNode( const UnsatCertificateNode *node,
                                            unsigned explanationSize,
-                                           List<String> &instance );
+                                           BufferedFileWriter &out );
 
     /*
-      Write a list of PLCLemmas to a JSON String
+      Write a list of PLCLemmas in JSON format
     */
     static void writePLCLemmas( const List<std::shared_ptr<PLCLemma>> &PLCLemma,
-                                List<String> &instance );
+                                BufferedFileWriter &out );
 
     /*
-      Write a contradiction object to a JSON String
+      Write a contradiction object in JSON format
     */
-    static void writeContradiction( const Contradiction *contradiction, List<String> &instance );
+    static void writeContradiction( const Contradiction *contradiction, BufferedFileWriter &out );
 
     /*
-      Write a PiecewiseLinearCaseSplit to a JSON String
+      Write a PiecewiseLinearCaseSplit in JSON format
     */
-    static void writeHeadSplit( const PiecewiseLinearCaseSplit &headSplit, List<String> &instance );
-
-    /*
-      Write an instance to a file
-    */
-    static void writeInstanceToFile( IFile &file, const List<String> &instance );
+    static void writeHeadSplit( const PiecewiseLinearCaseSplit &headSplit,
+                                BufferedFileWriter &out );
 
     /*
       Convert a double to a string
@@ -145,14 +143,14 @@ private:
     static String convertDoubleToString( double value );
 
     /*
-      Write an array of doubles to a JSON String
+      Write an array of doubles in JSON format
     */
-    static String convertDoubleArrayToString( const double *arr, unsigned size );
+    static void writeDoubleArray( const double *arr, unsigned size, BufferedFileWriter &out );
 
     /*
       Write a SparseUnsortedList object to a JSON String
     */
-    static String convertSparseUnsortedListToString( SparseUnsortedList sparseList );
+    static String convertSparseUnsortedListToString( const SparseUnsortedList &sparseList );
 };
 
 #endif //__JsonWriter_h__
\ No newline at end of file
@@ -33,14 +33,20 @@ void SmtLibWriter::writeToSmtLibFile( const String &fileName,
                                       const List<Equation> &additionalEquations,
                                       const List<PiecewiseLinearConstraint *> &problemConstraints )
 {
-    List<String> instance;
+    File file( fileName );
+    file.open( File::MODE_WRITE_TRUNCATE );
+    BufferedFileWriter out( file );
 
-    // Write with SmtLibWriter
+    // Write with SmtLibWriter, streaming each part of the instance to the file once it is ready
+    List<String> instance;
     unsigned b, f;
 
     SmtLibWriter::addHeader( numOfVariables, instance );
+    SmtLibWriter::flushInstance( instance, out );
     SmtLibWriter::addGroundUpperBounds( upperBounds, instance );
+    SmtLibWriter::flushInstance( instance, out );
     SmtLibWriter::addGroundLowerBounds( lowerBounds, instance );
+    SmtLibWriter::flushInstance( instance, out );
 
     auto tableauRow = SparseUnsortedList();
 
@@ -55,10 +61,14 @@ void SmtLibWriter::writeToSmtLibFile( const String &fileName,
                 tableauRow.incrementSize();
 
         SmtLibWriter::addTableauRow( tableauRow, instance );
+        SmtLibWriter::flushInstance( instance, out );
     }
 
     for ( const auto &eq : additionalEquations )
+    {
         SmtLibWriter::addEquation( eq, instance, true );
+        SmtLibWriter::flushInstance( instance, out );
+    }
 
     for ( auto &constraint : problemConstraints )
     {
@@ -116,11 +126,15 @@ void SmtLibWriter::writeToSmtLibFile( const String &fileName,
             SmtLibWriter::addLeakyReLUConstraint(
                 b, f, slope, constraint->getPhaseStatus(), instance );
         }
+
+        SmtLibWriter::flushInstance( instance, out );
     }
 
     SmtLibWriter::addFooter( instance );
-    File file( fileName );
-    SmtLibWriter::writeInstanceToFile( file, instance );
+    SmtLibWriter::flushInstance( instance, out );
+
+    out.flush();
+    file.close();
 }
 
 void SmtLibWriter::addHeader( unsigned numberOfVariables, List<String> &instance )
@@ -380,6 +394,14 @@ void SmtLibWriter::writeInstanceToFile( IFile &file, const List<String> &instanc
     file.close();
 }
 
+void SmtLibWriter::flushInstance( List<String> &instance, BufferedFileWriter &out )
+{
+    for ( const String &s : instance )
+        out.write( s );
+
+    instance.clear();
+}
+
 String SmtLibWriter::signedValue( double val )
 {
     std::stringstream s;
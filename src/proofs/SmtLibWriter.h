@@ -15,6 +15,7 @@
 #ifndef __SmtLibWriter_h__
 #define __SmtLibWriter_h__
 
+#include "BufferedFileWriter.h"
 #include "File.h"
 #include "List.h"
 #include "MString.h"
@@ -117,12 +118,18 @@ public:
      */
     static void writeInstanceToFile( IFile &file, const List<String> &instance );
 
+    /*
+      Writes the lines of an instance to a buffered file, and clears the instance
+     */
+    static void flushInstance( List<String> &instance, BufferedFileWriter &out );
+
     /*
       Returns a string representing the value of a double
      */
     static String signedValue( double val );
     /*
-      A wrapper function calling all previous functions
+      A wrapper function calling all previous functions. The instance is streamed to the file
+      part by part, so it is never held in memory as a whole.
     */
     static void writeToSmtLibFile( const String &fileName,
                                    unsigned numOfTableauRows,
@@ -0,0 +1,276 @@
+/*********************                                                        */
+/*! \file Test_BinaryCertificate.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "BinaryCertificateFormat.h"
+#include "BinaryCertificateReader.h"
+#include "BinaryCertificateWriter.h"
+#include "CSRMatrix.h"
+#include "Checker.h"
+#include "LittleEndian.h"
+#include "MarabouError.h"
+#include "MockFile.h"
+
+#include <cstdio>
+#include <cxxtest/TestSuite.h>
+#include <fstream>
+
+const String CERTIFICATE_TEST_FILE( "BinaryCertificateTest.mbc" );
+
+class BinaryCertificateTestSuite : public CxxTest::TestSuite
+{
+public:
+    void tearDown()
+    {
+        std::remove( CERTIFICATE_TEST_FILE.ascii() );
+    }
+
+    void writeCertificate( const UnsatCertificateNode *root,
+                           unsigned m,
+                           const SparseMatrix *initialTableau,
+                           const Vector<double> &groundUpperBounds,
+                           const Vector<double> &groundLowerBounds,
+                           const List<PiecewiseLinearConstraint *> &constraintsList )
+    {
+        MockFile file;
+        BinaryCertificateWriter::writeProof(
+            root, m, initialTableau, groundUpperBounds, groundLowerBounds, constraintsList, file );
+        writeFile( file.writtenLines );
+    }
+
+    void writeFile( const String &contents )
+    {
+        std::ofstream certificate( CERTIFICATE_TEST_FILE.ascii(),
+                                   std::ios::binary | std::ios::trunc );
+        certificate.write( contents.ascii(), contents.length() );
+    }
+
+    void test_write_and_read()
+    {
+        unsigned m = 3, n = 6;
+        double A[] = { 1, 0, -1, 1, 0, 0, 0, -1, 2, 0, 1, 0, 0.5, 0, -1, 0, 0, 1 };
+        CSRMatrix initialTableau( A, m, n );
+
+        Vector<double> groundUpperBounds( n, 1 );
+        Vector<double> groundLowerBounds( n, 0 );
+        groundUpperBounds[5] = 2.5;
+        groundLowerBounds[1] = -3;
+
+        ReluConstraint relu1( 0, 2 );
+        ReluConstraint relu2( 1, 3 );
+        List<PiecewiseLinearConstraint *> constraintsList = { &relu1, &relu2 };
+
+        auto *root = new UnsatCertificateNode( NULL, PiecewiseLinearCaseSplit() );
+        root->setVisited();
+
+        PiecewiseLinearCaseSplit split1;
+        split1.storeBoundTightening( Tightening( 0, 0.5, Tightening::UB ) );
+        PiecewiseLinearCaseSplit split2;
+        split2.storeBoundTightening( Tightening( 0, 0.5, Tightening::LB ) );
+        split2.storeBoundTightening( Tightening( 4, 0, Tightening::UB ) );
+
+        auto *child1 = new UnsatCertificateNode( root, split1 );
+        auto *child2 = new UnsatCertificateNode( root, split2 );
+        child1->setVisited();
+        child1->setContradiction( new Contradiction( Vector<double>( { 1, 0, -0.5 } ) ) );
+        child2->setSATSolutionFlag();
+        child2->setDelegationStatus( DelegationStatus::DELEGATE_DONT_SAVE );
+
+        double explanation[] = { 0, 2, 0 };
+        std::shared_ptr<PLCLemma> lemma =
+            std::make_shared<PLCLemma>( List<unsigned>( { 0 } ),
+                                        2,
+                                        0.25,
+                                        Tightening::LB,
+                                        Tightening::UB,
+                                        Vector<SparseUnsortedList>(
+                                            { SparseUnsortedList( explanation, m ) } ),
+                                        RELU );
+        root->addPLCLemma( lemma );
+
+        writeCertificate(
+            root, m, &initialTableau, groundUpperBounds, groundLowerBounds, constraintsList );
+
+        BinaryCertificateReader reader( CERTIFICATE_TEST_FILE );
+        TS_ASSERT_THROWS_NOTHING( reader.read() );
+
+        TS_ASSERT_EQUALS( reader.getExplanationSize(), m );
+        TS_ASSERT( reader.getUpperBounds() == groundUpperBounds );
+        TS_ASSERT( reader.getLowerBounds() == groundLowerBounds );
+        TS_ASSERT( reader.matchesConstraints( constraintsList ) );
+
+        for ( unsigned i = 0; i < m; ++i )
+            for ( unsigned j = 0; j < n; ++j )
+                TS_ASSERT_EQUALS( reader.getInitialTableau()->get( i, j ), A[i * n + j] );
+
+        const UnsatCertificateNode *readRoot = reader.getRoot();
+        TS_ASSERT( readRoot->getVisited() );
+        TS_ASSERT( !readRoot->getSATSolutionFlag() );
+        TS_ASSERT( !readRoot->getContradiction() );
+        TS_ASSERT_EQUALS( readRoot->getChildren().size(), 2U );
+
+        TS_ASSERT_EQUALS( readRoot->getPLCLemmas().size(), 1U );
+        const PLCLemma &readLemma = *readRoot->getPLCLemmas().front();
+        TS_ASSERT( readLemma.getCausingVars() == List<unsigned>( { 0 } ) );
+        TS_ASSERT_EQUALS( readLemma.getAffectedVar(), 2U );
+        TS_ASSERT_EQUALS( readLemma.getBound(), 0.25 );
+        TS_ASSERT_EQUALS( readLemma.getCausingVarBound(), Tightening::LB );
+        TS_ASSERT_EQUALS( readLemma.getAffectedVarBound(), Tightening::UB );
+        TS_ASSERT_EQUALS( readLemma.getConstraintType(), RELU );
+        TS_ASSERT_EQUALS( readLemma.getExplanations().size(), 1U );
+        TS_ASSERT_EQUALS( readLemma.getExplanations().front().getNnz(), 1U );
+        TS_ASSERT_EQUALS( readLemma.getExplanations().front().get( 1 ), 2 );
+
+        const UnsatCertificateNode *readChild1 = readRoot->getChildren().front();
+        TS_ASSERT( readChild1->getVisited() );
+        TS_ASSERT( readChild1->getSplit() == split1 );
+        TS_ASSERT_EQUALS( readChild1->getDelegationStatus(), DelegationStatus::DONT_DELEGATE );
+        TS_ASSERT( readChild1->getContradiction() );
+        TS_ASSERT_EQUALS( readChild1->getContradiction()->getContradiction().getNnz(), 2U );
+        TS_ASSERT_EQUALS( readChild1->getContradiction()->getContradiction().get( 0 ), 1 );
+        TS_ASSERT_EQUALS( readChild1->getContradiction()->getContradiction().get( 2 ), -0.5 );
+
+        const UnsatCertificateNode *readChild2 = readRoot->getChildren().back();
+        TS_ASSERT( !readChild2->getVisited() );
+        TS_ASSERT( readChild2->getSATSolutionFlag() );
+        TS_ASSERT( readChild2->getSplit() == split2 );
+        TS_ASSERT_EQUALS( readChild2->getDelegationStatus(), DelegationStatus::DELEGATE_DONT_SAVE );
+        TS_ASSERT( !readChild2->getContradiction() );
+
+        // A certificate for different constraints is detected
+        ReluConstraint relu3( 1, 4 );
+        TS_ASSERT( !reader.matchesConstraints( { &relu1, &relu3 } ) );
+        TS_ASSERT( !reader.matchesConstraints( { &relu1 } ) );
+
+        delete root;
+    }
+
+    void test_check_read_certificate()
+    {
+        unsigned m = 3, n = 6;
+        double A[] = { 1, 0, -1, 1, 0, 0, 0, -1, 2, 0, 1, 0, 0.5, 0, -1, 0, 0, 1 };
+        CSRMatrix initialTableau( A, m, n );
+
+        Vector<double> groundUpperBounds( n, 1 );
+        Vector<double> groundLowerBounds( n, 0 );
+
+        ReluConstraint relu1( 0, 2 );
+        ReluConstraint relu2( 1, 3 );
+        List<PiecewiseLinearConstraint *> constraintsList = { &relu1, &relu2 };
+
+        // One side of a split on x0 contradicts its ground bounds, the other one is delegated
+        auto *root = new UnsatCertificateNode( NULL, PiecewiseLinearCaseSplit() );
+        root->setVisited();
+
+        PiecewiseLinearCaseSplit split1;
+        split1.storeBoundTightening( Tightening( 0, -1, Tightening::UB ) );
+        PiecewiseLinearCaseSplit split2;
+        split2.storeBoundTightening( Tightening( 0, -1, Tightening::LB ) );
+
+        auto *child1 = new UnsatCertificateNode( root, split1 );
+        auto *child2 = new UnsatCertificateNode( root, split2 );
+        child1->setVisited();
+        child2->setVisited();
+        child1->setContradiction( new Contradiction( 0 ) );
+        child2->setDelegationStatus( DelegationStatus::DELEGATE_DONT_SAVE );
+
+        Checker checker(
+            root, m, &initialTableau, groundUpperBounds, groundLowerBounds, constraintsList );
+        TS_ASSERT( checker.check() );
+
+        writeCertificate(
+            root, m, &initialTableau, groundUpperBounds, groundLowerBounds, constraintsList );
+
+        BinaryCertificateReader reader( CERTIFICATE_TEST_FILE );
+        TS_ASSERT_THROWS_NOTHING( reader.read() );
+        TS_ASSERT( reader.matchesConstraints( constraintsList ) );
+
+        Checker readChecker( reader.getRoot(),
+                             reader.getExplanationSize(),
+                             reader.getInitialTableau(),
+                             reader.getUpperBounds(),
+                             reader.getLowerBounds(),
+                             constraintsList );
+        TS_ASSERT( readChecker.check() );
+
+        delete root;
+    }
+
+    void test_little_endian()
+    {
+        char bytes[8];
+        LittleEndian::storeUint32( 0x01020304, bytes );
+        TS_ASSERT_SAME_DATA( bytes, "\x04\x03\x02\x01", 4 );
+        TS_ASSERT_EQUALS( LittleEndian::loadUint32( bytes ), 0x01020304U );
+
+        LittleEndian::storeDouble( 1.0, bytes );
+        TS_ASSERT_SAME_DATA( bytes, "\x00\x00\x00\x00\x00\x00\xF0\x3F", 8 );
+        TS_ASSERT_EQUALS( LittleEndian::loadDouble( bytes ), 1.0 );
+
+        LittleEndian::storeDouble( -0.25, bytes );
+        TS_ASSERT_EQUALS( LittleEndian::loadDouble( bytes ), -0.25 );
+
+        // The header of a written certificate
+        unsigned m = 1, n = 2;
+        double A[] = { 1, -1 };
+        CSRMatrix initialTableau( A, m, n );
+        Vector<double> groundUpperBounds( n, 1 );
+        Vector<double> groundLowerBounds( n, 0 );
+        List<PiecewiseLinearConstraint *> constraintsList;
+
+        UnsatCertificateNode root( NULL, PiecewiseLinearCaseSplit() );
+        MockFile file;
+        BinaryCertificateWriter::writeProof( &root,
+                                             m,
+                                             &initialTableau,
+                                             groundUpperBounds,
+                                             groundLowerBounds,
+                                             constraintsList,
+                                             file );
+
+        const char *data = file.writtenLines.ascii();
+        TS_ASSERT( file.writtenLines.length() > 24 );
+        TS_ASSERT_SAME_DATA( data, "MARABOUC", 8 );
+        TS_ASSERT_SAME_DATA( data + 8, "\x01\x00\x00\x00", 4 );
+        TS_ASSERT_SAME_DATA( data + 12, "\x01\x00\x00\x00", 4 );
+        TS_ASSERT_SAME_DATA( data + 16, "\x02\x00\x00\x00", 4 );
+        TS_ASSERT_SAME_DATA( data + 20, "\x00\x00\x00\x00", 4 );
+    }
+
+    void test_invalid_file()
+    {
+        // A truncated certificate
+        writeFile( "MARABOUC" );
+
+        BinaryCertificateReader reader( CERTIFICATE_TEST_FILE );
+        TS_ASSERT_THROWS_EQUALS( reader.read(),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_BINARY_CERTIFICATE_FILE );
+
+        // Not a binary certificate at all
+        writeFile( "{ proof }" );
+
+        TS_ASSERT_THROWS_EQUALS( reader.read(),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_BINARY_CERTIFICATE_FILE );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -124,6 +124,45 @@ public:
         TS_ASSERT( be.isExplanationTrivial( 0, true ) );
     }
 
+    /*
+      Test that explanations are restored when the context is popped, and copied by assignment
+    */
+    void test_explanation_backtracking()
+    {
+        unsigned numberOfVariables = 2;
+        unsigned numberOfRows = 3;
+        BoundExplainer be( numberOfVariables, numberOfRows, *context );
+        Vector<double> first{ 1, 0, 2 };
+        Vector<double> second{ 0, -3, 0 };
+
+        BoundExplainer copy( numberOfVariables, numberOfRows, *context );
+        TS_ASSERT_THROWS_NOTHING( be.setExplanation( first, 0, true ) );
+
+        context->push();
+        TS_ASSERT_THROWS_NOTHING( be.setExplanation( second, 0, true ) );
+        TS_ASSERT_THROWS_NOTHING( be.setExplanation( first, 1, false ) );
+
+        SparseUnsortedList explanation = be.getExplanation( 0, true );
+        TS_ASSERT_EQUALS( explanation.getSize(), numberOfRows );
+        TS_ASSERT_EQUALS( explanation.getNnz(), 1U );
+        for ( unsigned i = 0; i < numberOfRows; ++i )
+            TS_ASSERT_EQUALS( explanation.get( i ), second[i] );
+
+        copy = be;
+
+        context->pop();
+        explanation = be.getExplanation( 0, true );
+        TS_ASSERT_EQUALS( explanation.getNnz(), 2U );
+        for ( unsigned i = 0; i < numberOfRows; ++i )
+            TS_ASSERT_EQUALS( explanation.get( i ), first[i] );
+        TS_ASSERT( be.isExplanationTrivial( 1, false ) );
+        TS_ASSERT( be.getExplanation( 1, false ).empty() );
+
+        // The copy was assigned after the push, so its explanations are restored as well
+        TS_ASSERT( copy.isExplanationTrivial( 0, true ) );
+        TS_ASSERT( copy.isExplanationTrivial( 1, false ) );
+    }
+
     /*
       Test main functionality of BoundExplainer i.e. updating explanations according to tableau rows
     */
@@ -14,6 +14,7 @@
 
 #include "CSRMatrix.h"
 #include "Checker.h"
+#include "Options.h"
 #include "cxxtest/TestSuite.h"
 
 class CheckerTestSuite : public CxxTest::TestSuite
@@ -83,4 +84,78 @@ public:
 
         delete root;
     }
+
+    /*
+      Split the node on whether var is above or below value
+    */
+    void addSingleVarChildren( UnsatCertificateNode *node, unsigned var, double value )
+    {
+        PiecewiseLinearCaseSplit lowerSplit;
+        lowerSplit.storeBoundTightening( Tightening( var, value, Tightening::UB ) );
+        PiecewiseLinearCaseSplit upperSplit;
+        upperSplit.storeBoundTightening( Tightening( var, value, Tightening::LB ) );
+
+        new UnsatCertificateNode( node, lowerSplit );
+        new UnsatCertificateNode( node, upperSplit );
+    }
+
+    void test_parallel_certification()
+    {
+        unsigned m = 3, n = 6;
+        double A[] = { 1, 0, -1, 1, 0, 0, 0, -1, 2, 0, 1, 0, 0.5, 0, -1, 0, 0, 1 };
+
+        auto initialTableau = CSRMatrix( A, m, n );
+
+        Vector<double> groundUpperBounds( n, 1 );
+        Vector<double> groundLowerBounds( n, 0 );
+
+        ReluConstraint relu1 = ReluConstraint( 0, 2 );
+        ReluConstraint relu2 = ReluConstraint( 1, 3 );
+        List<PiecewiseLinearConstraint *> constraintsList = { &relu1, &relu2 };
+
+        // A complete tree of depth 4, split on x0, x1, x2 and x3. With two threads, the subtrees
+        // rooted at depth 3 are checked on the threads.
+        auto *root = new UnsatCertificateNode( NULL, PiecewiseLinearCaseSplit() );
+        List<UnsatCertificateNode *> level = { root };
+        for ( unsigned var = 0; var < 4; ++var )
+        {
+            List<UnsatCertificateNode *> nextLevel;
+            for ( const auto &node : level )
+            {
+                node->setVisited();
+                addSingleVarChildren( node, var, 0.5 );
+                for ( const auto &child : node->getChildren() )
+                    nextLevel.append( child );
+            }
+            level = nextLevel;
+        }
+
+        TS_ASSERT_EQUALS( level.size(), 16U );
+        for ( const auto &leaf : level )
+        {
+            leaf->setVisited();
+            leaf->setDelegationStatus( DelegationStatus::DELEGATE_DONT_SAVE );
+        }
+
+        Options::get()->setInt( Options::NUM_PROOF_CHECKING_THREADS, 2 );
+
+        Checker checker(
+            root, m, &initialTableau, groundUpperBounds, groundLowerBounds, constraintsList );
+        TS_ASSERT( checker.check() );
+
+        // A visited leaf without a contradiction fails certification, wherever it is
+        level.back()->setDelegationStatus( DelegationStatus::DONT_DELEGATE );
+        TS_ASSERT( !checker.check() );
+
+        level.back()->setDelegationStatus( DelegationStatus::DELEGATE_DONT_SAVE );
+        level.front()->setDelegationStatus( DelegationStatus::DONT_DELEGATE );
+        TS_ASSERT( !checker.check() );
+
+        level.front()->setDelegationStatus( DelegationStatus::DELEGATE_DONT_SAVE );
+        TS_ASSERT( checker.check() );
+
+        Options::get()->setInt( Options::NUM_PROOF_CHECKING_THREADS, 1 );
+
+        delete root;
+    }
 };
@@ -0,0 +1,177 @@
+/*********************                                                        */
+/*! \file BinaryQueryFormat.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __BinaryQueryFormat_h__
+#define __BinaryQueryFormat_h__
+
+#include "LittleEndian.h"
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+/*
+  The layout of a query saved in binary form. The file starts with the
+  magic string and the fields of Header in order, followed by the
+  sections that the header points to, which are arrays of fixed-width
+  values that are read in place once the file is mapped into memory:
+
+    lower bounds          double[numberOfVariables] (-inf if unbounded)
+    upper bounds          double[numberOfVariables] (+inf if unbounded)
+    input variables       uint32[2 * numberOfInputVariables]  (index, variable)
+    output variables      uint32[2 * numberOfOutputVariables] (index, variable)
+    equation scalars      double[numberOfEquations]
+    equation types        uint32[numberOfEquations]
+    equation starts       uint32[numberOfEquations + 1]
+    addend variables      uint32[numberOfAddends]
+    addend coefficients   double[numberOfAddends]
+    constraints           numberOfConstraints records
+
+  The equations are stored in CSR form: the addends of equation i are
+  the entries [start[i], start[i+1]) of the addend arrays. Every
+  constraint record is a uint32 length, followed by the serialization
+  of the constraint (which starts with its type), padded to 4 bytes.
+  Sections of doubles are aligned to 8 bytes. All values are stored in
+  little-endian byte order (see LittleEndian), so that a file can be
+  shared between machines, e.g. through the network cache.
+*/
+class BinaryQueryFormat
+{
+public:
+    enum {
+        VERSION = 1,
+        MAGIC_LENGTH = 8,
+        HEADER_SIZE = MAGIC_LENGTH + 8 * sizeof( uint32_t ) + 11 * sizeof( uint64_t ),
+    };
+
+    struct Header
+    {
+        uint32_t _version;
+        uint32_t _numberOfVariables;
+        uint32_t _numberOfInputVariables;
+        uint32_t _numberOfOutputVariables;
+        uint32_t _numberOfEquations;
+        uint32_t _numberOfAddends;
+        uint32_t _numberOfConstraints;
+        uint32_t _reserved;
+        uint64_t _lowerBoundsOffset;
+        uint64_t _upperBoundsOffset;
+        uint64_t _inputVariablesOffset;
+        uint64_t _outputVariablesOffset;
+        uint64_t _equationScalarsOffset;
+        uint64_t _equationTypesOffset;
+        uint64_t _equationStartsOffset;
+        uint64_t _addendVariablesOffset;
+        uint64_t _addendCoefficientsOffset;
+        uint64_t _constraintsOffset;
+        uint64_t _fileSize;
+    };
+
+    static const char *magic()
+    {
+        return "MARABOUQ";
+    }
+
+    static bool hasMagic( const char *data, uint64_t size )
+    {
+        return size >= MAGIC_LENGTH && memcmp( data, magic(), MAGIC_LENGTH ) == 0;
+    }
+
+    /*
+      Convert the magic string and the header to and from the
+      HEADER_SIZE bytes at the start of the file
+    */
+    static void storeHeader( const Header &header, char *bytes )
+    {
+        memcpy( bytes, magic(), MAGIC_LENGTH );
+        bytes += MAGIC_LENGTH;
+
+        for ( uint32_t value : { header._version,
+                                 header._numberOfVariables,
+                                 header._numberOfInputVariables,
+                                 header._numberOfOutputVariables,
+                                 header._numberOfEquations,
+                                 header._numberOfAddends,
+                                 header._numberOfConstraints,
+                                 header._reserved } )
+        {
+            LittleEndian::storeUint32( value, bytes );
+            bytes += sizeof( uint32_t );
+        }
+
+        for ( uint64_t value : { header._lowerBoundsOffset,
+                                 header._upperBoundsOffset,
+                                 header._inputVariablesOffset,
+                                 header._outputVariablesOffset,
+                                 header._equationScalarsOffset,
+                                 header._equationTypesOffset,
+                                 header._equationStartsOffset,
+                                 header._addendVariablesOffset,
+                                 header._addendCoefficientsOffset,
+                                 header._constraintsOffset,
+                                 header._fileSize } )
+        {
+            LittleEndian::storeUint64( value, bytes );
+            bytes += sizeof( uint64_t );
+        }
+    }
+
+    static void loadHeader( const char *bytes, Header &header )
+    {
+        bytes += MAGIC_LENGTH;
+
+        for ( uint32_t *field : { &header._version,
+                                  &header._numberOfVariables,
+                                  &header._numberOfInputVariables,
+                                  &header._numberOfOutputVariables,
+                                  &header._numberOfEquations,
+                                  &header._numberOfAddends,
+                                  &header._numberOfConstraints,
+                                  &header._reserved } )
+        {
+            *field = LittleEndian::loadUint32( bytes );
+            bytes += sizeof( uint32_t );
+        }
+
+        for ( uint64_t *field : { &header._lowerBoundsOffset,
+                                  &header._upperBoundsOffset,
+                                  &header._inputVariablesOffset,
+                                  &header._outputVariablesOffset,
+                                  &header._equationScalarsOffset,
+                                  &header._equationTypesOffset,
+                                  &header._equationStartsOffset,
+                                  &header._addendVariablesOffset,
+                                  &header._addendCoefficientsOffset,
+                                  &header._constraintsOffset,
+                                  &header._fileSize } )
+        {
+            *field = LittleEndian::loadUint64( bytes );
+            bytes += sizeof( uint64_t );
+        }
+    }
+
+    static uint64_t align( uint64_t offset, uint64_t alignment )
+    {
+        return ( offset + alignment - 1 ) / alignment * alignment;
+    }
+};
+
+#endif // __BinaryQueryFormat_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,119 @@
+/*********************                                                        */
+/*! \file NetworkCache.cpp
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "NetworkCache.h"
+
+#include "BinaryQueryFormat.h"
+#include "CommonError.h"
+#include "File.h"
+#include "MStringf.h"
+#include "MemoryMappedFile.h"
+#include "QueryLoader.h"
+
+#include <cstdio>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+NetworkCache::NetworkCache( const String &cacheDirectory, const String &networkFilePath )
+    : _cacheDirectory( cacheDirectory )
+    , _networkFilePath( networkFilePath )
+{
+}
+
+bool NetworkCache::lookup( IQuery &inputQuery )
+{
+    if ( !enabled() || !File::exists( getEntryPath() ) )
+        return false;
+
+    QueryLoader::loadQuery( getEntryPath(), inputQuery );
+    return true;
+}
+
+void NetworkCache::store( const IQuery &inputQuery )
+{
+    if ( !enabled() )
+        return;
+
+    // Write to a private file first and then move it into place, so
+    // that concurrent runs never observe a partially written entry
+    String temporaryPath =
+        Stringf( "%s.%u.tmp", getEntryPath().ascii(), (unsigned)getpid() );
+
+    try
+    {
+        inputQuery.saveQueryAsBinary( temporaryPath );
+    }
+    catch ( const CommonError & )
+    {
+        printf( "Warning: could not write network cache entry %s\n", temporaryPath.ascii() );
+        std::remove( temporaryPath.ascii() );
+        return;
+    }
+
+    if ( std::rename( temporaryPath.ascii(), getEntryPath().ascii() ) != 0 )
+    {
+        printf( "Warning: could not write network cache entry %s\n", getEntryPath().ascii() );
+        std::remove( temporaryPath.ascii() );
+    }
+}
+
+const String &NetworkCache::getEntryPath()
+{
+    if ( _entryPath.length() == 0 )
+    {
+        // The format version is part of the name, so that entries
+        // written by older versions are ignored rather than rejected
+        _entryPath = Stringf( "%s/%016llx.v%u.mbq",
+                              _cacheDirectory.ascii(),
+                              hashFile( _networkFilePath ),
+                              (unsigned)BinaryQueryFormat::VERSION );
+    }
+
+    return _entryPath;
+}
+
+unsigned long long NetworkCache::hashFile( const String &path )
+{
+    MemoryMappedFile file( path );
+    file.open();
+
+    const unsigned char *data = (const unsigned char *)file.data();
+    unsigned long long size = file.size();
+
+    unsigned long long hash = 14695981039346656037ULL;
+    for ( unsigned long long i = 0; i < size; ++i )
+    {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+bool NetworkCache::enabled() const
+{
+    return _cacheDirectory.length() > 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
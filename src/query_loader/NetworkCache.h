@@ -0,0 +1,74 @@
+/*********************                                                        */
+/*! \file NetworkCache.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __NetworkCache_h__
+#define __NetworkCache_h__
+
+#include "IQuery.h"
+#include "MString.h"
+
+/*
+  An on-disk cache of parsed networks. When the same network is
+  verified against many properties, parsing it (e.g., protobuf
+  decoding, shape inference and equation generation for ONNX models)
+  dominates the cost of preparing each query. Instead, the query
+  produced for the network, before any property is applied, is stored
+  in binary form in the cache directory, and is memory-mapped on later
+  runs.
+
+  Entries are keyed by a hash of the contents of the network file, so
+  a modified network is never matched with a stale entry. An empty
+  cache directory disables the cache.
+*/
+class NetworkCache
+{
+public:
+    NetworkCache( const String &cacheDirectory, const String &networkFilePath );
+
+    /*
+      Load the query of the network from the cache, if it is there.
+      Returns true on a cache hit.
+    */
+    bool lookup( IQuery &inputQuery );
+
+    /*
+      Store the query of the network, before any property has been
+      added to it. Failing to write the entry is not an error: the
+      network will simply be parsed again next time.
+    */
+    void store( const IQuery &inputQuery );
+
+    const String &getEntryPath();
+
+    /*
+      A 64-bit FNV-1a hash of the contents of a file
+    */
+    static unsigned long long hashFile( const String &path );
+
+private:
+    String _cacheDirectory;
+    String _networkFilePath;
+    String _entryPath;
+
+    bool enabled() const;
+};
+
+#endif // __NetworkCache_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -18,12 +18,15 @@
 
 #include "AutoFile.h"
 #include "BilinearConstraint.h"
+#include "BinaryQueryFormat.h"
 #include "Debug.h"
 #include "DisjunctionConstraint.h"
 #include "Equation.h"
+#include "FloatUtils.h"
 #include "GlobalConfiguration.h"
 #include "IQuery.h"
 #include "LeakyReluConstraint.h"
+#include "LittleEndian.h"
 #include "MStringf.h"
 #include "MarabouError.h"
 #include "MaxConstraint.h"
@@ -32,6 +35,8 @@
 #include "SignConstraint.h"
 #include "SoftmaxConstraint.h"
 
+#include <fstream>
+
 void QueryLoader::loadQuery( const String &fileName, IQuery &inputQuery )
 {
     if ( !IFile::exists( fileName ) )
@@ -40,6 +45,16 @@ void QueryLoader::loadQuery( const String &fileName, IQuery &inputQuery )
                             Stringf( "File %s not found.\n", fileName.ascii() ).ascii() );
     }
 
+    // Binary queries are used in place, without parsing
+    if ( isBinaryQuery( fileName ) )
+    {
+        QL_LOG( "Loading query in binary form" );
+        MemoryMappedFile file( fileName );
+        file.open();
+        loadBinaryQuery( file, inputQuery );
+        return;
+    }
+
     AutoFile input( fileName );
     input->open( IFile::MODE_READ );
 
@@ -197,7 +212,6 @@ void QueryLoader::loadQuery( const String &fileName, IQuery &inputQuery )
 
         // Skip constraint number
         ++it;
-        String coType = *it;
         String serializeConstraint;
         // include type in serializeConstraint as well
         while ( it != tokens.end() )
@@ -207,63 +221,201 @@ void QueryLoader::loadQuery( const String &fileName, IQuery &inputQuery )
         }
         serializeConstraint = serializeConstraint.substring( 0, serializeConstraint.length() - 1 );
 
-        QL_LOG( Stringf( "Non-Linear Constraint: %u, Type: %s \n", i, coType.ascii() ).ascii() );
-        QL_LOG( Stringf( "\tserialized:\t%s \n", serializeConstraint.ascii() ).ascii() );
-        if ( coType == "relu" )
-        {
-            inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "leaky_relu" )
-        {
-            inputQuery.addPiecewiseLinearConstraint(
-                new LeakyReluConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "max" )
-        {
-            inputQuery.addPiecewiseLinearConstraint( new MaxConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "absoluteValue" )
-        {
-            inputQuery.addPiecewiseLinearConstraint(
-                new AbsoluteValueConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "sign" )
-        {
-            inputQuery.addPiecewiseLinearConstraint( new SignConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "disj" )
-        {
-            inputQuery.addPiecewiseLinearConstraint(
-                new DisjunctionConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "sigmoid" )
-        {
-            inputQuery.addNonlinearConstraint( new SigmoidConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "softmax" )
-        {
-            SoftmaxConstraint *softmax = new SoftmaxConstraint( serializeConstraint );
-            inputQuery.addNonlinearConstraint( softmax );
-            Equation eq;
-            for ( const auto &output : softmax->getOutputs() )
-                eq.addAddend( 1, output );
-            eq.setScalar( 1 );
-            inputQuery.addEquation( eq );
-        }
-        else if ( coType == "bilinear" )
-        {
-            BilinearConstraint *bilinear = new BilinearConstraint( serializeConstraint );
-            inputQuery.addNonlinearConstraint( bilinear );
-        }
-        else if ( coType == "round" )
-        {
-            inputQuery.addNonlinearConstraint( new RoundConstraint( serializeConstraint ) );
-        }
-        else
-        {
-            throw MarabouError(
-                MarabouError::UNSUPPORTED_NON_LINEAR_CONSTRAINT,
-                Stringf( "Unsupported non-linear constraint: %s\n", coType.ascii() ).ascii() );
-        }
+        QL_LOG( Stringf( "Non-Linear Constraint: %u\n", i ).ascii() );
+        addConstraint( serializeConstraint, inputQuery );
+    }
+}
+
+bool QueryLoader::isBinaryQuery( const String &fileName )
+{
+    char magic[BinaryQueryFormat::MAGIC_LENGTH];
+    std::ifstream input( fileName.ascii(), std::ios::binary );
+    if ( !input.read( magic, sizeof( magic ) ) )
+        return false;
+
+    return BinaryQueryFormat::hasMagic( magic, sizeof( magic ) );
+}
+
+void QueryLoader::loadBinaryQuery( const MemoryMappedFile &file, IQuery &inputQuery )
+{
+    const char *data = file.data();
+    uint64_t fileSize = file.size();
+
+    if ( fileSize < BinaryQueryFormat::HEADER_SIZE )
+        throw MarabouError( MarabouError::INVALID_BINARY_QUERY_FILE, "Truncated header" );
+
+    BinaryQueryFormat::Header header;
+    BinaryQueryFormat::loadHeader( data, header );
+
+    if ( header._version != BinaryQueryFormat::VERSION )
+        throw MarabouError(
+            MarabouError::INVALID_BINARY_QUERY_FILE,
+            Stringf( "Unsupported binary query version: %u", header._version ).ascii() );
+
+    if ( header._fileSize != fileSize )
+        throw MarabouError( MarabouError::INVALID_BINARY_QUERY_FILE, "Unexpected file size" );
+
+    // Make sure that every section lies within the file
+    auto checkSection = [&]( uint64_t offset, uint64_t count, uint64_t entrySize ) {
+        if ( offset > fileSize || count > ( fileSize - offset ) / entrySize )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY_FILE, "Truncated section" );
+    };
+
+    unsigned numVars = header._numberOfVariables;
+    unsigned numEquations = header._numberOfEquations;
+    unsigned numAddends = header._numberOfAddends;
+
+    checkSection( header._lowerBoundsOffset, numVars, sizeof( double ) );
+    checkSection( header._upperBoundsOffset, numVars, sizeof( double ) );
+    checkSection( header._inputVariablesOffset,
+                  2 * (uint64_t)header._numberOfInputVariables,
+                  sizeof( uint32_t ) );
+    checkSection( header._outputVariablesOffset,
+                  2 * (uint64_t)header._numberOfOutputVariables,
+                  sizeof( uint32_t ) );
+    checkSection( header._equationScalarsOffset, numEquations, sizeof( double ) );
+    checkSection( header._equationTypesOffset, numEquations, sizeof( uint32_t ) );
+    checkSection( header._equationStartsOffset, (uint64_t)numEquations + 1, sizeof( uint32_t ) );
+    checkSection( header._addendVariablesOffset, numAddends, sizeof( uint32_t ) );
+    checkSection( header._addendCoefficientsOffset, numAddends, sizeof( double ) );
+    checkSection( header._constraintsOffset, 0, 1 );
+
+    QL_LOG( Stringf( "Number of variables: %u\n", numVars ).ascii() );
+    QL_LOG( Stringf( "Number of equations: %u\n", numEquations ).ascii() );
+    QL_LOG( Stringf( "Number of non-linear constraints: %u\n", header._numberOfConstraints )
+                .ascii() );
+
+    inputQuery.setNumberOfVariables( numVars );
+
+    // The entries of the sections, which are stored in little-endian
+    // byte order
+    auto uint32At = [&]( uint64_t sectionOffset, uint64_t i ) {
+        return LittleEndian::loadUint32( data + sectionOffset + i * sizeof( uint32_t ) );
+    };
+    auto doubleAt = [&]( uint64_t sectionOffset, uint64_t i ) {
+        return LittleEndian::loadDouble( data + sectionOffset + i * sizeof( double ) );
+    };
+
+    // Input and output variables
+    for ( unsigned i = 0; i < header._numberOfInputVariables; ++i )
+        inputQuery.markInputVariable( uint32At( header._inputVariablesOffset, 2 * i + 1 ),
+                                      uint32At( header._inputVariablesOffset, 2 * i ) );
+
+    for ( unsigned i = 0; i < header._numberOfOutputVariables; ++i )
+        inputQuery.markOutputVariable( uint32At( header._outputVariablesOffset, 2 * i + 1 ),
+                                       uint32At( header._outputVariablesOffset, 2 * i ) );
+
+    // Bounds
+    for ( unsigned i = 0; i < numVars; ++i )
+    {
+        double lb = doubleAt( header._lowerBoundsOffset, i );
+        double ub = doubleAt( header._upperBoundsOffset, i );
+        if ( FloatUtils::isFinite( lb ) )
+            inputQuery.setLowerBound( i, lb );
+        if ( FloatUtils::isFinite( ub ) )
+            inputQuery.setUpperBound( i, ub );
+    }
+
+    // Equations
+    for ( unsigned i = 0; i < numEquations; ++i )
+    {
+        uint32_t type = uint32At( header._equationTypesOffset, i );
+        if ( type > Equation::LE )
+            throw MarabouError( MarabouError::INVALID_EQUATION_TYPE,
+                                Stringf( "Invalid Equation Type\n" ).ascii() );
+
+        uint32_t start = uint32At( header._equationStartsOffset, i );
+        uint32_t end = uint32At( header._equationStartsOffset, i + 1 );
+        if ( start > end || end > numAddends )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY_FILE,
+                                "Invalid equation addends" );
+
+        Equation equation( (Equation::EquationType)type );
+        equation.setScalar( doubleAt( header._equationScalarsOffset, i ) );
+        for ( unsigned j = start; j < end; ++j )
+            equation.addAddend( doubleAt( header._addendCoefficientsOffset, j ),
+                                uint32At( header._addendVariablesOffset, j ) );
+
+        inputQuery.addEquation( equation );
+    }
+
+    // Constraints
+    uint64_t offset = header._constraintsOffset;
+    for ( unsigned i = 0; i < header._numberOfConstraints; ++i )
+    {
+        checkSection( offset, 1, sizeof( uint32_t ) );
+        uint32_t length = LittleEndian::loadUint32( data + offset );
+        offset += sizeof( length );
+
+        checkSection( offset, length, 1 );
+        String serializedConstraint( data + offset, length );
+        offset += BinaryQueryFormat::align( length, sizeof( uint32_t ) );
+
+        QL_LOG( Stringf( "Non-Linear Constraint: %u\n", i ).ascii() );
+        addConstraint( serializedConstraint, inputQuery );
+    }
+}
+
+void QueryLoader::addConstraint( const String &serializeConstraint, IQuery &inputQuery )
+{
+    String coType = serializeConstraint.substring( 0, serializeConstraint.find( "," ) );
+
+    QL_LOG( Stringf( "\tType: %s \n", coType.ascii() ).ascii() );
+    QL_LOG( Stringf( "\tserialized:\t%s \n", serializeConstraint.ascii() ).ascii() );
+    if ( coType == "relu" )
+    {
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "leaky_relu" )
+    {
+        inputQuery.addPiecewiseLinearConstraint(
+            new LeakyReluConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "max" )
+    {
+        inputQuery.addPiecewiseLinearConstraint( new MaxConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "absoluteValue" )
+    {
+        inputQuery.addPiecewiseLinearConstraint(
+            new AbsoluteValueConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "sign" )
+    {
+        inputQuery.addPiecewiseLinearConstraint( new SignConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "disj" )
+    {
+        inputQuery.addPiecewiseLinearConstraint(
+            new DisjunctionConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "sigmoid" )
+    {
+        inputQuery.addNonlinearConstraint( new SigmoidConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "softmax" )
+    {
+        SoftmaxConstraint *softmax = new SoftmaxConstraint( serializeConstraint );
+        inputQuery.addNonlinearConstraint( softmax );
+        Equation eq;
+        for ( const auto &output : softmax->getOutputs() )
+            eq.addAddend( 1, output );
+        eq.setScalar( 1 );
+        inputQuery.addEquation( eq );
+    }
+    else if ( coType == "bilinear" )
+    {
+        BilinearConstraint *bilinear = new BilinearConstraint( serializeConstraint );
+        inputQuery.addNonlinearConstraint( bilinear );
+    }
+    else if ( coType == "round" )
+    {
+        inputQuery.addNonlinearConstraint( new RoundConstraint( serializeConstraint ) );
+    }
+    else
+    {
+        throw MarabouError(
+            MarabouError::UNSUPPORTED_NON_LINEAR_CONSTRAINT,
+            Stringf( "Unsupported non-linear constraint: %s\n", coType.ascii() ).ascii() );
     }
 }
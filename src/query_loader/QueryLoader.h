@@ -18,6 +18,7 @@
 #define __QueryLoader_h__
 
 #include "IQuery.h"
+#include "MemoryMappedFile.h"
 
 #define QL_LOG( x, ... ) LOG( GlobalConfiguration::QUERY_LOADER_LOGGING, "QueryLoader: %s\n", x )
 
@@ -29,9 +30,25 @@ public:
     unsigned _numConstraunsigneds;
 
     /*
-      Parse a serialized query and return it in Query form
+      Parse a serialized query and return it in Query form. Queries
+      saved in binary form (see BinaryQueryFormat) are detected
+      automatically.
     */
     static void loadQuery( const String &fileName, IQuery &inputQuery );
+
+private:
+    static bool isBinaryQuery( const String &fileName );
+
+    /*
+      Read a query in binary form directly from the mapped file
+    */
+    static void loadBinaryQuery( const MemoryMappedFile &file, IQuery &inputQuery );
+
+    /*
+      Construct a constraint from its serialization, and add it to the
+      query
+    */
+    static void addConstraint( const String &serializedConstraint, IQuery &inputQuery );
 };
 
 #endif // __QueryLoader_h__
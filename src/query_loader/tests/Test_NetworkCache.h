@@ -0,0 +1,153 @@
+/*********************                                                        */
+/*! \file Test_NetworkCache.h
+ ** \verbatim
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "Equation.h"
+#include "File.h"
+#include "NetworkCache.h"
+#include "Query.h"
+#include "ReluConstraint.h"
+#include "T/FileFactory.h"
+#include "T/unistd.h"
+
+#include <cstdio>
+#include <cxxtest/TestSuite.h>
+#include <fstream>
+#include <sys/stat.h>
+
+const String NETWORK_TEST_FILE( "NetworkCacheTest.nnet" );
+
+class MockForNetworkCache
+    : public T::Base_createFile
+    , public T::Base_discardFile
+    , public T::Base_stat
+{
+public:
+    // Cache entries are real files
+    IFile *createFile( const String &path )
+    {
+        return new File( path );
+    }
+
+    void discardFile( IFile *file )
+    {
+        delete file;
+    }
+
+    int stat( const char *path, StructStat *buf )
+    {
+        return ::stat( path, buf );
+    }
+};
+
+class NetworkCacheTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForNetworkCache *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForNetworkCache );
+    }
+
+    void tearDown()
+    {
+        std::remove( NETWORK_TEST_FILE.ascii() );
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void writeNetworkFile( const char *contents )
+    {
+        std::ofstream network( NETWORK_TEST_FILE.ascii(), std::ios::trunc );
+        network << contents;
+    }
+
+    void test_hash_depends_on_contents()
+    {
+        writeNetworkFile( "network a" );
+        unsigned long long hash = NetworkCache::hashFile( NETWORK_TEST_FILE );
+        TS_ASSERT_EQUALS( NetworkCache::hashFile( NETWORK_TEST_FILE ), hash );
+
+        writeNetworkFile( "network b" );
+        TS_ASSERT_DIFFERS( NetworkCache::hashFile( NETWORK_TEST_FILE ), hash );
+    }
+
+    void test_disabled_cache()
+    {
+        writeNetworkFile( "network a" );
+
+        NetworkCache cache( "", NETWORK_TEST_FILE );
+        Query query;
+        query.setNumberOfVariables( 2 );
+
+        TS_ASSERT_THROWS_NOTHING( cache.store( query ) );
+
+        Query query2;
+        TS_ASSERT( !cache.lookup( query2 ) );
+    }
+
+    void test_store_and_lookup()
+    {
+        writeNetworkFile( "network a" );
+
+        Query query;
+        query.setNumberOfVariables( 3 );
+        query.markInputVariable( 0, 0 );
+        query.markOutputVariable( 2, 0 );
+        query.setLowerBound( 0, -1 );
+        query.setUpperBound( 0, 1 );
+
+        Equation equation;
+        equation.addAddend( 2, 0 );
+        equation.addAddend( -1, 1 );
+        equation.setScalar( 0 );
+        query.addEquation( equation );
+        query.addPiecewiseLinearConstraint( new ReluConstraint( 1, 2 ) );
+
+        NetworkCache cache( ".", NETWORK_TEST_FILE );
+
+        Query query2;
+        TS_ASSERT( !cache.lookup( query2 ) );
+        TS_ASSERT_THROWS_NOTHING( cache.store( query ) );
+
+        // A new cache object finds the entry of the same network
+        NetworkCache cache2( ".", NETWORK_TEST_FILE );
+        TS_ASSERT_EQUALS( cache2.getEntryPath(), cache.getEntryPath() );
+        TS_ASSERT( cache2.lookup( query2 ) );
+
+        TS_ASSERT_EQUALS( query2.getNumberOfVariables(), 3U );
+        TS_ASSERT( query2.getInputVariables() == query.getInputVariables() );
+        TS_ASSERT( query2.getOutputVariables() == query.getOutputVariables() );
+        TS_ASSERT( query2.getLowerBounds() == query.getLowerBounds() );
+        TS_ASSERT( query2.getUpperBounds() == query.getUpperBounds() );
+        TS_ASSERT( query2.getEquations() == query.getEquations() );
+        TS_ASSERT_EQUALS( query2.getPiecewiseLinearConstraints().size(), 1U );
+
+        // Once the network changes, the entry no longer matches
+        writeNetworkFile( "network b" );
+        NetworkCache cache3( ".", NETWORK_TEST_FILE );
+        TS_ASSERT_DIFFERS( cache3.getEntryPath(), cache.getEntryPath() );
+
+        Query query3;
+        TS_ASSERT( !cache3.lookup( query3 ) );
+
+        std::remove( cache.getEntryPath().ascii() );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
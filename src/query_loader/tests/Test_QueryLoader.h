@@ -14,6 +14,7 @@
 **/
 
 #include "AutoFile.h"
+#include "BinaryQueryFormat.h"
 #include "Equation.h"
 #include "MockFileFactory.h"
 #include "Query.h"
@@ -21,9 +22,12 @@
 #include "ReluConstraint.h"
 #include "T/unistd.h"
 
+#include <cstdio>
 #include <cxxtest/TestSuite.h>
+#include <fstream>
 
 const String QUERY_TEST_FILE( "QueryTest.txt" );
+const String BINARY_QUERY_TEST_FILE( "QueryTest.bin" );
 
 class MockForQueryLoader
     : public MockFileFactory
@@ -52,10 +56,9 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete mock );
     }
 
-    void test_load_query()
+    void populateQuery( Query &inputQuery )
     {
         // Set up simple query as a test
-        Query inputQuery;
         inputQuery.setNumberOfVariables( 10 );
 
         // Input layer with one variable
@@ -121,16 +124,10 @@ public:
         equation4.addAddend( 1.0, 8 );  // Weighted equation input
         equation4.setScalar( 0.5 );     // Equation bias
         inputQuery.addEquation( equation4 );
+    }
 
-        // Save the query and then reload the query
-        inputQuery.saveQuery( QUERY_TEST_FILE );
-
-        mock->mockFile.wasCreated = false;
-        mock->mockFile.wasDiscarded = false;
-
-        Query inputQuery2;
-        QueryLoader::loadQuery( QUERY_TEST_FILE, inputQuery2 );
-
+    void checkQueriesEqual( Query &inputQuery, Query &inputQuery2 )
+    {
         // Check that inputQuery is unchanged when saving and loading the query
         // Number of variables unchanged
         TS_ASSERT( inputQuery.getNumberOfVariables() == inputQuery2.getNumberOfVariables() );
@@ -179,6 +176,58 @@ public:
         nlConstraint2 = (SigmoidConstraint *)*tsIt2;
         TS_ASSERT( nlConstraint->serializeToString() == nlConstraint2->serializeToString() );
     }
+
+    void test_load_query()
+    {
+        Query inputQuery;
+        populateQuery( inputQuery );
+
+        // Save the query and then reload the query
+        inputQuery.saveQuery( QUERY_TEST_FILE );
+
+        mock->mockFile.wasCreated = false;
+        mock->mockFile.wasDiscarded = false;
+
+        Query inputQuery2;
+        QueryLoader::loadQuery( QUERY_TEST_FILE, inputQuery2 );
+
+        checkQueriesEqual( inputQuery, inputQuery2 );
+    }
+
+    void test_load_binary_query()
+    {
+        Query inputQuery;
+        populateQuery( inputQuery );
+
+        // Binary queries are written through a file, and memory-mapped
+        // when loaded
+        inputQuery.saveQueryAsBinary( BINARY_QUERY_TEST_FILE );
+
+        String bytes = mock->mockFile.writtenLines;
+        TS_ASSERT_EQUALS( mock->mockFile.lastPath, BINARY_QUERY_TEST_FILE );
+        TS_ASSERT( BinaryQueryFormat::hasMagic( bytes.ascii(), bytes.length() ) );
+
+        // The version follows the magic string, in little-endian byte order
+        TS_ASSERT_EQUALS( String( bytes.ascii() + BinaryQueryFormat::MAGIC_LENGTH, 4 ),
+                          String( "\x01\x00\x00\x00", 4 ) );
+
+        std::ofstream binaryFile( BINARY_QUERY_TEST_FILE.ascii(), std::ios::binary );
+        binaryFile.write( bytes.ascii(), bytes.length() );
+        binaryFile.close();
+
+        mock->mockFile.wasCreated = false;
+        mock->mockFile.wasDiscarded = false;
+
+        Query inputQuery2;
+        TS_ASSERT_THROWS_NOTHING( QueryLoader::loadQuery( BINARY_QUERY_TEST_FILE, inputQuery2 ) );
+
+        // The text loader was not used
+        TS_ASSERT( !mock->mockFile.wasCreated );
+
+        checkQueriesEqual( inputQuery, inputQuery2 );
+
+        std::remove( BINARY_QUERY_TEST_FILE.ascii() );
+    }
 };
 
 //